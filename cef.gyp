@@ -413,6 +413,8 @@
         'tests/unittests/task_unittest.cc',
         'tests/unittests/test_handler.cc',
         'tests/unittests/test_handler.h',
+        'tests/unittests/test_server.cc',
+        'tests/unittests/test_server.h',
         'tests/unittests/test_suite.cc',
         'tests/unittests/test_suite.h',
         'tests/unittests/test_util.cc',
@@ -541,11 +543,15 @@
         }],
         [ 'OS=="linux" or OS=="freebsd" or OS=="openbsd"', {
           'dependencies': [
+            'gtk',
             'libcef',
           ],
           'sources': [
             'tests/cefclient/browser/resource_util_linux.cc',
             'tests/cefclient/browser/resource_util_posix.cc',
+            'tests/unittests/message_pump_unittest.cc',
+            'tests/unittests/test_message_pump.h',
+            'tests/unittests/test_message_pump_linux.cc',
           ],
           'copies': [
             {
@@ -958,6 +964,8 @@
         'libcef/browser/browser_host_impl.h',
         'libcef/browser/browser_info.cc',
         'libcef/browser/browser_info.h',
+        'libcef/browser/browser_info_index.cc',
+        'libcef/browser/browser_info_index.h',
         'libcef/browser/browser_main.cc',
         'libcef/browser/browser_main.h',
         'libcef/browser/browser_message_filter.cc',
@@ -1151,10 +1159,13 @@
         'libcef/common/http_header_utils.cc',
         'libcef/common/http_header_utils.h',
         'libcef/common/json_impl.cc',
+        'libcef/common/json_stream_impl.cc',
         'libcef/common/main_delegate.cc',
         'libcef/common/main_delegate.h',
         'libcef/common/net_resource_provider.cc',
         'libcef/common/net_resource_provider.h',
+        'libcef/common/ordered_string_map.cc',
+        'libcef/common/ordered_string_map.h',
         'libcef/common/parser_impl.cc',
         'libcef/common/process_message_impl.cc',
         'libcef/common/process_message_impl.h',
@@ -1170,6 +1181,10 @@
         'libcef/common/scheme_registrar_impl.h',
         'libcef/common/scheme_registration.cc',
         'libcef/common/scheme_registration.h',
+        'libcef/common/shared_binary_value.cc',
+        'libcef/common/shared_binary_value.h',
+        'libcef/common/string_chunker.cc',
+        'libcef/common/string_chunker.h',
         'libcef/common/string_list_impl.cc',
         'libcef/common/string_map_impl.cc',
         'libcef/common/string_multimap_impl.cc',
@@ -1773,6 +1788,8 @@
             'tests/unittests/urlrequest_unittest.cc',
             'tests/unittests/test_handler.cc',
             'tests/unittests/test_handler.h',
+            'tests/unittests/test_server.cc',
+            'tests/unittests/test_server.h',
             'tests/unittests/test_suite.cc',
             'tests/unittests/test_suite.h',
             'tests/unittests/test_util.cc',
@@ -128,12 +128,21 @@
 // TRACE_EVENT_COPY_XXX overloads of the macros at additional runtime
 // overhead.
 // Notes: The category must always be in a long-lived char* (i.e. static const).
+//        The enabled state of the category is cached per call site so a
+//        given call site must always use the same category.
 //        The |arg_values|, when used, are always deep copied with the _COPY
 //        macros.
 //
 //
 // Thread Safety:
 // All macros are thread safe and can be used from any process.
+//
+//
+// Performance note:
+// When a category is disabled the macros only test a flag that is cached on
+// the client side, so instrumentation can be left in performance-sensitive
+// code. The exported cef_trace_* functions are called only while the
+// category is enabled.
 ///
 
 #ifndef CEF_INCLUDE_BASE_CEF_TRACE_EVENT_H_
@@ -153,6 +162,7 @@
 // If the Chromium implementation diverges the below implementation should be
 // updated to match.
 
+#include "include/base/cef_atomicops.h"
 #include "include/internal/cef_trace_event_internal.h"
 
 // Records a pair of begin and end events called "name" for the current
@@ -161,16 +171,14 @@
 // - category and name strings must have application lifetime (statics or
 //   literals). They may not include " chars.
 #define TRACE_EVENT0(category, name) \
-  cef_trace_event_begin(category, name, NULL, 0, NULL, 0, false); \
-  CEF_INTERNAL_TRACE_END_ON_SCOPE_CLOSE(category, name)
+  CEF_INTERNAL_TRACE_EVENT_ADD_SCOPED(category, name, NULL, 0, NULL, 0)
 #define TRACE_EVENT1(category, name, arg1_name, arg1_val) \
-  cef_trace_event_begin(category, name, arg1_name, arg1_val, NULL, 0, false); \
-  CEF_INTERNAL_TRACE_END_ON_SCOPE_CLOSE(category, name)
+  CEF_INTERNAL_TRACE_EVENT_ADD_SCOPED(category, name, arg1_name, arg1_val, \
+      NULL, 0)
 #define TRACE_EVENT2(category, name, arg1_name, arg1_val, arg2_name, \
       arg2_val) \
-  cef_trace_event_begin(category, name, arg1_name, arg1_val, \
-                                        arg2_name, arg2_val, false); \
-  CEF_INTERNAL_TRACE_END_ON_SCOPE_CLOSE(category, name)
+  CEF_INTERNAL_TRACE_EVENT_ADD_SCOPED(category, name, arg1_name, arg1_val, \
+      arg2_name, arg2_val)
 
 // Implementation detail: trace event macros create temporary variable names.
 // These macros give each temporary variable a unique name based on the line
@@ -182,10 +190,37 @@
 #define CEF_INTERNAL_TRACE_EVENT_UID(name_prefix) \
   CEF_INTERNAL_TRACE_EVENT_UID2(name_prefix, __LINE__)
 
-// Implementation detail: internal macro to end end event when the scope ends.
-#define CEF_INTERNAL_TRACE_END_ON_SCOPE_CLOSE(category, name) \
-   cef_trace_event::CefTraceEndOnScopeClose \
-       CEF_INTERNAL_TRACE_EVENT_UID(profileScope)(category, name)
+// Implementation detail: look up the enabled flag for |category| once per call
+// site. The flag itself is owned and updated by the library so checking it
+// afterwards is a single load without crossing the DLL boundary. As a result
+// the category passed to a given call site must not change between calls.
+#define CEF_INTERNAL_TRACE_EVENT_GET_CATEGORY_INFO(category) \
+  static base::subtle::AtomicWord CEF_INTERNAL_TRACE_EVENT_UID(atomic) = 0; \
+  const unsigned char* CEF_INTERNAL_TRACE_EVENT_UID(category_enabled) = \
+      cef_trace_event::GetCategoryEnabled( \
+          &CEF_INTERNAL_TRACE_EVENT_UID(atomic), category)
+
+// Implementation detail: internal macro to call the exported trace function
+// |func| only if |category| is enabled.
+#define CEF_INTERNAL_TRACE_EVENT_ADD(func, category, ...) \
+  do { \
+    CEF_INTERNAL_TRACE_EVENT_GET_CATEGORY_INFO(category); \
+    if (*CEF_INTERNAL_TRACE_EVENT_UID(category_enabled)) \
+      func(category, __VA_ARGS__); \
+  } while (0)
+
+// Implementation detail: internal macro to add a begin event if |category| is
+// enabled and the matching end event when the scope ends.
+#define CEF_INTERNAL_TRACE_EVENT_ADD_SCOPED(category, name, arg1_name, \
+      arg1_val, arg2_name, arg2_val) \
+  CEF_INTERNAL_TRACE_EVENT_GET_CATEGORY_INFO(category); \
+  cef_trace_event::CefTraceEndOnScopeClose \
+      CEF_INTERNAL_TRACE_EVENT_UID(profileScope); \
+  if (*CEF_INTERNAL_TRACE_EVENT_UID(category_enabled)) { \
+    cef_trace_event_begin(category, name, arg1_name, arg1_val, arg2_name, \
+                          arg2_val, false); \
+    CEF_INTERNAL_TRACE_EVENT_UID(profileScope).Initialize(category, name); \
+  }
 
 // Records a single event called "name" immediately, with 0, 1 or 2
 // associated arguments. If the category is not enabled, then this
@@ -193,21 +228,25 @@
 // - category and name strings must have application lifetime (statics or
 //   literals). They may not include " chars.
 #define TRACE_EVENT_INSTANT0(category, name) \
-  cef_trace_event_instant(category, name, NULL, 0, NULL, 0, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_instant, category, name, NULL, \
+      0, NULL, 0, false)
 #define TRACE_EVENT_INSTANT1(category, name, arg1_name, arg1_val) \
-  cef_trace_event_instant(category, name, arg1_name, arg1_val, NULL, 0, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_instant, category, name, \
+      arg1_name, arg1_val, NULL, 0, false)
 #define TRACE_EVENT_INSTANT2(category, name, arg1_name, arg1_val, \
       arg2_name, arg2_val) \
-  cef_trace_event_instant(category, name, arg1_name, arg1_val, arg2_name, \
-      arg2_val, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_instant, category, name, \
+      arg1_name, arg1_val, arg2_name, arg2_val, false)
 #define TRACE_EVENT_COPY_INSTANT0(category, name) \
-  cef_trace_event_instant(category, name, NULL, 0, NULL, 0, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_instant, category, name, NULL, \
+      0, NULL, 0, true)
 #define TRACE_EVENT_COPY_INSTANT1(category, name, arg1_name, arg1_val) \
-  cef_trace_event_instant(category, name, arg1_name, arg1_val, NULL, 0, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_instant, category, name, \
+      arg1_name, arg1_val, NULL, 0, true)
 #define TRACE_EVENT_COPY_INSTANT2(category, name, arg1_name, arg1_val, \
       arg2_name, arg2_val) \
-  cef_trace_event_instant(category, name, arg1_name, arg1_val, arg2_name, \
-      arg2_val, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_instant, category, name, \
+      arg1_name, arg1_val, arg2_name, arg2_val, true)
 
 // Records a single BEGIN event called "name" immediately, with 0, 1 or 2
 // associated arguments. If the category is not enabled, then this
@@ -215,51 +254,61 @@
 // - category and name strings must have application lifetime (statics or
 //   literals). They may not include " chars.
 #define TRACE_EVENT_BEGIN0(category, name) \
-  cef_trace_event_begin(category, name, NULL, 0, NULL, 0, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_begin, category, name, NULL, 0, \
+      NULL, 0, false)
 #define TRACE_EVENT_BEGIN1(category, name, arg1_name, arg1_val) \
-  cef_trace_event_begin(category, name, arg1_name, arg1_val, NULL, 0, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_begin, category, name, \
+      arg1_name, arg1_val, NULL, 0, false)
 #define TRACE_EVENT_BEGIN2(category, name, arg1_name, arg1_val, \
       arg2_name, arg2_val) \
-  cef_trace_event_begin(category, name, arg1_name, arg1_val, arg2_name, \
-      arg2_val, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_begin, category, name, \
+      arg1_name, arg1_val, arg2_name, arg2_val, false)
 #define TRACE_EVENT_COPY_BEGIN0(category, name) \
-  cef_trace_event_begin(category, name, NULL, 0, NULL, 0, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_begin, category, name, NULL, 0, \
+      NULL, 0, true)
 #define TRACE_EVENT_COPY_BEGIN1(category, name, arg1_name, arg1_val) \
-  cef_trace_event_begin(category, name, arg1_name, arg1_val, NULL, 0, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_begin, category, name, \
+      arg1_name, arg1_val, NULL, 0, true)
 #define TRACE_EVENT_COPY_BEGIN2(category, name, arg1_name, arg1_val, \
       arg2_name, arg2_val) \
-  cef_trace_event_begin(category, name, arg1_name, arg1_val, arg2_name, \
-      arg2_val, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_begin, category, name, \
+      arg1_name, arg1_val, arg2_name, arg2_val, true)
 
 // Records a single END event for "name" immediately. If the category
 // is not enabled, then this does nothing.
 // - category and name strings must have application lifetime (statics or
 //   literals). They may not include " chars.
 #define TRACE_EVENT_END0(category, name) \
-  cef_trace_event_end(category, name, NULL, 0, NULL, 0, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_end, category, name, NULL, 0, \
+      NULL, 0, false)
 #define TRACE_EVENT_END1(category, name, arg1_name, arg1_val) \
-  cef_trace_event_end(category, name, arg1_name, arg1_val, NULL, 0, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_end, category, name, arg1_name, \
+      arg1_val, NULL, 0, false)
 #define TRACE_EVENT_END2(category, name, arg1_name, arg1_val, \
       arg2_name, arg2_val) \
-  cef_trace_event_end(category, name, arg1_name, arg1_val, arg2_name, \
-      arg2_val, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_end, category, name, arg1_name, \
+      arg1_val, arg2_name, arg2_val, false)
 #define TRACE_EVENT_COPY_END0(category, name) \
-  cef_trace_event_end(category, name, NULL, 0, NULL, 0, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_end, category, name, NULL, 0, \
+      NULL, 0, true)
 #define TRACE_EVENT_COPY_END1(category, name, arg1_name, arg1_val) \
-  cef_trace_event_end(category, name, arg1_name, arg1_val, NULL, 0, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_end, category, name, arg1_name, \
+      arg1_val, NULL, 0, true)
 #define TRACE_EVENT_COPY_END2(category, name, arg1_name, arg1_val, \
       arg2_name, arg2_val) \
-  cef_trace_event_end(category, name, arg1_name, arg1_val, arg2_name, \
-      arg2_val, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_end, category, name, arg1_name, \
+      arg1_val, arg2_name, arg2_val, true)
 
 // Records the value of a counter called "name" immediately. Value
 // must be representable as a 32 bit integer.
 // - category and name strings must have application lifetime (statics or
 //   literals). They may not include " chars.
 #define TRACE_COUNTER1(category, name, value) \
-  cef_trace_counter(category, name, NULL, value, NULL, 0, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_counter, category, name, NULL, value, \
+      NULL, 0, false)
 #define TRACE_COPY_COUNTER1(category, name, value) \
-  cef_trace_counter(category, name, NULL, value, NULL, 0, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_counter, category, name, NULL, value, \
+      NULL, 0, true)
 
 // Records the values of a multi-parted counter called "name" immediately.
 // The UI will treat value1 and value2 as parts of a whole, displaying their
@@ -268,12 +317,12 @@
 //   literals). They may not include " chars.
 #define TRACE_COUNTER2(category, name, value1_name, value1_val, \
       value2_name, value2_val) \
-  cef_trace_counter(category, name, value1_name, value1_val, value2_name, \
-      value2_val, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_counter, category, name, value1_name, \
+      value1_val, value2_name, value2_val, false)
 #define TRACE_COPY_COUNTER2(category, name, value1_name, value1_val, \
       value2_name, value2_val) \
-  cef_trace_counter(category, name, value1_name, value1_val, value2_name, \
-      value2_val, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_counter, category, name, value1_name, \
+      value1_val, value2_name, value2_val, true)
 
 // Records the value of a counter called "name" immediately. Value
 // must be representable as a 32 bit integer.
@@ -284,9 +333,11 @@
 //   bits will be xored with a hash of the process ID so that the same pointer
 //   on two different processes will not collide.
 #define TRACE_COUNTER_ID1(category, name, id, value) \
-  cef_trace_counter_id(category, name, id, NULL, value, NULL, 0, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_counter_id, category, name, id, NULL, \
+      value, NULL, 0, false)
 #define TRACE_COPY_COUNTER_ID1(category, name, id, value) \
-  cef_trace_counter_id(category, name, id, NULL, value, NULL, 0, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_counter_id, category, name, id, NULL, \
+      value, NULL, 0, true)
 
 // Records the values of a multi-parted counter called "name" immediately.
 // The UI will treat value1 and value2 as parts of a whole, displaying their
@@ -299,12 +350,12 @@
 //   on two different processes will not collide.
 #define TRACE_COUNTER_ID2(category, name, id, value1_name, value1_val, \
       value2_name, value2_val) \
-  cef_trace_counter_id(category, name, id, value1_name, value1_val, \
-      value2_name, value2_val, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_counter_id, category, name, id, \
+      value1_name, value1_val, value2_name, value2_val, false)
 #define TRACE_COPY_COUNTER_ID2(category, name, id, value1_name, \
       value1_val, value2_name, value2_val) \
-  cef_trace_counter_id(category, name, id, value1_name, value1_val, \
-      value2_name, value2_val, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_counter_id, category, name, id, \
+      value1_name, value1_val, value2_name, value2_val, true)
 
 
 // Records a single ASYNC_BEGIN event called "name" immediately, with 0, 1 or 2
@@ -324,24 +375,26 @@
 // operation must use the same |name| and |id|. Each event can have its own
 // args.
 #define TRACE_EVENT_ASYNC_BEGIN0(category, name, id) \
-  cef_trace_event_async_begin(category, name, id, NULL, 0, NULL, 0, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_begin, category, name, \
+      id, NULL, 0, NULL, 0, false)
 #define TRACE_EVENT_ASYNC_BEGIN1(category, name, id, arg1_name, arg1_val) \
-  cef_trace_event_async_begin(category, name, id, arg1_name, arg1_val, NULL, \
-      0, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_begin, category, name, \
+      id, arg1_name, arg1_val, NULL, 0, false)
 #define TRACE_EVENT_ASYNC_BEGIN2(category, name, id, arg1_name, arg1_val, \
       arg2_name, arg2_val) \
-  cef_trace_event_async_begin(category, name, id, arg1_name, arg1_val, \
-      arg2_name, arg2_val, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_begin, category, name, \
+      id, arg1_name, arg1_val, arg2_name, arg2_val, false)
 #define TRACE_EVENT_COPY_ASYNC_BEGIN0(category, name, id) \
-  cef_trace_event_async_begin(category, name, id, NULL, 0, NULL, 0, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_begin, category, name, \
+      id, NULL, 0, NULL, 0, true)
 #define TRACE_EVENT_COPY_ASYNC_BEGIN1(category, name, id, arg1_name, \
       arg1_val) \
-  cef_trace_event_async_begin(category, name, id, arg1_name, arg1_val, NULL, \
-      0, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_begin, category, name, \
+      id, arg1_name, arg1_val, NULL, 0, true)
 #define TRACE_EVENT_COPY_ASYNC_BEGIN2(category, name, id, arg1_name, \
       arg1_val, arg2_name, arg2_val) \
-  cef_trace_event_async_begin(category, name, id, arg1_name, arg1_val, \
-      arg2_name, arg2_val, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_begin, category, name, \
+      id, arg1_name, arg1_val, arg2_name, arg2_val, true)
 
 // Records a single ASYNC_STEP_INTO event for |step| immediately. If the
 // category is not enabled, then this does nothing. The |name| and |id| must
@@ -350,17 +403,19 @@
 // phase of an asynchronous operation. The ASYNC_BEGIN event must not have any
 // ASYNC_STEP_PAST events.
 #define TRACE_EVENT_ASYNC_STEP_INTO0(category, name, id, step) \
-  cef_trace_event_async_step_into(category, name, id, step, NULL, 0, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_step_into, category, \
+      name, id, step, NULL, 0, false)
 #define TRACE_EVENT_ASYNC_STEP_INTO1(category, name, id, step, \
       arg1_name, arg1_val) \
-  cef_trace_event_async_step_into(category, name, id, step, arg1_name, \
-      arg1_val, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_step_into, category, \
+      name, id, step, arg1_name, arg1_val, false)
 #define TRACE_EVENT_COPY_ASYNC_STEP_INTO0(category, name, id, step) \
-  cef_trace_event_async_step_into(category, name, id, step, NULL, 0, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_step_into, category, \
+      name, id, step, NULL, 0, true)
 #define TRACE_EVENT_COPY_ASYNC_STEP_INTO1(category, name, id, step, \
       arg1_name, arg1_val) \
-  cef_trace_event_async_step_into(category, name, id, step, arg1_name, \
-      arg1_val, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_step_into, category, \
+      name, id, step, arg1_name, arg1_val, true)
 
 // Records a single ASYNC_STEP_PAST event for |step| immediately. If the
 // category is not enabled, then this does nothing. The |name| and |id| must
@@ -369,50 +424,76 @@
 // phase of an asynchronous operation. The ASYNC_BEGIN event must not have any
 // ASYNC_STEP_INTO events.
 #define TRACE_EVENT_ASYNC_STEP_PAST0(category, name, id, step) \
-  cef_trace_event_async_step_past(category, name, id, step, NULL, 0, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_step_past, category, \
+      name, id, step, NULL, 0, false)
 #define TRACE_EVENT_ASYNC_STEP_PAST1(category, name, id, step, \
       arg1_name, arg1_val) \
-  cef_trace_event_async_step_past(category, name, id, step, arg1_name, \
-      arg1_val, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_step_past, category, \
+      name, id, step, arg1_name, arg1_val, false)
 #define TRACE_EVENT_COPY_ASYNC_STEP_PAST0(category, name, id, step) \
-  cef_trace_event_async_step_past(category, name, id, step, NULL, 0, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_step_past, category, \
+      name, id, step, NULL, 0, true)
 #define TRACE_EVENT_COPY_ASYNC_STEP_PAST1(category, name, id, step, \
       arg1_name, arg1_val) \
-  cef_trace_event_async_step_past(category, name, id, step, arg1_name, \
-      arg1_val, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_step_past, category, \
+      name, id, step, arg1_name, arg1_val, true)
 
 // Records a single ASYNC_END event for "name" immediately. If the category
 // is not enabled, then this does nothing.
 #define TRACE_EVENT_ASYNC_END0(category, name, id) \
-  cef_trace_event_async_end(category, name, id, NULL, 0, NULL, 0, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_end, category, name, id, \
+      NULL, 0, NULL, 0, false)
 #define TRACE_EVENT_ASYNC_END1(category, name, id, arg1_name, arg1_val) \
-  cef_trace_event_async_end(category, name, id, arg1_name, arg1_val, NULL, 0, \
-      false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_end, category, name, id, \
+      arg1_name, arg1_val, NULL, 0, false)
 #define TRACE_EVENT_ASYNC_END2(category, name, id, arg1_name, arg1_val, \
       arg2_name, arg2_val) \
-  cef_trace_event_async_end(category, name, id, arg1_name, arg1_val, \
-      arg2_name, arg2_val, false)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_end, category, name, id, \
+      arg1_name, arg1_val, arg2_name, arg2_val, false)
 #define TRACE_EVENT_COPY_ASYNC_END0(category, name, id) \
-  cef_trace_event_async_end(category, name, id, NULL, 0, NULL, 0, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_end, category, name, id, \
+      NULL, 0, NULL, 0, true)
 #define TRACE_EVENT_COPY_ASYNC_END1(category, name, id, arg1_name, \
       arg1_val) \
-  cef_trace_event_async_end(category, name, id, arg1_name, arg1_val, NULL, 0, \
-      true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_end, category, name, id, \
+      arg1_name, arg1_val, NULL, 0, true)
 #define TRACE_EVENT_COPY_ASYNC_END2(category, name, id, arg1_name, \
       arg1_val, arg2_name, arg2_val) \
-  cef_trace_event_async_end(category, name, id, arg1_name, arg1_val, \
-      arg2_name, arg2_val, true)
+  CEF_INTERNAL_TRACE_EVENT_ADD(cef_trace_event_async_end, category, name, id, \
+      arg1_name, arg1_val, arg2_name, arg2_val, true)
 
 namespace cef_trace_event {
 
+// Used by the trace macros to cache the enabled flag for a call site. Do not
+// use directly.
+inline const unsigned char* GetCategoryEnabled(
+    base::subtle::AtomicWord* cache,
+    const char* category) {
+  const unsigned char* enabled = reinterpret_cast<const unsigned char*>(
+      base::subtle::NoBarrier_Load(cache));
+  if (!enabled) {
+    // Racing threads will store the same value so no locking is required.
+    enabled = cef_trace_event_get_category_enabled(category);
+    base::subtle::NoBarrier_Store(
+        cache, reinterpret_cast<base::subtle::AtomicWord>(enabled));
+  }
+  return enabled;
+}
+
 // Used by TRACE_EVENTx macro. Do not use directly.
 class CefTraceEndOnScopeClose {
  public:
-  CefTraceEndOnScopeClose(const char* category, const char* name)
-      : category_(category), name_(name) {
+  CefTraceEndOnScopeClose()
+      : category_(NULL), name_(NULL) {
   }
   ~CefTraceEndOnScopeClose() {
-    cef_trace_event_end(category_, name_, NULL, 0, NULL, 0, false);
+    if (category_)
+      cef_trace_event_end(category_, name_, NULL, 0, NULL, 0, false);
+  }
+
+  void Initialize(const char* category, const char* name) {
+    category_ = category;
+    name_ = name;
   }
 
  private:
@@ -149,6 +149,16 @@ CEF_EXPORT void cef_shutdown();
 // This function should only be called on the main application thread and only
 // if cef_initialize() is called with a CefSettings.multi_threaded_message_loop
 // value of false (0). This function will not block.
+//
+// Calling this function on a fixed interval either wastes CPU (interval too
+// short) or delays input and paint processing (interval too long). To avoid
+// guessing, set CefSettings.external_message_pump to true (1) and implement
+// cef_browser_process_handler_t::on_schedule_message_pump_work() to be told
+// when this function should next be called. On Linux the descriptor returned by
+// cef_get_message_pump_fd() can be polled instead. Each call will perform
+// pending work for a limited time slice and then return; if work remains a new
+// callback with a delay of 0 will be issued. cef_run_message_loop() should not
+// be used in that mode.
 ///
 CEF_EXPORT void cef_do_message_loop_work();
 
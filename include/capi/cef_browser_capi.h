@@ -174,6 +174,14 @@ typedef struct _cef_browser_t {
   void (CEF_CALLBACK *get_frame_names)(struct _cef_browser_t* self,
       cef_string_list_t names);
 
+  ///
+  // Returns all existing frames. This is more efficient than retrieving the
+  // identifiers or names and then retrieving each frame individually. Frames
+  // are returned in the same order as GetFrameIdentifiers.
+  ///
+  void (CEF_CALLBACK *get_frames)(struct _cef_browser_t* self,
+      size_t* framesCount, struct _cef_frame_t** frames);
+
   //
   // Send a message to the specified |target_process|. Returns true (1) if the
   // message was sent successfully.
@@ -557,6 +565,23 @@ typedef struct _cef_browser_host_t {
   void (CEF_CALLBACK *set_windowless_frame_rate)(
       struct _cef_browser_host_t* self, int frame_rate);
 
+  ///
+  // Generate a new frame if one is needed. Only used when window rendering is
+  // disabled and cef_browser_tSettings.windowless_frame_pacing is
+  // FRAME_PACING_EXTERNAL. Call this function from the client's vsync or
+  // display refresh signal.
+  ///
+  void (CEF_CALLBACK *send_external_begin_frame)(
+      struct _cef_browser_host_t* self);
+
+  ///
+  // Retrieve frame generation statistics for a windowless browser. Returns
+  // false (0) if window rendering is enabled or the browser view does not yet
+  // exist. This function can only be called on the UI thread.
+  ///
+  int (CEF_CALLBACK *get_windowless_frame_statistics)(
+      struct _cef_browser_host_t* self, struct _cef_frame_statistics_t* stats);
+
   ///
   // Get the NSTextInputContext implementation for enabling IME on Mac when
   // window rendering is disabled.
@@ -40,6 +40,7 @@
 
 #include "include/capi/cef_base_capi.h"
 #include "include/capi/cef_callback_capi.h"
+#include "include/capi/cef_values_capi.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -47,7 +48,9 @@ extern "C" {
 
 struct _cef_cookie_visitor_t;
 struct _cef_delete_cookies_callback_t;
+struct _cef_export_cookies_callback_t;
 struct _cef_set_cookie_callback_t;
+struct _cef_set_cookies_callback_t;
 
 ///
 // Structure used for managing cookies. The functions of this structure may be
@@ -87,6 +90,20 @@ typedef struct _cef_cookie_manager_t {
       const cef_string_t* url, int includeHttpOnly,
       struct _cef_cookie_visitor_t* visitor);
 
+  ///
+  // Visit a subset of cookies on the IO thread. If |domain| is non-NULL only
+  // cookies for that domain and its subdomains will be visited. If |name| is
+  // non-NULL only cookies with that name will be visited. If |expires_after|
+  // has a non-zero year value only persistent cookies that expire after that
+  // time will be visited. The filter is applied before cookies are converted so
+  // |total| will be the number of matching cookies. The returned cookies are
+  // ordered as with visit_all_cookies(). Returns false (0) if cookies cannot be
+  // accessed.
+  ///
+  int (CEF_CALLBACK *visit_filtered_cookies)(struct _cef_cookie_manager_t* self,
+      const cef_string_t* domain, const cef_string_t* name,
+      const cef_time_t* expires_after, struct _cef_cookie_visitor_t* visitor);
+
   ///
   // Sets a cookie given a valid URL and explicit user-provided cookie
   // attributes. This function expects each attribute to be well-formed. It will
@@ -100,6 +117,40 @@ typedef struct _cef_cookie_manager_t {
       const cef_string_t* url, const struct _cef_cookie_t* cookie,
       struct _cef_set_cookie_callback_t* callback);
 
+  ///
+  // Sets multiple cookies for a valid URL in a single operation. Each entry in
+  // |cookie_lines| is a "Set-Cookie" header value such as "name=value; path=/;
+  // secure". Invalid entries will be skipped. If |callback| is non-NULL it will
+  // be executed asnychronously on the IO thread after all cookies have been
+  // set. Returns false (0) if an invalid URL is specified or if cookies cannot
+  // be accessed.
+  ///
+  int (CEF_CALLBACK *set_cookies)(struct _cef_cookie_manager_t* self,
+      const cef_string_t* url, cef_string_list_t cookie_lines,
+      struct _cef_set_cookies_callback_t* callback);
+
+  ///
+  // Export all cookies as a single blob using the specified |format|. The
+  // cookies are serialized on the FILE thread and |callback| will be executed
+  // on the IO thread. Returns false (0) if cookies cannot be accessed.
+  ///
+  int (CEF_CALLBACK *export_cookies)(struct _cef_cookie_manager_t* self,
+      cef_cookie_format_t format,
+      struct _cef_export_cookies_callback_t* callback);
+
+  ///
+  // Import cookies from a blob created by export_cookies() using any format.
+  // Cookies will be set for a URL matching their domain, path and secure
+  // attribute and will replace existing cookies with the same name. Creation
+  // and last access times are not preserved. If |callback| is non-NULL it will
+  // be executed asnychronously on the IO thread after all cookies have been
+  // set. Returns false (0) if |data| cannot be parsed or if cookies cannot be
+  // accessed.
+  ///
+  int (CEF_CALLBACK *import_cookies)(struct _cef_cookie_manager_t* self,
+      struct _cef_binary_value_t* data,
+      struct _cef_set_cookies_callback_t* callback);
+
   ///
   // Delete all cookies that match the specified parameters. If both |url| and
   // |cookie_name| values are specified all host and domain cookies matching
@@ -206,6 +257,47 @@ typedef struct _cef_set_cookie_callback_t {
 } cef_set_cookie_callback_t;
 
 
+///
+// Structure to implement to be notified of asynchronous completion via
+// cef_cookie_manager_t::set_cookies() or
+// cef_cookie_manager_t::import_cookies().
+///
+typedef struct _cef_set_cookies_callback_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Method that will be called upon completion. |num_set| will be the number of
+  // cookies that were set successfully.
+  ///
+  void (CEF_CALLBACK *on_complete)(struct _cef_set_cookies_callback_t* self,
+      int num_set);
+} cef_set_cookies_callback_t;
+
+
+///
+// Structure to implement to receive the result of
+// cef_cookie_manager_t::export_cookies(). The functions of this structure will
+// be called on the IO thread.
+///
+typedef struct _cef_export_cookies_callback_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Method that will be called upon completion. |data| will contain the
+  // serialized cookies or will be NULL if serialization failed. |num_exported|
+  // will be the number of cookies contained in |data|.
+  ///
+  void (CEF_CALLBACK *on_complete)(struct _cef_export_cookies_callback_t* self,
+      struct _cef_binary_value_t* data, int num_exported);
+} cef_export_cookies_callback_t;
+
+
 ///
 // Structure to implement to be notified of asynchronous completion via
 // cef_cookie_manager_t::delete_cookies().
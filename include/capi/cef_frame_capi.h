@@ -124,6 +124,23 @@ typedef struct _cef_frame_t {
   void (CEF_CALLBACK *get_text)(struct _cef_frame_t* self,
       struct _cef_string_visitor_t* visitor);
 
+  ///
+  // Retrieve this frame's HTML source in chunks sent to the specified visitor.
+  // Unlike get_source() the complete value is never held in the browser process
+  // and other messages for the browser are not delayed while a large document
+  // is transferred. The request will fail if a cross-process navigation
+  // replaces the renderer before all chunks have been received.
+  ///
+  void (CEF_CALLBACK *get_source_chunked)(struct _cef_frame_t* self,
+      struct _cef_string_chunk_visitor_t* visitor);
+
+  ///
+  // Retrieve this frame's display text in chunks sent to the specified visitor.
+  // See get_source_chunked() for details.
+  ///
+  void (CEF_CALLBACK *get_text_chunked)(struct _cef_frame_t* self,
+      struct _cef_string_chunk_visitor_t* visitor);
+
   ///
   // Load the request represented by the |request| object.
   ///
@@ -39,12 +39,175 @@
 #pragma once
 
 #include "include/capi/cef_base_capi.h"
+#include "include/capi/cef_stream_capi.h"
+#include "include/capi/cef_values_capi.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 
+///
+// Structure that should be implemented by the client to receive events from
+// CefParseJSONStream. Events are delivered in document order on the thread that
+// called CefParseJSONStream. Return false (0) from any function to stop
+// parsing.
+///
+typedef struct _cef_jsonparser_handler_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Called at the start of a dictionary value.
+  ///
+  int (CEF_CALLBACK *on_begin_dictionary)(
+      struct _cef_jsonparser_handler_t* self);
+
+  ///
+  // Called at the end of a dictionary value.
+  ///
+  int (CEF_CALLBACK *on_end_dictionary)(struct _cef_jsonparser_handler_t* self);
+
+  ///
+  // Called at the start of a list value.
+  ///
+  int (CEF_CALLBACK *on_begin_list)(struct _cef_jsonparser_handler_t* self);
+
+  ///
+  // Called at the end of a list value.
+  ///
+  int (CEF_CALLBACK *on_end_list)(struct _cef_jsonparser_handler_t* self);
+
+  ///
+  // Called for each dictionary |key|. The next event will be for the associated
+  // value.
+  ///
+  int (CEF_CALLBACK *on_key)(struct _cef_jsonparser_handler_t* self,
+      const cef_string_t* key);
+
+  ///
+  // Called for a null value.
+  ///
+  int (CEF_CALLBACK *on_null)(struct _cef_jsonparser_handler_t* self);
+
+  ///
+  // Called for a bool value.
+  ///
+  int (CEF_CALLBACK *on_bool)(struct _cef_jsonparser_handler_t* self,
+      int value);
+
+  ///
+  // Called for an integer value. Numbers that have a fraction or exponent or
+  // that do not fit in an int are reported via OnDouble instead.
+  ///
+  int (CEF_CALLBACK *on_int)(struct _cef_jsonparser_handler_t* self, int value);
+
+  ///
+  // Called for a double value.
+  ///
+  int (CEF_CALLBACK *on_double)(struct _cef_jsonparser_handler_t* self,
+      double value);
+
+  ///
+  // Called for a string value.
+  ///
+  int (CEF_CALLBACK *on_string)(struct _cef_jsonparser_handler_t* self,
+      const cef_string_t* value);
+} cef_jsonparser_handler_t;
+
+
+///
+// Structure used to incrementally write JSON data to a stream. Output is
+// buffered and written to the stream in chunks. The output is identical to what
+// CefWriteJSON would produce for the equivalent value with the same |options|
+// (JSON_WRITER_OMIT_BINARY_VALUES is ignored). The functions of this structure
+// should only be called on the thread that created the object. Write functions
+// return false (0) if the value would result in invalid JSON (for example, a
+// value in a dictionary without a preceding key) or if the stream write fails.
+///
+typedef struct _cef_jsonwriter_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Begin a dictionary value.
+  ///
+  int (CEF_CALLBACK *begin_dictionary)(struct _cef_jsonwriter_t* self);
+
+  ///
+  // End the current dictionary value.
+  ///
+  int (CEF_CALLBACK *end_dictionary)(struct _cef_jsonwriter_t* self);
+
+  ///
+  // Begin a list value.
+  ///
+  int (CEF_CALLBACK *begin_list)(struct _cef_jsonwriter_t* self);
+
+  ///
+  // End the current list value.
+  ///
+  int (CEF_CALLBACK *end_list)(struct _cef_jsonwriter_t* self);
+
+  ///
+  // Write a dictionary |key|. Must be followed by exactly one value.
+  ///
+  int (CEF_CALLBACK *write_key)(struct _cef_jsonwriter_t* self,
+      const cef_string_t* key);
+
+  ///
+  // Write a null value.
+  ///
+  int (CEF_CALLBACK *write_null)(struct _cef_jsonwriter_t* self);
+
+  ///
+  // Write a bool value.
+  ///
+  int (CEF_CALLBACK *write_bool)(struct _cef_jsonwriter_t* self, int value);
+
+  ///
+  // Write an integer value.
+  ///
+  int (CEF_CALLBACK *write_int)(struct _cef_jsonwriter_t* self, int value);
+
+  ///
+  // Write a double value. Returns false (0) for NaN and infinite values, which
+  // cannot be represented in JSON.
+  ///
+  int (CEF_CALLBACK *write_double)(struct _cef_jsonwriter_t* self,
+      double value);
+
+  ///
+  // Write a string value.
+  ///
+  int (CEF_CALLBACK *write_string)(struct _cef_jsonwriter_t* self,
+      const cef_string_t* value);
+
+  ///
+  // Returns true (1) if a complete root value has been written.
+  ///
+  int (CEF_CALLBACK *is_complete)(struct _cef_jsonwriter_t* self);
+
+  ///
+  // Write any buffered output to the stream and flush it. Buffered output is
+  // also written when this object is destroyed. Returns false (0) if writing to
+  // the stream failed.
+  ///
+  int (CEF_CALLBACK *flush)(struct _cef_jsonwriter_t* self);
+} cef_jsonwriter_t;
+
+
+///
+// Create a new cef_jsonwriter_t object that writes to |stream|.
+///
+CEF_EXPORT cef_jsonwriter_t* cef_jsonwriter_create(
+    struct _cef_stream_writer_t* stream, cef_json_writer_options_t options);
+
+
 ///
 // Parse the specified |url| into its component parts. Returns false (0) if the
 // URL is NULL or invalid.
@@ -156,6 +319,21 @@ CEF_EXPORT struct _cef_value_t* cef_parse_jsonand_return_error(
 CEF_EXPORT cef_string_userfree_t cef_write_json(struct _cef_value_t* node,
     cef_json_writer_options_t options);
 
+///
+// Parses JSON data from |stream| and reports the contents to |handler| as they
+// are read, without building an intermediate value representation. The stream
+// is read in fixed-size chunks and each key, string or number is buffered in
+// full before it's reported, so memory usage grows with the largest single
+// token or value rather than with the size of the document. Returns true (1) if
+// the complete document was parsed. If parsing fails |error_code_out| and
+// |error_msg_out| will be populated with an error code and a formatted error
+// message respectively. If parsing is stopped by |handler| this function
+// returns false (0) and |error_code_out| is set to JSON_NO_ERROR.
+///
+CEF_EXPORT int cef_parse_jsonstream(struct _cef_stream_reader_t* stream,
+    cef_jsonparser_handler_t* handler, cef_json_parser_options_t options,
+    cef_json_parser_error_t* error_code_out, cef_string_t* error_msg_out);
+
 #ifdef __cplusplus
 }
 #endif
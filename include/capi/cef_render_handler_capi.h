@@ -113,7 +113,8 @@ typedef struct _cef_render_handler_t {
   // contains the pixel data for the whole image. |dirtyRects| contains the set
   // of rectangles in pixel coordinates that need to be repainted. |buffer| will
   // be |width|*|height|*4 bytes in size and represents a BGRA image with an
-  // upper-left origin.
+  // upper-left origin. See cef_browser_tSettings.windowless_partial_paint for
+  // additional |buffer| guarantees when partial paint delivery is enabled.
   ///
   void (CEF_CALLBACK *on_paint)(struct _cef_render_handler_t* self,
       struct _cef_browser_t* browser, cef_paint_element_type_t type,
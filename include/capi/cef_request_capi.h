@@ -39,6 +39,7 @@
 #pragma once
 
 #include "include/capi/cef_base_capi.h"
+#include "include/capi/cef_stream_capi.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -253,6 +254,26 @@ typedef struct _cef_post_data_element_t {
   void (CEF_CALLBACK *set_to_file)(struct _cef_post_data_element_t* self,
       const cef_string_t* fileName);
 
+  ///
+  // The post data element will represent |length| bytes of the file starting at
+  // |offset|. If |length| is -1 the remainder of the file will be used. The
+  // file contents will be read incrementally when the request is sent.
+  ///
+  void (CEF_CALLBACK *set_to_file_range)(struct _cef_post_data_element_t* self,
+      const cef_string_t* fileName, int64 offset, int64 length);
+
+  ///
+  // The post data element will represent |length| bytes read from |stream|
+  // starting at its current position. The contents will be read incrementally
+  // when the request is sent so that they are never fully buffered in memory.
+  // If the request needs to be resent |stream| will be seeked back to the
+  // starting position. Streams that report may_block() will be read on the
+  // browser process FILE thread. Only supported for requests sent from the
+  // browser process.
+  ///
+  void (CEF_CALLBACK *set_to_stream)(struct _cef_post_data_element_t* self,
+      struct _cef_stream_reader_t* stream, int64 length);
+
   ///
   // The post data element will represent bytes.  The bytes passed in will be
   // copied.
@@ -273,6 +294,32 @@ typedef struct _cef_post_data_element_t {
   cef_string_userfree_t (CEF_CALLBACK *get_file)(
       struct _cef_post_data_element_t* self);
 
+  ///
+  // Return the offset into the file at which the data starts.
+  ///
+  int64 (CEF_CALLBACK *get_file_offset)(struct _cef_post_data_element_t* self);
+
+  ///
+  // Return the number of bytes to read from the file or -1 if the remainder of
+  // the file will be used.
+  ///
+  int64 (CEF_CALLBACK *get_file_length)(struct _cef_post_data_element_t* self);
+
+  ///
+  // Return the stream. Returns NULL for the post data of requests passed to
+  // handler callbacks such as cef_resource_handler_t::process_request() because
+  // the stream is only read by the network stack. Use get_stream_length()
+  // instead.
+  ///
+  struct _cef_stream_reader_t* (CEF_CALLBACK *get_stream)(
+      struct _cef_post_data_element_t* self);
+
+  ///
+  // Return the number of bytes to read from the stream.
+  ///
+  int64 (CEF_CALLBACK *get_stream_length)(
+      struct _cef_post_data_element_t* self);
+
   ///
   // Return the number of bytes.
   ///
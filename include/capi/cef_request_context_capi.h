@@ -48,6 +48,51 @@ extern "C" {
 
 struct _cef_scheme_handler_factory_t;
 
+///
+// Structure to implement to be notified of asynchronous completion via
+// cef_request_tContext::get_cache_statistics().
+///
+typedef struct _cef_cache_statistics_callback_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Method that will be called upon completion. |hit_count| and |miss_count|
+  // are the number of completed HTTP and HTTPS requests that were and were not
+  // served from the HTTP cache. |cached_bytes| is the number of response body
+  // bytes served from the cache and |network_bytes| is the number of bytes
+  // received from the network. |entry_count| is the number of entries currently
+  // stored in the cache or -1 if the cache is unavailable.
+  ///
+  void (CEF_CALLBACK *on_complete)(
+      struct _cef_cache_statistics_callback_t* self, int64 hit_count,
+      int64 miss_count, int64 cached_bytes, int64 network_bytes,
+      int entry_count);
+} cef_cache_statistics_callback_t;
+
+
+///
+// Structure to implement to be notified of asynchronous completion via
+// cef_request_tContext::preload_cache_entry() or
+// cef_request_tContext::evict_cache_entry().
+///
+typedef struct _cef_cache_entry_callback_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Method that will be called upon completion. |success| will be true (1) if
+  // the cache entry was loaded or evicted successfully.
+  ///
+  void (CEF_CALLBACK *on_complete)(struct _cef_cache_entry_callback_t* self,
+      int success);
+} cef_cache_entry_callback_t;
+
+
 ///
 // A request context provides request handling for a set of related browser or
 // URL request objects. A request context can be specified when creating a new
@@ -199,6 +244,35 @@ typedef struct _cef_request_context_t {
   int (CEF_CALLBACK *set_preference)(struct _cef_request_context_t* self,
       const cef_string_t* name, struct _cef_value_t* value,
       cef_string_t* error);
+
+  ///
+  // Retrieve HTTP cache statistics for this context. Statistics are collected
+  // for all HTTP and HTTPS requests completed since the context's storage was
+  // initialized and are shared by all contexts that share the same storage.
+  // |callback| will be executed asnychronously on the IO thread.
+  ///
+  void (CEF_CALLBACK *get_cache_statistics)(struct _cef_request_context_t* self,
+      struct _cef_cache_statistics_callback_t* callback);
+
+  ///
+  // Load the resource at |url| into the HTTP cache without displaying it. The
+  // request will be sent with the cookies and network configuration of this
+  // context and the response body will be discarded once cached. If |callback|
+  // is non-NULL it will be executed asnychronously on the IO thread after the
+  // request completes. The request will be canceled without executing
+  // |callback| if the context's storage is destroyed first.
+  ///
+  void (CEF_CALLBACK *preload_cache_entry)(struct _cef_request_context_t* self,
+      const cef_string_t* url, struct _cef_cache_entry_callback_t* callback);
+
+  ///
+  // Remove the HTTP cache entry for |url| if one exists. Only entries for GET
+  // requests can be removed using this function. If |callback| is non-NULL it
+  // will be executed asnychronously on the IO thread after the entry has been
+  // removed.
+  ///
+  void (CEF_CALLBACK *evict_cache_entry)(struct _cef_request_context_t* self,
+      const cef_string_t* url, struct _cef_cache_entry_callback_t* callback);
 } cef_request_context_t;
 
 
@@ -50,6 +50,29 @@ extern "C" {
 #endif
 
 
+///
+// Structure representing a contiguous block of response data. The data must
+// remain valid and unchanged for the lifespan of this object. The functions of
+// this structure may be called on any thread.
+///
+typedef struct _cef_resource_data_block_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Returns a pointer to the data.
+  ///
+  void* (CEF_CALLBACK *get_data)(struct _cef_resource_data_block_t* self);
+
+  ///
+  // Returns the size of the data in bytes.
+  ///
+  size_t (CEF_CALLBACK *get_size)(struct _cef_resource_data_block_t* self);
+} cef_resource_data_block_t;
+
+
 ///
 // Structure used to implement a custom request handler structure. The functions
 // of this structure will always be called on the IO thread.
@@ -95,6 +118,19 @@ typedef struct _cef_resource_handler_t {
       void* data_out, int bytes_to_read, int* bytes_read,
       struct _cef_callback_t* callback);
 
+  ///
+  // Optionally provide response data as a sequence of data blocks instead of
+  // copying it via read_response(). This function will be called before the
+  // first call to read_response(). If it returns a non-NULL value the response
+  // data will be read directly from the returned block and this function will
+  // be called again each time the previous block has been consumed. Return NULL
+  // to indicate response completion. If the first call returns NULL then
+  // read_response() will be used instead. The response data will not be copied
+  // into any intermediate buffer.
+  ///
+  struct _cef_resource_data_block_t* (CEF_CALLBACK *get_response_data_block)(
+      struct _cef_resource_handler_t* self);
+
   ///
   // Return true (1) if the specified cookie can be sent with the request or
   // false (0) otherwise. If false (0) is returned for any cookie then no
@@ -62,6 +62,35 @@ typedef struct _cef_string_visitor_t {
 } cef_string_visitor_t;
 
 
+///
+// Implement this structure to receive a large string value asynchronously in a
+// sequence of chunks. The next chunk will not be delivered until the previous
+// call to visit_chunk() has returned.
+///
+typedef struct _cef_string_chunk_visitor_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Method that will be executed for each chunk in order. Chunks never split a
+  // character. Return true (1) to receive the next chunk or false (0) to
+  // cancel.
+  ///
+  int (CEF_CALLBACK *visit_chunk)(struct _cef_string_chunk_visitor_t* self,
+      const cef_string_t* chunk);
+
+  ///
+  // Method that will be executed once after the last chunk has been delivered.
+  // |success| will be false (0) if the value could not be retrieved in full
+  // because the request failed or was canceled.
+  ///
+  void (CEF_CALLBACK *on_complete)(struct _cef_string_chunk_visitor_t* self,
+      int success);
+} cef_string_chunk_visitor_t;
+
+
 #ifdef __cplusplus
 }
 #endif
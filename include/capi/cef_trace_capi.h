@@ -68,13 +68,43 @@ typedef struct _cef_end_tracing_callback_t {
 } cef_end_tracing_callback_t;
 
 
+///
+// Implement this structure to receive trace data in memory instead of via a
+// file. The functions of this structure will be called on the browser process
+// UI thread.
+///
+typedef struct _cef_trace_data_callback_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Called with the next chunk of trace data. Concatenating the chunks in the
+  // order received produces a JSON document in the same format as the tracing
+  // file. |data| is only valid for the duration of this call.
+  ///
+  void (CEF_CALLBACK *on_trace_data_chunk)(
+      struct _cef_trace_data_callback_t* self, const void* data,
+      size_t data_size);
+
+  ///
+  // Called after all processes have sent their trace data and the last chunk
+  // has been delivered.
+  ///
+  void (CEF_CALLBACK *on_trace_data_complete)(
+      struct _cef_trace_data_callback_t* self);
+} cef_trace_data_callback_t;
+
+
 ///
 // Start tracing events on all processes. Tracing is initialized asynchronously
 // and |callback| will be executed on the UI thread after initialization is
 // complete.
 //
-// If CefBeginTracing was called previously, or if a CefEndTracingAsync call is
-// pending, CefBeginTracing will fail and return false (0).
+// If CefBeginTracing was called previously, or if a CefEndTracing or
+// CefEndTracingToCallback call is pending, CefBeginTracing will fail and return
+// false (0).
 //
 // |categories| is a comma-delimited list of category wildcards. A category can
 // have an optional '-' prefix to make it an excluded category. Having both
@@ -104,6 +134,67 @@ CEF_EXPORT int cef_begin_tracing(const cef_string_t* categories,
 CEF_EXPORT int cef_end_tracing(const cef_string_t* tracing_file,
     cef_end_tracing_callback_t* callback);
 
+///
+// Stop tracing events on all processes and deliver the trace data in memory.
+//
+// This function will fail and return false (0) if a previous call to
+// CefEndTracing or CefEndTracingToCallback is already pending or if
+// CefBeginTracing was not called.
+//
+// |callback| will receive the trace data in chunks once all processes have sent
+// their trace data. No temporary file is created.
+//
+// This function must be called on the browser process UI thread.
+///
+CEF_EXPORT int cef_end_tracing_to_callback(cef_trace_data_callback_t* callback);
+
+///
+// Start recording events on all processes into a fixed-size ring buffer. This
+// "flight recorder" mode can run for the lifespan of the application because
+// the oldest events are discarded as new events are added. Use
+// CefCaptureTraceMonitoringSnapshot to retrieve the most recent events without
+// stopping. Monitoring is independent of CefBeginTracing. |callback| will be
+// executed on the UI thread after initialization is complete.
+//
+// The ring buffer size is fixed by Chromium and cannot be configured, and
+// events are not discarded based on their age. The time span covered by a
+// snapshot therefore depends on the rate at which events are recorded for the
+// enabled |categories|. Enable fewer categories to cover a longer span.
+//
+// If CefBeginTraceMonitoring was called previously without a matching call to
+// CefEndTraceMonitoring this function will fail and return false (0).
+//
+// |categories| has the same format as for CefBeginTracing.
+//
+// This function must be called on the browser process UI thread.
+///
+CEF_EXPORT int cef_begin_trace_monitoring(const cef_string_t* categories,
+    struct _cef_completion_callback_t* callback);
+
+///
+// Deliver the events currently held in the monitoring ring buffer of all
+// processes to |callback| without stopping monitoring.
+//
+// This function will fail and return false (0) if CefBeginTraceMonitoring was
+// not called or if a previous snapshot is still pending.
+//
+// This function must be called on the browser process UI thread.
+///
+CEF_EXPORT int cef_capture_trace_monitoring_snapshot(
+    cef_trace_data_callback_t* callback);
+
+///
+// Stop monitoring events on all processes and discard the ring buffer contents.
+// |callback| will be executed on the UI thread after monitoring has stopped.
+//
+// This function will fail and return false (0) if CefBeginTraceMonitoring was
+// not called.
+//
+// This function must be called on the browser process UI thread.
+///
+CEF_EXPORT int cef_end_trace_monitoring(
+    struct _cef_completion_callback_t* callback);
+
 ///
 // Returns the current system trace time or, if none is defined, the current
 // high-res time. Can be used by clients to synchronize with the time
@@ -43,6 +43,7 @@
 #include "include/capi/cef_request_capi.h"
 #include "include/capi/cef_request_context_capi.h"
 #include "include/capi/cef_response_capi.h"
+#include "include/capi/cef_stream_capi.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -106,16 +107,18 @@ typedef struct _cef_urlrequest_t {
 
 ///
 // Create a new URL request. Only GET, POST, HEAD, DELETE and PUT request
-// functions are supported. Multiple post data elements are not supported and
-// elements of type PDE_TYPE_FILE are only supported for requests originating
-// from the browser process. Requests originating from the render process will
-// receive the same handling as requests originating from Web content -- if the
-// response contains Content-Disposition or Mime-Type header values that would
-// not normally be rendered then the response may receive special handling
-// inside the browser (for example, via the file download code path instead of
-// the URL request code path). The |request| object will be marked as read-only
-// after calling this function. In the browser process if |request_context| is
-// NULL the global request context will be used. In the render process
+// functions are supported. Multiple post data elements and elements of type
+// PDE_TYPE_FILE or PDE_TYPE_STREAM are only supported for requests originating
+// from the browser process. In the browser process post data is read
+// incrementally while the request is sent so memory usage does not depend on
+// the upload size. Requests originating from the render process will receive
+// the same handling as requests originating from Web content -- if the response
+// contains Content-Disposition or Mime-Type header values that would not
+// normally be rendered then the response may receive special handling inside
+// the browser (for example, via the file download code path instead of the URL
+// request code path). The |request| object will be marked as read-only after
+// calling this function. In the browser process if |request_context| is NULL
+// the global request context will be used. In the render process
 // |request_context| must be NULL and the context associated with the current
 // renderer process' browser will be used.
 ///
@@ -165,12 +168,27 @@ typedef struct _cef_urlrequest_client_t {
   ///
   // Called when some part of the response is read. |data| contains the current
   // bytes received since the last call. This function will not be called if the
-  // UR_FLAG_NO_DOWNLOAD_DATA flag is set on the request.
+  // UR_FLAG_NO_DOWNLOAD_DATA flag is set on the request or if a writer was
+  // returned from GetDownloadStreamWriter.
   ///
   void (CEF_CALLBACK *on_download_data)(struct _cef_urlrequest_client_t* self,
       struct _cef_urlrequest_t* request, const void* data,
       size_t data_length);
 
+  ///
+  // Called once when the request is started to optionally provide a destination
+  // for the response body. Return a cef_stream_writer_t to have the response
+  // body written to it instead of being delivered via OnDownloadData. Writers
+  // that may block will be accessed on the FILE thread and all others on the IO
+  // thread. Use cef_stream_writer_t::CreateForFile to save the response body
+  // directly to disk. The writer will be flushed before OnRequestComplete is
+  // called. Return NULL for the default behavior. This function will only be
+  // called for requests initiated from the browser process.
+  ///
+  struct _cef_stream_writer_t* (CEF_CALLBACK *get_download_stream_writer)(
+      struct _cef_urlrequest_client_t* self,
+      struct _cef_urlrequest_t* request);
+
   ///
   // Called on the IO thread when the browser needs credentials from the user.
   // |isProxy| indicates whether the host is a proxy server. |host| contains the
@@ -42,6 +42,7 @@
 #include "include/capi/cef_browser_capi.h"
 #include "include/capi/cef_frame_capi.h"
 #include "include/capi/cef_task_capi.h"
+#include "include/capi/cef_values_capi.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -150,6 +151,77 @@ CEF_EXPORT cef_v8context_t* cef_v8context_get_entered_context();
 CEF_EXPORT int cef_v8context_in_context();
 
 
+///
+// Structure representing a compiled JavaScript script. A script is compiled
+// once and may then be run any number of times in any context that belongs to
+// the same thread. Compiling also produces V8 code cache data that can be
+// passed to cef_translator_test_object_child_child_create() in a later render
+// process so that the script is not parsed and compiled again. The code cache
+// data can be sent to the browser process for storage using
+// cef_process_message_t and sent to new render processes using the |extra_info|
+// argument of cef_render_process_handler_t::on_render_thread_created(). The
+// functions of this structure can only be called on the thread that created the
+// script.
+///
+typedef struct _cef_v8script_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Returns true (1) if the underlying handle is valid and it can be accessed
+  // on the current thread. Do not call any other functions if this function
+  // returns false (0).
+  ///
+  int (CEF_CALLBACK *is_valid)(struct _cef_v8script_t* self);
+
+  ///
+  // Runs this script using the global object of |context|. On success |retval|
+  // will be set to the return value, if any, and the function will return true
+  // (1). On failure |exception| will be set to the exception, if any, and the
+  // function will return false (0).
+  ///
+  int (CEF_CALLBACK *run)(struct _cef_v8script_t* self,
+      struct _cef_v8context_t* context, struct _cef_v8value_t** retval,
+      struct _cef_v8exception_t** exception);
+
+  ///
+  // Returns the V8 code cache data for this script or NULL if no data is
+  // available. If the |cached_data| passed to
+  // cef_translator_test_object_child_child_create() was accepted it will be
+  // returned unchanged.
+  ///
+  struct _cef_binary_value_t* (CEF_CALLBACK *get_cached_data)(
+      struct _cef_v8script_t* self);
+
+  ///
+  // Returns true (1) if the |cached_data| passed to
+  // cef_translator_test_object_child_child_create() was rejected and the script
+  // was compiled from source instead. Stored code cache data should be
+  // discarded in this case.
+  ///
+  int (CEF_CALLBACK *is_cached_data_rejected)(struct _cef_v8script_t* self);
+} cef_v8script_t;
+
+
+///
+// Compile the specified JavaScript |code|. |script_url| is the URL that will be
+// reported in stack traces and exceptions. If |cached_data| is non-NULL it
+// should be the result of get_cached_data() for the same |code| and will be
+// used to avoid compiling the script again. Cached data that does not match
+// |code| or the current V8 version will be ignored. On failure |exception| will
+// be set to the exception, if any, and NULL will be returned. This function
+// should only be called from within the scope of a
+// cef_render_process_handler_t, cef_v8handler_t or cef_v8accessor_t callback,
+// or in combination with calling enter() and exit() on a stored cef_v8context_t
+// reference.
+///
+CEF_EXPORT cef_v8script_t* cef_v8script_create(const cef_string_t* code,
+    const cef_string_t* script_url, struct _cef_binary_value_t* cached_data,
+    struct _cef_v8exception_t** exception);
+
+
 ///
 // Structure that should be implemented to handle V8 function calls. The
 // functions of this structure will be called on the thread associated with the
@@ -211,6 +283,31 @@ typedef struct _cef_v8accessor_t {
 } cef_v8accessor_t;
 
 
+///
+// Callback structure that is passed to cef_v8value_t::CreateArrayBuffer. The
+// functions of this structure will be called on the render process thread that
+// owns the ArrayBuffer.
+///
+typedef struct _cef_v8array_buffer_release_callback_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Called to release |buffer| after V8 garbage collects the ArrayBuffer JS
+  // object. This is not affected by releasing cef_v8value_t references to the
+  // ArrayBuffer or by releasing its context because the ArrayBuffer may still
+  // be reachable from JS. This function will not be called if the render
+  // process exits before the ArrayBuffer is collected. |buffer| is the value
+  // that was passed to CreateArrayBuffer along with this object. V8 functions
+  // must not be called from this function.
+  ///
+  void (CEF_CALLBACK *release_buffer)(
+      struct _cef_v8array_buffer_release_callback_t* self, void* buffer);
+} cef_v8array_buffer_release_callback_t;
+
+
 ///
 // Structure representing a V8 exception. The functions of this structure may be
 // called on any render process thread.
@@ -345,6 +442,16 @@ typedef struct _cef_v8value_t {
   ///
   int (CEF_CALLBACK *is_array)(struct _cef_v8value_t* self);
 
+  ///
+  // True if the value type is an ArrayBuffer.
+  ///
+  int (CEF_CALLBACK *is_array_buffer)(struct _cef_v8value_t* self);
+
+  ///
+  // True if the value type is a typed array or DataView (an ArrayBuffer view).
+  ///
+  int (CEF_CALLBACK *is_array_buffer_view)(struct _cef_v8value_t* self);
+
   ///
   // True if the value type is function.
   ///
@@ -563,6 +670,25 @@ typedef struct _cef_v8value_t {
   int (CEF_CALLBACK *get_array_length)(struct _cef_v8value_t* self);
 
 
+  // ARRAY BUFFER METHODS - These functions are only available on ArrayBuffers
+  // and ArrayBuffer views (typed arrays and DataViews).
+
+  ///
+  // Returns a pointer to the first byte of the backing store. For ArrayBuffer
+  // views the pointer is adjusted by the view's byte offset. The memory is not
+  // copied and remains valid only while this value and its ArrayBuffer are
+  // alive. Returns NULL if the backing store is NULL or has been neutered.
+  ///
+  void* (CEF_CALLBACK *get_array_buffer_data)(struct _cef_v8value_t* self);
+
+  ///
+  // Returns the number of bytes accessible via get_array_buffer_data(). For
+  // ArrayBuffer views this is the view's byte length.
+  ///
+  size_t (CEF_CALLBACK *get_array_buffer_byte_length)(
+      struct _cef_v8value_t* self);
+
+
   // FUNCTION METHODS - These functions are only available on functions.
 
   ///
@@ -670,6 +796,20 @@ CEF_EXPORT cef_v8value_t* cef_v8value_create_object(cef_v8accessor_t* accessor);
 ///
 CEF_EXPORT cef_v8value_t* cef_v8value_create_array(int length);
 
+///
+// Create a new cef_v8value_t object of type ArrayBuffer which wraps the
+// provided |buffer| of size |length| bytes. The ArrayBuffer is externalized,
+// meaning that it does not own |buffer|. The caller is responsible for freeing
+// |buffer| when requested via a call to cef_v8array_buffer_release_callback_t::
+// ReleaseBuffer. The contents of |buffer| are not copied and must remain valid
+// until ReleaseBuffer is called. This function should only be called from
+// within the scope of a cef_render_process_handler_t, cef_v8handler_t or
+// cef_v8accessor_t callback, or in combination with calling enter() and exit()
+// on a stored cef_v8context_t reference.
+///
+CEF_EXPORT cef_v8value_t* cef_v8value_create_array_buffer(void* buffer,
+    size_t length, cef_v8array_buffer_release_callback_t* release_callback);
+
 ///
 // Create a new cef_v8value_t object of type function. This function should only
 // be called from within the scope of a cef_render_process_handler_t,
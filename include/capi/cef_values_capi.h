@@ -274,6 +274,14 @@ typedef struct _cef_binary_value_t {
   ///
   size_t (CEF_CALLBACK *get_data)(struct _cef_binary_value_t* self,
       void* buffer, size_t buffer_size, size_t data_offset);
+
+  ///
+  // Returns a pointer to the data without copying it, or NULL if the size is 0.
+  // The data must not be modified. The pointer remains valid while this object
+  // is valid. Large binary arguments of a received cef_process_message_t point
+  // directly into the shared memory that was used to transfer them.
+  ///
+  void* (CEF_CALLBACK *get_raw_data)(struct _cef_binary_value_t* self);
 } cef_binary_value_t;
 
 
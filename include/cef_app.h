@@ -94,6 +94,16 @@ void CefShutdown();
 // This function should only be called on the main application thread and only
 // if CefInitialize() is called with a CefSettings.multi_threaded_message_loop
 // value of false. This function will not block.
+//
+// Calling this function on a fixed interval either wastes CPU (interval too
+// short) or delays input and paint processing (interval too long). To avoid
+// guessing, set CefSettings.external_message_pump to true and implement
+// CefBrowserProcessHandler::OnScheduleMessagePumpWork() to be told when this
+// function should next be called. On Linux the descriptor returned by
+// cef_get_message_pump_fd() can be polled instead. Each call will perform
+// pending work for a limited time slice and then return; if work remains a new
+// callback with a delay of 0 will be issued. CefRunMessageLoop() should not be
+// used in that mode.
 ///
 /*--cef()--*/
 void CefDoMessageLoopWork();
@@ -181,6 +181,14 @@ class CefBrowser : public virtual CefBase {
   /*--cef()--*/
   virtual void GetFrameNames(std::vector<CefString>& names) =0;
 
+  ///
+  // Returns all existing frames. This is more efficient than retrieving the
+  // identifiers or names and then retrieving each frame individually. Frames
+  // are returned in the same order as GetFrameIdentifiers.
+  ///
+  /*--cef(count_func=frames:GetFrameCount)--*/
+  virtual void GetFrames(std::vector<CefRefPtr<CefFrame> >& frames) =0;
+
   //
   // Send a message to the specified |target_process|. Returns true if the
   // message was sent successfully.
@@ -603,6 +611,23 @@ class CefBrowserHost : public virtual CefBase {
   /*--cef()--*/
   virtual void SetWindowlessFrameRate(int frame_rate) =0;
 
+  ///
+  // Generate a new frame if one is needed. Only used when window rendering is
+  // disabled and CefBrowserSettings.windowless_frame_pacing is
+  // FRAME_PACING_EXTERNAL. Call this method from the client's vsync or display
+  // refresh signal.
+  ///
+  /*--cef()--*/
+  virtual void SendExternalBeginFrame() =0;
+
+  ///
+  // Retrieve frame generation statistics for a windowless browser. Returns
+  // false if window rendering is enabled or the browser view does not yet
+  // exist. This method can only be called on the UI thread.
+  ///
+  /*--cef()--*/
+  virtual bool GetWindowlessFrameStatistics(CefFrameStatistics& stats) =0;
+
   ///
   // Get the NSTextInputContext implementation for enabling IME on Mac when
   // window rendering is disabled.
@@ -87,6 +87,23 @@ class CefBrowserProcessHandler : public virtual CefBase {
   virtual CefRefPtr<CefPrintHandler> GetPrintHandler() {
     return NULL;
   }
+
+  ///
+  // Called from any thread when work has been scheduled for the browser process
+  // main (UI) thread. This callback is used in combination with CefSettings.
+  // external_message_pump and CefDoMessageLoopWork() in cases where the CEF
+  // message loop must be integrated into an existing application message loop.
+  // This callback should schedule a CefDoMessageLoopWork() call to happen on the
+  // main (UI) thread. |delay_ms| is the requested delay in milliseconds. If
+  // |delay_ms| is <= 0 then the call should happen reasonably soon. If
+  // |delay_ms| is > 0 then the call should be scheduled to happen after the
+  // specified delay unless an earlier call is already pending. Pending calls
+  // are satisfied by any call to CefDoMessageLoopWork(). When CEF returns from
+  // CefDoMessageLoopWork() with work remaining this callback will be executed
+  // again before the function returns.
+  ///
+  /*--cef()--*/
+  virtual void OnScheduleMessagePumpWork(int64 delay_ms) {}
 };
 
 #endif  // CEF_INCLUDE_CEF_BROWSER_PROCESS_HANDLER_H_
@@ -40,11 +40,14 @@
 
 #include "include/cef_base.h"
 #include "include/cef_callback.h"
+#include "include/cef_values.h"
 #include <vector>
 
 class CefCookieVisitor;
 class CefSetCookieCallback;
+class CefSetCookiesCallback;
 class CefDeleteCookiesCallback;
+class CefExportCookiesCallback;
 
 ///
 // Class used for managing cookies. The methods of this class may be called on
@@ -110,6 +113,22 @@ class CefCookieManager : public virtual CefBase {
                                bool includeHttpOnly,
                                CefRefPtr<CefCookieVisitor> visitor) =0;
 
+  ///
+  // Visit a subset of cookies on the IO thread. If |domain| is non-empty only
+  // cookies for that domain and its subdomains will be visited. If |name| is
+  // non-empty only cookies with that name will be visited. If |expires_after|
+  // has a non-zero year value only persistent cookies that expire after that
+  // time will be visited. The filter is applied before cookies are converted
+  // so |total| will be the number of matching cookies. The returned cookies
+  // are ordered as with VisitAllCookies(). Returns false if cookies cannot be
+  // accessed.
+  ///
+  /*--cef(optional_param=domain,optional_param=name)--*/
+  virtual bool VisitFilteredCookies(const CefString& domain,
+                                    const CefString& name,
+                                    const CefTime& expires_after,
+                                    CefRefPtr<CefCookieVisitor> visitor) =0;
+
   ///
   // Sets a cookie given a valid URL and explicit user-provided cookie
   // attributes. This function expects each attribute to be well-formed. It will
@@ -124,6 +143,41 @@ class CefCookieManager : public virtual CefBase {
                          const CefCookie& cookie,
                          CefRefPtr<CefSetCookieCallback> callback) =0;
 
+  ///
+  // Sets multiple cookies for a valid URL in a single operation. Each entry in
+  // |cookie_lines| is a "Set-Cookie" header value such as
+  // "name=value; path=/; secure". Invalid entries will be skipped. If
+  // |callback| is non-NULL it will be executed asnychronously on the IO thread
+  // after all cookies have been set. Returns false if an invalid URL is
+  // specified or if cookies cannot be accessed.
+  ///
+  /*--cef(optional_param=callback)--*/
+  virtual bool SetCookies(const CefString& url,
+                          const std::vector<CefString>& cookie_lines,
+                          CefRefPtr<CefSetCookiesCallback> callback) =0;
+
+  ///
+  // Export all cookies as a single blob using the specified |format|. The
+  // cookies are serialized on the FILE thread and |callback| will be executed
+  // on the IO thread. Returns false if cookies cannot be accessed.
+  ///
+  /*--cef()--*/
+  virtual bool ExportCookies(cef_cookie_format_t format,
+                             CefRefPtr<CefExportCookiesCallback> callback) =0;
+
+  ///
+  // Import cookies from a blob created by ExportCookies() using any format.
+  // Cookies will be set for a URL matching their domain, path and secure
+  // attribute and will replace existing cookies with the same name. Creation
+  // and last access times are not preserved. If |callback| is non-NULL it will
+  // be executed asnychronously on the IO thread after all cookies have been
+  // set. Returns false if |data| cannot be parsed or if cookies cannot be
+  // accessed.
+  ///
+  /*--cef(optional_param=callback)--*/
+  virtual bool ImportCookies(CefRefPtr<CefBinaryValue> data,
+                             CefRefPtr<CefSetCookiesCallback> callback) =0;
+
   ///
   // Delete all cookies that match the specified parameters. If both |url| and
   // |cookie_name| values are specified all host and domain cookies matching
@@ -202,6 +256,41 @@ class CefSetCookieCallback : public virtual CefBase {
 };
 
 
+///
+// Interface to implement to be notified of asynchronous completion via
+// CefCookieManager::SetCookies() or CefCookieManager::ImportCookies().
+///
+/*--cef(source=client)--*/
+class CefSetCookiesCallback : public virtual CefBase {
+ public:
+  ///
+  // Method that will be called upon completion. |num_set| will be the number
+  // of cookies that were set successfully.
+  ///
+  /*--cef()--*/
+  virtual void OnComplete(int num_set) =0;
+};
+
+
+///
+// Interface to implement to receive the result of
+// CefCookieManager::ExportCookies(). The methods of this class will be called
+// on the IO thread.
+///
+/*--cef(source=client)--*/
+class CefExportCookiesCallback : public virtual CefBase {
+ public:
+  ///
+  // Method that will be called upon completion. |data| will contain the
+  // serialized cookies or will be NULL if serialization failed. |num_exported|
+  // will be the number of cookies contained in |data|.
+  ///
+  /*--cef(optional_param=data)--*/
+  virtual void OnComplete(CefRefPtr<CefBinaryValue> data,
+                          int num_exported) =0;
+};
+
+
 ///
 // Interface to implement to be notified of asynchronous completion via
 // CefCookieManager::DeleteCookies().
@@ -126,6 +126,23 @@ class CefFrame : public virtual CefBase {
   /*--cef()--*/
   virtual void GetText(CefRefPtr<CefStringVisitor> visitor) =0;
 
+  ///
+  // Retrieve this frame's HTML source in chunks sent to the specified visitor.
+  // Unlike GetSource() the complete value is never held in the browser process
+  // and other messages for the browser are not delayed while a large document
+  // is transferred. The request will fail if a cross-process navigation
+  // replaces the renderer before all chunks have been received.
+  ///
+  /*--cef()--*/
+  virtual void GetSourceChunked(CefRefPtr<CefStringChunkVisitor> visitor) =0;
+
+  ///
+  // Retrieve this frame's display text in chunks sent to the specified
+  // visitor. See GetSourceChunked() for details.
+  ///
+  /*--cef()--*/
+  virtual void GetTextChunked(CefRefPtr<CefStringChunkVisitor> visitor) =0;
+
   ///
   // Load the request represented by the |request| object.
   ///
@@ -41,6 +41,7 @@
 #include <vector>
 
 #include "include/cef_base.h"
+#include "include/cef_stream.h"
 #include "include/cef_values.h"
 
 ///
@@ -161,4 +162,190 @@ CefRefPtr<CefValue> CefParseJSONAndReturnError(
 CefString CefWriteJSON(CefRefPtr<CefValue> node,
                        cef_json_writer_options_t options);
 
+///
+// Interface that should be implemented by the client to receive events from
+// CefParseJSONStream. Events are delivered in document order on the thread
+// that called CefParseJSONStream. Return false from any method to stop
+// parsing.
+///
+/*--cef(source=client)--*/
+class CefJSONParserHandler : public virtual CefBase {
+ public:
+  ///
+  // Called at the start of a dictionary value.
+  ///
+  /*--cef()--*/
+  virtual bool OnBeginDictionary() =0;
+
+  ///
+  // Called at the end of a dictionary value.
+  ///
+  /*--cef()--*/
+  virtual bool OnEndDictionary() =0;
+
+  ///
+  // Called at the start of a list value.
+  ///
+  /*--cef()--*/
+  virtual bool OnBeginList() =0;
+
+  ///
+  // Called at the end of a list value.
+  ///
+  /*--cef()--*/
+  virtual bool OnEndList() =0;
+
+  ///
+  // Called for each dictionary |key|. The next event will be for the
+  // associated value.
+  ///
+  /*--cef(optional_param=key)--*/
+  virtual bool OnKey(const CefString& key) =0;
+
+  ///
+  // Called for a null value.
+  ///
+  /*--cef()--*/
+  virtual bool OnNull() =0;
+
+  ///
+  // Called for a bool value.
+  ///
+  /*--cef()--*/
+  virtual bool OnBool(bool value) =0;
+
+  ///
+  // Called for an integer value. Numbers that have a fraction or exponent or
+  // that do not fit in an int are reported via OnDouble instead.
+  ///
+  /*--cef()--*/
+  virtual bool OnInt(int value) =0;
+
+  ///
+  // Called for a double value.
+  ///
+  /*--cef()--*/
+  virtual bool OnDouble(double value) =0;
+
+  ///
+  // Called for a string value.
+  ///
+  /*--cef(optional_param=value)--*/
+  virtual bool OnString(const CefString& value) =0;
+};
+
+///
+// Parses JSON data from |stream| and reports the contents to |handler| as they
+// are read, without building an intermediate value representation. The stream
+// is read in fixed-size chunks and each key, string or number is buffered in
+// full before it's reported, so memory usage grows with the largest single
+// token or value rather than with the size of the document. Returns true if
+// the complete document was parsed. If parsing
+// fails |error_code_out| and |error_msg_out| will be populated with an error
+// code and a formatted error message respectively. If parsing is stopped by
+// |handler| this method returns false and |error_code_out| is set to
+// JSON_NO_ERROR.
+///
+/*--cef()--*/
+bool CefParseJSONStream(CefRefPtr<CefStreamReader> stream,
+                        CefRefPtr<CefJSONParserHandler> handler,
+                        cef_json_parser_options_t options,
+                        cef_json_parser_error_t& error_code_out,
+                        CefString& error_msg_out);
+
+///
+// Class used to incrementally write JSON data to a stream. Output is buffered
+// and written to the stream in chunks. The output is identical to what
+// CefWriteJSON would produce for the equivalent value with the same |options|
+// (JSON_WRITER_OMIT_BINARY_VALUES is ignored). The methods of this class
+// should only be called on the thread that created the object. Write methods
+// return false if the value would result in invalid JSON (for example, a
+// value in a dictionary without a preceding key) or if the stream write fails.
+///
+/*--cef(source=library)--*/
+class CefJSONWriter : public virtual CefBase {
+ public:
+  ///
+  // Create a new CefJSONWriter object that writes to |stream|.
+  ///
+  /*--cef()--*/
+  static CefRefPtr<CefJSONWriter> Create(CefRefPtr<CefStreamWriter> stream,
+                                         cef_json_writer_options_t options);
+
+  ///
+  // Begin a dictionary value.
+  ///
+  /*--cef()--*/
+  virtual bool BeginDictionary() =0;
+
+  ///
+  // End the current dictionary value.
+  ///
+  /*--cef()--*/
+  virtual bool EndDictionary() =0;
+
+  ///
+  // Begin a list value.
+  ///
+  /*--cef()--*/
+  virtual bool BeginList() =0;
+
+  ///
+  // End the current list value.
+  ///
+  /*--cef()--*/
+  virtual bool EndList() =0;
+
+  ///
+  // Write a dictionary |key|. Must be followed by exactly one value.
+  ///
+  /*--cef(optional_param=key)--*/
+  virtual bool WriteKey(const CefString& key) =0;
+
+  ///
+  // Write a null value.
+  ///
+  /*--cef()--*/
+  virtual bool WriteNull() =0;
+
+  ///
+  // Write a bool value.
+  ///
+  /*--cef()--*/
+  virtual bool WriteBool(bool value) =0;
+
+  ///
+  // Write an integer value.
+  ///
+  /*--cef()--*/
+  virtual bool WriteInt(int value) =0;
+
+  ///
+  // Write a double value. Returns false for NaN and infinite values, which
+  // cannot be represented in JSON.
+  ///
+  /*--cef()--*/
+  virtual bool WriteDouble(double value) =0;
+
+  ///
+  // Write a string value.
+  ///
+  /*--cef(optional_param=value)--*/
+  virtual bool WriteString(const CefString& value) =0;
+
+  ///
+  // Returns true if a complete root value has been written.
+  ///
+  /*--cef()--*/
+  virtual bool IsComplete() =0;
+
+  ///
+  // Write any buffered output to the stream and flush it. Buffered output is
+  // also written when this object is destroyed. Returns false if writing to
+  // the stream failed.
+  ///
+  /*--cef()--*/
+  virtual bool Flush() =0;
+};
+
 #endif  // CEF_INCLUDE_CEF_PARSER_H_
@@ -119,7 +119,8 @@ class CefRenderHandler : public virtual CefBase {
   // contains the pixel data for the whole image. |dirtyRects| contains the set
   // of rectangles in pixel coordinates that need to be repainted. |buffer| will
   // be |width|*|height|*4 bytes in size and represents a BGRA image with an
-  // upper-left origin.
+  // upper-left origin. See CefBrowserSettings.windowless_partial_paint for
+  // additional |buffer| guarantees when partial paint delivery is enabled.
   ///
   /*--cef()--*/
   virtual void OnPaint(CefRefPtr<CefBrowser> browser,
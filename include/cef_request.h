@@ -39,6 +39,7 @@
 #pragma once
 
 #include "include/cef_base.h"
+#include "include/cef_stream.h"
 #include <map>
 #include <vector>
 
@@ -241,7 +242,7 @@ class CefPostData : public virtual CefBase {
 class CefPostDataElement : public virtual CefBase {
  public:
   ///
-  // Post data elements may represent either bytes or files.
+  // Post data elements may represent bytes, files or streams.
   ///
   typedef cef_postdataelement_type_t Type;
 
@@ -269,6 +270,29 @@ class CefPostDataElement : public virtual CefBase {
   /*--cef()--*/
   virtual void SetToFile(const CefString& fileName) =0;
 
+  ///
+  // The post data element will represent |length| bytes of the file starting
+  // at |offset|. If |length| is -1 the remainder of the file will be used. The
+  // file contents will be read incrementally when the request is sent.
+  ///
+  /*--cef()--*/
+  virtual void SetToFileRange(const CefString& fileName,
+                              int64 offset,
+                              int64 length) =0;
+
+  ///
+  // The post data element will represent |length| bytes read from |stream|
+  // starting at its current position. The contents will be read incrementally
+  // when the request is sent so that they are never fully buffered in memory.
+  // If the request needs to be resent |stream| will be seeked back to the
+  // starting position. Streams that report MayBlock() will be read on the
+  // browser process FILE thread. Only supported for requests sent from the
+  // browser process.
+  ///
+  /*--cef()--*/
+  virtual void SetToStream(CefRefPtr<CefStreamReader> stream,
+                           int64 length) =0;
+
   ///
   // The post data element will represent bytes.  The bytes passed
   // in will be copied.
@@ -288,6 +312,33 @@ class CefPostDataElement : public virtual CefBase {
   /*--cef()--*/
   virtual CefString GetFile() =0;
 
+  ///
+  // Return the offset into the file at which the data starts.
+  ///
+  /*--cef()--*/
+  virtual int64 GetFileOffset() =0;
+
+  ///
+  // Return the number of bytes to read from the file or -1 if the remainder of
+  // the file will be used.
+  ///
+  /*--cef()--*/
+  virtual int64 GetFileLength() =0;
+
+  ///
+  // Return the stream. Returns NULL for the post data of requests passed to
+  // handler callbacks such as CefResourceHandler::ProcessRequest() because the
+  // stream is only read by the network stack. Use GetStreamLength() instead.
+  ///
+  /*--cef()--*/
+  virtual CefRefPtr<CefStreamReader> GetStream() =0;
+
+  ///
+  // Return the number of bytes to read from the stream.
+  ///
+  /*--cef()--*/
+  virtual int64 GetStreamLength() =0;
+
   ///
   // Return the number of bytes.
   ///
@@ -44,6 +44,47 @@
 
 class CefSchemeHandlerFactory;
 
+///
+// Interface to implement to be notified of asynchronous completion via
+// CefRequestContext::GetCacheStatistics().
+///
+/*--cef(source=client)--*/
+class CefCacheStatisticsCallback : public virtual CefBase {
+ public:
+  ///
+  // Method that will be called upon completion. |hit_count| and |miss_count|
+  // are the number of completed HTTP and HTTPS requests that were and were not
+  // served from the HTTP cache. |cached_bytes| is the number of response body
+  // bytes served from the cache and |network_bytes| is the number of bytes
+  // received from the network. |entry_count| is the number of entries
+  // currently stored in the cache or -1 if the cache is unavailable.
+  ///
+  /*--cef()--*/
+  virtual void OnComplete(int64 hit_count,
+                          int64 miss_count,
+                          int64 cached_bytes,
+                          int64 network_bytes,
+                          int entry_count) =0;
+};
+
+
+///
+// Interface to implement to be notified of asynchronous completion via
+// CefRequestContext::PreloadCacheEntry() or
+// CefRequestContext::EvictCacheEntry().
+///
+/*--cef(source=client)--*/
+class CefCacheEntryCallback : public virtual CefBase {
+ public:
+  ///
+  // Method that will be called upon completion. |success| will be true if the
+  // cache entry was loaded or evicted successfully.
+  ///
+  /*--cef()--*/
+  virtual void OnComplete(bool success) =0;
+};
+
+
 ///
 // A request context provides request handling for a set of related browser
 // or URL request objects. A request context can be specified when creating a
@@ -217,6 +258,38 @@ class CefRequestContext : public virtual CefBase {
   virtual bool SetPreference(const CefString& name,
                              CefRefPtr<CefValue> value,
                              CefString& error) =0;
+
+  ///
+  // Retrieve HTTP cache statistics for this context. Statistics are collected
+  // for all HTTP and HTTPS requests completed since the context's storage was
+  // initialized and are shared by all contexts that share the same storage.
+  // |callback| will be executed asnychronously on the IO thread.
+  ///
+  /*--cef()--*/
+  virtual void GetCacheStatistics(
+      CefRefPtr<CefCacheStatisticsCallback> callback) =0;
+
+  ///
+  // Load the resource at |url| into the HTTP cache without displaying it. The
+  // request will be sent with the cookies and network configuration of this
+  // context and the response body will be discarded once cached. If |callback|
+  // is non-NULL it will be executed asnychronously on the IO thread after the
+  // request completes. The request will be canceled without executing
+  // |callback| if the context's storage is destroyed first.
+  ///
+  /*--cef(optional_param=callback)--*/
+  virtual void PreloadCacheEntry(const CefString& url,
+                                 CefRefPtr<CefCacheEntryCallback> callback) =0;
+
+  ///
+  // Remove the HTTP cache entry for |url| if one exists. Only entries for GET
+  // requests can be removed using this method. If |callback| is non-NULL it
+  // will be executed asnychronously on the IO thread after the entry has been
+  // removed.
+  ///
+  /*--cef(optional_param=callback)--*/
+  virtual void EvictCacheEntry(const CefString& url,
+                               CefRefPtr<CefCacheEntryCallback> callback) =0;
 };
 
 #endif  // CEF_INCLUDE_CEF_REQUEST_CONTEXT_H_
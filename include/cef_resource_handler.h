@@ -45,6 +45,28 @@
 #include "include/cef_request.h"
 #include "include/cef_response.h"
 
+///
+// Class representing a contiguous block of response data. The data must remain
+// valid and unchanged for the lifespan of this object. The methods of this
+// class may be called on any thread.
+///
+/*--cef(source=client)--*/
+class CefResourceDataBlock : public virtual CefBase {
+ public:
+  ///
+  // Returns a pointer to the data.
+  ///
+  /*--cef()--*/
+  virtual void* GetData() =0;
+
+  ///
+  // Returns the size of the data in bytes.
+  ///
+  /*--cef()--*/
+  virtual size_t GetSize() =0;
+};
+
+
 ///
 // Class used to implement a custom request handler interface. The methods of
 // this class will always be called on the IO thread.
@@ -91,6 +113,21 @@ class CefResourceHandler : public virtual CefBase {
                             int& bytes_read,
                             CefRefPtr<CefCallback> callback) =0;
 
+  ///
+  // Optionally provide response data as a sequence of data blocks instead of
+  // copying it via ReadResponse(). This method will be called before the first
+  // call to ReadResponse(). If it returns a non-NULL value the response data
+  // will be read directly from the returned block and this method will be
+  // called again each time the previous block has been consumed. Return NULL to
+  // indicate response completion. If the first call returns NULL then
+  // ReadResponse() will be used instead. The response data will not be copied
+  // into any intermediate buffer.
+  ///
+  /*--cef()--*/
+  virtual CefRefPtr<CefResourceDataBlock> GetResponseDataBlock() {
+    return NULL;
+  }
+
   ///
   // Return true if the specified cookie can be sent with the request or false
   // otherwise. If false is returned for any cookie then no cookies will be sent
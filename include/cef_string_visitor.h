@@ -52,4 +52,28 @@ class CefStringVisitor : public virtual CefBase {
   virtual void Visit(const CefString& string) =0;
 };
 
+///
+// Implement this interface to receive a large string value asynchronously in
+// a sequence of chunks. The next chunk will not be delivered until the
+// previous call to VisitChunk() has returned.
+///
+/*--cef(source=client)--*/
+class CefStringChunkVisitor : public virtual CefBase {
+ public:
+  ///
+  // Method that will be executed for each chunk in order. Chunks never split a
+  // character. Return true to receive the next chunk or false to cancel.
+  ///
+  /*--cef(optional_param=chunk)--*/
+  virtual bool VisitChunk(const CefString& chunk) =0;
+
+  ///
+  // Method that will be executed once after the last chunk has been delivered.
+  // |success| will be false if the value could not be retrieved in full
+  // because the request failed or was canceled.
+  ///
+  /*--cef()--*/
+  virtual void OnComplete(bool success) =0;
+};
+
 #endif  // CEF_INCLUDE_CEF_STRING_VISITOR_H_
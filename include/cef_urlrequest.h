@@ -43,6 +43,7 @@
 #include "include/cef_request.h"
 #include "include/cef_request_context.h"
 #include "include/cef_response.h"
+#include "include/cef_stream.h"
 
 class CefURLRequestClient;
 
@@ -61,12 +62,14 @@ class CefURLRequest : public virtual CefBase {
 
   ///
   // Create a new URL request. Only GET, POST, HEAD, DELETE and PUT request
-  // methods are supported. Multiple post data elements are not supported and
-  // elements of type PDE_TYPE_FILE are only supported for requests originating
-  // from the browser process. Requests originating from the render process will
-  // receive the same handling as requests originating from Web content -- if
-  // the response contains Content-Disposition or Mime-Type header values that
-  // would not normally be rendered then the response may receive special
+  // methods are supported. Multiple post data elements and elements of type
+  // PDE_TYPE_FILE or PDE_TYPE_STREAM are only supported for requests
+  // originating from the browser process. In the browser process post data is
+  // read incrementally while the request is sent so memory usage does not
+  // depend on the upload size. Requests originating from the render process
+  // will receive the same handling as requests originating from Web content --
+  // if the response contains Content-Disposition or Mime-Type header values
+  // that would not normally be rendered then the response may receive special
   // handling inside the browser (for example, via the file download code path
   // instead of the URL request code path). The |request| object will be marked
   // as read-only after calling this method. In the browser process if
@@ -161,13 +164,28 @@ class CefURLRequestClient : public virtual CefBase {
   ///
   // Called when some part of the response is read. |data| contains the current
   // bytes received since the last call. This method will not be called if the
-  // UR_FLAG_NO_DOWNLOAD_DATA flag is set on the request.
+  // UR_FLAG_NO_DOWNLOAD_DATA flag is set on the request or if a writer was
+  // returned from GetDownloadStreamWriter.
   ///
   /*--cef()--*/
   virtual void OnDownloadData(CefRefPtr<CefURLRequest> request,
                               const void* data,
                               size_t data_length) =0;
 
+  ///
+  // Called once when the request is started to optionally provide a
+  // destination for the response body. Return a CefStreamWriter to have the
+  // response body written to it instead of being delivered via OnDownloadData.
+  // Writers that may block will be accessed on the FILE thread and all others
+  // on the IO thread. Use CefStreamWriter::CreateForFile to save the response
+  // body directly to disk. The writer will be flushed before OnRequestComplete
+  // is called. Return NULL for the default behavior. This method will only be
+  // called for requests initiated from the browser process.
+  ///
+  /*--cef()--*/
+  virtual CefRefPtr<CefStreamWriter> GetDownloadStreamWriter(
+      CefRefPtr<CefURLRequest> request) { return NULL; }
+
   ///
   // Called on the IO thread when the browser needs credentials from the user.
   // |isProxy| indicates whether the host is a proxy server. |host| contains the
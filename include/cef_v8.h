@@ -43,6 +43,7 @@
 #include "include/cef_browser.h"
 #include "include/cef_frame.h"
 #include "include/cef_task.h"
+#include "include/cef_values.h"
 #include <vector>
 
 class CefV8Exception;
@@ -218,6 +219,75 @@ class CefV8Context : public virtual CefBase {
 };
 
 
+///
+// Class representing a compiled JavaScript script. A script is compiled once
+// and may then be run any number of times in any context that belongs to the
+// same thread. Compiling also produces V8 code cache data that can be passed
+// to Create() in a later render process so that the script is not parsed and
+// compiled again. The code cache data can be sent to the browser process for
+// storage using CefProcessMessage and sent to new render processes using the
+// |extra_info| argument of CefRenderProcessHandler::OnRenderThreadCreated().
+// The methods of this class can only be called on the thread that created the
+// script.
+///
+/*--cef(source=library)--*/
+class CefV8Script : public virtual CefBase {
+ public:
+  ///
+  // Compile the specified JavaScript |code|. |script_url| is the URL that will
+  // be reported in stack traces and exceptions. If |cached_data| is non-empty
+  // it should be the result of GetCachedData() for the same |code| and will be
+  // used to avoid compiling the script again. Cached data that does not match
+  // |code| or the current V8 version will be ignored. On failure |exception|
+  // will be set to the exception, if any, and NULL will be returned. This
+  // method should only be called from within the scope of a
+  // CefRenderProcessHandler, CefV8Handler or CefV8Accessor callback, or in
+  // combination with calling Enter() and Exit() on a stored CefV8Context
+  // reference.
+  ///
+  /*--cef(optional_param=script_url,optional_param=cached_data)--*/
+  static CefRefPtr<CefV8Script> Create(const CefString& code,
+                                       const CefString& script_url,
+                                       CefRefPtr<CefBinaryValue> cached_data,
+                                       CefRefPtr<CefV8Exception>& exception);
+
+  ///
+  // Returns true if the underlying handle is valid and it can be accessed on
+  // the current thread. Do not call any other methods if this method returns
+  // false.
+  ///
+  /*--cef()--*/
+  virtual bool IsValid() =0;
+
+  ///
+  // Runs this script using the global object of |context|. On success |retval|
+  // will be set to the return value, if any, and the function will return
+  // true. On failure |exception| will be set to the exception, if any, and the
+  // function will return false.
+  ///
+  /*--cef()--*/
+  virtual bool Run(CefRefPtr<CefV8Context> context,
+                   CefRefPtr<CefV8Value>& retval,
+                   CefRefPtr<CefV8Exception>& exception) =0;
+
+  ///
+  // Returns the V8 code cache data for this script or NULL if no data is
+  // available. If the |cached_data| passed to Create() was accepted it will be
+  // returned unchanged.
+  ///
+  /*--cef()--*/
+  virtual CefRefPtr<CefBinaryValue> GetCachedData() =0;
+
+  ///
+  // Returns true if the |cached_data| passed to Create() was rejected and the
+  // script was compiled from source instead. Stored code cache data should be
+  // discarded in this case.
+  ///
+  /*--cef()--*/
+  virtual bool IsCachedDataRejected() =0;
+};
+
+
 typedef std::vector<CefRefPtr<CefV8Value> > CefV8ValueList;
 
 ///
@@ -277,6 +347,27 @@ class CefV8Accessor : public virtual CefBase {
                    CefString& exception) =0;
 };
 
+///
+// Callback interface that is passed to CefV8Value::CreateArrayBuffer. The
+// methods of this class will be called on the render process thread that owns
+// the ArrayBuffer.
+///
+/*--cef(source=client)--*/
+class CefV8ArrayBufferReleaseCallback : public virtual CefBase {
+ public:
+  ///
+  // Called to release |buffer| after V8 garbage collects the ArrayBuffer JS
+  // object. This is not affected by releasing CefV8Value references to the
+  // ArrayBuffer or by releasing its context because the ArrayBuffer may still
+  // be reachable from JS. This method will not be called if the render process
+  // exits before the ArrayBuffer is collected. |buffer| is the value that was
+  // passed to CreateArrayBuffer along with this object. V8 methods must not be
+  // called from this method.
+  ///
+  /*--cef()--*/
+  virtual void ReleaseBuffer(void* buffer) =0;
+};
+
 ///
 // Class representing a V8 exception. The methods of this class may be called on
 // any render process thread.
@@ -423,6 +514,23 @@ class CefV8Value : public virtual CefBase {
   /*--cef()--*/
   static CefRefPtr<CefV8Value> CreateArray(int length);
 
+  ///
+  // Create a new CefV8Value object of type ArrayBuffer which wraps the provided
+  // |buffer| of size |length| bytes. The ArrayBuffer is externalized, meaning
+  // that it does not own |buffer|. The caller is responsible for freeing
+  // |buffer| when requested via a call to CefV8ArrayBufferReleaseCallback::
+  // ReleaseBuffer. The contents of |buffer| are not copied and must remain
+  // valid until ReleaseBuffer is called. This method should only be called
+  // from within the scope of a CefRenderProcessHandler, CefV8Handler or
+  // CefV8Accessor callback, or in combination with calling Enter() and Exit()
+  // on a stored CefV8Context reference.
+  ///
+  /*--cef()--*/
+  static CefRefPtr<CefV8Value> CreateArrayBuffer(
+      void* buffer,
+      size_t length,
+      CefRefPtr<CefV8ArrayBufferReleaseCallback> release_callback);
+
   ///
   // Create a new CefV8Value object of type function. This method should only be
   // called from within the scope of a CefRenderProcessHandler, CefV8Handler or
@@ -501,6 +609,18 @@ class CefV8Value : public virtual CefBase {
   /*--cef()--*/
   virtual bool IsArray() =0;
 
+  ///
+  // True if the value type is an ArrayBuffer.
+  ///
+  /*--cef()--*/
+  virtual bool IsArrayBuffer() =0;
+
+  ///
+  // True if the value type is a typed array or DataView (an ArrayBuffer view).
+  ///
+  /*--cef()--*/
+  virtual bool IsArrayBufferView() =0;
+
   ///
   // True if the value type is function.
   ///
@@ -730,6 +850,26 @@ class CefV8Value : public virtual CefBase {
   virtual int GetArrayLength() =0;
 
 
+  // ARRAY BUFFER METHODS - These methods are only available on ArrayBuffers
+  // and ArrayBuffer views (typed arrays and DataViews).
+
+  ///
+  // Returns a pointer to the first byte of the backing store. For ArrayBuffer
+  // views the pointer is adjusted by the view's byte offset. The memory is not
+  // copied and remains valid only while this value and its ArrayBuffer are
+  // alive. Returns NULL if the backing store is empty or has been neutered.
+  ///
+  /*--cef()--*/
+  virtual void* GetArrayBufferData() =0;
+
+  ///
+  // Returns the number of bytes accessible via GetArrayBufferData(). For
+  // ArrayBuffer views this is the view's byte length.
+  ///
+  /*--cef()--*/
+  virtual size_t GetArrayBufferByteLength() =0;
+
+
   // FUNCTION METHODS - These methods are only available on functions.
 
   ///
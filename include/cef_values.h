@@ -293,6 +293,15 @@ class CefBinaryValue : public virtual CefBase {
   virtual size_t GetData(void* buffer,
                          size_t buffer_size,
                          size_t data_offset) =0;
+
+  ///
+  // Returns a pointer to the data without copying it, or NULL if the size is
+  // 0. The data must not be modified. The pointer remains valid while this
+  // object is valid. Large binary arguments of a received CefProcessMessage
+  // point directly into the shared memory that was used to transfer them.
+  ///
+  /*--cef()--*/
+  virtual void* GetRawData() =0;
 };
 
 
@@ -39,7 +39,8 @@ extern "C" {
 #endif
 
 ///
-// CEF string maps are a set of key/value string pairs.
+// CEF string maps are a set of key/value string pairs. Pairs are kept in the
+// order they were appended and can be retrieved by index in constant time.
 ///
 typedef void* cef_string_map_t;
 
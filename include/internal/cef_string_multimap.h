@@ -40,7 +40,8 @@ extern "C" {
 
 ///
 // CEF string multimaps are a set of key/value string pairs.
-// More than one value can be assigned to a single key.
+// More than one value can be assigned to a single key. Pairs are kept in the
+// order they were appended and can be retrieved by index in constant time.
 ///
 typedef void* cef_string_multimap_t;
 
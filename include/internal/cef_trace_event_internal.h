@@ -50,6 +50,14 @@ extern "C" {
 // - |id| is used to disambiguate counters with the same name, or match async
 //   trace events
 
+// Returns a pointer to the enabled flag for |category|. The flag is non-zero
+// while the category is enabled in the current process and is updated in
+// place by the library when CefBeginTracing/CefEndTracing change the category
+// filter. The returned pointer is valid for the lifespan of the application
+// so it can be cached by the caller.
+CEF_EXPORT const unsigned char* cef_trace_event_get_category_enabled(
+    const char* category);
+
 CEF_EXPORT void cef_trace_event_instant(const char* category,
                                         const char* name,
                                         const char* arg1_name,
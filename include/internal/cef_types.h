@@ -176,10 +176,27 @@ typedef struct _cef_settings_t {
   // Set to true (1) to have the browser process message loop run in a separate
   // thread. If false (0) than the CefDoMessageLoopWork() function must be
   // called from your application message loop. This option is only supported on
-  // Windows.
+  // Windows and Linux. On Linux CefInitialize() must be called before any other
+  // use of Xlib or GTK+ in the process and the browser process message loop
+  // will use its own GLib main context, leaving the default context to the
+  // application.
   ///
   int multi_threaded_message_loop;
 
+  ///
+  // Set to true (1) to control browser process main (UI) thread message pump
+  // scheduling via the CefBrowserProcessHandler::OnScheduleMessagePumpWork()
+  // callback or, on Linux, the cef_get_message_pump_fd() descriptor. This
+  // option is recommended for use in combination with the
+  // CefDoMessageLoopWork() function in cases where the CEF message loop must be
+  // integrated into an existing application message loop (see additional
+  // comments and warnings on CefDoMessageLoopWork). Enabling this option is not
+  // recommended for most users; leave this option disabled and use either the
+  // CefRunMessageLoop() function or multi_threaded_message_loop if possible.
+  // This option is ignored if multi_threaded_message_loop is enabled.
+  ///
+  int external_message_pump;
+
   ///
   // Set to true (1) to enable windowless (off-screen) rendering support. Do not
   // enable this value if the application does not use windowless rendering as
@@ -237,6 +254,33 @@ typedef struct _cef_settings_t {
   ///
   int persist_user_preferences;
 
+  ///
+  // The maximum size in bytes of the HTTP disk cache. If 0 the size will be
+  // chosen automatically based on the available disk space. Can be overridden
+  // for individual CefRequestContext instances via the
+  // CefRequestContextSettings.cache_max_size value.
+  ///
+  int cache_max_size;
+
+  ///
+  // Set to true (1) to keep the HTTP cache in memory even when |cache_path| is
+  // specified. Cookies, user preferences and HTML5 databases will still be
+  // persisted to |cache_path|. Use this to avoid disk I/O from cache churn
+  // on slow or size-constrained storage. Can be overridden for individual
+  // CefRequestContext instances via the CefRequestContextSettings.
+  // cache_in_memory value.
+  ///
+  int cache_in_memory;
+
+  ///
+  // The maximum size in bytes of the in-memory HTTP cache that is used when
+  // |cache_path| is empty or |cache_in_memory| is true (1). If 0 the size
+  // will be chosen automatically based on the available system memory. Can be
+  // overridden for individual CefRequestContext instances via the
+  // CefRequestContextSettings.memory_cache_max_size value.
+  ///
+  int memory_cache_max_size;
+
   ///
   // Value that will be returned as the User-Agent HTTP header. If empty the
   // default User-Agent string will be used. Also configurable using the
@@ -353,6 +397,17 @@ typedef struct _cef_settings_t {
   ///
   int context_safety_implementation;
 
+  ///
+  // Binary values of at least this many bytes in CefProcessMessage arguments
+  // will be transferred between processes using read-only shared memory
+  // instead of being copied into the IPC message. The receiving process reads
+  // the contents directly from the shared memory segment. Specify 0 to use the
+  // default value of 65536 (64KB) or -1 to always copy binary values. Also
+  // configurable using the "process-message-shared-memory-threshold"
+  // command-line switch.
+  ///
+  int process_message_shared_memory_threshold;
+
   ///
   // Set to true (1) to ignore errors related to invalid SSL certificates.
   // Enabling this setting can lead to potential security vulnerabilities like
@@ -421,6 +476,33 @@ typedef struct _cef_request_context_settings_t {
   ///
   int persist_user_preferences;
 
+  ///
+  // The maximum size in bytes of the HTTP disk cache. If 0 the size will be
+  // chosen automatically based on the available disk space. Can be set
+  // globally using the CefSettings.cache_max_size value. This value will be
+  // ignored if |cache_path| is empty or if it matches the CefSettings.
+  // cache_path value.
+  ///
+  int cache_max_size;
+
+  ///
+  // Set to true (1) to keep the HTTP cache in memory even when |cache_path| is
+  // specified. Cookies, user preferences and HTML5 databases will still be
+  // persisted to |cache_path|. Can be set globally using the
+  // CefSettings.cache_in_memory value. This value will be ignored if
+  // |cache_path| matches the CefSettings.cache_path value.
+  ///
+  int cache_in_memory;
+
+  ///
+  // The maximum size in bytes of the in-memory HTTP cache that is used when
+  // |cache_path| is empty or |cache_in_memory| is true (1). If 0 the size
+  // will be chosen automatically based on the available system memory. Can be
+  // set globally using the CefSettings.memory_cache_max_size value. This value
+  // will be ignored if |cache_path| matches the CefSettings.cache_path value.
+  ///
+  int memory_cache_max_size;
+
   ///
   // Set to true (1) to ignore errors related to invalid SSL certificates.
   // Enabling this setting can lead to potential security vulnerabilities like
@@ -442,6 +524,34 @@ typedef struct _cef_request_context_settings_t {
   cef_string_t accept_language_list;
 } cef_request_context_settings_t;
 
+///
+// Frame pacing modes for windowless rendering. Modes other than
+// FRAME_PACING_FIXED require BeginFrame scheduling to be enabled using the
+// "enable-begin-frame-scheduling" command-line switch and will otherwise
+// behave like FRAME_PACING_FIXED.
+///
+typedef enum {
+  ///
+  // Generate frames at the fixed rate specified by
+  // CefBrowserSettings.windowless_frame_rate.
+  ///
+  FRAME_PACING_FIXED = 0,
+
+  ///
+  // Progressively reduce the rate at which frames are generated while no
+  // content is changing and return to the full frame rate immediately when
+  // content changes or input is received.
+  ///
+  FRAME_PACING_ADAPTIVE,
+
+  ///
+  // Generate frames only in response to calls to
+  // CefBrowserHost::SendExternalBeginFrame. Use this mode to lock frame
+  // generation to an externally supplied vsync signal.
+  ///
+  FRAME_PACING_EXTERNAL,
+} cef_frame_pacing_mode_t;
+
 ///
 // Browser initialization settings. Specify NULL or 0 to get the recommended
 // default values. The consequences of using custom values may not be well
@@ -463,6 +573,25 @@ typedef struct _cef_browser_settings_t {
   ///
   int windowless_frame_rate;
 
+  ///
+  // Set to true (1) to enable partial paint delivery for a windowless browser.
+  // When enabled the |dirtyRects| argument to CefRenderHandler::OnPaint will
+  // contain the exact set of non-overlapping rectangles that changed instead of
+  // a single bounding rectangle, and only the pixel data inside those
+  // rectangles is guaranteed to be valid. The |buffer| argument will alternate
+  // between two pixel surfaces and the surface passed to one OnPaint call will
+  // not be modified until the next OnPaint call for the same element type has
+  // returned. This allows the client to upload or copy only the changed
+  // regions without CEF copying pixel data between frames.
+  ///
+  int windowless_partial_paint;
+
+  ///
+  // Frame pacing mode for a windowless browser. See cef_frame_pacing_mode_t
+  // for details. The default value is FRAME_PACING_FIXED.
+  ///
+  cef_frame_pacing_mode_t windowless_frame_pacing;
+
   // The below values map to WebPreferences settings.
 
   ///
@@ -945,12 +1074,13 @@ typedef enum {
 } cef_v8_propertyattribute_t;
 
 ///
-// Post data elements may represent either bytes or files.
+// Post data elements may represent bytes, files or streams.
 ///
 typedef enum {
   PDE_TYPE_EMPTY  = 0,
   PDE_TYPE_BYTES,
   PDE_TYPE_FILE,
+  PDE_TYPE_STREAM,
 } cef_postdataelement_type_t;
 
 ///
@@ -1176,6 +1306,15 @@ typedef enum {
   // originated in the browser process.
   ///
   UR_FLAG_NO_RETRY_ON_5XX           = 1 << 7,
+
+  ///
+  // If set response data will be copied into buffers from a recycled pool
+  // before being passed to CefURLRequestClient::OnDownloadData. This allows
+  // the network stack to continue reading while the client processes previous
+  // data and avoids a thread round trip for each read. This currently only
+  // applies for requests originated in the browser process.
+  ///
+  UR_FLAG_POOLED_DOWNLOAD_DATA      = 1 << 8,
 } cef_urlrequest_flags_t;
 
 ///
@@ -1396,6 +1535,45 @@ typedef struct _cef_screen_info_t {
   cef_rect_t available_rect;
 } cef_screen_info_t;
 
+///
+// Frame generation statistics for a windowless browser. Returned by
+// CefBrowserHost::GetWindowlessFrameStatistics.
+///
+typedef struct _cef_frame_statistics_t {
+  ///
+  // Number of frames delivered via CefRenderHandler::OnPaint.
+  ///
+  int64 frames_produced;
+
+  ///
+  // Number of BeginFrame requests sent to the renderer and number of those
+  // that did not produce new content. Only used with BeginFrame scheduling.
+  ///
+  int64 begin_frames;
+  int64 idle_begin_frames;
+
+  ///
+  // Number of frame capture requests that were coalesced into a later frame.
+  // Only used with GPU compositing.
+  ///
+  int64 coalesced_frames;
+
+  ///
+  // Number of frame captures that completed and number of times that frame
+  // capture failed and was retried. Only used with GPU compositing.
+  ///
+  int64 capture_count;
+  int64 capture_retries;
+
+  ///
+  // Time in milliseconds between requesting a frame capture and the pixel data
+  // becoming available for the most recent frame, and averaged over all
+  // |capture_count| captured frames. Only used with GPU compositing.
+  ///
+  double last_capture_latency_ms;
+  double average_capture_latency_ms;
+} cef_frame_statistics_t;
+
 ///
 // Supported menu IDs. Non-English translations can be provided for the
 // IDS_MENU_* strings in CefResourceBundleHandler::GetLocalizedString().
@@ -2299,6 +2477,25 @@ typedef enum {
   PLUGIN_POLICY_DISABLE,
 } cef_plugin_policy_t;
 
+///
+// Cookie serialization formats supported by CefCookieManager::ExportCookies.
+///
+typedef enum {
+  ///
+  // Compact binary format. The format is versioned but is otherwise private to
+  // CEF and should only be passed back to CefCookieManager::ImportCookies.
+  ///
+  COOKIE_FORMAT_BINARY,
+
+  ///
+  // JSON array containing one object per cookie. Each object has "name",
+  // "value", "domain" and "path" string members, "secure" and "httponly"
+  // boolean members, "creation" and "last_access" number members and an
+  // optional "expires" number member. Times are seconds since the epoch.
+  ///
+  COOKIE_FORMAT_JSON,
+} cef_cookie_format_t;
+
 #ifdef __cplusplus
 }
 #endif
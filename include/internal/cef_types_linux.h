@@ -60,6 +60,18 @@ extern "C" {
 // thread-safe and must only be accessed on the browser process UI thread.
 ///
 CEF_EXPORT XDisplay* cef_get_xdisplay();
+
+///
+// Return a file descriptor that becomes readable when CefDoMessageLoopWork()
+// should be called. Only valid when CefSettings.external_message_pump is true
+// (1); returns -1 otherwise or if called from a thread other than the browser
+// process UI thread. The descriptor can be added to an existing poll() or
+// GLib main loop in place of implementing
+// CefBrowserProcessHandler::OnScheduleMessagePumpWork(). It is reset by each
+// CefDoMessageLoopWork() call and must not be read from or closed by the
+// application.
+///
+CEF_EXPORT int cef_get_message_pump_fd();
 #define cef_text_input_context_t void*
 
 ///
@@ -356,6 +356,32 @@ class CefScreenInfo : public CefStructBase<CefScreenInfoTraits> {
 };
 
 
+struct CefFrameStatisticsTraits {
+  typedef cef_frame_statistics_t struct_type;
+
+  static inline void init(struct_type* s) {}
+
+  static inline void clear(struct_type* s) {}
+
+  static inline void set(const struct_type* src, struct_type* target,
+      bool copy) {
+    target->frames_produced = src->frames_produced;
+    target->begin_frames = src->begin_frames;
+    target->idle_begin_frames = src->idle_begin_frames;
+    target->coalesced_frames = src->coalesced_frames;
+    target->capture_count = src->capture_count;
+    target->capture_retries = src->capture_retries;
+    target->last_capture_latency_ms = src->last_capture_latency_ms;
+    target->average_capture_latency_ms = src->average_capture_latency_ms;
+  }
+};
+
+///
+// Class representing frame generation statistics for a windowless browser.
+///
+typedef CefStructBase<CefFrameStatisticsTraits> CefFrameStatistics;
+
+
 struct CefKeyEventTraits {
   typedef cef_key_event_t struct_type;
 
@@ -481,6 +507,7 @@ struct CefSettingsTraits {
         src->browser_subprocess_path.length,
         &target->browser_subprocess_path, copy);
     target->multi_threaded_message_loop = src->multi_threaded_message_loop;
+    target->external_message_pump = src->external_message_pump;
     target->windowless_rendering_enabled = src->windowless_rendering_enabled;
     target->command_line_args_disabled = src->command_line_args_disabled;
 
@@ -490,6 +517,9 @@ struct CefSettingsTraits {
         &target->user_data_path, copy);
     target->persist_session_cookies = src->persist_session_cookies;
     target->persist_user_preferences = src->persist_user_preferences;
+    target->cache_max_size = src->cache_max_size;
+    target->cache_in_memory = src->cache_in_memory;
+    target->memory_cache_max_size = src->memory_cache_max_size;
 
     cef_string_set(src->user_agent.str, src->user_agent.length,
         &target->user_agent, copy);
@@ -511,6 +541,8 @@ struct CefSettingsTraits {
     target->remote_debugging_port = src->remote_debugging_port;
     target->uncaught_exception_stack_size = src->uncaught_exception_stack_size;
     target->context_safety_implementation = src->context_safety_implementation;
+    target->process_message_shared_memory_threshold =
+        src->process_message_shared_memory_threshold;
     target->ignore_certificate_errors = src->ignore_certificate_errors;
     target->background_color = src->background_color;
 
@@ -543,6 +575,9 @@ struct CefRequestContextSettingsTraits {
         &target->cache_path, copy);
     target->persist_session_cookies = src->persist_session_cookies;
     target->persist_user_preferences = src->persist_user_preferences;
+    target->cache_max_size = src->cache_max_size;
+    target->cache_in_memory = src->cache_in_memory;
+    target->memory_cache_max_size = src->memory_cache_max_size;
     target->ignore_certificate_errors = src->ignore_certificate_errors;
     cef_string_set(src->accept_language_list.str,
         src->accept_language_list.length, &target->accept_language_list, copy);
@@ -577,6 +612,8 @@ struct CefBrowserSettingsTraits {
   static inline void set(const struct_type* src, struct_type* target,
       bool copy) {
     target->windowless_frame_rate = src->windowless_frame_rate;
+    target->windowless_partial_paint = src->windowless_partial_paint;
+    target->windowless_frame_pacing = src->windowless_frame_pacing;
 
     cef_string_set(src->standard_font_family.str,
         src->standard_font_family.length, &target->standard_font_family, copy);
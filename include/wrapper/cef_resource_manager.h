@@ -38,6 +38,8 @@
 #pragma once
 
 #include <list>
+#include <map>
+#include <string>
 
 #include "include/base/cef_macros.h"
 #include "include/base/cef_ref_counted.h"
@@ -73,6 +75,40 @@ class CefResourceManager :
   typedef base::Callback<std::string(
       const std::string& /*url*/)> MimeTypeResolver;
 
+  ///
+  // Used to check whether a cached response is still valid. Will be executed on
+  // the browser process FILE thread before the cached response is returned if
+  // it has not been validated within the interval specified via
+  // SetCacheValidationInterval. Return false to discard the cached response.
+  ///
+  typedef base::Callback<bool()> CacheValidator;
+
+  ///
+  // Response cache statistics. See GetCacheStatistics.
+  ///
+  struct CacheStatistics {
+    CacheStatistics()
+        : hit_count(0),
+          miss_count(0),
+          entry_count(0),
+          size(0) {
+    }
+
+    // Number of requests that were returned from the cache.
+    size_t hit_count;
+
+    // Number of requests that were not returned from the cache and whose
+    // response the provider allowed to be cached. Includes responses that were
+    // evicted or that failed validation.
+    size_t miss_count;
+
+    // Number of responses currently in the cache.
+    size_t entry_count;
+
+    // Total size in bytes of the response data currently in the cache.
+    size_t size;
+  };
+
  private:
   // Values that stay with a request as it moves between providers.
   struct RequestParams {
@@ -134,6 +170,16 @@ class CefResourceManager :
       return params_.mime_type_resolver_;
     }
 
+    ///
+    // Allow the response passed to the next call to Continue to be stored in
+    // the response cache. Has no effect if caching has not been enabled via
+    // CefResourceManager::SetCacheLimit or if the request is not a GET request.
+    // |validator| will be executed before the cached response is used. If
+    // |validator| is null the cached response will remain valid until evicted
+    // or until the set of providers changes. Must be called before Continue.
+    ///
+    void AllowCaching(const CefResourceManager::CacheValidator& validator);
+
     ///
     // Continue handling the request. If |handler| is non-NULL then no
     // additional providers will be called and the |handler| value will be
@@ -224,8 +270,10 @@ class CefResourceManager :
   // Add a provider that maps requests that start with |url_path| to files under
   // |directory_path|. |url_path| should include an origin and optional path
   // component only. Files will be loaded when a matching URL is requested.
-  // See comments on AddProvider for usage of the |order| and |identifier|
-  // parameters.
+  // Responses may be cached if enabled via SetCacheLimit. Cached responses are
+  // validated against the file modification time and size as configured via
+  // SetCacheValidationInterval. See comments on AddProvider for usage of the
+  // |order| and |identifier| parameters.
   ///
   void AddDirectoryProvider(const std::string& url_path,
                             const std::string& directory_path,
@@ -236,8 +284,9 @@ class CefResourceManager :
   // Add a provider that maps requests that start with |url_path| to files
   // stored in the archive file at |archive_path|. |url_path| should include an
   // origin and optional path component only. The archive file will be loaded
-  // when a matching URL is requested for the first time. See comments on
-  // AddProvider for usage of the |order| and |identifier| parameters.
+  // when a matching URL is requested for the first time. Responses may be
+  // cached if enabled via SetCacheLimit. See comments on AddProvider for usage
+  // of the |order| and |identifier| parameters.
   ///
   void AddArchiveProvider(const std::string& url_path,
                           const std::string& archive_path,
@@ -283,6 +332,37 @@ class CefResourceManager :
   ///
   void SetMimeTypeResolver(const MimeTypeResolver& resolver);
 
+  ///
+  // Set the maximum size in bytes of response data that will be kept in the
+  // in-memory response cache. Responses are keyed on the filtered URL,
+  // including the query component, and evicted in least recently used order.
+  // Only GET requests for which the provider called Request::AllowCaching will
+  // be cached. Cached responses that do not require validation are returned
+  // synchronously from OnBeforeResourceLoad without calling any providers.
+  // The cache will be cleared when providers are added or removed, or when the
+  // URL filter changes. Specify 0 (the default) to disable caching.
+  ///
+  void SetCacheLimit(size_t cache_limit);
+
+  ///
+  // Set the minimum time in milliseconds between executions of a cached
+  // response's CacheValidator. Within this interval the cached response will
+  // be returned without validation. Specify 0 to validate before each use. The
+  // default value is 1000.
+  ///
+  void SetCacheValidationInterval(int64 interval_ms);
+
+  ///
+  // Remove all responses from the response cache. Statistics are not reset.
+  ///
+  void ClearCache();
+
+  ///
+  // Returns statistics for the response cache. Must be called on the browser
+  // process IO thread.
+  ///
+  CacheStatistics GetCacheStatistics() const;
+
 
   // The below methods should be called from other CEF handlers. They must be
   // called exactly as documented for the manager to function correctly.
@@ -318,9 +398,13 @@ class CefResourceManager :
   struct ProviderEntry;
   typedef std::list<ProviderEntry*> ProviderEntryList;
 
+  // Index of providers by the URLs that they may handle.
+  class ProviderIndex;
+
   // Values associated with the pending request only. Ownership will be passed
   // between requests and the resource manager as request handling proceeds.
   struct RequestState {
+    RequestState();
     ~RequestState();
 
     base::WeakPtr<CefResourceManager> manager_;
@@ -338,8 +422,22 @@ class CefResourceManager :
 
     // Params that will be copied to each request object.
     RequestParams params_;
+
+    // Filtered URL including the query component. Used as the response cache
+    // key.
+    std::string cache_key_;
+
+    // True if the current provider allowed caching of its response.
+    bool cacheable_;
+    CacheValidator cache_validator_;
   };
 
+  // Response stored in the response cache.
+  struct CachedResponse;
+
+  // Resource handler that records the response for the response cache.
+  class CachingHandler;
+
   // Methods that manage request state between requests. Called on the browser
   // process IO thread.
   bool SendRequest(scoped_ptr<RequestState> state);
@@ -348,14 +446,50 @@ class CefResourceManager :
   void StopRequest(scoped_ptr<RequestState> state);
   bool IncrementProvider(RequestState* state);
   void DetachRequestFromProvider(RequestState* state);
-  void GetNextValidProvider(ProviderEntryList::iterator& iterator);
+  ProviderEntryList::iterator GetNextProvider(const std::string& url,
+                                              const ProviderEntry* after);
   void DeleteProvider(ProviderEntryList::iterator& iterator, bool stop);
 
+  // Methods that manage the response cache. Called on the browser process IO
+  // thread.
+  typedef std::list<std::string> CacheLRUList;
+  typedef std::map<std::string,
+                   std::pair<CefRefPtr<CachedResponse>,
+                             CacheLRUList::iterator> > CacheMap;
+  bool NeedsValidation(CefRefPtr<CachedResponse> response) const;
+  void UseCachedResponse(CacheMap::iterator it, uint64 request_id);
+  static void ValidateOnFileThread(base::WeakPtr<CefResourceManager> manager,
+                                   CefRefPtr<CachedResponse> response,
+                                   scoped_ptr<RequestState> state);
+  void ContinueAfterValidation(CefRefPtr<CachedResponse> response,
+                               bool valid,
+                               scoped_ptr<RequestState> state);
+  void AddCachedResponse(const std::string& cache_key,
+                         CefRefPtr<CachedResponse> response);
+  void RemoveCachedResponse(CacheMap::iterator it);
+  void EvictCachedResponses(size_t new_size);
+  void ClearCacheInternal();
+
+  // Add a provider that will only be called for |url|, or for URLs starting
+  // with |url| if |url_is_prefix| is true. If |url| is empty the provider will
+  // be called for all URLs.
+  void AddProviderInternal(Provider* provider,
+                           int order,
+                           const std::string& identifier,
+                           const std::string& url,
+                           bool url_is_prefix);
+
   // The below members are only accessed on the browser process IO thread.
 
   // List of providers including additional associated information.
   ProviderEntryList providers_;
 
+  // Index of |providers_| entries that are not pending deletion.
+  scoped_ptr<ProviderIndex> provider_index_;
+
+  // Used to order providers that share the same |order| value.
+  uint64 next_provider_sequence_;
+
   // Map of response ID to pending CefResourceHandler object.
   typedef std::map<uint64, CefRefPtr<CefResourceHandler> > PendingHandlersMap;
   PendingHandlersMap pending_handlers_;
@@ -363,6 +497,14 @@ class CefResourceManager :
   UrlFilter url_filter_;
   MimeTypeResolver mime_type_resolver_;
 
+  // Response cache. |cache_lru_| contains cache keys in most recently used
+  // order.
+  CacheMap cache_;
+  CacheLRUList cache_lru_;
+  size_t cache_limit_;
+  int64 cache_validation_interval_ms_;
+  CacheStatistics cache_statistics_;
+
   // Must be the last member. Created and accessed on the IO thread.
   scoped_ptr<base::WeakPtrFactory<CefResourceManager> > weak_ptr_factory_;
 
@@ -46,7 +46,8 @@
 class CefStreamReader;
 
 ///
-// Implementation of the CefResourceHandler class for reading from a CefStream.
+// Implementation of the CefResourceHandler class for reading from a CefStream
+// or from a CefResourceDataBlock.
 ///
 class CefStreamResourceHandler : public CefResourceHandler {
  public:
@@ -64,6 +65,23 @@ class CefStreamResourceHandler : public CefResourceHandler {
                            CefResponse::HeaderMap header_map,
                            CefRefPtr<CefStreamReader> stream);
 
+  ///
+  // Create a new object with default response values that returns the contents
+  // of |data_block| without copying it into an intermediate buffer.
+  ///
+  CefStreamResourceHandler(const CefString& mime_type,
+                           CefRefPtr<CefResourceDataBlock> data_block);
+
+  ///
+  // Create a new object with explicit response values that returns the
+  // contents of |data_block| without copying it into an intermediate buffer.
+  ///
+  CefStreamResourceHandler(int status_code,
+                           const CefString& status_text,
+                           const CefString& mime_type,
+                           CefResponse::HeaderMap header_map,
+                           CefRefPtr<CefResourceDataBlock> data_block);
+
   virtual ~CefStreamResourceHandler();
 
   // CefResourceHandler methods.
@@ -76,6 +94,7 @@ class CefStreamResourceHandler : public CefResourceHandler {
                             int bytes_to_read,
                             int& bytes_read,
                             CefRefPtr<CefCallback> callback) OVERRIDE;
+  virtual CefRefPtr<CefResourceDataBlock> GetResponseDataBlock() OVERRIDE;
   virtual void Cancel() OVERRIDE;
 
  private:
@@ -89,6 +108,11 @@ class CefStreamResourceHandler : public CefResourceHandler {
   const CefRefPtr<CefStreamReader> stream_;
   bool read_on_file_thread_;
 
+  // Used instead of |stream_| when reading from a data block.
+  const CefRefPtr<CefResourceDataBlock> data_block_;
+  size_t data_block_offset_;
+  bool data_block_returned_;
+
   class Buffer;
   scoped_ptr<Buffer> buffer_;
 #ifndef NDEBUG
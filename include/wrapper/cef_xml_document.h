@@ -0,0 +1,349 @@
+// Copyright (c) 2015 Marshall A. Greenblatt. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//    * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//    * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//    * Neither the name of Google Inc. nor the name Chromium Embedded
+// Framework nor the names of its contributors may be used to endorse
+// or promote products derived from this software without specific prior
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// ---------------------------------------------------------------------------
+//
+// The contents of this file are only available to applications that link
+// against the libcef_dll_wrapper target.
+//
+
+#ifndef CEF_INCLUDE_WRAPPER_CEF_XML_DOCUMENT_H_
+#define CEF_INCLUDE_WRAPPER_CEF_XML_DOCUMENT_H_
+#pragma once
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "include/base/cef_macros.h"
+#include "include/base/cef_ref_counted.h"
+#include "include/cef_base.h"
+
+class CefStreamReader;
+class CefXmlDocumentBuilder;
+
+///
+// Reference to a UTF-8 string that is owned by some other object. The string
+// is not NUL-terminated.
+///
+struct CefXmlStringRef {
+  CefXmlStringRef() : data(NULL), length(0) {}
+  CefXmlStringRef(const char* data, size_t length)
+      : data(data), length(length) {}
+
+  bool empty() const { return length == 0; }
+
+  bool Equals(const char* str, size_t str_length) const {
+    return length == str_length &&
+           (length == 0 || memcmp(data, str, length) == 0);
+  }
+  bool Equals(const char* str) const { return Equals(str, strlen(str)); }
+
+  std::string ToString() const { return std::string(data, length); }
+
+  const char* data;
+  size_t length;
+};
+
+///
+// Reference to an attribute name and value.
+///
+struct CefXmlAttributeRef {
+  CefXmlStringRef name;
+  CefXmlStringRef value;
+};
+
+///
+// Interface implemented by CefXmlSaxParser clients. Strings passed to these
+// methods are only valid for the duration of the call. Return false from any
+// method to stop parsing.
+///
+class CefXmlSaxHandler {
+ public:
+  virtual ~CefXmlSaxHandler() {}
+
+  ///
+  // Called for each element start tag. |attributes| contains
+  // |attribute_count| attributes in document order with entity references
+  // resolved.
+  ///
+  virtual bool OnStartElement(const CefXmlStringRef& name,
+                              const CefXmlAttributeRef* attributes,
+                              size_t attribute_count) =0;
+
+  ///
+  // Called for each element end tag. Also called immediately after
+  // OnStartElement() for empty elements (<a/>).
+  ///
+  virtual bool OnEndElement(const CefXmlStringRef& name) =0;
+
+  ///
+  // Called for character data, including CDATA sections, within the root
+  // element. Entity references are resolved and line endings are normalized.
+  // Adjacent text may be delivered via multiple calls.
+  ///
+  virtual bool OnText(const CefXmlStringRef& text) =0;
+};
+
+///
+// Non-validating push parser that reports the contents of a UTF-8 XML
+// document to a CefXmlSaxHandler as data arrives. This implementation
+// supports a restricted set of XML features:
+// <pre>
+// (1) Only UTF-8 (including ASCII) input is supported. The encoding named by
+//     the XML declaration is ignored.
+// (2) Processing instructions, comments and document type declarations are
+//     ignored. Entities declared by a document type declaration are not
+//     supported.
+// (3) Only the predefined entities (&lt; &gt; &amp; &apos; &quot;) and
+//     character references are resolved.
+// (4) Namespaces are not processed. Elements and attributes are reported
+//     using the qualified name (ie, namespace:localname).
+// </pre>
+// This class is not thread safe.
+///
+class CefXmlSaxParser {
+ public:
+  explicit CefXmlSaxParser(CefXmlSaxHandler* handler);
+  ~CefXmlSaxParser();
+
+  ///
+  // Parse the next |size| bytes of the document. Incomplete markup at the end
+  // of |data| is kept until more data arrives. Returns false if an error
+  // occurs.
+  ///
+  bool Push(const char* data, size_t size);
+
+  ///
+  // Signal that the whole document has been pushed. Returns false if an error
+  // occurs or the document is incomplete.
+  ///
+  bool Finish();
+
+  ///
+  // Push the entire contents of |stream| followed by Finish(). Returns false
+  // if an error occurs.
+  ///
+  bool Parse(CefRefPtr<CefStreamReader> stream);
+
+  ///
+  // Returns the error message and the line number where it occurred. The
+  // message will be empty if no error has occurred.
+  ///
+  const std::string& GetError() const { return error_; }
+  int GetLineNumber() const { return line_number_; }
+
+ private:
+  enum PrefixMatch {
+    PREFIX_MATCH,
+    PREFIX_NO_MATCH,
+    PREFIX_NEED_MORE,
+  };
+
+  // Parse as much of |buffer_| as possible. If |final| is true incomplete
+  // markup is an error.
+  bool ParseBuffer(bool final);
+
+  PrefixMatch MatchPrefix(const char* prefix, bool final) const;
+
+  // Find |terminator| at or after |from|. Remembers how far the search got so
+  // that the next search for the same token does not start over.
+  size_t FindTerminator(const char* terminator, size_t from);
+
+  // Find the '>' that ends the markup starting at |pos_| while skipping
+  // quoted values and, if |brackets| is true, bracketed sections. Returns
+  // std::string::npos if the markup is incomplete.
+  size_t FindTagEnd(bool brackets) const;
+
+  bool ParseStartTag(size_t end);
+  bool ParseEndTag(size_t end);
+  // Report the text between |begin| and |end|. Entity references are not
+  // resolved if |cdata| is true.
+  bool HandleText(size_t begin, size_t end, bool cdata);
+
+  // Append the contents of |data| to |output| with entity references resolved
+  // and line endings normalized. Whitespace is also normalized if
+  // |attribute| is true.
+  bool DecodeText(const char* data, size_t length, bool attribute,
+                  std::string* output);
+
+  // Advance |pos_| to |pos| and update the line number.
+  void Consume(size_t pos);
+
+  bool SetError(const std::string& error);
+
+  CefXmlSaxHandler* handler_;
+
+  // Unparsed document data starting at |pos_|.
+  std::string buffer_;
+  size_t pos_;
+  // Position where the last FindTerminator() search stopped.
+  size_t search_pos_;
+
+  // Qualified names of the open elements stored back to back, and the offset
+  // of each name.
+  std::string open_names_;
+  std::vector<size_t> open_name_offsets_;
+
+  // Reused for each start tag.
+  std::vector<CefXmlAttributeRef> attributes_;
+  std::vector<size_t> attribute_value_offsets_;
+  std::string attribute_values_;
+  // Reused for text that requires decoding.
+  std::string text_;
+
+  bool started_;
+  bool has_root_;
+  bool failed_;
+  int line_number_;
+  std::string error_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefXmlSaxParser);
+};
+
+///
+// Thread safe, immutable representation of an XML document. Unlike
+// CefXmlObject all elements, attributes and strings are stored in a small
+// number of large memory blocks owned by the document, element and attribute
+// names are interned, and no per-element reference counting or locking is
+// required. Element and string pointers are valid for the lifespan of the
+// document. The document is built using CefXmlSaxParser and has the same
+// restrictions. In addition, whitespace-only text is ignored and the value of
+// an element is the concatenation of its text, excluding the text of child
+// elements.
+///
+class CefXmlDocument : public base::RefCountedThreadSafe<CefXmlDocument> {
+ public:
+  ///
+  // An element in the document.
+  ///
+  class Element {
+   public:
+    const CefXmlStringRef& GetName() const { return name_; }
+
+    ///
+    // Returns the element's text value. The value will be empty if the
+    // element has no text.
+    ///
+    const CefXmlStringRef& GetValue() const { return value_; }
+
+    ///
+    // Access the element's attributes in document order.
+    ///
+    size_t GetAttributeCount() const { return attribute_count_; }
+    const CefXmlAttributeRef& GetAttribute(size_t index) const {
+      return attributes_[index];
+    }
+    bool HasAttribute(const char* name) const;
+    CefXmlStringRef GetAttributeValue(const char* name) const;
+
+    ///
+    // Access the element's parent and children. The root element has no
+    // parent.
+    ///
+    const Element* GetParent() const { return parent_; }
+    size_t GetChildCount() const { return child_count_; }
+    const Element* GetFirstChild() const { return first_child_; }
+    const Element* GetNextSibling() const { return next_sibling_; }
+
+    ///
+    // Find the first child or the next sibling with the specified name.
+    ///
+    const Element* FindChild(const char* name) const;
+    const Element* FindNextSibling(const char* name) const;
+
+   private:
+    friend class CefXmlDocumentBuilder;
+
+    CefXmlStringRef name_;
+    CefXmlStringRef value_;
+    const CefXmlAttributeRef* attributes_;
+    size_t attribute_count_;
+    const Element* parent_;
+    const Element* first_child_;
+    const Element* next_sibling_;
+    size_t child_count_;
+  };
+
+  ///
+  // Load the contents of the specified UTF-8 XML stream. Returns NULL and
+  // populates |loadError| if an error occurs.
+  ///
+  static CefRefPtr<CefXmlDocument> Load(CefRefPtr<CefStreamReader> stream,
+                                        CefString* loadError);
+
+  ///
+  // Returns the document's root element.
+  ///
+  const Element* GetRoot() const { return root_; }
+
+  ///
+  // Returns the interned copy of |name| or an empty string if no element or
+  // attribute in the document has that name. Interned names can be compared
+  // with element and attribute names by pointer.
+  ///
+  CefXmlStringRef GetInternedName(const char* name) const;
+
+  ///
+  // Returns the total number of elements in the document.
+  ///
+  size_t GetElementCount() const { return element_count_; }
+
+ private:
+  friend class CefXmlDocumentBuilder;
+  // Protect against accidental deletion of this object.
+  friend class base::RefCountedThreadSafe<CefXmlDocument>;
+
+  CefXmlDocument();
+  ~CefXmlDocument();
+
+  // Allocate |size| bytes that will be freed when the document is destroyed.
+  void* Allocate(size_t size);
+  CefXmlStringRef CopyString(const CefXmlStringRef& str);
+  CefXmlStringRef InternName(const CefXmlStringRef& name);
+
+  // Returns the slot in |name_table_| for |name|.
+  size_t FindNameSlot(const char* name, size_t length) const;
+
+  const Element* root_;
+  size_t element_count_;
+
+  std::vector<char*> blocks_;
+  char* block_pos_;
+  size_t block_remaining_;
+
+  // Open addressing hash table of interned names. The size is a power of 2.
+  std::vector<CefXmlStringRef> name_table_;
+  size_t name_count_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefXmlDocument);
+};
+
+#endif  // CEF_INCLUDE_WRAPPER_CEF_XML_DOCUMENT_H_
@@ -47,10 +47,10 @@
 class CefStreamReader;
 
 ///
-// Thread-safe class for accessing zip archive file contents. This class should
-// not be used with large archive files because all data will be resident in
-// memory at the same time. This implementation supports a restricted set of zip
-// archive features:
+// Thread-safe class for accessing zip archive file contents. Archives loaded
+// with Load() will have all data resident in memory at the same time. Use
+// LoadMapped() for large archive files. This implementation supports a
+// restricted set of zip archive features:
 // (1) All file names are stored and compared in lower case.
 // (2) File ordering from the original zip archive is not maintained. This
 //     means that files from the same folder may not be located together in the
@@ -98,6 +98,30 @@ class CefZipArchive : public base::RefCountedThreadSafe<CefZipArchive> {
               const CefString& password,
               bool overwriteExisting);
 
+  ///
+  // Load the zip archive file at |path| into this object without reading the
+  // file contents. Only the central directory is read and the archive file is
+  // memory mapped, so it must not be modified while this object or any File
+  // object obtained from it exists. Files stored without compression or
+  // encryption are read directly from the mapping. Other files are
+  // decompressed on first access and the result is kept in a least recently
+  // used cache limited by SetCacheLimit(). Data for a File object remains
+  // valid while a reference to that object is kept, even if it has been
+  // evicted from the cache. |password| and |overwriteExisting| behave the same
+  // as for Load(). ZIP64 archives are not supported. Returns the number of
+  // files successfully loaded.
+  ///
+  size_t LoadMapped(const CefString& path,
+                    const CefString& password,
+                    bool overwriteExisting);
+
+  ///
+  // Set the maximum number of bytes of decompressed data that will be cached
+  // for files loaded with LoadMapped(). Specify 0 to disable caching. The
+  // default limit is 32MB.
+  ///
+  void SetCacheLimit(size_t cache_limit);
+
   ///
   // Clears the contents of this object.
   ///
@@ -133,7 +157,11 @@ class CefZipArchive : public base::RefCountedThreadSafe<CefZipArchive> {
   friend class base::RefCountedThreadSafe<CefZipArchive>;
   ~CefZipArchive();
 
+  // Cache of decompressed data for files loaded with LoadMapped().
+  class DecompressedCache;
+
   FileMap contents_;
+  scoped_refptr<DecompressedCache> cache_;
 
   mutable base::Lock lock_;
 
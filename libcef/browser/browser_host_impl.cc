@@ -7,6 +7,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "libcef/browser/browser_context_impl.h"
 #include "libcef/browser/browser_info.h"
@@ -33,6 +34,7 @@
 #include "libcef/common/main_delegate.h"
 #include "libcef/common/process_message_impl.h"
 #include "libcef/common/request_impl.h"
+#include "libcef/common/string_chunker.h"
 
 #include "base/bind.h"
 #include "base/bind_helpers.h"
@@ -75,6 +77,10 @@
 
 namespace {
 
+// Maximum number of chunks that the renderer will send for a chunked string
+// request before waiting for the browser to process them.
+const int kMaxStringChunksInFlight = 2;
+
 // Manages the global list of Impl instances.
 class ImplManager {
  public:
@@ -1375,6 +1381,40 @@ void CefBrowserHostImpl::SetWindowlessFrameRate(int frame_rate) {
     view->UpdateFrameRate();
 }
 
+void CefBrowserHostImpl::SendExternalBeginFrame() {
+  if (!CEF_CURRENTLY_ON_UIT()) {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefBrowserHostImpl::SendExternalBeginFrame, this));
+    return;
+  }
+
+  if (!IsWindowless() || !web_contents())
+    return;
+
+  CefRenderWidgetHostViewOSR* view = GetOSRHostView(web_contents());
+  if (view)
+    view->SendExternalBeginFrame();
+}
+
+bool CefBrowserHostImpl::GetWindowlessFrameStatistics(
+    CefFrameStatistics& stats) {
+  // Verify that this method is being called on the UI thread.
+  if (!CEF_CURRENTLY_ON_UIT()) {
+    NOTREACHED() << "called on invalid thread";
+    return false;
+  }
+
+  if (!IsWindowless() || !web_contents())
+    return false;
+
+  CefRenderWidgetHostViewOSR* view = GetOSRHostView(web_contents());
+  if (!view)
+    return false;
+
+  stats = view->frame_statistics();
+  return true;
+}
+
 // CefBrowser methods.
 // -----------------------------------------------------------------------------
 
@@ -1540,11 +1580,15 @@ CefRefPtr<CefFrame> CefBrowserHostImpl::GetFrame(int64 identifier) {
 CefRefPtr<CefFrame> CefBrowserHostImpl::GetFrame(const CefString& name) {
   base::AutoLock lock_scope(state_lock_);
 
-  FrameMap::const_iterator it = frames_.begin();
-  for (; it != frames_.end(); ++it) {
-    if (it->second->GetName() == name)
-      return it->second.get();
-  }
+  FrameNameMap::const_iterator name_it = frame_names_.find(name);
+  if (name_it == frame_names_.end())
+    return NULL;
+
+  // Return the frame with the lowest id if multiple frames share the name.
+  DCHECK(!name_it->second.empty());
+  FrameMap::const_iterator it = frames_.find(*name_it->second.begin());
+  if (it != frames_.end())
+    return it->second.get();
 
   return NULL;
 }
@@ -1559,6 +1603,7 @@ void CefBrowserHostImpl::GetFrameIdentifiers(std::vector<int64>& identifiers) {
 
   if (identifiers.size() > 0)
     identifiers.clear();
+  identifiers.reserve(frames_.size());
 
   FrameMap::const_iterator it = frames_.begin();
   for (; it != frames_.end(); ++it)
@@ -1570,26 +1615,115 @@ void CefBrowserHostImpl::GetFrameNames(std::vector<CefString>& names) {
 
   if (names.size() > 0)
     names.clear();
+  names.reserve(frames_.size());
 
   FrameMap::const_iterator it = frames_.begin();
   for (; it != frames_.end(); ++it)
     names.push_back(it->second->GetName());
 }
 
+void CefBrowserHostImpl::GetFrames(std::vector<CefRefPtr<CefFrame> >& frames) {
+  base::AutoLock lock_scope(state_lock_);
+
+  if (frames.size() > 0)
+    frames.clear();
+  frames.reserve(frames_.size());
+
+  FrameMap::const_iterator it = frames_.begin();
+  for (; it != frames_.end(); ++it)
+    frames.push_back(it->second.get());
+}
+
 bool CefBrowserHostImpl::SendProcessMessage(
     CefProcessId target_process,
     CefRefPtr<CefProcessMessage> message) {
   DCHECK(message.get());
+  DCHECK_EQ(PID_RENDERER, target_process);
 
-  Cef_Request_Params params;
-  CefProcessMessageImpl* impl =
-      static_cast<CefProcessMessageImpl*>(message.get());
-  if (impl->CopyTo(params)) {
-    return SendProcessMessage(target_process, params.name, &params.arguments,
-                              true);
+#if defined(OS_WIN)
+  // Shared memory handles must be duplicated into the renderer process that
+  // exists when the message is sent, which is only known on the UI thread.
+  const bool defer = !CEF_CURRENTLY_ON_UIT() || queue_messages_;
+#else
+  const bool defer = CEF_CURRENTLY_ON_UIT() && queue_messages_;
+#endif
+  if (!defer)
+    return SendProcessMessageNow(message);
+
+  // |message| may be modified after this method returns so serialize it now.
+  // Large binary arguments are written to shared memory segments owned by
+  // this process a single time and the segments are shared with the renderer
+  // process when the message is sent.
+  scoped_ptr<Cef_Request_Params> params(new Cef_Request_Params());
+  if (!static_cast<CefProcessMessageImpl*>(message.get())->CopyTo(
+          *params, base::GetCurrentProcessHandle())) {
+    return false;
   }
+  params->frame_id = -1;
+  params->user_initiated = true;
+  params->request_id = -1;
+  params->expect_response = false;
 
-  return false;
+  if (CEF_CURRENTLY_ON_UIT())
+    return SendRequestParams(params.Pass());
+
+  CEF_POST_TASK(CEF_UIT,
+      base::Bind(base::IgnoreResult(&CefBrowserHostImpl::SendRequestParams),
+                 this, base::Passed(&params)));
+  return true;
+}
+
+bool CefBrowserHostImpl::SendProcessMessageNow(
+    CefRefPtr<CefProcessMessage> message) {
+  // Large binary arguments are transferred using shared memory. On Windows the
+  // handles must be duplicated into the renderer process which can only be
+  // retrieved on the UI thread.
+  base::ProcessHandle peer_process = base::kNullProcessHandle;
+#if defined(OS_WIN)
+  if (CEF_CURRENTLY_ON_UIT() && web_contents())
+    peer_process = web_contents()->GetRenderProcessHost()->GetHandle();
+#else
+  peer_process = base::GetCurrentProcessHandle();
+#endif
+
+  // The arguments are serialized in place when possible instead of being
+  // copied into |params| first. The message is locked until |send_params| is
+  // destroyed so only create the IPC message in this scope.
+  IPC::Message* ipc_message = NULL;
+  {
+    Cef_Request_Params params;
+    CefProcessMessageImpl::ScopedSendParams send_params(
+        static_cast<CefProcessMessageImpl*>(message.get()), peer_process,
+        &params);
+    if (!send_params.is_valid())
+      return false;
+
+    params.frame_id = -1;
+    params.user_initiated = true;
+    params.request_id = -1;
+    params.expect_response = false;
+    ipc_message = new CefMsg_Request(routing_id(), params);
+  }
+
+  return Send(ipc_message);
+}
+
+bool CefBrowserHostImpl::SendRequestParams(
+    scoped_ptr<Cef_Request_Params> params) {
+  CEF_REQUIRE_UIT();
+
+  if (queue_messages_) {
+    queued_messages_.push(QueuedMessage(params.release()));
+    return true;
+  }
+
+  base::ProcessHandle peer_process = base::kNullProcessHandle;
+  if (web_contents())
+    peer_process = web_contents()->GetRenderProcessHost()->GetHandle();
+  if (!CefProcessMessageImpl::ShareSharedBinaries(*params, peer_process))
+    return false;
+
+  return Send(new CefMsg_Request(routing_id(), *params));
 }
 
 
@@ -1625,12 +1759,20 @@ void CefBrowserHostImpl::DestroyBrowser() {
   }
 
   while (!queued_messages_.empty()) {
-    delete queued_messages_.front();
+    const QueuedMessage& queued = queued_messages_.front();
+    if (queued.request_params) {
+      CefProcessMessageImpl::ReleaseSharedBinaries(*queued.request_params);
+      delete queued.request_params;
+    } else {
+      delete queued.message;
+    }
     queued_messages_.pop();
   }
 
   g_manager.Get().RemoveImpl(this);
 
+  CancelStringChunksRequests(-1, MSG_ROUTING_NONE, false);
+
   registrar_.reset(NULL);
   response_manager_.reset(NULL);
   content::WebContentsObserver::Observe(NULL);
@@ -1891,6 +2033,53 @@ void CefBrowserHostImpl::SendCode(
   }
 }
 
+void CefBrowserHostImpl::SendStringChunksRequest(
+    int64 frame_id,
+    const std::string& command,
+    CefRefPtr<CefStringChunkVisitor> visitor) {
+  // Only known frame ids are supported.
+  DCHECK(frame_id > CefFrameHostImpl::kMainFrameId);
+  DCHECK(!command.empty());
+  DCHECK(visitor.get());
+
+  if (!CEF_CURRENTLY_ON_UIT()) {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefBrowserHostImpl::SendStringChunksRequest, this,
+                   frame_id, command, visitor));
+    return;
+  }
+
+  if (!response_manager_) {
+    // The browser has been destroyed.
+    visitor->OnComplete(false);
+    return;
+  }
+
+  TRACE_EVENT1("libcef", "CefBrowserHostImpl::SendStringChunksRequest",
+               "frame_id", frame_id);
+
+  Cef_Request_Params params;
+  params.name = "get-string-chunks";
+  params.frame_id = frame_id;
+  params.user_initiated = false;
+  params.request_id = response_manager_->GetNextRequestId();
+  params.expect_response = false;
+
+  params.arguments.AppendString(command);
+  params.arguments.AppendInteger(
+      static_cast<int>(CefStringChunker::kDefaultChunkSize));
+  params.arguments.AppendInteger(kMaxStringChunksInFlight);
+
+  content::RenderViewHost* render_view_host =
+      web_contents()->GetRenderViewHost();
+  StringChunksRequest& request = string_chunks_requests_[params.request_id];
+  request.visitor = visitor;
+  request.render_process_id = render_view_host->GetProcess()->GetID();
+  request.render_view_routing_id = render_view_host->GetRoutingID();
+
+  Send(new CefMsg_Request(routing_id(), params));
+}
+
 bool CefBrowserHostImpl::SendProcessMessage(CefProcessId target_process,
                                             const std::string& name,
                                             base::ListValue* arguments,
@@ -2700,13 +2889,32 @@ void CefBrowserHostImpl::RenderViewDeleted(
     registrar_->Remove(this, content::NOTIFICATION_FOCUS_CHANGED_IN_PAGE,
         content::Source<content::RenderViewHost>(render_view_host));
   }
+
+  // Chunks will no longer arrive from the deleted view.
+  CancelStringChunksRequests(render_view_host->GetProcess()->GetID(),
+                             render_view_host->GetRoutingID(), false);
+}
+
+void CefBrowserHostImpl::RenderViewHostChanged(
+    content::RenderViewHost* old_host,
+    content::RenderViewHost* new_host) {
+  // Chunks sent by a swapped out view may be discarded, so don't wait for
+  // them.
+  if (old_host) {
+    CancelStringChunksRequests(old_host->GetProcess()->GetID(),
+                               old_host->GetRoutingID(), true);
+  }
 }
 
 void CefBrowserHostImpl::RenderViewReady() {
   // Send the queued messages.
   queue_messages_ = false;
   while (!queued_messages_.empty()) {
-    Send(queued_messages_.front());
+    const QueuedMessage& queued = queued_messages_.front();
+    if (queued.request_params)
+      SendRequestParams(make_scoped_ptr(queued.request_params));
+    else
+      Send(queued.message);
     queued_messages_.pop();
   }
 
@@ -2720,6 +2928,10 @@ void CefBrowserHostImpl::RenderViewReady() {
 void CefBrowserHostImpl::RenderProcessGone(base::TerminationStatus status) {
   queue_messages_ = true;
 
+  // Chunks will no longer arrive for pending requests.
+  CancelStringChunksRequests(web_contents()->GetRenderProcessHost()->GetID(),
+                             MSG_ROUTING_NONE, false);
+
   cef_termination_status_t ts = TS_ABNORMAL_TERMINATION;
   if (status == base::TERMINATION_STATUS_PROCESS_WAS_KILLED)
     ts = TS_PROCESS_WAS_KILLED;
@@ -2799,6 +3011,7 @@ void CefBrowserHostImpl::FrameDeleted(
   const int64 frame_id = render_frame_host->GetRoutingID();
   FrameMap::iterator it = frames_.find(frame_id);
   if (it != frames_.end()) {
+    RemoveFrameName(it->second->GetName(), frame_id);
     it->second->Detach();
     frames_.erase(it);
   }
@@ -2853,6 +3066,7 @@ bool CefBrowserHostImpl::OnMessageReceived(const IPC::Message& message) {
     IPC_MESSAGE_HANDLER(CefHostMsg_Request, OnRequest)
     IPC_MESSAGE_HANDLER(CefHostMsg_Response, OnResponse)
     IPC_MESSAGE_HANDLER(CefHostMsg_ResponseAck, OnResponseAck)
+    IPC_MESSAGE_HANDLER(CefHostMsg_StringChunk, OnStringChunk)
     IPC_MESSAGE_UNHANDLED(handled = false)
   IPC_END_MESSAGE_MAP()
   return handled;
@@ -2869,7 +3083,7 @@ void CefBrowserHostImpl::OnWebContentsFocused() {
 bool CefBrowserHostImpl::Send(IPC::Message* message) {
   if (CEF_CURRENTLY_ON_UIT()) {
     if (queue_messages_) {
-      queued_messages_.push(message);
+      queued_messages_.push(QueuedMessage(message));
       return true;
     } else {
       return content::WebContentsObserver::Send(message);
@@ -2933,6 +3147,20 @@ void CefBrowserHostImpl::OnRequest(const Cef_Request_Params& params) {
   bool expect_response_ack = false;
 
   if (params.user_initiated) {
+    // Map binary arguments that were transferred using shared memory. On
+    // Windows the handles are duplicated from the renderer process.
+    base::ProcessHandle source_process = base::kNullProcessHandle;
+#if defined(OS_WIN)
+    source_process = web_contents()->GetRenderProcessHost()->GetHandle();
+#endif
+    if (!CefProcessMessageImpl::MapSharedBinaries(
+            const_cast<Cef_Request_Params&>(params), source_process)) {
+      // The renderer sent shared memory parameters that are inconsistent with
+      // the message. Drop the message and terminate the renderer.
+      web_contents()->GetRenderProcessHost()->ShutdownForBadMessage();
+      return;
+    }
+
     // Give the user a chance to handle the request.
     if (client_.get()) {
       CefRefPtr<CefProcessMessageImpl> message(
@@ -2970,6 +3198,83 @@ void CefBrowserHostImpl::OnResponseAck(int request_id) {
   response_manager_->RunAckHandler(request_id);
 }
 
+void CefBrowserHostImpl::OnStringChunk(int request_id,
+                                       const std::string& chunk,
+                                       bool last,
+                                       bool success) {
+  StringChunksRequestMap::iterator it =
+      string_chunks_requests_.find(request_id);
+  if (it == string_chunks_requests_.end()) {
+    // The request was canceled and this chunk was already in flight.
+    return;
+  }
+
+  CefRefPtr<CefStringChunkVisitor> visitor = it->second.visitor;
+
+  bool keep_going = true;
+  if (success && (!chunk.empty() || last))
+    keep_going = visitor->VisitChunk(chunk);
+
+  // The request may have been canceled while |visitor| was executing.
+  if (string_chunks_requests_.find(request_id) ==
+      string_chunks_requests_.end()) {
+    return;
+  }
+
+  if (last || !keep_going) {
+    if (!last)
+      SendStringChunkAck(request_id, true);
+    string_chunks_requests_.erase(request_id);
+    visitor->OnComplete(last && success && keep_going);
+    return;
+  }
+
+  // Request the next chunk.
+  SendStringChunkAck(request_id, false);
+}
+
+void CefBrowserHostImpl::SendStringChunkAck(int request_id, bool cancel) {
+  StringChunksRequestMap::const_iterator it =
+      string_chunks_requests_.find(request_id);
+  DCHECK(it != string_chunks_requests_.end());
+
+  // Send directly to the render view that received the request. It may not be
+  // the current render view.
+  content::RenderProcessHost* host =
+      content::RenderProcessHost::FromID(it->second.render_process_id);
+  if (host) {
+    host->Send(new CefMsg_StringChunkAck(it->second.render_view_routing_id,
+                                         request_id, cancel));
+  }
+}
+
+void CefBrowserHostImpl::CancelStringChunksRequests(int render_process_id,
+                                                    int render_view_routing_id,
+                                                    bool send_cancel) {
+  std::vector<CefRefPtr<CefStringChunkVisitor> > visitors;
+
+  StringChunksRequestMap::iterator it = string_chunks_requests_.begin();
+  while (it != string_chunks_requests_.end()) {
+    const StringChunksRequest& request = it->second;
+    if (render_process_id == -1 ||
+        (request.render_process_id == render_process_id &&
+         (render_view_routing_id == MSG_ROUTING_NONE ||
+          request.render_view_routing_id == render_view_routing_id))) {
+      if (send_cancel)
+        SendStringChunkAck(it->first, true);
+      visitors.push_back(request.visitor);
+      string_chunks_requests_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+
+  // Execute the visitors after the map is updated because they may start new
+  // requests.
+  for (size_t i = 0; i < visitors.size(); ++i)
+    visitors[i]->OnComplete(false);
+}
+
 
 // content::NotificationObserver methods.
 // -----------------------------------------------------------------------------
@@ -3104,6 +3409,7 @@ CefRefPtr<CefFrame> CefBrowserHostImpl::GetOrCreateFrame(
           if (name.empty())
             name = it->second->GetName();
 
+          RemoveFrameName(it->second->GetName(), main_frame_id_);
           it->second->Detach();
           frames_.erase(it);
         }
@@ -3124,6 +3430,14 @@ CefRefPtr<CefFrame> CefBrowserHostImpl::GetOrCreateFrame(
                                    parent_frame_id);
       frame_created = true;
       frames_.insert(std::make_pair(frame_id, frame));
+      AddFrameName(name, frame_id);
+    } else if (!name.empty()) {
+      // SetAttributes will only change the name if the new name is non-empty.
+      const CefString& old_name = frame->GetName();
+      if (old_name != name) {
+        RemoveFrameName(old_name, frame_id);
+        AddFrameName(name, frame_id);
+      }
     }
   }
 
@@ -3141,6 +3455,7 @@ void CefBrowserHostImpl::DetachAllFrames() {
 
     frames = frames_;
     frames_.clear();
+    frame_names_.clear();
 
     if (main_frame_id_ != CefFrameHostImpl::kInvalidFrameId)
       main_frame_id_ = CefFrameHostImpl::kInvalidFrameId;
@@ -3153,6 +3468,22 @@ void CefBrowserHostImpl::DetachAllFrames() {
     it->second->Detach();
 }
 
+void CefBrowserHostImpl::AddFrameName(const CefString& name, int64 frame_id) {
+  state_lock_.AssertAcquired();
+  frame_names_[name].insert(frame_id);
+}
+
+void CefBrowserHostImpl::RemoveFrameName(const CefString& name,
+                                         int64 frame_id) {
+  state_lock_.AssertAcquired();
+  FrameNameMap::iterator it = frame_names_.find(name);
+  if (it == frame_names_.end())
+    return;
+  it->second.erase(frame_id);
+  if (it->second.empty())
+    frame_names_.erase(it);
+}
+
 void CefBrowserHostImpl::SetFocusedFrame(int64 frame_id) {
   CefRefPtr<CefFrameHostImpl> unfocused_frame;
   CefRefPtr<CefFrameHostImpl> focused_frame;
@@ -9,6 +9,7 @@
 
 #include <map>
 #include <queue>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -199,6 +200,8 @@ class CefBrowserHostImpl : public CefBrowserHost,
   void NotifyMoveOrResizeStarted() override;
   int GetWindowlessFrameRate() override;
   void SetWindowlessFrameRate(int frame_rate) override;
+  void SendExternalBeginFrame() override;
+  bool GetWindowlessFrameStatistics(CefFrameStatistics& stats) override;
   CefTextInputContext GetNSTextInputContext() override;
   void HandleKeyEventBeforeTextInputClient(CefEventHandle keyEvent) override;
   void HandleKeyEventAfterTextInputClient(CefEventHandle keyEvent) override;
@@ -233,6 +236,7 @@ class CefBrowserHostImpl : public CefBrowserHost,
   size_t GetFrameCount() override;
   void GetFrameIdentifiers(std::vector<int64>& identifiers) override;
   void GetFrameNames(std::vector<CefString>& names) override;
+  void GetFrames(std::vector<CefRefPtr<CefFrame> >& frames) override;
   bool SendProcessMessage(
       CefProcessId target_process,
       CefRefPtr<CefProcessMessage> message) override;
@@ -287,6 +291,11 @@ class CefBrowserHostImpl : public CefBrowserHost,
                 const std::string& script_url, int script_start_line,
                 CefRefPtr<CefResponseManager::Handler> responseHandler);
 
+  // Send a request to the renderer for the result of a "GetSource" or "GetText"
+  // command delivered in chunks to |visitor|.
+  void SendStringChunksRequest(int64 frame_id, const std::string& command,
+                               CefRefPtr<CefStringChunkVisitor> visitor);
+
   bool SendProcessMessage(CefProcessId target_process,
                           const std::string& name,
                           base::ListValue* arguments,
@@ -454,6 +463,9 @@ class CefBrowserHostImpl : public CefBrowserHost,
       content::RenderViewHost* render_view_host) override;
   void RenderViewDeleted(
       content::RenderViewHost* render_view_host) override;
+  void RenderViewHostChanged(
+      content::RenderViewHost* old_host,
+      content::RenderViewHost* new_host) override;
   void RenderViewReady() override;
   void RenderProcessGone(base::TerminationStatus status) override;
   void DidCommitProvisionalLoadForFrame(
@@ -487,6 +499,12 @@ class CefBrowserHostImpl : public CefBrowserHost,
  private:
   class DevToolsWebContentsObserver;
 
+  // Serialize |message| and send it to the current renderer process.
+  bool SendProcessMessageNow(CefRefPtr<CefProcessMessage> message);
+  // Send |params| that were serialized by SendProcessMessage() for later
+  // delivery. Must be called on the UI thread.
+  bool SendRequestParams(scoped_ptr<Cef_Request_Params> params);
+
   static CefRefPtr<CefBrowserHostImpl> CreateInternal(
       const CefWindowInfo& window_info,
       const CefBrowserSettings& settings,
@@ -510,6 +528,23 @@ class CefBrowserHostImpl : public CefBrowserHost,
   void OnRequest(const Cef_Request_Params& params);
   void OnResponse(const Cef_Response_Params& params);
   void OnResponseAck(int request_id);
+  void OnStringChunk(int request_id,
+                     const std::string& chunk,
+                     bool last,
+                     bool success);
+
+  // Send a CefMsg_StringChunkAck to the render view that is sending chunks for
+  // |request_id|.
+  void SendStringChunkAck(int request_id, bool cancel);
+
+  // Complete pending chunked string requests with failure. If
+  // |render_process_id| is -1 all requests will be completed. Otherwise, only
+  // requests sent to that process will be completed and if
+  // |render_view_routing_id| is not MSG_ROUTING_NONE only requests sent to that
+  // render view. The render view is notified when |send_cancel| is true.
+  void CancelStringChunksRequests(int render_process_id,
+                                  int render_view_routing_id,
+                                  bool send_cancel);
 
   // content::NotificationObserver methods.
   void Observe(int type,
@@ -533,6 +568,10 @@ class CefBrowserHostImpl : public CefBrowserHost,
                                        const GURL& frame_url);
   // Remove the references to all frames and mark them as detached.
   void DetachAllFrames();
+  // Add or remove |frame_id| from the |frame_names_| index. Must be called
+  // with |state_lock_| held.
+  void AddFrameName(const CefString& name, int64 frame_id);
+  void RemoveFrameName(const CefString& name, int64 frame_id);
 
 #if defined(OS_WIN)
   static LPCTSTR GetWndClass();
@@ -652,12 +691,31 @@ class CefBrowserHostImpl : public CefBrowserHost,
   // Messages we queue while waiting for the RenderView to be ready. We queue
   // them here instead of in the RenderProcessHost to ensure that they're sent
   // after the CefRenderViewObserver has been created on the renderer side.
-  std::queue<IPC::Message*> queued_messages_;
+  // Process messages are serialized when they are queued but shared memory
+  // handles are only shared with the renderer process when the queue is
+  // flushed.
+  struct QueuedMessage {
+    explicit QueuedMessage(IPC::Message* message)
+        : message(message),
+          request_params(NULL) {}
+    explicit QueuedMessage(Cef_Request_Params* request_params)
+        : message(NULL),
+          request_params(request_params) {}
+
+    IPC::Message* message;
+    Cef_Request_Params* request_params;
+  };
+  std::queue<QueuedMessage> queued_messages_;
   bool queue_messages_;
 
   // Map of unique frame ids to CefFrameHostImpl references.
   typedef std::map<int64, CefRefPtr<CefFrameHostImpl> > FrameMap;
   FrameMap frames_;
+  // Map of frame names to the ids of frames with that name. Kept in sync with
+  // |frames_| so that frames can be found by name without visiting every
+  // frame.
+  typedef std::map<CefString, std::set<int64> > FrameNameMap;
+  FrameNameMap frame_names_;
   // The unique frame id currently identified as the main frame.
   int64 main_frame_id_;
   // The unique frame id currently identified as the focused frame.
@@ -694,6 +752,19 @@ class CefBrowserHostImpl : public CefBrowserHost,
   // Manages response registrations.
   scoped_ptr<CefResponseManager> response_manager_;
 
+  // Pending chunked string request. Acks are sent to the render view that
+  // received the request even if it's no longer the current render view.
+  struct StringChunksRequest {
+    CefRefPtr<CefStringChunkVisitor> visitor;
+    int render_process_id;
+    int render_view_routing_id;
+  };
+
+  // Pending chunked string requests keyed by request id. Only accessed on the
+  // UI thread.
+  typedef std::map<int, StringChunksRequest> StringChunksRequestMap;
+  StringChunksRequestMap string_chunks_requests_;
+
   // Used for creating and managing JavaScript dialogs.
   scoped_ptr<CefJavaScriptDialogManager> dialog_manager_;
 
@@ -10,29 +10,38 @@
 
 // CefBrowserInfo::RenderIDManager
 
-CefBrowserInfo::RenderIDManager::RenderIDManager(base::Lock* lock)
-  : lock_(lock) {
+CefBrowserInfo::RenderIDManager::RenderIDManager(base::Lock* lock,
+                                                 CefBrowserInfo* browser_info,
+                                                 bool is_guest)
+  : lock_(lock),
+    browser_info_(browser_info),
+    is_guest_(is_guest) {
   DCHECK(lock);
+  DCHECK(browser_info);
 }
 
 void CefBrowserInfo::RenderIDManager::add_render_view_id(
     int render_process_id, int render_routing_id) {
-  add_render_id(&render_view_id_set_, render_process_id, render_routing_id);
+  add_render_id(&render_view_id_set_, view_id_type(), render_process_id,
+                render_routing_id);
 }
 
 void CefBrowserInfo::RenderIDManager::add_render_frame_id(
     int render_process_id, int render_routing_id) {
-  add_render_id(&render_frame_id_set_, render_process_id, render_routing_id);
+  add_render_id(&render_frame_id_set_, frame_id_type(), render_process_id,
+                render_routing_id);
 }
 
 void CefBrowserInfo::RenderIDManager::remove_render_view_id(
     int render_process_id, int render_routing_id) {
-  remove_render_id(&render_view_id_set_, render_process_id, render_routing_id);
+  remove_render_id(&render_view_id_set_, view_id_type(), render_process_id,
+                   render_routing_id);
 }
 
 void CefBrowserInfo::RenderIDManager::remove_render_frame_id(
     int render_process_id, int render_routing_id) {
-  remove_render_id(&render_frame_id_set_, render_process_id, render_routing_id);
+  remove_render_id(&render_frame_id_set_, frame_id_type(), render_process_id,
+                   render_routing_id);
 }
 
 bool CefBrowserInfo::RenderIDManager::is_render_view_id_match(
@@ -49,9 +58,11 @@ bool CefBrowserInfo::RenderIDManager::is_render_frame_id_match(
                             render_routing_id);
 }
 
-void CefBrowserInfo::RenderIDManager::add_render_id(RenderIdSet* id_set,
-                                                    int render_process_id,
-                                                    int render_routing_id) {
+void CefBrowserInfo::RenderIDManager::add_render_id(
+    RenderIdSet* id_set,
+    CefBrowserInfoIndex::IDType type,
+    int render_process_id,
+    int render_routing_id) {
   DCHECK_GT(render_process_id, 0);
   DCHECK_GT(render_routing_id, 0);
 
@@ -65,11 +76,18 @@ void CefBrowserInfo::RenderIDManager::add_render_id(RenderIdSet* id_set,
   }
 
   id_set->insert(std::make_pair(render_process_id, render_routing_id));
+
+  if (browser_info_->index_) {
+    browser_info_->index_->Add(type, render_process_id, render_routing_id,
+                               browser_info_);
+  }
 }
 
-void CefBrowserInfo::RenderIDManager::remove_render_id(RenderIdSet* id_set,
-                                                       int render_process_id,
-                                                       int render_routing_id) {
+void CefBrowserInfo::RenderIDManager::remove_render_id(
+    RenderIdSet* id_set,
+    CefBrowserInfoIndex::IDType type,
+    int render_process_id,
+    int render_routing_id) {
   DCHECK_GT(render_process_id, 0);
   DCHECK_GT(render_routing_id, 0);
 
@@ -82,6 +100,11 @@ void CefBrowserInfo::RenderIDManager::remove_render_id(RenderIdSet* id_set,
   bool erased = id_set->erase(
       std::make_pair(render_process_id, render_routing_id)) != 0;
   DCHECK(erased);
+
+  if (erased && browser_info_->index_) {
+    browser_info_->index_->Remove(type, render_process_id, render_routing_id,
+                                  browser_info_);
+  }
 }
 
 bool CefBrowserInfo::RenderIDManager::is_render_id_match(
@@ -98,6 +121,44 @@ bool CefBrowserInfo::RenderIDManager::is_render_id_match(
   return (it != id_set->end());
 }
 
+void CefBrowserInfo::RenderIDManager::AddAllToIndex(
+    CefBrowserInfoIndex* index) {
+  lock_->AssertAcquired();
+
+  RenderIdSet::const_iterator it = render_view_id_set_.begin();
+  for (; it != render_view_id_set_.end(); ++it)
+    index->Add(view_id_type(), it->first, it->second, browser_info_);
+
+  it = render_frame_id_set_.begin();
+  for (; it != render_frame_id_set_.end(); ++it)
+    index->Add(frame_id_type(), it->first, it->second, browser_info_);
+}
+
+void CefBrowserInfo::RenderIDManager::RemoveAllFromIndex(
+    CefBrowserInfoIndex* index) {
+  lock_->AssertAcquired();
+
+  RenderIdSet::const_iterator it = render_view_id_set_.begin();
+  for (; it != render_view_id_set_.end(); ++it)
+    index->Remove(view_id_type(), it->first, it->second, browser_info_);
+
+  it = render_frame_id_set_.begin();
+  for (; it != render_frame_id_set_.end(); ++it)
+    index->Remove(frame_id_type(), it->first, it->second, browser_info_);
+}
+
+CefBrowserInfoIndex::IDType
+    CefBrowserInfo::RenderIDManager::view_id_type() const {
+  return is_guest_ ? CefBrowserInfoIndex::GUEST_RENDER_VIEW :
+                     CefBrowserInfoIndex::RENDER_VIEW;
+}
+
+CefBrowserInfoIndex::IDType
+    CefBrowserInfo::RenderIDManager::frame_id_type() const {
+  return is_guest_ ? CefBrowserInfoIndex::GUEST_RENDER_FRAME :
+                     CefBrowserInfoIndex::RENDER_FRAME;
+}
+
 
 // CefBrowserInfo
 
@@ -105,12 +166,14 @@ CefBrowserInfo::CefBrowserInfo(int browser_id, bool is_popup)
     : browser_id_(browser_id),
       is_popup_(is_popup),
       is_windowless_(false),
-      render_id_manager_(&lock_),
-      guest_render_id_manager_(&lock_) {
+      render_id_manager_(&lock_, this, false),
+      guest_render_id_manager_(&lock_, this, true),
+      index_(NULL) {
   DCHECK_GT(browser_id, 0);
 }
 
 CefBrowserInfo::~CefBrowserInfo() {
+  DCHECK(!index_);
 }
 
 void CefBrowserInfo::set_windowless(bool windowless) {
@@ -126,3 +189,21 @@ void CefBrowserInfo::set_browser(CefRefPtr<CefBrowserHostImpl> browser) {
   base::AutoLock lock_scope(lock_);
   browser_ = browser;
 }
+
+void CefBrowserInfo::set_index(CefBrowserInfoIndex* index) {
+  base::AutoLock lock_scope(lock_);
+  if (index_ == index)
+    return;
+
+  if (index_) {
+    render_id_manager_.RemoveAllFromIndex(index_);
+    guest_render_id_manager_.RemoveAllFromIndex(index_);
+  }
+
+  index_ = index;
+
+  if (index_) {
+    render_id_manager_.AddAllToIndex(index_);
+    guest_render_id_manager_.AddAllToIndex(index_);
+  }
+}
@@ -9,6 +9,7 @@
 #include <set>
 
 #include "include/internal/cef_ptr.h"
+#include "libcef/browser/browser_info_index.h"
 
 #include "base/memory/ref_counted.h"
 #include "base/synchronization/lock.h"
@@ -25,7 +26,9 @@ class CefBrowserInfo : public base::RefCountedThreadSafe<CefBrowserInfo> {
  public:
   class RenderIDManager {
    public:
-    explicit RenderIDManager(base::Lock* lock);
+    RenderIDManager(base::Lock* lock,
+                    CefBrowserInfo* browser_info,
+                    bool is_guest);
 
     // Adds an ID pair if it doesn't already exist.
     void add_render_view_id(int render_process_id, int render_routing_id);
@@ -42,17 +45,30 @@ class CefBrowserInfo : public base::RefCountedThreadSafe<CefBrowserInfo> {
    private:
     typedef std::set<std::pair<int, int> > RenderIdSet;
 
+    friend class CefBrowserInfo;
+
     void add_render_id(RenderIdSet* id_set,
+                       CefBrowserInfoIndex::IDType type,
                        int render_process_id,
                        int render_routing_id);
     void remove_render_id(RenderIdSet* id_set,
+                          CefBrowserInfoIndex::IDType type,
                           int render_process_id,
                           int render_routing_id);
     bool is_render_id_match(const RenderIdSet* id_set,
                             int render_process_id,
                             int render_routing_id);
 
+    // Add or remove all ID pairs from |index|. Called with |lock_| held.
+    void AddAllToIndex(CefBrowserInfoIndex* index);
+    void RemoveAllFromIndex(CefBrowserInfoIndex* index);
+
+    CefBrowserInfoIndex::IDType view_id_type() const;
+    CefBrowserInfoIndex::IDType frame_id_type() const;
+
     base::Lock* lock_;
+    CefBrowserInfo* browser_info_;
+    bool is_guest_;
 
     // The below members must be protected by |lock_|.
 
@@ -91,6 +107,12 @@ class CefBrowserInfo : public base::RefCountedThreadSafe<CefBrowserInfo> {
   CefRefPtr<CefBrowserHostImpl> browser();
   void set_browser(CefRefPtr<CefBrowserHostImpl> browser);
 
+  // Associates this object with |index|. All existing and future render ID
+  // pairs will be reflected in |index| until this method is called again with
+  // a NULL value. Called by CefContentBrowserClient when this object is added
+  // to or removed from the browser info list.
+  void set_index(CefBrowserInfoIndex* index);
+
  private:
   friend class base::RefCountedThreadSafe<CefBrowserInfo>;
 
@@ -107,6 +129,10 @@ class CefBrowserInfo : public base::RefCountedThreadSafe<CefBrowserInfo> {
   RenderIDManager render_id_manager_;
   RenderIDManager guest_render_id_manager_;
 
+  // May be NULL if this object is not currently registered with
+  // CefContentBrowserClient.
+  CefBrowserInfoIndex* index_;
+
   // May be NULL if the browser has not yet been created or if the browser has
   // been destroyed.
   CefRefPtr<CefBrowserHostImpl> browser_;
@@ -0,0 +1,96 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#include "libcef/browser/browser_info_index.h"
+
+#include "libcef/browser/browser_info.h"
+
+#include "base/logging.h"
+
+CefBrowserInfoIndex::CefBrowserInfoIndex() {
+  for (int i = 0; i < ID_TYPE_COUNT; ++i)
+    snapshots_[i] = new InfoMapSnapshot();
+}
+
+CefBrowserInfoIndex::~CefBrowserInfoIndex() {
+}
+
+void CefBrowserInfoIndex::Add(IDType type,
+                              int render_process_id,
+                              int render_routing_id,
+                              CefBrowserInfo* browser_info) {
+  DCHECK(browser_info);
+  const int64 key = MakeKey(render_process_id, render_routing_id);
+
+  base::AutoLock write_lock_scope(write_lock_);
+
+  scoped_refptr<InfoMapSnapshot> current = GetSnapshot(type);
+  InfoMap::const_iterator it = current->data.find(key);
+  if (it != current->data.end() && it->second.get() == browser_info)
+    return;
+
+  scoped_refptr<InfoMapSnapshot> updated = new InfoMapSnapshot(current->data);
+  updated->data[key] = browser_info;
+
+  {
+    base::AutoLock lock_scope(lock_);
+    snapshots_[type].swap(updated);
+  }
+
+  // |updated| now holds the previous snapshot. It will be destroyed outside of
+  // |lock_| when the last reader releases it.
+}
+
+void CefBrowserInfoIndex::Remove(IDType type,
+                                 int render_process_id,
+                                 int render_routing_id,
+                                 CefBrowserInfo* browser_info) {
+  DCHECK(browser_info);
+  const int64 key = MakeKey(render_process_id, render_routing_id);
+
+  base::AutoLock write_lock_scope(write_lock_);
+
+  scoped_refptr<InfoMapSnapshot> current = GetSnapshot(type);
+  InfoMap::const_iterator it = current->data.find(key);
+  if (it == current->data.end() || it->second.get() != browser_info)
+    return;
+
+  scoped_refptr<InfoMapSnapshot> updated = new InfoMapSnapshot(current->data);
+  updated->data.erase(key);
+
+  {
+    base::AutoLock lock_scope(lock_);
+    snapshots_[type].swap(updated);
+  }
+}
+
+scoped_refptr<CefBrowserInfo> CefBrowserInfoIndex::Find(
+    IDType type,
+    int render_process_id,
+    int render_routing_id) const {
+  scoped_refptr<InfoMapSnapshot> snapshot = GetSnapshot(type);
+  if (snapshot->data.empty())
+    return NULL;
+
+  InfoMap::const_iterator it =
+      snapshot->data.find(MakeKey(render_process_id, render_routing_id));
+  if (it != snapshot->data.end())
+    return it->second;
+  return NULL;
+}
+
+// static
+int64 CefBrowserInfoIndex::MakeKey(int render_process_id,
+                                   int render_routing_id) {
+  return (static_cast<int64>(render_process_id) << 32) |
+         static_cast<uint32>(render_routing_id);
+}
+
+scoped_refptr<CefBrowserInfoIndex::InfoMapSnapshot>
+    CefBrowserInfoIndex::GetSnapshot(IDType type) const {
+  DCHECK_GE(type, 0);
+  DCHECK_LT(type, ID_TYPE_COUNT);
+  base::AutoLock lock_scope(lock_);
+  return snapshots_[type];
+}
@@ -0,0 +1,80 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_BROWSER_BROWSER_INFO_INDEX_H_
+#define CEF_LIBCEF_BROWSER_BROWSER_INFO_INDEX_H_
+#pragma once
+
+#include "base/basictypes.h"
+#include "base/containers/hash_tables.h"
+#include "base/memory/ref_counted.h"
+#include "base/synchronization/lock.h"
+
+class CefBrowserInfo;
+
+// Maps render (process_id, routing_id) pairs to the associated CefBrowserInfo.
+// The index is updated by CefBrowserInfo::RenderIDManager whenever an ID pair
+// is added or removed and is queried by CefContentBrowserClient.
+//
+// The index is read far more often (on the IO thread for every IPC message and
+// resource request) than it is written (on the UI thread when views and frames
+// are created or destroyed). Each ID type is therefore stored as an immutable
+// snapshot. Readers only hold |lock_| long enough to take a reference to the
+// current snapshot and perform the lookup without holding any lock. Writers
+// copy the snapshot, apply the change and swap the new snapshot in.
+//
+// This object is thread safe.
+class CefBrowserInfoIndex {
+ public:
+  enum IDType {
+    RENDER_VIEW = 0,
+    RENDER_FRAME,
+    GUEST_RENDER_VIEW,
+    GUEST_RENDER_FRAME,
+    ID_TYPE_COUNT,
+  };
+
+  CefBrowserInfoIndex();
+  ~CefBrowserInfoIndex();
+
+  // Associate the ID pair with |browser_info|. Any existing association for
+  // the ID pair will be replaced.
+  void Add(IDType type,
+           int render_process_id,
+           int render_routing_id,
+           CefBrowserInfo* browser_info);
+
+  // Remove the association for the ID pair if it currently refers to
+  // |browser_info|.
+  void Remove(IDType type,
+              int render_process_id,
+              int render_routing_id,
+              CefBrowserInfo* browser_info);
+
+  // Returns the CefBrowserInfo associated with the ID pair or an empty pointer
+  // if no association exists.
+  scoped_refptr<CefBrowserInfo> Find(IDType type,
+                                     int render_process_id,
+                                     int render_routing_id) const;
+
+ private:
+  typedef base::hash_map<int64, scoped_refptr<CefBrowserInfo> > InfoMap;
+  typedef base::RefCountedData<InfoMap> InfoMapSnapshot;
+
+  static int64 MakeKey(int render_process_id, int render_routing_id);
+
+  // Returns a reference to the current snapshot for |type|.
+  scoped_refptr<InfoMapSnapshot> GetSnapshot(IDType type) const;
+
+  // Serializes writers. Always acquired before |lock_|.
+  base::Lock write_lock_;
+
+  // Protects swapping and acquiring references to |snapshots_|.
+  mutable base::Lock lock_;
+  scoped_refptr<InfoMapSnapshot> snapshots_[ID_TYPE_COUNT];
+
+  DISALLOW_COPY_AND_ASSIGN(CefBrowserInfoIndex);
+};
+
+#endif  // CEF_LIBCEF_BROWSER_BROWSER_INFO_INDEX_H_
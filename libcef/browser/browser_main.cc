@@ -65,6 +65,9 @@ CefBrowserMainParts::~CefBrowserMainParts() {
 
 void CefBrowserMainParts::PreMainMessageLoopStart() {
   if (!base::MessageLoop::current()) {
+    // Use an external message pump if requested by the application.
+    InitExternalMessagePumpFactoryForUI();
+
     // Create the browser message loop.
     message_loop_.reset(new CefBrowserMessageLoop());
     message_loop_->set_thread_name("CrBrowserMain");
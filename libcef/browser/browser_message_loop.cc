@@ -3,7 +3,285 @@
 // be found in the LICENSE file.
 
 #include "libcef/browser/browser_message_loop.h"
+#include "libcef/browser/context.h"
+#include "libcef/browser/thread_util.h"
+#include "libcef/common/content_client.h"
+
+#if defined(OS_LINUX)
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+
+#include "base/message_loop/message_pump.h"
 #include "base/run_loop.h"
+#include "base/synchronization/lock.h"
+#include "base/synchronization/waitable_event.h"
+
+#if defined(OS_LINUX)
+#include "base/posix/eintr_wrapper.h"
+#endif
+
+namespace {
+
+// Maximum amount of time that a single CefDoMessageLoopWork() call will spend
+// performing work before returning control to the application.
+const int64 kMaxTimeSliceMs = 10;
+
+// Message pump that does not run its own event loop. Work is performed only
+// when the application calls CefDoMessageLoopWork(). The application is
+// notified via CefBrowserProcessHandler::OnScheduleMessagePumpWork() and, on
+// Linux, via a pollable file descriptor when that should next happen. Nested
+// run loops (modal dialogs, menus) block in Run() until Quit() is called.
+class MessagePumpExternal : public base::MessagePump {
+ public:
+  explicit MessagePumpExternal(CefRefPtr<CefBrowserProcessHandler> handler);
+  ~MessagePumpExternal() override;
+
+  // Returns the pump for the current process or NULL if the external message
+  // pump is not in use. Only accessed on the UI thread.
+  static MessagePumpExternal* Get();
+
+  // Called at the start of each CefDoMessageLoopWork() call. The next Run()
+  // call will return when its time slice expires.
+  void WillDoMessageLoopWork();
+
+#if defined(OS_LINUX)
+  int fd() const { return timer_fd_; }
+#endif
+
+  // base::MessagePump methods.
+  void Run(Delegate* delegate) override;
+  void Quit() override;
+  void ScheduleWork() override;
+  void ScheduleDelayedWork(const base::TimeTicks& delayed_work_time) override;
+
+ private:
+  // Notify the application that CefDoMessageLoopWork() should be called after
+  // |delay_ms|. May be called on any thread.
+  void NotifyScheduleWork(int64 delay_ms);
+
+#if defined(OS_LINUX)
+  // Make |timer_fd_| readable after |delay_ms| unless it will already become
+  // readable earlier. May be called on any thread.
+  void ArmTimer(int64 delay_ms);
+  // Make |timer_fd_| non-readable.
+  void DisarmTimer();
+#endif
+
+  CefRefPtr<CefBrowserProcessHandler> handler_;
+
+  // Signaled when work is scheduled so that nested run loops can block while
+  // idle.
+  base::WaitableEvent event_;
+
+  // Only accessed on the UI thread.
+  bool keep_running_;
+  bool time_slice_pending_;
+  int run_depth_;
+
+#if defined(OS_LINUX)
+  // timerfd that becomes readable when work should be performed.
+  int timer_fd_;
+
+  base::Lock timer_lock_;
+  // Time when |timer_fd_| will become readable. Null if the timer is not
+  // armed. Protected by |timer_lock_|.
+  base::TimeTicks timer_time_;
+#endif
+
+  DISALLOW_COPY_AND_ASSIGN(MessagePumpExternal);
+};
+
+MessagePumpExternal* g_external_pump = NULL;
+
+MessagePumpExternal::MessagePumpExternal(
+    CefRefPtr<CefBrowserProcessHandler> handler)
+    : handler_(handler),
+      event_(false, false),
+      keep_running_(true),
+      time_slice_pending_(false),
+      run_depth_(0) {
+#if defined(OS_LINUX)
+  timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  PCHECK(timer_fd_ >= 0) << "timerfd_create failed";
+#endif
+
+  DCHECK(!g_external_pump);
+  g_external_pump = this;
+}
+
+MessagePumpExternal::~MessagePumpExternal() {
+  DCHECK_EQ(g_external_pump, this);
+  g_external_pump = NULL;
+
+#if defined(OS_LINUX)
+  close(timer_fd_);
+#endif
+}
+
+// static
+MessagePumpExternal* MessagePumpExternal::Get() {
+  return g_external_pump;
+}
+
+void MessagePumpExternal::WillDoMessageLoopWork() {
+  time_slice_pending_ = true;
+#if defined(OS_LINUX)
+  // Pending work will be performed now. The timer is armed again before
+  // returning if work remains.
+  DisarmTimer();
+#endif
+}
+
+void MessagePumpExternal::Run(Delegate* delegate) {
+  // Only the Run() call started by CefDoMessageLoopWork() is limited to a time
+  // slice. Nested run loops must not return until Quit() is called.
+  const bool use_time_slice = time_slice_pending_;
+  time_slice_pending_ = false;
+
+  // Save the state so that nested Run calls behave correctly.
+  const bool keep_running = keep_running_;
+  keep_running_ = true;
+  run_depth_++;
+
+  const base::TimeTicks start = base::TimeTicks::Now();
+  const base::TimeDelta max_time_slice =
+      base::TimeDelta::FromMilliseconds(kMaxTimeSliceMs);
+
+  base::TimeTicks next_delayed_work_time;
+  bool more_work = false;
+
+  for (;;) {
+    next_delayed_work_time = base::TimeTicks();
+
+    more_work = delegate->DoWork();
+    if (!keep_running_)
+      break;
+
+    more_work |= delegate->DoDelayedWork(&next_delayed_work_time);
+    if (!keep_running_)
+      break;
+
+    if (more_work) {
+      if (use_time_slice && base::TimeTicks::Now() - start >= max_time_slice)
+        break;
+      continue;
+    }
+
+    // A RunUntilIdle() call, including the one started by
+    // CefDoMessageLoopWork(), calls Quit() from DoIdleWork().
+    more_work = delegate->DoIdleWork();
+    if (!keep_running_)
+      break;
+    if (more_work)
+      continue;
+
+    // Block until work is scheduled or the next delayed work is due.
+    if (next_delayed_work_time.is_null()) {
+      event_.Wait();
+    } else {
+      const base::TimeDelta delay =
+          next_delayed_work_time - base::TimeTicks::Now();
+      if (delay > base::TimeDelta())
+        event_.TimedWait(delay);
+    }
+  }
+
+  keep_running_ = keep_running;
+  run_depth_--;
+
+  if (run_depth_ == 0) {
+    // Tell the application when it next needs to call CefDoMessageLoopWork().
+    // Immediate work posted from other threads during this call has already
+    // been reported via ScheduleWork().
+    if (more_work)
+      NotifyScheduleWork(0);
+    else if (!next_delayed_work_time.is_null())
+      ScheduleDelayedWork(next_delayed_work_time);
+  }
+}
+
+void MessagePumpExternal::Quit() {
+  keep_running_ = false;
+}
+
+void MessagePumpExternal::ScheduleWork() {
+  // May be called on any thread.
+  event_.Signal();
+  NotifyScheduleWork(0);
+}
+
+void MessagePumpExternal::ScheduleDelayedWork(
+    const base::TimeTicks& delayed_work_time) {
+  // Delayed work added while running will be picked up by the
+  // DoDelayedWork() calls in Run() and reported before it returns.
+  if (run_depth_ > 0)
+    return;
+
+  // Round up so that the application does not call CefDoMessageLoopWork()
+  // before the work is due.
+  const base::TimeDelta delay = delayed_work_time - base::TimeTicks::Now();
+  NotifyScheduleWork(std::max(static_cast<int64>(0),
+                              delay.InMillisecondsRoundedUp()));
+}
+
+void MessagePumpExternal::NotifyScheduleWork(int64 delay_ms) {
+#if defined(OS_LINUX)
+  ArmTimer(delay_ms);
+#endif
+  if (handler_.get())
+    handler_->OnScheduleMessagePumpWork(delay_ms);
+}
+
+#if defined(OS_LINUX)
+void MessagePumpExternal::ArmTimer(int64 delay_ms) {
+  base::AutoLock lock_scope(timer_lock_);
+
+  const base::TimeTicks time =
+      base::TimeTicks::Now() + base::TimeDelta::FromMilliseconds(delay_ms);
+  if (!timer_time_.is_null() && timer_time_ <= time)
+    return;
+  timer_time_ = time;
+
+  // A zero expiration would disarm the timer so use the smallest delay instead.
+  struct itimerspec spec = {};
+  spec.it_value.tv_sec = delay_ms / base::Time::kMillisecondsPerSecond;
+  spec.it_value.tv_nsec =
+      (delay_ms % base::Time::kMillisecondsPerSecond) *
+      base::Time::kNanosecondsPerMillisecond;
+  if (spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0)
+    spec.it_value.tv_nsec = 1;
+  PCHECK(timerfd_settime(timer_fd_, 0, &spec, NULL) == 0);
+}
+
+void MessagePumpExternal::DisarmTimer() {
+  base::AutoLock lock_scope(timer_lock_);
+  timer_time_ = base::TimeTicks();
+
+  struct itimerspec spec = {};
+  PCHECK(timerfd_settime(timer_fd_, 0, &spec, NULL) == 0);
+
+  // Consume any expiration that has already made the descriptor readable.
+  uint64_t expirations;
+  ignore_result(HANDLE_EINTR(read(timer_fd_, &expirations,
+                                  sizeof(expirations))));
+}
+#endif  // defined(OS_LINUX)
+
+CefRefPtr<CefBrowserProcessHandler> GetBrowserProcessHandler() {
+  CefRefPtr<CefApp> app = CefContentClient::Get()->application();
+  if (app.get())
+    return app->GetBrowserProcessHandler();
+  return NULL;
+}
+
+scoped_ptr<base::MessagePump> CreateMessagePumpForUI() {
+  return make_scoped_ptr(new MessagePumpExternal(GetBrowserProcessHandler()));
+}
+
+}  // namespace
 
 CefBrowserMessageLoop::CefBrowserMessageLoop() {
 }
@@ -19,6 +297,10 @@ CefBrowserMessageLoop* CefBrowserMessageLoop::current() {
 }
 
 void CefBrowserMessageLoop::DoMessageLoopIteration() {
+  MessagePumpExternal* external_pump = MessagePumpExternal::Get();
+  if (external_pump)
+    external_pump->WillDoMessageLoopWork();
+
   base::RunLoop run_loop;
   run_loop.RunUntilIdle();
 }
@@ -26,3 +308,28 @@ void CefBrowserMessageLoop::DoMessageLoopIteration() {
 void CefBrowserMessageLoop::RunMessageLoop() {
   Run();
 }
+
+void InitExternalMessagePumpFactoryForUI() {
+  const CefSettings& settings = CefContext::Get()->settings();
+  if (!settings.external_message_pump || settings.multi_threaded_message_loop)
+    return;
+
+#if !defined(OS_LINUX)
+  // On Linux the application may use cef_get_message_pump_fd() instead.
+  if (!GetBrowserProcessHandler().get()) {
+    LOG(ERROR) << "external_message_pump requires a CefBrowserProcessHandler";
+    return;
+  }
+#endif
+
+  base::MessageLoop::InitMessagePumpForUIFactory(&CreateMessagePumpForUI);
+}
+
+#if defined(OS_LINUX)
+CEF_EXPORT int cef_get_message_pump_fd() {
+  if (!CEF_CURRENTLY_ON(CEF_UIT))
+    return -1;
+  MessagePumpExternal* external_pump = MessagePumpExternal::Get();
+  return external_pump ? external_pump->fd() : -1;
+}
+#endif
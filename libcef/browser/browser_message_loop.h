@@ -30,4 +30,9 @@ class CefBrowserMessageLoop : public base::MessageLoopForUI {
   DISALLOW_COPY_AND_ASSIGN(CefBrowserMessageLoop);
 };
 
+// Install a factory that creates an external message pump for the browser
+// process UI message loop if CefSettings.external_message_pump is enabled. Must
+// be called before the CefBrowserMessageLoop is created.
+void InitExternalMessagePumpFactoryForUI();
+
 #endif  // CEF_LIBCEF_BROWSER_BROWSER_MESSAGE_LOOP_H_
@@ -4,7 +4,9 @@
 
 #include "libcef/browser/browser_urlrequest_impl.h"
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #include "libcef/browser/browser_context.h"
 #include "libcef/browser/content_browser_client.h"
@@ -16,13 +18,16 @@
 #include "libcef/common/response_impl.h"
 
 #include "base/logging.h"
+#include "base/memory/weak_ptr.h"
 #include "base/message_loop/message_loop.h"
 #include "base/strings/string_util.h"
+#include "base/task_runner_util.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/common/url_fetcher.h"
 #include "net/base/io_buffer.h"
 #include "net/base/load_flags.h"
 #include "net/base/net_errors.h"
+#include "net/base/upload_data_stream.h"
 #include "net/http/http_request_headers.h"
 #include "net/http/http_response_headers.h"
 #include "net/url_request/url_fetcher.h"
@@ -116,9 +121,272 @@ class NET_EXPORT CefURLFetcherResponseWriter :
   DISALLOW_COPY_AND_ASSIGN(CefURLFetcherResponseWriter);
 };
 
+// Maximum number of buffers that may be in use by the client thread at any
+// time for UR_FLAG_POOLED_DOWNLOAD_DATA requests.
+const size_t kMaxPooledBuffers = 4;
+
+// Initial size of pooled buffers. Matches the URLFetcher read size so that
+// buffers are not normally reallocated.
+const int kPooledBufferSize = 4096;
+
+// Response writer used with UR_FLAG_POOLED_DOWNLOAD_DATA. Data is copied into
+// a recycled buffer and delivered to the client thread without waiting for
+// the client to process it. Writes only wait for the client thread when all
+// buffers are in use.
+class CefPooledURLFetcherResponseWriter :
+    public net::URLFetcherResponseWriter {
+ public:
+  CefPooledURLFetcherResponseWriter(
+      CefRefPtr<CefBrowserURLRequest> url_request,
+      scoped_refptr<base::SequencedTaskRunner> task_runner)
+      : url_request_(url_request),
+        task_runner_(task_runner),
+        in_use_count_(0),
+        pending_num_bytes_(0),
+        weak_ptr_factory_(this) {
+  }
+
+  // net::URLFetcherResponseWriter methods.
+  int Initialize(const net::CompletionCallback& callback) override {
+    return net::OK;
+  }
+
+  int Write(net::IOBuffer* buffer,
+            int num_bytes,
+            const net::CompletionCallback& callback) override {
+    if (!url_request_.get())
+      return num_bytes;
+
+    if (in_use_count_ >= kMaxPooledBuffers) {
+      // Wait for the client thread to return a buffer.
+      DCHECK(pending_callback_.is_null());
+      pending_buffer_ = buffer;
+      pending_num_bytes_ = num_bytes;
+      pending_callback_ = callback;
+      return net::ERR_IO_PENDING;
+    }
+
+    PostToClientThread(buffer, num_bytes);
+    return num_bytes;
+  }
+
+  int Finish(const net::CompletionCallback& callback) override {
+    if (url_request_.get())
+      url_request_ = NULL;
+    return net::OK;
+  }
+
+ private:
+  void PostToClientThread(net::IOBuffer* buffer, int num_bytes) {
+    scoped_refptr<net::IOBufferWithSize> pooled_buffer;
+    if (!free_buffers_.empty() && free_buffers_.back()->size() >= num_bytes) {
+      pooled_buffer = free_buffers_.back();
+      free_buffers_.pop_back();
+    } else {
+      pooled_buffer =
+          new net::IOBufferWithSize(std::max(num_bytes, kPooledBufferSize));
+    }
+    memcpy(pooled_buffer->data(), buffer->data(), num_bytes);
+    in_use_count_++;
+
+    task_runner_->PostTask(FROM_HERE,
+        base::Bind(&CefPooledURLFetcherResponseWriter::WriteOnClientThread,
+                   url_request_, pooled_buffer, num_bytes,
+                   base::MessageLoop::current()->task_runner(),
+                   weak_ptr_factory_.GetWeakPtr()));
+  }
+
+  static void WriteOnClientThread(
+      CefRefPtr<CefBrowserURLRequest> url_request,
+      scoped_refptr<net::IOBufferWithSize> buffer,
+      int num_bytes,
+      scoped_refptr<base::SequencedTaskRunner> source_task_runner,
+      base::WeakPtr<CefPooledURLFetcherResponseWriter> writer) {
+    CefRefPtr<CefURLRequestClient> client = url_request->GetClient();
+    if (client.get())
+      client->OnDownloadData(url_request.get(), buffer->data(), num_bytes);
+
+    source_task_runner->PostTask(FROM_HERE,
+        base::Bind(&CefPooledURLFetcherResponseWriter::ReleaseBuffer,
+                   writer, buffer));
+  }
+
+  void ReleaseBuffer(scoped_refptr<net::IOBufferWithSize> buffer) {
+    DCHECK_GT(in_use_count_, 0U);
+    in_use_count_--;
+    if (free_buffers_.size() < kMaxPooledBuffers)
+      free_buffers_.push_back(buffer);
+
+    if (!pending_callback_.is_null()) {
+      // Continue the write that was waiting for a buffer.
+      scoped_refptr<net::IOBuffer> pending_buffer;
+      pending_buffer.swap(pending_buffer_);
+      const int num_bytes = pending_num_bytes_;
+      net::CompletionCallback callback = pending_callback_;
+      pending_callback_.Reset();
+
+      PostToClientThread(pending_buffer.get(), num_bytes);
+      callback.Run(num_bytes);
+    }
+  }
+
+  CefRefPtr<CefBrowserURLRequest> url_request_;
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+
+  std::vector<scoped_refptr<net::IOBufferWithSize> > free_buffers_;
+  size_t in_use_count_;
+
+  // Write that is waiting for a buffer to be returned.
+  scoped_refptr<net::IOBuffer> pending_buffer_;
+  int pending_num_bytes_;
+  net::CompletionCallback pending_callback_;
+
+  base::WeakPtrFactory<CefPooledURLFetcherResponseWriter> weak_ptr_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefPooledURLFetcherResponseWriter);
+};
+
+// Moves |writer| to |offset|. Returns a net error code.
+int SeekStreamWriter(CefRefPtr<CefStreamWriter> writer, int64 offset) {
+  if (writer->Tell() == offset)
+    return net::OK;
+  if (writer->Seek(offset, SEEK_SET) != 0)
+    return net::ERR_FAILED;
+  return net::OK;
+}
+
+// Writes |num_bytes| from |buffer| to |writer|. Returns the number of bytes
+// written or a net error code.
+int WriteStreamWriter(CefRefPtr<CefStreamWriter> writer,
+                      scoped_refptr<net::IOBuffer> buffer,
+                      int num_bytes) {
+  const size_t bytes_written = writer->Write(buffer->data(), 1, num_bytes);
+  if (bytes_written == 0)
+    return net::ERR_FAILED;
+  return static_cast<int>(bytes_written);
+}
+
+// Flushes |writer|. Returns a net error code.
+int FlushStreamWriter(CefRefPtr<CefStreamWriter> writer) {
+  if (writer->Flush() != 0)
+    return net::ERR_FAILED;
+  return net::OK;
+}
+
+// Response writer that writes data to the CefStreamWriter returned from
+// CefURLRequestClient::GetDownloadStreamWriter. Writers that may block are
+// accessed on the FILE thread.
+class CefStreamURLFetcherResponseWriter :
+    public net::URLFetcherResponseWriter {
+ public:
+  explicit CefStreamURLFetcherResponseWriter(
+      CefRefPtr<CefStreamWriter> writer)
+      : writer_(writer),
+        start_offset_(writer->Tell()),
+        weak_ptr_factory_(this) {
+  }
+
+  // net::URLFetcherResponseWriter methods.
+  int Initialize(const net::CompletionCallback& callback) override {
+    // Return to the starting position in case the request is being retried.
+    return RunOnWriterThread(
+        base::Bind(&SeekStreamWriter, writer_, start_offset_), callback);
+  }
+
+  int Write(net::IOBuffer* buffer,
+            int num_bytes,
+            const net::CompletionCallback& callback) override {
+    return RunOnWriterThread(
+        base::Bind(&WriteStreamWriter, writer_, make_scoped_refptr(buffer),
+                   num_bytes),
+        callback);
+  }
+
+  int Finish(const net::CompletionCallback& callback) override {
+    return RunOnWriterThread(base::Bind(&FlushStreamWriter, writer_),
+                             callback);
+  }
+
+ private:
+  // Runs |task| immediately if the writer will not block. Otherwise runs
+  // |task| on the FILE thread and returns ERR_IO_PENDING.
+  int RunOnWriterThread(const base::Callback<int(void)>& task,
+                        const net::CompletionCallback& callback) {
+    if (!writer_->MayBlock())
+      return task.Run();
+
+    base::PostTaskAndReplyWithResult(
+        BrowserThread::GetMessageLoopProxyForThread(BrowserThread::FILE).get(),
+        FROM_HERE, task,
+        base::Bind(&CefStreamURLFetcherResponseWriter::OnTaskCompleted,
+                   weak_ptr_factory_.GetWeakPtr(), callback));
+    return net::ERR_IO_PENDING;
+  }
+
+  void OnTaskCompleted(const net::CompletionCallback& callback, int result) {
+    callback.Run(result);
+  }
+
+  CefRefPtr<CefStreamWriter> writer_;
+  const int64 start_offset_;
+  base::WeakPtrFactory<CefStreamURLFetcherResponseWriter> weak_ptr_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefStreamURLFetcherResponseWriter);
+};
+
 base::SupportsUserData::Data* CreateURLRequestUserData(
-    CefRefPtr<CefURLRequestClient> client) {
-  return new CefURLRequestUserData(client);
+    CefRefPtr<CefURLRequestClient> client,
+    CefRefPtr<CefPostData> post_data) {
+  return new CefURLRequestUserData(client, post_data);
+}
+
+// Returns true if |post_data| contains any non-empty elements.
+bool HasUploadData(CefRefPtr<CefPostData> post_data) {
+  CefPostData::ElementVector elements;
+  post_data->GetElements(elements);
+  CefPostData::ElementVector::const_iterator it = elements.begin();
+  for (; it != elements.end(); ++it) {
+    if ((*it)->GetType() != PDE_TYPE_EMPTY)
+      return true;
+  }
+  return false;
+}
+
+// Returns the total size of |post_data| or 0 if the size is not known in
+// advance.
+int64 GetUploadDataSize(CefRefPtr<CefPostData> post_data) {
+  CefPostData::ElementVector elements;
+  post_data->GetElements(elements);
+
+  int64 size = 0;
+  CefPostData::ElementVector::const_iterator it = elements.begin();
+  for (; it != elements.end(); ++it) {
+    switch ((*it)->GetType()) {
+      case PDE_TYPE_BYTES:
+        size += (*it)->GetBytesCount();
+        break;
+      case PDE_TYPE_FILE:
+        // The remainder of the file is used if the length is -1.
+        if ((*it)->GetFileLength() < 0)
+          return 0;
+        size += (*it)->GetFileLength();
+        break;
+      case PDE_TYPE_STREAM:
+        size += (*it)->GetStreamLength();
+        break;
+      case PDE_TYPE_EMPTY:
+        break;
+    }
+  }
+  return size;
+}
+
+// Called on the IO thread each time the request is sent. Bytes elements are
+// referenced without copying because the request is read-only.
+scoped_ptr<net::UploadDataStream> CreateUploadDataStream(
+    CefRefPtr<CefPostData> post_data) {
+  return make_scoped_ptr(
+      static_cast<CefPostDataImpl*>(post_data.get())->Get());
 }
 
 }  // namespace
@@ -249,38 +517,19 @@ class CefBrowserURLRequest::Context
     int64 upload_data_size = 0;
 
     CefRefPtr<CefPostData> post_data = request_->GetPostData();
+    if (post_data.get() && !HasUploadData(post_data))
+      post_data = NULL;
     if (post_data.get()) {
-      CefPostData::ElementVector elements;
-      post_data->GetElements(elements);
-      if (elements.size() == 1) {
-        // Default to URL encoding if not specified.
-        if (content_type.empty())
-          content_type = "application/x-www-form-urlencoded";
-
-        CefPostDataElementImpl* impl =
-            static_cast<CefPostDataElementImpl*>(elements[0].get());
-
-        switch (elements[0]->GetType())
-          case PDE_TYPE_BYTES: {
-            upload_data_size = impl->GetBytesCount();
-            fetcher_->SetUploadData(content_type,
-                std::string(static_cast<char*>(impl->GetBytes()),
-                            upload_data_size));
-            break;
-          case PDE_TYPE_FILE:
-            fetcher_->SetUploadFilePath(
-                content_type, 
-                base::FilePath(impl->GetFile()),
-                0, kuint64max,
-                content::BrowserThread::GetMessageLoopProxyForThread(
-                    content::BrowserThread::FILE).get());
-            break;
-          case PDE_TYPE_EMPTY:
-            break;
-        }
-      } else if (elements.size() > 1) {
-        NOTIMPLEMENTED() << " multi-part form data is not supported";
-      }
+      // Default to URL encoding if not specified.
+      if (content_type.empty())
+        content_type = "application/x-www-form-urlencoded";
+
+      upload_data_size = GetUploadDataSize(post_data);
+
+      // The upload data stream reads each element incrementally when the
+      // request is sent and may be created again if the request is resent.
+      fetcher_->SetUploadStreamFactory(content_type,
+          base::Bind(&CreateUploadDataStream, post_data));
     }
 
     std::string first_party_for_cookies = request_->GetFirstPartyForCookies();
@@ -314,11 +563,19 @@ class CefBrowserURLRequest::Context
 
     fetcher_->SetURLRequestUserData(
         CefURLRequestUserData::kUserDataKey,
-        base::Bind(&CreateURLRequestUserData, client_));
+        base::Bind(&CreateURLRequestUserData, client_, post_data));
 
     scoped_ptr<net::URLFetcherResponseWriter> response_writer;
-    if (cef_flags & UR_FLAG_NO_DOWNLOAD_DATA) {
+    CefRefPtr<CefStreamWriter> stream_writer =
+        client_->GetDownloadStreamWriter(url_request_.get());
+    if (stream_writer.get()) {
+      response_writer.reset(
+          new CefStreamURLFetcherResponseWriter(stream_writer));
+    } else if (cef_flags & UR_FLAG_NO_DOWNLOAD_DATA) {
       response_writer.reset(new CefURLFetcherResponseWriter(NULL, NULL));
+    } else if (cef_flags & UR_FLAG_POOLED_DOWNLOAD_DATA) {
+      response_writer.reset(
+          new CefPooledURLFetcherResponseWriter(url_request_, task_runner_));
     } else {
       response_writer.reset(
           new CefURLFetcherResponseWriter(url_request_, task_runner_));
@@ -460,6 +460,7 @@ scoped_refptr<CefBrowserInfo> CefContentBrowserClient::CreateBrowserInfo(
 
   scoped_refptr<CefBrowserInfo> browser_info =
       new CefBrowserInfo(++next_browser_id_, is_popup);
+  browser_info->set_index(&browser_info_index_);
   browser_info_list_.push_back(browser_info);
   return browser_info;
 }
@@ -476,28 +477,39 @@ scoped_refptr<CefBrowserInfo>
   if (is_guest_view)
     *is_guest_view = false;
 
-  BrowserInfoList::const_iterator it = browser_info_list_.begin();
-  for (; it != browser_info_list_.end(); ++it) {
-    const scoped_refptr<CefBrowserInfo>& browser_info = *it;
-    if (browser_info->render_id_manager()->is_render_view_id_match(
-            render_view_process_id, render_view_routing_id)) {
-      // Make sure the frame id is also registered.
-      browser_info->render_id_manager()->add_render_frame_id(
-          render_frame_process_id, render_frame_routing_id);
-      return browser_info;
-    }
-    if (browser_info->render_id_manager()->is_render_frame_id_match(
-            render_frame_process_id, render_frame_routing_id)) {
-      // Make sure the view id is also registered.
-      browser_info->render_id_manager()->add_render_view_id(
-          render_view_process_id, render_view_routing_id);
-      return browser_info;
+  scoped_refptr<CefBrowserInfo> browser_info =
+      browser_info_index_.Find(CefBrowserInfoIndex::RENDER_VIEW,
+                               render_view_process_id, render_view_routing_id);
+  if (browser_info.get()) {
+    // Make sure the frame id is also registered.
+    browser_info->render_id_manager()->add_render_frame_id(
+        render_frame_process_id, render_frame_routing_id);
+    return browser_info;
+  }
+
+  browser_info =
+      browser_info_index_.Find(CefBrowserInfoIndex::RENDER_FRAME,
+                               render_frame_process_id,
+                               render_frame_routing_id);
+  if (browser_info.get()) {
+    // Make sure the view id is also registered.
+    browser_info->render_id_manager()->add_render_view_id(
+        render_view_process_id, render_view_routing_id);
+    return browser_info;
+  }
+
+  if (extensions::ExtensionsEnabled()) {
+    browser_info =
+        browser_info_index_.Find(CefBrowserInfoIndex::GUEST_RENDER_VIEW,
+                                 render_view_process_id,
+                                 render_view_routing_id);
+    if (!browser_info.get()) {
+      browser_info =
+          browser_info_index_.Find(CefBrowserInfoIndex::GUEST_RENDER_FRAME,
+                                   render_frame_process_id,
+                                   render_frame_routing_id);
     }
-    if (extensions::ExtensionsEnabled() &&
-        (browser_info->guest_render_id_manager()->is_render_view_id_match(
-             render_view_process_id, render_view_routing_id) ||
-         browser_info->guest_render_id_manager()->is_render_frame_id_match(
-             render_frame_process_id, render_frame_routing_id))) {
+    if (browser_info.get()) {
       if (is_guest_view)
         *is_guest_view = true;
       return browser_info;
@@ -505,8 +517,8 @@ scoped_refptr<CefBrowserInfo>
   }
 
   // Must be a popup if it hasn't already been created.
-  scoped_refptr<CefBrowserInfo> browser_info =
-      new CefBrowserInfo(++next_browser_id_, true);
+  browser_info = new CefBrowserInfo(++next_browser_id_, true);
+  browser_info->set_index(&browser_info_index_);
   browser_info->render_id_manager()->add_render_view_id(
       render_view_process_id, render_view_routing_id);
   browser_info->render_id_manager()->add_render_frame_id(
@@ -522,6 +534,7 @@ void CefContentBrowserClient::RemoveBrowserInfo(
   BrowserInfoList::iterator it = browser_info_list_.begin();
   for (; it != browser_info_list_.end(); ++it) {
     if (*it == browser_info) {
+      browser_info->set_index(NULL);
       browser_info_list_.erase(it);
       return;
     }
@@ -568,21 +581,20 @@ scoped_refptr<CefBrowserInfo> CefContentBrowserClient::GetBrowserInfoForView(
     int render_process_id,
     int render_routing_id,
     bool* is_guest_view) {
-  base::AutoLock lock_scope(browser_info_lock_);
-
   if (is_guest_view)
     *is_guest_view = false;
 
-  BrowserInfoList::const_iterator it = browser_info_list_.begin();
-  for (; it != browser_info_list_.end(); ++it) {
-    const scoped_refptr<CefBrowserInfo>& browser_info = *it;
-    if (browser_info->render_id_manager()->is_render_view_id_match(
-          render_process_id, render_routing_id)) {
-      return browser_info;
-    }
-    if (extensions::ExtensionsEnabled() &&
-        browser_info->guest_render_id_manager()->is_render_view_id_match(
-            render_process_id, render_routing_id)) {
+  scoped_refptr<CefBrowserInfo> browser_info =
+      browser_info_index_.Find(CefBrowserInfoIndex::RENDER_VIEW,
+                               render_process_id, render_routing_id);
+  if (browser_info.get())
+    return browser_info;
+
+  if (extensions::ExtensionsEnabled()) {
+    browser_info =
+        browser_info_index_.Find(CefBrowserInfoIndex::GUEST_RENDER_VIEW,
+                                 render_process_id, render_routing_id);
+    if (browser_info.get()) {
       if (is_guest_view)
         *is_guest_view = true;
       return browser_info;
@@ -599,21 +611,20 @@ scoped_refptr<CefBrowserInfo> CefContentBrowserClient::GetBrowserInfoForFrame(
     int render_process_id,
     int render_routing_id,
     bool* is_guest_view) {
-  base::AutoLock lock_scope(browser_info_lock_);
-
   if (is_guest_view)
     *is_guest_view = false;
 
-  BrowserInfoList::const_iterator it = browser_info_list_.begin();
-  for (; it != browser_info_list_.end(); ++it) {
-    const scoped_refptr<CefBrowserInfo>& browser_info = *it;
-    if (browser_info->render_id_manager()->is_render_frame_id_match(
-            render_process_id, render_routing_id)) {
-      return browser_info;
-    }
-    if (extensions::ExtensionsEnabled() &&
-        browser_info->guest_render_id_manager()->is_render_frame_id_match(
-            render_process_id, render_routing_id)) {
+  scoped_refptr<CefBrowserInfo> browser_info =
+      browser_info_index_.Find(CefBrowserInfoIndex::RENDER_FRAME,
+                               render_process_id, render_routing_id);
+  if (browser_info.get())
+    return browser_info;
+
+  if (extensions::ExtensionsEnabled()) {
+    browser_info =
+        browser_info_index_.Find(CefBrowserInfoIndex::GUEST_RENDER_FRAME,
+                                 render_process_id, render_routing_id);
+    if (browser_info.get()) {
       if (is_guest_view)
         *is_guest_view = true;
       return browser_info;
@@ -798,6 +809,7 @@ void CefContentBrowserClient::AppendExtraCommandLineSwitches(
       switches::kPpapiFlashArgs,
       switches::kPpapiFlashPath,
       switches::kPpapiFlashVersion,
+      switches::kProcessMessageSharedMemoryThreshold,
       switches::kUncaughtExceptionStackSize,
       switches::kWidevineCdmPath,
       switches::kWidevineCdmVersion,
@@ -14,6 +14,7 @@
 
 #include "include/cef_request_context_handler.h"
 #include "libcef/browser/browser_context_impl.h"
+#include "libcef/browser/browser_info_index.h"
 #include "libcef/browser/url_request_context_getter_impl.h"
 
 #include "base/compiler_specific.h"
@@ -190,6 +191,10 @@ class CefContentBrowserClient : public content::ContentBrowserClient {
   BrowserInfoList browser_info_list_;
   int next_browser_id_;
 
+  // Index of render IDs for all objects in |browser_info_list_|. Lookups do
+  // not require |browser_info_lock_|.
+  CefBrowserInfoIndex browser_info_index_;
+
   // Only accessed on the IO thread.
   LastCreateWindowParams last_create_window_params_;
 };
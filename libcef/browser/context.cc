@@ -41,6 +41,10 @@
 #include "sandbox/win/src/sandbox_types.h"
 #endif
 
+#if defined(USE_X11)
+#include "ui/gfx/x/x11_connection.h"
+#endif
+
 namespace {
 
 CefContext* g_context = NULL;
@@ -237,13 +241,25 @@ bool CefContext::Initialize(const CefMainArgs& args,
   init_thread_id_ = base::PlatformThread::CurrentId();
   settings_ = settings;
 
-#if !defined(OS_WIN)
+#if defined(OS_MACOSX)
   if (settings.multi_threaded_message_loop) {
     NOTIMPLEMENTED() << "multi_threaded_message_loop is not supported.";
     return false;
   }
 #endif
 
+#if defined(USE_X11)
+  if (settings.multi_threaded_message_loop) {
+    // The UI thread and the application main thread may both use Xlib. This
+    // must be the first Xlib call in the process so CefInitialize() should be
+    // called before initializing any toolkit.
+    if (!gfx::InitializeThreadedX11()) {
+      LOG(ERROR) << "Failed to put Xlib into threaded mode.";
+      return false;
+    }
+  }
+#endif
+
   main_delegate_.reset(new CefMainDelegate(application));
   main_runner_.reset(content::ContentMainRunner::Create());
 
@@ -363,6 +379,9 @@ void CefContext::PopulateRequestContextSettings(
   settings->persist_user_preferences =
       settings_.persist_user_preferences ||
       command_line->HasSwitch(switches::kPersistUserPreferences);
+  settings->cache_max_size = settings_.cache_max_size;
+  settings->cache_in_memory = settings_.cache_in_memory;
+  settings->memory_cache_max_size = settings_.memory_cache_max_size;
   settings->ignore_certificate_errors =
       settings_.ignore_certificate_errors ||
       command_line->HasSwitch(switches::kIgnoreCertificateErrors);
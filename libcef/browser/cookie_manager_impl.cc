@@ -16,37 +16,108 @@
 #include "base/bind.h"
 #include "base/files/file_util.h"
 #include "base/format_macros.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
 #include "base/logging.h"
+#include "base/pickle.h"
+#include "base/strings/string_util.h"
 #include "base/threading/thread_restrictions.h"
+#include "base/values.h"
 #include "net/cookies/cookie_util.h"
 #include "net/cookies/parsed_cookie.h"
 #include "net/extras/sqlite/sqlite_persistent_cookie_store.h"
 #include "net/url_request/url_request_context.h"
 #include "url/gurl.h"
+#include "url/url_constants.h"
 
 using content::BrowserThread;
 
 namespace {
 
+// Identifies the binary cookie format ("CEFC").
+const uint32 kCookieBinaryMagic = 0x43454643;
+const int kCookieBinaryVersion = 1;
+
+// Filter that is applied to cookies before they are converted for a visitor.
+struct CookieFilter {
+  CookieFilter() {}
+  CookieFilter(const std::string& domain,
+               const std::string& name,
+               const base::Time& expires_after)
+    : name(name),
+      expires_after(expires_after) {
+    // Cookie domains are canonicalized to lower case.
+    this->domain = base::StringToLowerASCII(domain);
+    if (!this->domain.empty() && this->domain[0] == '.')
+      this->domain.erase(0, 1);
+  }
+
+  bool IsEmpty() const {
+    return domain.empty() && name.empty() && expires_after.is_null();
+  }
+
+  bool Matches(const net::CanonicalCookie& cc) const {
+    if (!name.empty() && cc.Name() != name)
+      return false;
+    if (!expires_after.is_null() &&
+        (!cc.IsPersistent() || cc.ExpiryDate() <= expires_after)) {
+      return false;
+    }
+    if (!domain.empty() && !DomainMatches(cc.Domain()))
+      return false;
+    return true;
+  }
+
+  // Returns true if |cookie_domain| is |domain| or a subdomain of |domain|.
+  bool DomainMatches(const std::string& cookie_domain) const {
+    // Ignore the leading dot of domain cookies.
+    const size_t offset =
+        (!cookie_domain.empty() && cookie_domain[0] == '.') ? 1 : 0;
+    const size_t length = cookie_domain.size() - offset;
+    if (length < domain.size())
+      return false;
+
+    const size_t start = offset + length - domain.size();
+    if (cookie_domain.compare(start, domain.size(), domain) != 0)
+      return false;
+    return start == offset || cookie_domain[start - 1] == '.';
+  }
+
+  // Lower case without a leading dot.
+  std::string domain;
+  std::string name;
+  base::Time expires_after;
+};
+
 // Callback class for visiting cookies.
 class VisitCookiesCallback : public base::RefCounted<VisitCookiesCallback> {
  public:
-  explicit VisitCookiesCallback(
+  VisitCookiesCallback(
       scoped_refptr<net::CookieMonster> cookie_monster,
-      CefRefPtr<CefCookieVisitor> visitor)
+      CefRefPtr<CefCookieVisitor> visitor,
+      const CookieFilter& filter = CookieFilter())
     : cookie_monster_(cookie_monster),
-      visitor_(visitor) {
+      visitor_(visitor),
+      filter_(filter) {
   }
 
   void Run(const net::CookieList& list) {
     CEF_REQUIRE_IOT();
 
-    int total = list.size(), count = 0;
-
+    // Apply the filter before converting any cookies so that |total| is
+    // accurate.
+    std::vector<const net::CanonicalCookie*> matches;
+    matches.reserve(list.size());
     net::CookieList::const_iterator it = list.begin();
-    for (; it != list.end(); ++it, ++count) {
+    for (; it != list.end(); ++it) {
+      if (filter_.IsEmpty() || filter_.Matches(*it))
+        matches.push_back(&(*it));
+    }
+
+    const int total = static_cast<int>(matches.size());
+    for (int count = 0; count < total; ++count) {
       CefCookie cookie;
-      const net::CanonicalCookie& cc = *(it);
+      const net::CanonicalCookie& cc = *matches[count];
       CefCookieManagerImpl::GetCefCookie(cc, cookie);
 
       bool deleteCookie = false;
@@ -67,8 +138,287 @@ class VisitCookiesCallback : public base::RefCounted<VisitCookiesCallback> {
 
   scoped_refptr<net::CookieMonster> cookie_monster_;
   CefRefPtr<CefCookieVisitor> visitor_;
+  CookieFilter filter_;
 };
 
+// Tracks a batch of asynchronous set operations and executes |callback| once
+// all of them have completed.
+class SetCookiesBatch : public base::RefCounted<SetCookiesBatch> {
+ public:
+  explicit SetCookiesBatch(CefRefPtr<CefSetCookiesCallback> callback)
+    : callback_(callback),
+      pending_(0),
+      num_set_(0),
+      started_(false) {
+  }
+
+  // Returns the completion callback for a single set operation.
+  net::CookieMonster::SetCookiesCallback AddOperation() {
+    CEF_REQUIRE_IOT();
+    DCHECK(!started_);
+    pending_++;
+    return base::Bind(&SetCookiesBatch::OnOperationComplete, this);
+  }
+
+  // Must be called after all operations have been added. Operations may
+  // complete synchronously so completion is not reported before this call.
+  void Start() {
+    CEF_REQUIRE_IOT();
+    started_ = true;
+    MaybeComplete();
+  }
+
+ private:
+  friend class base::RefCounted<SetCookiesBatch>;
+
+  ~SetCookiesBatch() {}
+
+  void OnOperationComplete(bool success) {
+    CEF_REQUIRE_IOT();
+    DCHECK_GT(pending_, 0);
+    pending_--;
+    if (success)
+      num_set_++;
+    MaybeComplete();
+  }
+
+  void MaybeComplete() {
+    if (!started_ || pending_ > 0 || !callback_.get())
+      return;
+
+    // Always execute the callback asynchronously.
+    CEF_POST_TASK(CEF_IOT,
+        base::Bind(&CefSetCookiesCallback::OnComplete, callback_.get(),
+                   num_set_));
+    callback_ = NULL;
+  }
+
+  CefRefPtr<CefSetCookiesCallback> callback_;
+  int pending_;
+  int num_set_;
+  bool started_;
+};
+
+void InitCefCookie(const std::string& name,
+                   const std::string& value,
+                   const std::string& domain,
+                   const std::string& path,
+                   bool secure,
+                   bool httponly,
+                   const base::Time& creation,
+                   const base::Time& last_access,
+                   const base::Time& expires,
+                   CefCookie& cookie) {
+  CefString(&cookie.name).FromString(name);
+  CefString(&cookie.value).FromString(value);
+  CefString(&cookie.domain).FromString(domain);
+  CefString(&cookie.path).FromString(path);
+  cookie.secure = secure;
+  cookie.httponly = httponly;
+  cef_time_from_basetime(creation, cookie.creation);
+  cef_time_from_basetime(last_access, cookie.last_access);
+  cookie.has_expires = !expires.is_null();
+  if (cookie.has_expires)
+    cef_time_from_basetime(expires, cookie.expires);
+}
+
+void WriteCookiesBinary(const net::CookieList& list, std::string* data) {
+  base::Pickle pickle;
+  pickle.WriteUInt32(kCookieBinaryMagic);
+  pickle.WriteInt(kCookieBinaryVersion);
+  pickle.WriteInt(static_cast<int>(list.size()));
+
+  net::CookieList::const_iterator it = list.begin();
+  for (; it != list.end(); ++it) {
+    pickle.WriteString(it->Name());
+    pickle.WriteString(it->Value());
+    pickle.WriteString(it->Domain());
+    pickle.WriteString(it->Path());
+    pickle.WriteBool(it->IsSecure());
+    pickle.WriteBool(it->IsHttpOnly());
+    pickle.WriteInt64(it->CreationDate().ToInternalValue());
+    pickle.WriteInt64(it->LastAccessDate().ToInternalValue());
+    pickle.WriteInt64(
+        it->IsPersistent() ? it->ExpiryDate().ToInternalValue() : 0);
+  }
+
+  data->assign(static_cast<const char*>(pickle.data()), pickle.size());
+}
+
+bool ReadCookiesBinary(const char* data,
+                       size_t data_size,
+                       std::vector<CefCookie>* cookies) {
+  base::Pickle pickle(data, static_cast<int>(data_size));
+  if (!pickle.data())
+    return false;
+
+  base::PickleIterator iter(pickle);
+  uint32 magic;
+  int version, count;
+  if (!iter.ReadUInt32(&magic) || magic != kCookieBinaryMagic ||
+      !iter.ReadInt(&version) || version != kCookieBinaryVersion ||
+      !iter.ReadInt(&count) || count < 0) {
+    return false;
+  }
+
+  // Each cookie requires more than one byte so don't trust larger counts.
+  if (static_cast<size_t>(count) <= data_size)
+    cookies->reserve(count);
+
+  for (int i = 0; i < count; ++i) {
+    std::string name, value, domain, path;
+    bool secure, httponly;
+    int64 creation, last_access, expires;
+    if (!iter.ReadString(&name) || !iter.ReadString(&value) ||
+        !iter.ReadString(&domain) || !iter.ReadString(&path) ||
+        !iter.ReadBool(&secure) || !iter.ReadBool(&httponly) ||
+        !iter.ReadInt64(&creation) || !iter.ReadInt64(&last_access) ||
+        !iter.ReadInt64(&expires)) {
+      return false;
+    }
+
+    cookies->push_back(CefCookie());
+    InitCefCookie(name, value, domain, path, secure, httponly,
+                  base::Time::FromInternalValue(creation),
+                  base::Time::FromInternalValue(last_access),
+                  base::Time::FromInternalValue(expires),
+                  cookies->back());
+  }
+
+  return true;
+}
+
+void WriteCookiesJSON(const net::CookieList& list, std::string* data) {
+  base::ListValue root;
+
+  net::CookieList::const_iterator it = list.begin();
+  for (; it != list.end(); ++it) {
+    scoped_ptr<base::DictionaryValue> dict(new base::DictionaryValue());
+    dict->SetString("name", it->Name());
+    dict->SetString("value", it->Value());
+    dict->SetString("domain", it->Domain());
+    dict->SetString("path", it->Path());
+    dict->SetBoolean("secure", it->IsSecure());
+    dict->SetBoolean("httponly", it->IsHttpOnly());
+    dict->SetDouble("creation", it->CreationDate().ToDoubleT());
+    dict->SetDouble("last_access", it->LastAccessDate().ToDoubleT());
+    if (it->IsPersistent())
+      dict->SetDouble("expires", it->ExpiryDate().ToDoubleT());
+    root.Append(dict.Pass());
+  }
+
+  base::JSONWriter::Write(root, data);
+}
+
+bool ReadCookiesJSON(const char* data,
+                     size_t data_size,
+                     std::vector<CefCookie>* cookies) {
+  scoped_ptr<base::Value> root =
+      base::JSONReader::Read(base::StringPiece(data, data_size));
+  base::ListValue* list = NULL;
+  if (!root.get() || !root->GetAsList(&list))
+    return false;
+
+  cookies->reserve(list->GetSize());
+
+  for (size_t i = 0; i < list->GetSize(); ++i) {
+    base::DictionaryValue* dict = NULL;
+    std::string name, value, domain, path;
+    if (!list->GetDictionary(i, &dict) || !dict->GetString("name", &name) ||
+        !dict->GetString("domain", &domain)) {
+      return false;
+    }
+
+    // All other members are optional.
+    bool secure = false, httponly = false;
+    double creation = 0, last_access = 0, expires = 0;
+    dict->GetString("value", &value);
+    dict->GetString("path", &path);
+    dict->GetBoolean("secure", &secure);
+    dict->GetBoolean("httponly", &httponly);
+    dict->GetDouble("creation", &creation);
+    dict->GetDouble("last_access", &last_access);
+    dict->GetDouble("expires", &expires);
+
+    cookies->push_back(CefCookie());
+    InitCefCookie(name, value, domain, path, secure, httponly,
+                  base::Time::FromDoubleT(creation),
+                  base::Time::FromDoubleT(last_access),
+                  base::Time::FromDoubleT(expires),
+                  cookies->back());
+  }
+
+  return true;
+}
+
+// Serialize |list| and execute |callback| on the IO thread.
+void ExportCookiesOnFileThread(cef_cookie_format_t format,
+                               CefRefPtr<CefExportCookiesCallback> callback,
+                               const net::CookieList& list) {
+  CEF_REQUIRE_FILET();
+
+  std::string data;
+  if (format == COOKIE_FORMAT_JSON)
+    WriteCookiesJSON(list, &data);
+  else
+    WriteCookiesBinary(list, &data);
+
+  CefRefPtr<CefBinaryValue> value;
+  if (!data.empty())
+    value = CefBinaryValue::Create(data.data(), data.size());
+
+  CEF_POST_TASK(CEF_IOT,
+      base::Bind(&CefExportCookiesCallback::OnComplete, callback.get(), value,
+                 value.get() ? static_cast<int>(list.size()) : 0));
+}
+
+void ExportCookiesOnIOThread(cef_cookie_format_t format,
+                             CefRefPtr<CefExportCookiesCallback> callback,
+                             const net::CookieList& list) {
+  CEF_REQUIRE_IOT();
+
+  // Serialize on the FILE thread to avoid blocking network IO.
+  CEF_POST_TASK(CEF_FILET,
+      base::Bind(ExportCookiesOnFileThread, format, callback, list));
+}
+
+// Returns a URL that a cookie with the specified attributes can be set for.
+GURL GetCookieSourceURL(const std::string& domain,
+                        const std::string& path,
+                        bool secure) {
+  std::string host = domain;
+  if (!host.empty() && host[0] == '.')
+    host.erase(0, 1);
+  return GURL(std::string(secure ? url::kHttpsScheme : url::kHttpScheme) +
+              url::kStandardSchemeSeparator + host +
+              (path.empty() ? "/" : path));
+}
+
+void SetCookieWithDetails(
+    net::CookieMonster* cookie_monster,
+    const GURL& url,
+    const CefCookie& cookie,
+    const net::CookieMonster::SetCookiesCallback& callback) {
+  std::string name = CefString(&cookie.name).ToString();
+  std::string value = CefString(&cookie.value).ToString();
+  std::string domain = CefString(&cookie.domain).ToString();
+  std::string path = CefString(&cookie.path).ToString();
+
+  base::Time expiration_time;
+  if (cookie.has_expires)
+    cef_time_to_basetime(cookie.expires, expiration_time);
+
+  cookie_monster->SetCookieWithDetailsAsync(
+      url, name, value, domain, path,
+      expiration_time,
+      cookie.secure ? true : false,
+      cookie.httponly ? true : false,
+      false,  // First-party only.
+      false,  // Enforces prefixes.
+      net::COOKIE_PRIORITY_DEFAULT,
+      callback);
+}
+
 
 // Methods extracted from net/cookies/cookie_monster.cc
 
@@ -221,6 +571,23 @@ bool CefCookieManagerImpl::VisitUrlCookies(
   return true;
 }
 
+bool CefCookieManagerImpl::VisitFilteredCookies(
+    const CefString& domain,
+    const CefString& name,
+    const CefTime& expires_after,
+    CefRefPtr<CefCookieVisitor> visitor) {
+  base::Time expires_after_time;
+  if (expires_after.year != 0)
+    cef_time_to_basetime(expires_after, expires_after_time);
+
+  GetCookieMonster(
+      BrowserThread::GetMessageLoopProxyForThread(BrowserThread::IO),
+      base::Bind(&CefCookieManagerImpl::VisitFilteredCookiesInternal, this,
+                 domain.ToString(), name.ToString(), expires_after_time,
+                 visitor));
+  return true;
+}
+
 bool CefCookieManagerImpl::SetCookie(
     const CefString& url,
     const CefCookie& cookie,
@@ -236,6 +603,65 @@ bool CefCookieManagerImpl::SetCookie(
   return true;
 }
 
+bool CefCookieManagerImpl::SetCookies(
+    const CefString& url,
+    const std::vector<CefString>& cookie_lines,
+    CefRefPtr<CefSetCookiesCallback> callback) {
+  GURL gurl = GURL(url.ToString());
+  if (!gurl.is_valid())
+    return false;
+
+  std::vector<std::string> lines;
+  lines.reserve(cookie_lines.size());
+  std::vector<CefString>::const_iterator it = cookie_lines.begin();
+  for (; it != cookie_lines.end(); ++it)
+    lines.push_back(*it);
+
+  GetCookieMonster(
+      BrowserThread::GetMessageLoopProxyForThread(BrowserThread::IO),
+      base::Bind(&CefCookieManagerImpl::SetCookiesInternal, this, gurl, lines,
+                 callback));
+  return true;
+}
+
+bool CefCookieManagerImpl::ExportCookies(
+    cef_cookie_format_t format,
+    CefRefPtr<CefExportCookiesCallback> callback) {
+  GetCookieMonster(
+      BrowserThread::GetMessageLoopProxyForThread(BrowserThread::IO),
+      base::Bind(&CefCookieManagerImpl::ExportCookiesInternal, this, format,
+                 callback));
+  return true;
+}
+
+bool CefCookieManagerImpl::ImportCookies(
+    CefRefPtr<CefBinaryValue> data,
+    CefRefPtr<CefSetCookiesCallback> callback) {
+  const size_t data_size = data->GetSize();
+  if (data_size == 0)
+    return false;
+
+  std::vector<char> buffer(data_size);
+  data->GetData(&buffer[0], data_size, 0);
+
+  // Parse on the calling thread to avoid blocking network IO. JSON data will
+  // always start with an array.
+  std::vector<CefCookie> cookies;
+  bool parsed;
+  if (buffer[0] == '[')
+    parsed = ReadCookiesJSON(&buffer[0], data_size, &cookies);
+  else
+    parsed = ReadCookiesBinary(&buffer[0], data_size, &cookies);
+  if (!parsed)
+    return false;
+
+  GetCookieMonster(
+      BrowserThread::GetMessageLoopProxyForThread(BrowserThread::IO),
+      base::Bind(&CefCookieManagerImpl::ImportCookiesInternal, this, cookies,
+                 callback));
+  return true;
+}
+
 bool CefCookieManagerImpl::DeleteCookies(
     const CefString& url,
     const CefString& cookie_name,
@@ -534,6 +960,22 @@ void CefCookieManagerImpl::VisitUrlCookiesInternal(
       base::Bind(&VisitCookiesCallback::Run, callback.get()));
 }
 
+void CefCookieManagerImpl::VisitFilteredCookiesInternal(
+    const std::string& domain,
+    const std::string& name,
+    const base::Time& expires_after,
+    CefRefPtr<CefCookieVisitor> visitor,
+    scoped_refptr<net::CookieMonster> cookie_monster) {
+  CEF_REQUIRE_IOT();
+
+  scoped_refptr<VisitCookiesCallback> callback(
+      new VisitCookiesCallback(cookie_monster, visitor,
+                               CookieFilter(domain, name, expires_after)));
+
+  cookie_monster->GetAllCookiesAsync(
+      base::Bind(&VisitCookiesCallback::Run, callback.get()));
+}
+
 void CefCookieManagerImpl::SetCookieInternal(
     const GURL& url,
     const CefCookie& cookie,
@@ -541,24 +983,67 @@ void CefCookieManagerImpl::SetCookieInternal(
     scoped_refptr<net::CookieMonster> cookie_monster) {
   CEF_REQUIRE_IOT();
 
-  std::string name = CefString(&cookie.name).ToString();
-  std::string value = CefString(&cookie.value).ToString();
-  std::string domain = CefString(&cookie.domain).ToString();
-  std::string path = CefString(&cookie.path).ToString();
+  SetCookieWithDetails(cookie_monster.get(), url, cookie,
+                       base::Bind(SetCookieCallbackImpl, callback));
+}
 
-  base::Time expiration_time;
-  if (cookie.has_expires)
-    cef_time_to_basetime(cookie.expires, expiration_time);
+void CefCookieManagerImpl::SetCookiesInternal(
+    const GURL& url,
+    const std::vector<std::string>& cookie_lines,
+    CefRefPtr<CefSetCookiesCallback> callback,
+    scoped_refptr<net::CookieMonster> cookie_monster) {
+  CEF_REQUIRE_IOT();
 
-  cookie_monster->SetCookieWithDetailsAsync(
-      url, name, value, domain, path,
-      expiration_time,
-      cookie.secure ? true : false,
-      cookie.httponly ? true : false,
-      false,  // First-party only.
-      false,  // Enforces prefixes.
-      net::COOKIE_PRIORITY_DEFAULT,
-      base::Bind(SetCookieCallbackImpl, callback));
+  net::CookieOptions options;
+  options.set_include_httponly();
+
+  scoped_refptr<SetCookiesBatch> batch(new SetCookiesBatch(callback));
+  std::vector<std::string>::const_iterator it = cookie_lines.begin();
+  for (; it != cookie_lines.end(); ++it) {
+    cookie_monster->SetCookieWithOptionsAsync(url, *it, options,
+                                              batch->AddOperation());
+  }
+  batch->Start();
+}
+
+void CefCookieManagerImpl::ExportCookiesInternal(
+    cef_cookie_format_t format,
+    CefRefPtr<CefExportCookiesCallback> callback,
+    scoped_refptr<net::CookieMonster> cookie_monster) {
+  CEF_REQUIRE_IOT();
+
+  cookie_monster->GetAllCookiesAsync(
+      base::Bind(ExportCookiesOnIOThread, format, callback));
+}
+
+void CefCookieManagerImpl::ImportCookiesInternal(
+    const std::vector<CefCookie>& cookies,
+    CefRefPtr<CefSetCookiesCallback> callback,
+    scoped_refptr<net::CookieMonster> cookie_monster) {
+  CEF_REQUIRE_IOT();
+
+  scoped_refptr<SetCookiesBatch> batch(new SetCookiesBatch(callback));
+  std::vector<CefCookie>::const_iterator it = cookies.begin();
+  for (; it != cookies.end(); ++it) {
+    const std::string domain = CefString(&it->domain).ToString();
+    const std::string path = CefString(&it->path).ToString();
+    const GURL url =
+        GetCookieSourceURL(domain, path, it->secure ? true : false);
+    if (!url.is_valid())
+      continue;
+
+    if (!domain.empty() && domain[0] == '.') {
+      SetCookieWithDetails(cookie_monster.get(), url, *it,
+                           batch->AddOperation());
+    } else {
+      // Host cookies are set without a domain attribute.
+      CefCookie host_cookie(*it);
+      cef_string_clear(&host_cookie.domain);
+      SetCookieWithDetails(cookie_monster.get(), url, host_cookie,
+                           batch->AddOperation());
+    }
+  }
+  batch->Start();
 }
 
 void CefCookieManagerImpl::DeleteCookiesInternal(
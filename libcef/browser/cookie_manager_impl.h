@@ -45,9 +45,20 @@ class CefCookieManagerImpl : public CefCookieManager {
   bool VisitAllCookies(CefRefPtr<CefCookieVisitor> visitor) override;
   bool VisitUrlCookies(const CefString& url, bool includeHttpOnly,
                        CefRefPtr<CefCookieVisitor> visitor) override;
+  bool VisitFilteredCookies(const CefString& domain,
+                            const CefString& name,
+                            const CefTime& expires_after,
+                            CefRefPtr<CefCookieVisitor> visitor) override;
   bool SetCookie(const CefString& url,
                  const CefCookie& cookie,
                  CefRefPtr<CefSetCookieCallback> callback) override;
+  bool SetCookies(const CefString& url,
+                  const std::vector<CefString>& cookie_lines,
+                  CefRefPtr<CefSetCookiesCallback> callback) override;
+  bool ExportCookies(cef_cookie_format_t format,
+                     CefRefPtr<CefExportCookiesCallback> callback) override;
+  bool ImportCookies(CefRefPtr<CefBinaryValue> data,
+                     CefRefPtr<CefSetCookiesCallback> callback) override;
   bool DeleteCookies(const CefString& url,
                      const CefString& cookie_name,
                      CefRefPtr<CefDeleteCookiesCallback> callback) override;
@@ -101,11 +112,30 @@ class CefCookieManagerImpl : public CefCookieManager {
       bool includeHttpOnly,
       CefRefPtr<CefCookieVisitor> visitor,
       scoped_refptr<net::CookieMonster> cookie_monster);
+  void VisitFilteredCookiesInternal(
+      const std::string& domain,
+      const std::string& name,
+      const base::Time& expires_after,
+      CefRefPtr<CefCookieVisitor> visitor,
+      scoped_refptr<net::CookieMonster> cookie_monster);
   void SetCookieInternal(
       const GURL& url,
       const CefCookie& cookie,
       CefRefPtr<CefSetCookieCallback> callback,
       scoped_refptr<net::CookieMonster> cookie_monster);
+  void SetCookiesInternal(
+      const GURL& url,
+      const std::vector<std::string>& cookie_lines,
+      CefRefPtr<CefSetCookiesCallback> callback,
+      scoped_refptr<net::CookieMonster> cookie_monster);
+  void ExportCookiesInternal(
+      cef_cookie_format_t format,
+      CefRefPtr<CefExportCookiesCallback> callback,
+      scoped_refptr<net::CookieMonster> cookie_monster);
+  void ImportCookiesInternal(
+      const std::vector<CefCookie>& cookies,
+      CefRefPtr<CefSetCookiesCallback> callback,
+      scoped_refptr<net::CookieMonster> cookie_monster);
   void DeleteCookiesInternal(
       const GURL& url,
       const CefString& cookie_name,
@@ -8,6 +8,9 @@
 #include "include/cef_v8.h"
 #include "libcef/common/cef_messages.h"
 #include "libcef/browser/browser_host_impl.h"
+#include "libcef/browser/thread_util.h"
+
+#include "base/bind.h"
 
 namespace {
 
@@ -111,6 +114,16 @@ void CefFrameHostImpl::GetText(CefRefPtr<CefStringVisitor> visitor) {
   SendCommand("GetText", new StringVisitHandler(visitor));
 }
 
+void CefFrameHostImpl::GetSourceChunked(
+    CefRefPtr<CefStringChunkVisitor> visitor) {
+  SendStringChunksRequest("GetSource", visitor);
+}
+
+void CefFrameHostImpl::GetTextChunked(
+    CefRefPtr<CefStringChunkVisitor> visitor) {
+  SendStringChunksRequest("GetText", visitor);
+}
+
 void CefFrameHostImpl::LoadRequest(CefRefPtr<CefRequest> request) {
   CefRefPtr<CefBrowserHostImpl> browser;
   int64 frame_id;
@@ -277,3 +290,24 @@ void CefFrameHostImpl::SendCommand(
   if (browser.get() && frame_id != kInvalidFrameId)
     browser->SendCommand(frame_id, command, responseHandler);
 }
+
+void CefFrameHostImpl::SendStringChunksRequest(
+    const std::string& command,
+    CefRefPtr<CefStringChunkVisitor> visitor) {
+  CefRefPtr<CefBrowserHostImpl> browser;
+  int64 frame_id;
+
+  {
+    base::AutoLock lock_scope(state_lock_);
+    browser = browser_;
+    // Requests can only be sent to known frame ids.
+    frame_id = frame_id_;
+  }
+
+  if (browser.get() && frame_id != kInvalidFrameId) {
+    browser->SendStringChunksRequest(frame_id, command, visitor);
+  } else {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefStringChunkVisitor::OnComplete, visitor.get(), false));
+  }
+}
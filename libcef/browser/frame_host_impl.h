@@ -38,6 +38,8 @@ class CefFrameHostImpl : public CefFrame {
   void ViewSource() override;
   void GetSource(CefRefPtr<CefStringVisitor> visitor) override;
   void GetText(CefRefPtr<CefStringVisitor> visitor) override;
+  void GetSourceChunked(CefRefPtr<CefStringChunkVisitor> visitor) override;
+  void GetTextChunked(CefRefPtr<CefStringChunkVisitor> visitor) override;
   void LoadRequest(CefRefPtr<CefRequest> request) override;
   void LoadURL(const CefString& url) override;
   void LoadString(const CefString& string,
@@ -77,6 +79,8 @@ class CefFrameHostImpl : public CefFrame {
  protected:
   void SendCommand(const std::string& command,
                    CefRefPtr<CefResponseManager::Handler> responseHandler);
+  void SendStringChunksRequest(const std::string& command,
+                               CefRefPtr<CefStringChunkVisitor> visitor);
 
   int64 frame_id_;
   bool is_main_frame_;
@@ -4,6 +4,9 @@
 // found in the LICENSE file.
 
 #include "libcef/browser/render_widget_host_view_osr.h"
+
+#include <algorithm>
+
 #include "libcef/browser/browser_host_impl.h"
 #include "libcef/browser/software_output_device_osr.h"
 #include "libcef/browser/thread_util.h"
@@ -41,6 +44,12 @@ const int kMaximumFrameRate = 60;
 // The maximum number of retry counts if frame capture fails.
 const int kFrameRetryLimit = 2;
 
+// When adaptive frame pacing is enabled the BeginFrame interval will be doubled
+// after this many consecutive BeginFrames that produce no new content, up to a
+// maximum interval of kAdaptiveMaxFrameIntervalMs.
+const int kAdaptiveIdleFrameLimit = 4;
+const int kAdaptiveMaxFrameIntervalMs = 1000;
+
 // When accelerated compositing is enabled and a widget resize is pending,
 // we delay further resizes of the UI. The following constant is the maximum
 // length of time that we should delay further UI resizes while waiting for a
@@ -128,8 +137,10 @@ class CefResizeLock : public content::ResizeLock {
 class CefCopyFrameGenerator {
  public:
   CefCopyFrameGenerator(int frame_rate_threshold_ms,
+                        bool partial_paint,
                         CefRenderWidgetHostViewOSR* view)
     : frame_rate_threshold_ms_(frame_rate_threshold_ms),
+      partial_paint_(partial_paint),
       view_(view),
       frame_pending_(false),
       frame_in_progress_(false),
@@ -140,8 +151,14 @@ class CefCopyFrameGenerator {
   void GenerateCopyFrame(
       bool force_frame,
       const gfx::Rect& damage_rect) {
-    if (force_frame && !frame_pending_)
-      frame_pending_ = true;
+    if (force_frame) {
+      if (!frame_pending_) {
+        frame_pending_ = true;
+      } else if (!damage_rect.IsEmpty()) {
+        // The previously requested frame will be coalesced with this one.
+        view_->RecordFrameCoalesced();
+      }
+    }
 
     // No frame needs to be generated at this time.
     if (!frame_pending_)
@@ -149,7 +166,7 @@ class CefCopyFrameGenerator {
 
     // Keep track of |damage_rect| for when the next frame is generated.
     if (!damage_rect.IsEmpty())
-      pending_damage_rect_.Union(damage_rect);
+      pending_damage_region_.Union(damage_rect);
 
     // Don't attempt to generate a frame while one is currently in-progress.
     if (frame_in_progress_)
@@ -185,8 +202,8 @@ class CefCopyFrameGenerator {
     if (!view_->render_widget_host())
       return;
 
-    const gfx::Rect damage_rect = pending_damage_rect_;
-    pending_damage_rect_.SetRect(0, 0, 0, 0);
+    const cc::Region damage_region = pending_damage_region_;
+    pending_damage_region_.Clear();
 
     // The below code is similar in functionality to
     // DelegatedFrameHost::CopyFromCompositingSurface but we reuse the same
@@ -195,38 +212,38 @@ class CefCopyFrameGenerator {
         cc::CopyOutputRequest::CreateRequest(base::Bind(
             &CefCopyFrameGenerator::CopyFromCompositingSurfaceHasResult,
             weak_ptr_factory_.GetWeakPtr(),
-            damage_rect));
+            damage_region));
 
     request->set_area(gfx::Rect(view_->GetPhysicalBackingSize()));
     view_->DelegatedFrameHostGetLayer()->RequestCopyOfOutput(request.Pass());
   }
 
   void CopyFromCompositingSurfaceHasResult(
-      const gfx::Rect& damage_rect,
+      const cc::Region& damage_region,
       scoped_ptr<cc::CopyOutputResult> result) {
     if (result->IsEmpty() || result->size().IsEmpty() ||
         !view_->render_widget_host()) {
-      OnCopyFrameCaptureFailure(damage_rect);
+      OnCopyFrameCaptureFailure(damage_region);
       return;
     }
 
     if (result->HasTexture()) {
-      PrepareTextureCopyOutputResult(damage_rect, result.Pass());
+      PrepareTextureCopyOutputResult(damage_region, result.Pass());
       return;
     }
 
     DCHECK(result->HasBitmap());
-    PrepareBitmapCopyOutputResult(damage_rect, result.Pass());
+    PrepareBitmapCopyOutputResult(damage_region, result.Pass());
   }
 
   void PrepareTextureCopyOutputResult(
-      const gfx::Rect& damage_rect,
+      const cc::Region& damage_region,
       scoped_ptr<cc::CopyOutputResult> result) {
     DCHECK(result->HasTexture());
     base::ScopedClosureRunner scoped_callback_runner(
         base::Bind(&CefCopyFrameGenerator::OnCopyFrameCaptureFailure,
                    weak_ptr_factory_.GetWeakPtr(),
-                   damage_rect));
+                   damage_region));
 
     const gfx::Size& result_size = result->size();
     SkIRect bitmap_size;
@@ -276,7 +293,7 @@ class CefCopyFrameGenerator {
             &CefCopyFrameGenerator::CopyFromCompositingSurfaceFinishedProxy,
             weak_ptr_factory_.GetWeakPtr(),
             base::Passed(&release_callback),
-            damage_rect,
+            damage_region,
             base::Passed(&bitmap_),
             base::Passed(&bitmap_pixels_lock)),
         content::GLHelper::SCALER_QUALITY_FAST);
@@ -285,7 +302,7 @@ class CefCopyFrameGenerator {
   static void CopyFromCompositingSurfaceFinishedProxy(
       base::WeakPtr<CefCopyFrameGenerator> generator,
       scoped_ptr<cc::SingleReleaseCallback> release_callback,
-      const gfx::Rect& damage_rect,
+      const cc::Region& damage_region,
       scoped_ptr<SkBitmap> bitmap,
       scoped_ptr<SkAutoLockPixels> bitmap_pixels_lock,
       bool result) {
@@ -302,7 +319,7 @@ class CefCopyFrameGenerator {
 
     if (generator) {
       generator->CopyFromCompositingSurfaceFinished(
-          damage_rect, bitmap.Pass(), bitmap_pixels_lock.Pass(), result);
+          damage_region, bitmap.Pass(), bitmap_pixels_lock.Pass(), result);
     } else {
       bitmap_pixels_lock.reset();
       bitmap.reset();
@@ -310,7 +327,7 @@ class CefCopyFrameGenerator {
   }
 
   void CopyFromCompositingSurfaceFinished(
-      const gfx::Rect& damage_rect,
+      const cc::Region& damage_region,
       scoped_ptr<SkBitmap> bitmap,
       scoped_ptr<SkAutoLockPixels> bitmap_pixels_lock,
       bool result) {
@@ -319,16 +336,21 @@ class CefCopyFrameGenerator {
     bitmap_ = bitmap.Pass();
 
     if (result) {
-      OnCopyFrameCaptureSuccess(damage_rect, *bitmap_,
+      OnCopyFrameCaptureSuccess(damage_region, *bitmap_,
                                 bitmap_pixels_lock.Pass());
+      if (partial_paint_) {
+        // Read the next frame into the other bitmap so that the client can
+        // continue to access the pixel data that was just delivered.
+        bitmap_.swap(front_bitmap_);
+      }
     } else {
       bitmap_pixels_lock.reset();
-      OnCopyFrameCaptureFailure(damage_rect);
+      OnCopyFrameCaptureFailure(damage_region);
     }
   }
 
   void PrepareBitmapCopyOutputResult(
-      const gfx::Rect& damage_rect,
+      const cc::Region& damage_region,
       scoped_ptr<cc::CopyOutputResult> result) {
     DCHECK(result->HasBitmap());
     scoped_ptr<SkBitmap> source = result->TakeBitmap();
@@ -336,27 +358,31 @@ class CefCopyFrameGenerator {
     if (source) {
       scoped_ptr<SkAutoLockPixels> bitmap_pixels_lock(
           new SkAutoLockPixels(*source));
-      OnCopyFrameCaptureSuccess(damage_rect, *source,
+      OnCopyFrameCaptureSuccess(damage_region, *source,
                                 bitmap_pixels_lock.Pass());
     } else {
-      OnCopyFrameCaptureFailure(damage_rect);
+      OnCopyFrameCaptureFailure(damage_region);
     }
   }
 
   void OnCopyFrameCaptureFailure(
-      const gfx::Rect& damage_rect) {
-    // Retry with the same |damage_rect|.
-    pending_damage_rect_.Union(damage_rect);
+      const cc::Region& damage_region) {
+    // Retry with the same |damage_region|.
+    pending_damage_region_.Union(damage_region);
 
     const bool force_frame = (++frame_retry_count_ <= kFrameRetryLimit);
+    if (force_frame)
+      view_->RecordFrameCaptureRetry();
     OnCopyFrameCaptureCompletion(force_frame);
   }
 
   void OnCopyFrameCaptureSuccess(
-      const gfx::Rect& damage_rect,
+      const cc::Region& damage_region,
       const SkBitmap& bitmap,
       scoped_ptr<SkAutoLockPixels> bitmap_pixels_lock) {
-    view_->OnPaint(damage_rect, bitmap.width(), bitmap.height(),
+    view_->RecordFrameCaptureLatency(base::TimeTicks::Now() -
+                                     frame_start_time_);
+    view_->OnPaint(damage_region, bitmap.width(), bitmap.height(),
                    bitmap.getPixels());
     bitmap_pixels_lock.reset();
 
@@ -382,6 +408,7 @@ class CefCopyFrameGenerator {
   }
 
   int frame_rate_threshold_ms_;
+  const bool partial_paint_;
   CefRenderWidgetHostViewOSR* view_;
 
   base::TimeTicks frame_start_time_;
@@ -389,7 +416,10 @@ class CefCopyFrameGenerator {
   bool frame_in_progress_;
   int frame_retry_count_;
   scoped_ptr<SkBitmap> bitmap_;
-  gfx::Rect pending_damage_rect_;
+  // The bitmap passed to the most recent OnPaint call. Only used when
+  // |partial_paint_| is true.
+  scoped_ptr<SkBitmap> front_bitmap_;
+  cc::Region pending_damage_region_;
 
   base::WeakPtrFactory<CefCopyFrameGenerator> weak_ptr_factory_;
 
@@ -441,6 +471,11 @@ CefRenderWidgetHostViewOSR::CefRenderWidgetHostViewOSR(
     CefRenderWidgetHostViewOSR* parent_host_view)
     : scale_factor_(kDefaultScaleFactor),
       frame_rate_threshold_ms_(0),
+      frame_pacing_mode_(FRAME_PACING_FIXED),
+      needs_begin_frames_(false),
+      adaptive_frame_interval_ms_(0),
+      idle_begin_frame_count_(0),
+      frame_swapped_since_begin_frame_(false),
       delegated_frame_host_(new content::DelegatedFrameHost(this)),
       compositor_widget_(gfx::kNullAcceleratedWidget),
       software_output_device_(NULL),
@@ -643,6 +678,9 @@ void CefRenderWidgetHostViewOSR::OnSwapCompositorFrame(
     }
   }
 
+  frame_swapped_since_begin_frame_ = true;
+  ResetAdaptiveFrameInterval();
+
   if (frame->delegated_frame_data) {
     if (software_output_device_) {
       if (!begin_frame_timer_.get()) {
@@ -663,7 +701,8 @@ void CefRenderWidgetHostViewOSR::OnSwapCompositorFrame(
     } else {
       if (!copy_frame_generator_.get()) {
         copy_frame_generator_.reset(
-            new CefCopyFrameGenerator(frame_rate_threshold_ms_, this));
+            new CefCopyFrameGenerator(frame_rate_threshold_ms_,
+                                      IsPartialPaintEnabled(), this));
       }
 
       // Determine the damage rectangle for the current frame. This is the same
@@ -986,8 +1025,12 @@ bool CefRenderWidgetHostViewOSR::OnMessageReceived(const IPC::Message& msg) {
 void CefRenderWidgetHostViewOSR::OnSetNeedsBeginFrames(bool enabled) {
   SetFrameRate();
 
-  // Start/stop the timer that sends BeginFrame requests.
-  begin_frame_timer_->SetActive(enabled);
+  needs_begin_frames_ = enabled;
+
+  // Start/stop the timer that sends BeginFrame requests. With external frame
+  // pacing BeginFrames are sent from SendExternalBeginFrame instead.
+  begin_frame_timer_->SetActive(
+      enabled && frame_pacing_mode_ != FRAME_PACING_EXTERNAL);
   if (software_output_device_) {
     // When the SoftwareOutputDevice is active it will call OnPaint for each
     // frame. If the SoftwareOutputDevice is deactivated while an invalidation
@@ -1005,6 +1048,7 @@ CefRenderWidgetHostViewOSR::CreateSoftwareOutputDevice(
   software_output_device_ = new CefSoftwareOutputDeviceOSR(
       compositor,
       browser_impl_.get() ? browser_impl_->IsTransparent() : false,
+      IsPartialPaintEnabled(),
       base::Bind(&CefRenderWidgetHostViewOSR::OnPaint,
                  weak_ptr_factory_.GetWeakPtr()));
   return make_scoped_ptr<cc::SoftwareOutputDevice>(software_output_device_);
@@ -1138,6 +1182,7 @@ void CefRenderWidgetHostViewOSR::SendKeyEvent(
   TRACE_EVENT0("libcef", "CefRenderWidgetHostViewOSR::SendKeyEvent");
   if (!render_widget_host_)
     return;
+  ResetAdaptiveFrameInterval();
   render_widget_host_->ForwardKeyboardEvent(event);
 }
 
@@ -1162,6 +1207,7 @@ void CefRenderWidgetHostViewOSR::SendMouseEvent(
   }
   if (!render_widget_host_)
     return;
+  ResetAdaptiveFrameInterval();
   render_widget_host_->ForwardMouseEvent(event);
 }
 
@@ -1193,6 +1239,7 @@ void CefRenderWidgetHostViewOSR::SendMouseWheelEvent(
   }
   if (!render_widget_host_)
     return;
+  ResetAdaptiveFrameInterval();
   render_widget_host_->ForwardWheelEvent(event);
 }
 
@@ -1223,6 +1270,38 @@ void CefRenderWidgetHostViewOSR::UpdateFrameRate() {
     guest_host_view->UpdateFrameRate();
 }
 
+void CefRenderWidgetHostViewOSR::SendExternalBeginFrame() {
+  if (begin_frame_timer_.get() &&
+      frame_pacing_mode_ == FRAME_PACING_EXTERNAL && needs_begin_frames_) {
+    OnBeginFrameTimerTick();
+  }
+
+  if (popup_host_view_)
+    popup_host_view_->SendExternalBeginFrame();
+
+  // Notify the guest hosts if any.
+  for (auto guest_host_view : guest_host_views_)
+    guest_host_view->SendExternalBeginFrame();
+}
+
+void CefRenderWidgetHostViewOSR::RecordFrameCoalesced() {
+  frame_statistics_.coalesced_frames++;
+}
+
+void CefRenderWidgetHostViewOSR::RecordFrameCaptureRetry() {
+  frame_statistics_.capture_retries++;
+}
+
+void CefRenderWidgetHostViewOSR::RecordFrameCaptureLatency(
+    base::TimeDelta latency) {
+  const double latency_ms = latency.InMillisecondsF();
+  const int64 samples = frame_statistics_.capture_count++;
+  frame_statistics_.last_capture_latency_ms = latency_ms;
+  frame_statistics_.average_capture_latency_ms =
+      (frame_statistics_.average_capture_latency_ms * samples + latency_ms) /
+      (samples + 1);
+}
+
 void CefRenderWidgetHostViewOSR::HoldResize() {
   if (!hold_resize_)
     hold_resize_ = true;
@@ -1242,7 +1321,7 @@ void CefRenderWidgetHostViewOSR::ReleaseResize() {
 }
 
 void CefRenderWidgetHostViewOSR::OnPaint(
-    const gfx::Rect& damage_rect,
+    const cc::Region& damage_region,
     int bitmap_width,
     int bitmap_height,
     void* bitmap_pixels) {
@@ -1253,15 +1332,31 @@ void CefRenderWidgetHostViewOSR::OnPaint(
   if (!handler.get())
     return;
 
+  frame_statistics_.frames_produced++;
+
   // Don't execute WasResized while the OnPaint callback is pending.
   HoldResize();
 
-  gfx::Rect rect_in_bitmap(0, 0, bitmap_width, bitmap_height);
-  rect_in_bitmap.Intersect(damage_rect);
+  const gfx::Rect bitmap_rect(0, 0, bitmap_width, bitmap_height);
 
   CefRenderHandler::RectList rcList;
-  rcList.push_back(CefRect(rect_in_bitmap.x(), rect_in_bitmap.y(),
-                           rect_in_bitmap.width(), rect_in_bitmap.height()));
+  if (IsPartialPaintEnabled()) {
+    // Deliver the non-overlapping rectangles that make up the damaged region.
+    for (cc::Region::Iterator it(damage_region); it.has_rect(); it.next()) {
+      gfx::Rect rect_in_bitmap = it.rect();
+      rect_in_bitmap.Intersect(bitmap_rect);
+      if (rect_in_bitmap.IsEmpty())
+        continue;
+      rcList.push_back(CefRect(rect_in_bitmap.x(), rect_in_bitmap.y(),
+                               rect_in_bitmap.width(),
+                               rect_in_bitmap.height()));
+    }
+  } else {
+    gfx::Rect rect_in_bitmap(bitmap_rect);
+    rect_in_bitmap.Intersect(damage_region.bounds());
+    rcList.push_back(CefRect(rect_in_bitmap.x(), rect_in_bitmap.y(),
+                             rect_in_bitmap.width(), rect_in_bitmap.height()));
+  }
 
   handler->OnPaint(
         browser_impl_.get(),
@@ -1311,6 +1406,10 @@ void CefRenderWidgetHostViewOSR::SetFrameRate() {
       ClampFrameRate(browser->settings().windowless_frame_rate);
   frame_rate_threshold_ms_ = 1000 / frame_rate;
 
+  frame_pacing_mode_ = browser->settings().windowless_frame_pacing;
+  adaptive_frame_interval_ms_ = frame_rate_threshold_ms_;
+  idle_begin_frame_count_ = 0;
+
   // Configure the VSync interval for the browser process.
   compositor_->vsync_manager()->SetAuthoritativeVSyncInterval(
       base::TimeDelta::FromMilliseconds(frame_rate_threshold_ms_));
@@ -1333,6 +1432,17 @@ void CefRenderWidgetHostViewOSR::SetFrameRate() {
   }
 }
 
+bool CefRenderWidgetHostViewOSR::IsPartialPaintEnabled() const {
+  CefRefPtr<CefBrowserHostImpl> browser;
+  if (parent_host_view_) {
+    // Use the same setting as the embedding browser.
+    browser = parent_host_view_->browser_impl_;
+  } else {
+    browser = browser_impl_;
+  }
+  return browser.get() && browser->settings().windowless_partial_paint;
+}
+
 void CefRenderWidgetHostViewOSR::SetDeviceScaleFactor() {
   if (browser_impl_.get())  {
     CefScreenInfo screen_info(
@@ -1373,21 +1483,62 @@ bool CefRenderWidgetHostViewOSR::IsFramePending() {
   if (!IsShowing())
     return false;
 
-  if (begin_frame_timer_.get())
+  if (begin_frame_timer_.get()) {
+    if (frame_pacing_mode_ == FRAME_PACING_EXTERNAL)
+      return needs_begin_frames_;
     return begin_frame_timer_->IsActive();
-  else if (copy_frame_generator_.get())
+  } else if (copy_frame_generator_.get())
     return copy_frame_generator_->frame_pending();
 
   return false;
 }
 
 void CefRenderWidgetHostViewOSR::OnBeginFrameTimerTick() {
+  if (frame_swapped_since_begin_frame_) {
+    idle_begin_frame_count_ = 0;
+  } else if (frame_statistics_.begin_frames > 0) {
+    // The previous BeginFrame did not produce new content.
+    frame_statistics_.idle_begin_frames++;
+
+    if (frame_pacing_mode_ == FRAME_PACING_ADAPTIVE &&
+        ++idle_begin_frame_count_ >= kAdaptiveIdleFrameLimit &&
+        adaptive_frame_interval_ms_ < kAdaptiveMaxFrameIntervalMs) {
+      // Back off while the content is idle.
+      idle_begin_frame_count_ = 0;
+      adaptive_frame_interval_ms_ =
+          std::min(adaptive_frame_interval_ms_ * 2,
+                   kAdaptiveMaxFrameIntervalMs);
+      begin_frame_timer_->SetFrameRateThresholdMs(adaptive_frame_interval_ms_);
+    }
+  }
+  frame_swapped_since_begin_frame_ = false;
+
+  frame_statistics_.begin_frames++;
+
   const base::TimeTicks frame_time = base::TimeTicks::Now();
   const base::TimeDelta vsync_period =
-      base::TimeDelta::FromMilliseconds(frame_rate_threshold_ms_);
+      base::TimeDelta::FromMilliseconds(
+          frame_pacing_mode_ == FRAME_PACING_ADAPTIVE ?
+              adaptive_frame_interval_ms_ : frame_rate_threshold_ms_);
   SendBeginFrame(frame_time, vsync_period);
 }
 
+void CefRenderWidgetHostViewOSR::ResetAdaptiveFrameInterval() {
+  if (!begin_frame_timer_.get() ||
+      frame_pacing_mode_ != FRAME_PACING_ADAPTIVE) {
+    return;
+  }
+
+  idle_begin_frame_count_ = 0;
+  if (adaptive_frame_interval_ms_ == frame_rate_threshold_ms_)
+    return;
+
+  // Return to the full frame rate. This also restarts the timer so that the
+  // next BeginFrame is sent within one full rate interval.
+  adaptive_frame_interval_ms_ = frame_rate_threshold_ms_;
+  begin_frame_timer_->SetFrameRateThresholdMs(frame_rate_threshold_ms_);
+}
+
 void CefRenderWidgetHostViewOSR::SendBeginFrame(base::TimeTicks frame_time,
                                                 base::TimeDelta vsync_period) {
   TRACE_EVENT1("libcef", "CefRenderWidgetHostViewOSR::SendBeginFrame",
@@ -14,6 +14,7 @@
 #include "include/cef_browser.h"
 
 #include "base/memory/weak_ptr.h"
+#include "cc/base/region.h"
 #include "content/browser/compositor/delegated_frame_host.h"
 #include "content/browser/renderer_host/render_widget_host_view_base.h"
 #include "ui/compositor/compositor.h"
@@ -238,15 +239,29 @@ class CefRenderWidgetHostViewOSR
   void SendMouseWheelEvent(const blink::WebMouseWheelEvent& event);
   void SendFocusEvent(bool focus);
   void UpdateFrameRate();
+  void SendExternalBeginFrame();
+
+  // Frame statistics reporting. The Record* methods are called by
+  // CefCopyFrameGenerator.
+  const CefFrameStatistics& frame_statistics() const {
+    return frame_statistics_;
+  }
+  void RecordFrameCoalesced();
+  void RecordFrameCaptureRetry();
+  void RecordFrameCaptureLatency(base::TimeDelta latency);
 
   void HoldResize();
   void ReleaseResize();
 
-  void OnPaint(const gfx::Rect& damage_rect,
+  void OnPaint(const cc::Region& damage_region,
                int bitmap_width,
                int bitmap_height,
                void* bitmap_pixels);
 
+  // Returns true if CefBrowserSettings.windowless_partial_paint is enabled for
+  // the associated browser.
+  bool IsPartialPaintEnabled() const;
+
   bool IsPopupWidget() const {
     return popup_type_ != blink::WebPopupTypeNone;
   }
@@ -296,6 +311,10 @@ class CefRenderWidgetHostViewOSR
 
   // Called by CefBeginFrameTimer to send a BeginFrame request.
   void OnBeginFrameTimerTick();
+
+  // Restore the full frame rate when adaptive frame pacing is enabled. Called
+  // when new content is received or input is sent to the renderer.
+  void ResetAdaptiveFrameInterval();
   void SendBeginFrame(base::TimeTicks frame_time,
                       base::TimeDelta vsync_period);
 
@@ -331,6 +350,15 @@ class CefRenderWidgetHostViewOSR
   float scale_factor_;
   int frame_rate_threshold_ms_;
 
+  // Frame pacing state. Only used when BeginFrame scheduling is enabled.
+  cef_frame_pacing_mode_t frame_pacing_mode_;
+  bool needs_begin_frames_;
+  int adaptive_frame_interval_ms_;
+  int idle_begin_frame_count_;
+  bool frame_swapped_since_begin_frame_;
+
+  CefFrameStatistics frame_statistics_;
+
   scoped_ptr<content::DelegatedFrameHost> delegated_frame_host_;
   scoped_ptr<ui::Compositor> compositor_;
   gfx::AcceleratedWidget compositor_widget_;
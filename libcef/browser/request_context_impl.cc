@@ -9,6 +9,7 @@
 #include "libcef/browser/context.h"
 #include "libcef/browser/cookie_manager_impl.h"
 #include "libcef/browser/thread_util.h"
+#include "libcef/browser/url_request_context_getter_impl.h"
 #include "libcef/common/values_impl.h"
 
 #include "base/atomic_sequence_num.h"
@@ -16,6 +17,9 @@
 #include "base/prefs/pref_service.h"
 #include "base/strings/stringprintf.h"
 #include "content/public/browser/plugin_service.h"
+#include "net/base/net_errors.h"
+#include "net/disk_cache/disk_cache.h"
+#include "net/http/http_util.h"
 
 using content::BrowserThread;
 
@@ -47,6 +51,43 @@ const char* GetTypeString(base::Value::Type type) {
   return "UNKNOWN";
 }
 
+void OnCacheStatisticsBackend(
+    CefRefPtr<CefCacheStatisticsCallback> callback,
+    const CefNetworkDelegate::CacheStatistics& statistics,
+    disk_cache::Backend* backend) {
+  callback->OnComplete(statistics.hit_count,
+                       statistics.miss_count,
+                       statistics.cached_bytes,
+                       statistics.network_bytes,
+                       backend ? backend->GetEntryCount() : -1);
+}
+
+void OnCacheEntryPreloaded(CefRefPtr<CefCacheEntryCallback> callback,
+                           bool success) {
+  if (callback.get())
+    callback->OnComplete(success);
+}
+
+void OnCacheEntryEvicted(CefRefPtr<CefCacheEntryCallback> callback, int rv) {
+  if (callback.get())
+    callback->OnComplete(rv == net::OK);
+}
+
+void OnEvictCacheEntryBackend(const std::string& key,
+                              CefRefPtr<CefCacheEntryCallback> callback,
+                              disk_cache::Backend* backend) {
+  if (!backend) {
+    OnCacheEntryEvicted(callback, net::ERR_FAILED);
+    return;
+  }
+
+  net::CompletionCallback completion =
+      base::Bind(&OnCacheEntryEvicted, callback);
+  const int rv = backend->DoomEntry(key, completion);
+  if (rv != net::ERR_IO_PENDING)
+    completion.Run(rv);
+}
+
 }  // namespace
 
 
@@ -444,6 +485,37 @@ bool CefRequestContextImpl::SetPreference(const CefString& name,
   return true;
 }
 
+void CefRequestContextImpl::GetCacheStatistics(
+    CefRefPtr<CefCacheStatisticsCallback> callback) {
+  if (!callback.get()) {
+    NOTREACHED() << "invalid parameter";
+    return;
+  }
+
+  GetRequestContextImpl(
+      BrowserThread::GetMessageLoopProxyForThread(BrowserThread::IO),
+      base::Bind(&CefRequestContextImpl::GetCacheStatisticsInternal,
+                 this, callback));
+}
+
+void CefRequestContextImpl::PreloadCacheEntry(
+    const CefString& url,
+    CefRefPtr<CefCacheEntryCallback> callback) {
+  GetRequestContextImpl(
+      BrowserThread::GetMessageLoopProxyForThread(BrowserThread::IO),
+      base::Bind(&CefRequestContextImpl::PreloadCacheEntryInternal,
+                 this, url, callback));
+}
+
+void CefRequestContextImpl::EvictCacheEntry(
+    const CefString& url,
+    CefRefPtr<CefCacheEntryCallback> callback) {
+  GetRequestContextImpl(
+      BrowserThread::GetMessageLoopProxyForThread(BrowserThread::IO),
+      base::Bind(&CefRequestContextImpl::EvictCacheEntryInternal,
+                 this, url, callback));
+}
+
 CefRequestContextImpl::CefRequestContextImpl(
     scoped_refptr<CefBrowserContext> browser_context)
     : browser_context_(browser_context),
@@ -548,3 +620,48 @@ void CefRequestContextImpl::PurgePluginListCacheInternal(
   content::PluginService::GetInstance()->PurgePluginListCache(
       browser_context.get(), false);
 }
+
+void CefRequestContextImpl::GetCacheStatisticsInternal(
+    CefRefPtr<CefCacheStatisticsCallback> callback,
+    scoped_refptr<CefURLRequestContextGetterImpl> request_context) {
+  CEF_REQUIRE_IOT();
+  request_context->GetCacheBackend(
+      base::Bind(&OnCacheStatisticsBackend, callback,
+                 request_context->GetCacheStatistics()));
+}
+
+void CefRequestContextImpl::PreloadCacheEntryInternal(
+    const CefString& url,
+    CefRefPtr<CefCacheEntryCallback> callback,
+    scoped_refptr<CefURLRequestContextGetterImpl> request_context) {
+  CEF_REQUIRE_IOT();
+
+  const GURL gurl = GURL(url.ToString());
+  if (!gurl.SchemeIsHTTPOrHTTPS()) {
+    if (callback.get())
+      callback->OnComplete(false);
+    return;
+  }
+
+  request_context->PreloadCacheEntry(
+      gurl, base::Bind(&OnCacheEntryPreloaded, callback));
+}
+
+void CefRequestContextImpl::EvictCacheEntryInternal(
+    const CefString& url,
+    CefRefPtr<CefCacheEntryCallback> callback,
+    scoped_refptr<CefURLRequestContextGetterImpl> request_context) {
+  CEF_REQUIRE_IOT();
+
+  const GURL gurl = GURL(url.ToString());
+  if (!gurl.is_valid()) {
+    if (callback.get())
+      callback->OnComplete(false);
+    return;
+  }
+
+  // Matches the key used by net::HttpCache for GET requests.
+  request_context->GetCacheBackend(
+      base::Bind(&OnEvictCacheEntryBackend,
+                 net::HttpUtil::SpecForRequest(gurl), callback));
+}
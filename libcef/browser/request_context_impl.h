@@ -69,6 +69,12 @@ class CefRequestContextImpl : public CefRequestContext {
   bool SetPreference(const CefString& name,
                      CefRefPtr<CefValue> value,
                      CefString& error) override;
+  void GetCacheStatistics(
+      CefRefPtr<CefCacheStatisticsCallback> callback) override;
+  void PreloadCacheEntry(const CefString& url,
+                         CefRefPtr<CefCacheEntryCallback> callback) override;
+  void EvictCacheEntry(const CefString& url,
+                       CefRefPtr<CefCacheEntryCallback> callback) override;
 
   const CefRequestContextSettings& settings() const { return settings_; }
 
@@ -103,6 +109,17 @@ class CefRequestContextImpl : public CefRequestContext {
   void PurgePluginListCacheInternal(
       bool reload_pages,
       scoped_refptr<CefBrowserContext> browser_context);
+  void GetCacheStatisticsInternal(
+      CefRefPtr<CefCacheStatisticsCallback> callback,
+      scoped_refptr<CefURLRequestContextGetterImpl> request_context);
+  void PreloadCacheEntryInternal(
+      const CefString& url,
+      CefRefPtr<CefCacheEntryCallback> callback,
+      scoped_refptr<CefURLRequestContextGetterImpl> request_context);
+  void EvictCacheEntryInternal(
+      const CefString& url,
+      CefRefPtr<CefCacheEntryCallback> callback,
+      scoped_refptr<CefURLRequestContextGetterImpl> request_context);
 
   scoped_refptr<CefBrowserContext> browser_context_;
   CefRequestContextSettings settings_;
@@ -5,6 +5,9 @@
 
 #include "libcef/browser/resource_request_job.h"
 
+#include <string.h>
+
+#include <algorithm>
 #include <map>
 #include <vector>
 
@@ -154,6 +157,10 @@ CefResourceRequestJob::CefResourceRequestJob(
     : net::URLRequestJob(request, network_delegate),
       handler_(handler),
       done_(false),
+      read_mode_(READ_MODE_UNKNOWN),
+      data_block_data_(NULL),
+      data_block_size_(0),
+      data_block_offset_(0),
       remaining_bytes_(0),
       response_cookies_save_index_(0),
       weak_factory_(this) {
@@ -209,6 +216,11 @@ void CefResourceRequestJob::Kill() {
     handler_->Cancel();
   }
 
+  // Release the current data block, if any.
+  data_block_ = NULL;
+  data_block_data_ = NULL;
+  data_block_size_ = data_block_offset_ = 0;
+
   if (callback_.get()) {
     callback_->Detach();
     callback_ = NULL;
@@ -246,6 +258,17 @@ bool CefResourceRequestJob::ReadRawData(net::IOBuffer* dest, int dest_size,
     dest_size = static_cast<int>(remaining_bytes_);
   }
 
+  if (read_mode_ != READ_MODE_READ_RESPONSE &&
+      ReadDataBlock(dest->data(), dest_size, bytes_read)) {
+    if (*bytes_read == 0) {
+      // The handler has no more data blocks.
+      done_ = true;
+    } else if (remaining_bytes_ > 0) {
+      remaining_bytes_ -= *bytes_read;
+    }
+    return true;
+  }
+
   if (!callback_.get()) {
     // Create the bytes available callback that will be used until the request
     // is completed.
@@ -281,6 +304,45 @@ bool CefResourceRequestJob::ReadRawData(net::IOBuffer* dest, int dest_size,
   return true;
 }
 
+// Copy up to |dest_size| bytes from the handler's data blocks into |dest|.
+// Returns false if the handler does not provide data blocks, in which case
+// ReadResponse() should be used instead. Data is copied directly from the
+// block into the destination buffer owned by the consumer.
+bool CefResourceRequestJob::ReadDataBlock(char* dest, int dest_size,
+                                          int* bytes_read) {
+  while (data_block_offset_ >= data_block_size_) {
+    // Request the next data block. Empty blocks are skipped.
+    data_block_ = handler_->GetResponseDataBlock();
+    data_block_offset_ = 0;
+    if (data_block_.get()) {
+      read_mode_ = READ_MODE_DATA_BLOCK;
+      data_block_data_ = static_cast<const char*>(data_block_->GetData());
+      data_block_size_ = data_block_data_ ? data_block_->GetSize() : 0;
+    } else {
+      data_block_data_ = NULL;
+      data_block_size_ = 0;
+
+      if (read_mode_ == READ_MODE_UNKNOWN) {
+        // The handler does not provide data blocks.
+        read_mode_ = READ_MODE_READ_RESPONSE;
+        return false;
+      }
+
+      // No more data.
+      *bytes_read = 0;
+      return true;
+    }
+  }
+
+  const int copy_size = static_cast<int>(
+      std::min(static_cast<size_t>(dest_size),
+               data_block_size_ - data_block_offset_));
+  memcpy(dest, data_block_data_ + data_block_offset_, copy_size);
+  data_block_offset_ += copy_size;
+  *bytes_read = copy_size;
+  return true;
+}
+
 void CefResourceRequestJob::GetResponseInfo(net::HttpResponseInfo* info) {
   CEF_REQUIRE_IOT();
 
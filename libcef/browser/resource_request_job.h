@@ -44,6 +44,9 @@ class CefResourceRequestJob : public net::URLRequestJob {
 
   void SendHeaders();
 
+  // Used for reading response data from CefResourceDataBlock objects.
+  bool ReadDataBlock(char* dest, int dest_size, int* bytes_read);
+
   // Used for sending cookies with the request.
   void AddCookieHeaderAndStart();
   void DoLoadCookies();
@@ -62,6 +65,21 @@ class CefResourceRequestJob : public net::URLRequestJob {
 
   CefRefPtr<CefResourceHandler> handler_;
   bool done_;
+
+  // How response data is retrieved from the handler.
+  enum ReadMode {
+    READ_MODE_UNKNOWN,
+    READ_MODE_DATA_BLOCK,
+    READ_MODE_READ_RESPONSE,
+  };
+  ReadMode read_mode_;
+
+  // Current data block and read position when using READ_MODE_DATA_BLOCK.
+  CefRefPtr<CefResourceDataBlock> data_block_;
+  const char* data_block_data_;
+  size_t data_block_size_;
+  size_t data_block_offset_;
+
   CefRefPtr<CefResponse> response_;
   GURL redirect_url_;
   int64 remaining_bytes_;
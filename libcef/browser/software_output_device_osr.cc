@@ -16,10 +16,14 @@
 CefSoftwareOutputDeviceOSR::CefSoftwareOutputDeviceOSR(
     ui::Compositor* compositor,
     bool transparent,
+    bool partial_paint,
     const OnPaintCallback& callback)
     : transparent_(transparent),
+      partial_paint_(partial_paint),
       callback_(callback),
-      active_(false) {
+      active_(false),
+      front_index_(0),
+      paint_index_(0) {
   CEF_REQUIRE_UIT();
   DCHECK(!callback_.is_null());
 }
@@ -39,43 +43,63 @@ void CefSoftwareOutputDeviceOSR::Resize(const gfx::Size& viewport_pixel_size,
 
   viewport_pixel_size_ = viewport_pixel_size;
 
-  canvas_.reset(NULL);
-  bitmap_.reset(new SkBitmap);
-  bitmap_->allocN32Pixels(viewport_pixel_size.width(),
-                          viewport_pixel_size.height(),
-                          !transparent_);
-  if (bitmap_->drawsNothing()) {
-    NOTREACHED();
-    bitmap_.reset(NULL);
-    return;
-  }
+  front_index_ = 0;
+  paint_index_ = 0;
+
+  const int surface_count = partial_paint_ ? 2 : 1;
+  for (int i = 0; i < surface_count; ++i) {
+    stale_region_[i].Clear();
 
-  if (transparent_)
-    bitmap_->eraseARGB(0, 0, 0, 0);
+    canvas_[i].reset(NULL);
+    bitmap_[i].reset(new SkBitmap);
+    bitmap_[i]->allocN32Pixels(viewport_pixel_size.width(),
+                               viewport_pixel_size.height(),
+                               !transparent_);
+    if (bitmap_[i]->drawsNothing()) {
+      NOTREACHED();
+      bitmap_[i].reset(NULL);
+      return;
+    }
 
-  canvas_.reset(new SkCanvas(*bitmap_.get()));
+    if (transparent_)
+      bitmap_[i]->eraseARGB(0, 0, 0, 0);
+
+    canvas_[i].reset(new SkCanvas(*bitmap_[i].get()));
+  }
 }
 
 SkCanvas* CefSoftwareOutputDeviceOSR::BeginPaint(const gfx::Rect& damage_rect) {
   CEF_REQUIRE_UIT();
-  DCHECK(canvas_.get());
-  DCHECK(bitmap_.get());
+
+  // Paint into the surface that is not currently being presented.
+  paint_index_ = partial_paint_ ? 1 - front_index_ : 0;
+
+  DCHECK(canvas_[paint_index_].get());
+  DCHECK(bitmap_[paint_index_].get());
 
   damage_rect_ = damage_rect;
 
-  return canvas_.get();
+  return canvas_[paint_index_].get();
 }
 
 void CefSoftwareOutputDeviceOSR::EndPaint() {
   CEF_REQUIRE_UIT();
-  DCHECK(canvas_.get());
-  DCHECK(bitmap_.get());
+  DCHECK(canvas_[paint_index_].get());
+  DCHECK(bitmap_[paint_index_].get());
 
-  if (!bitmap_.get())
+  if (!bitmap_[paint_index_].get())
     return;
 
   cc::SoftwareOutputDevice::EndPaint();
 
+  if (partial_paint_) {
+    // The damaged region is now current in the painted surface and out of
+    // date in the other surface.
+    stale_region_[paint_index_].Subtract(damage_rect_);
+    stale_region_[1 - paint_index_].Union(damage_rect_);
+    front_index_ = paint_index_;
+  }
+
   if (active_)
     OnPaint(damage_rect_);
 }
@@ -86,29 +110,71 @@ void CefSoftwareOutputDeviceOSR::SetActive(bool active) {
   active_ = active;
 
   // Call OnPaint immediately if deactivated while a damage rect is pending.
-  if (!active_ && !pending_damage_rect_.IsEmpty())
-    OnPaint(pending_damage_rect_);
+  if (!active_ && !pending_damage_region_.IsEmpty())
+    OnPaint(gfx::Rect());
 }
 
 void CefSoftwareOutputDeviceOSR::Invalidate(const gfx::Rect& damage_rect) {
-  if (pending_damage_rect_.IsEmpty())
-    pending_damage_rect_ = damage_rect;
-  else
-    pending_damage_rect_.Union(damage_rect);
+  pending_damage_region_.Union(damage_rect);
 }
 
 void CefSoftwareOutputDeviceOSR::OnPaint(const gfx::Rect& damage_rect) {
-  gfx::Rect rect = damage_rect;
-  if (!pending_damage_rect_.IsEmpty()) {
-    rect.Union(pending_damage_rect_);
-    pending_damage_rect_.SetRect(0, 0, 0, 0);
+  cc::Region region(damage_rect);
+  if (!pending_damage_region_.IsEmpty()) {
+    region.Union(pending_damage_region_);
+    pending_damage_region_.Clear();
   }
 
-  rect.Intersect(gfx::Rect(viewport_pixel_size_));
-  if (rect.IsEmpty())
+  region.Intersect(gfx::Rect(viewport_pixel_size_));
+  if (region.IsEmpty())
+    return;
+
+  SkBitmap* bitmap = bitmap_[front_index_].get();
+  if (!bitmap)
     return;
 
-  SkAutoLockPixels bitmap_pixels_lock(*bitmap_.get());
-  callback_.Run(rect, bitmap_->width(), bitmap_->height(),
-                bitmap_->getPixels());
+  // Invalidated regions that were not redrawn by the compositor may be out of
+  // date in the front surface.
+  if (partial_paint_)
+    UpdateStaleRegion(front_index_, region);
+
+  SkAutoLockPixels bitmap_pixels_lock(*bitmap);
+  callback_.Run(region, bitmap->width(), bitmap->height(),
+                bitmap->getPixels());
+}
+
+void CefSoftwareOutputDeviceOSR::UpdateStaleRegion(int index,
+                                                   const cc::Region& region) {
+  DCHECK(partial_paint_);
+
+  cc::Region stale_region = stale_region_[index];
+  stale_region.Intersect(region);
+  if (stale_region.IsEmpty())
+    return;
+
+  SkBitmap* target = bitmap_[index].get();
+  SkBitmap* source = bitmap_[1 - index].get();
+  if (!target || !source)
+    return;
+
+  SkAutoLockPixels target_pixels_lock(*target);
+  SkAutoLockPixels source_pixels_lock(*source);
+
+  const size_t row_bytes = target->rowBytes();
+  DCHECK_EQ(row_bytes, source->rowBytes());
+  uint8* target_pixels = static_cast<uint8*>(target->getPixels());
+  const uint8* source_pixels = static_cast<const uint8*>(source->getPixels());
+
+  for (cc::Region::Iterator it(stale_region); it.has_rect(); it.next()) {
+    const gfx::Rect& rect = it.rect();
+    const size_t offset = rect.x() * target->bytesPerPixel();
+    const size_t length = rect.width() * target->bytesPerPixel();
+    for (int y = rect.y(); y < rect.bottom(); ++y) {
+      memcpy(target_pixels + y * row_bytes + offset,
+             source_pixels + y * row_bytes + offset,
+             length);
+    }
+  }
+
+  stale_region_[index].Subtract(stale_region);
 }
@@ -8,6 +8,7 @@
 
 #include "base/callback.h"
 #include "base/memory/scoped_ptr.h"
+#include "cc/base/region.h"
 #include "cc/output/software_output_device.h"
 
 namespace ui {
@@ -16,13 +17,21 @@ class Compositor;
 
 // Device implementation for direct software rendering via DelegatedFrameHost.
 // All Rect/Size values are in pixels.
+//
+// When |partial_paint| is true two pixel surfaces are used. The compositor
+// draws the damaged region of each new frame into the surface that was not
+// passed to the most recent OnPaint call so that the client can continue
+// reading the previous frame. Regions of a surface that were not redrawn are
+// not copied forward and only the damaged region of each frame is guaranteed
+// to be valid.
 class CefSoftwareOutputDeviceOSR : public cc::SoftwareOutputDevice {
  public:
-  typedef base::Callback<void(const gfx::Rect&,int,int,void*)>
+  typedef base::Callback<void(const cc::Region&,int,int,void*)>
       OnPaintCallback;
 
   CefSoftwareOutputDeviceOSR(ui::Compositor* compositor,
                              bool transparent,
+                             bool partial_paint,
                              const OnPaintCallback& callback);
   ~CefSoftwareOutputDeviceOSR() override;
 
@@ -41,13 +50,32 @@ class CefSoftwareOutputDeviceOSR : public cc::SoftwareOutputDevice {
   void OnPaint(const gfx::Rect& damage_rect);
 
  private:
+  // Copy the portion of |region| that is stale in the surface at |index| from
+  // the other surface. Only used when |partial_paint_| is true.
+  void UpdateStaleRegion(int index, const cc::Region& region);
+
   const bool transparent_;
+  const bool partial_paint_;
   const OnPaintCallback callback_;
 
   bool active_;
-  scoped_ptr<SkCanvas> canvas_;
-  scoped_ptr<SkBitmap> bitmap_;
-  gfx::Rect pending_damage_rect_;
+
+  // Pixel surfaces. Only the first surface is used if |partial_paint_| is
+  // false.
+  scoped_ptr<SkCanvas> canvas_[2];
+  scoped_ptr<SkBitmap> bitmap_[2];
+
+  // Regions of each surface that were redrawn in the other surface and are
+  // therefore out of date.
+  cc::Region stale_region_[2];
+
+  // Index of the surface passed to the most recent OnPaint call.
+  int front_index_;
+
+  // Index of the surface that is currently being painted.
+  int paint_index_;
+
+  cc::Region pending_damage_region_;
 
   DISALLOW_COPY_AND_ASSIGN(CefSoftwareOutputDeviceOSR);
 };
@@ -47,6 +47,80 @@ bool CefEndTracing(const CefString& tracing_file,
   return subscriber->EndTracing(base::FilePath(tracing_file), callback);
 }
 
+bool CefEndTracingToCallback(CefRefPtr<CefTraceDataCallback> callback) {
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return false;
+  }
+
+  if (!CEF_CURRENTLY_ON_UIT()) {
+    NOTREACHED() << "called on invalid thread";
+    return false;
+  }
+
+  CefTraceSubscriber* subscriber = CefContext::Get()->GetTraceSubscriber();
+  if (!subscriber)
+    return false;
+
+  return subscriber->EndTracing(callback);
+}
+
+bool CefBeginTraceMonitoring(const CefString& categories,
+                             CefRefPtr<CefCompletionCallback> callback) {
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return false;
+  }
+
+  if (!CEF_CURRENTLY_ON_UIT()) {
+    NOTREACHED() << "called on invalid thread";
+    return false;
+  }
+
+  CefTraceSubscriber* subscriber = CefContext::Get()->GetTraceSubscriber();
+  if (!subscriber)
+    return false;
+
+  return subscriber->BeginMonitoring(categories, callback);
+}
+
+bool CefCaptureTraceMonitoringSnapshot(
+    CefRefPtr<CefTraceDataCallback> callback) {
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return false;
+  }
+
+  if (!CEF_CURRENTLY_ON_UIT()) {
+    NOTREACHED() << "called on invalid thread";
+    return false;
+  }
+
+  CefTraceSubscriber* subscriber = CefContext::Get()->GetTraceSubscriber();
+  if (!subscriber)
+    return false;
+
+  return subscriber->CaptureMonitoringSnapshot(callback);
+}
+
+bool CefEndTraceMonitoring(CefRefPtr<CefCompletionCallback> callback) {
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return false;
+  }
+
+  if (!CEF_CURRENTLY_ON_UIT()) {
+    NOTREACHED() << "called on invalid thread";
+    return false;
+  }
+
+  CefTraceSubscriber* subscriber = CefContext::Get()->GetTraceSubscriber();
+  if (!subscriber)
+    return false;
+
+  return subscriber->EndMonitoring(callback);
+}
+
 int64 CefNowFromSystemTraceTime() {
   return base::TimeTicks::Now().ToInternalValue();
 }
@@ -24,12 +24,88 @@ void CreateTemporaryFileOnFileThread(
   message_loop_proxy->PostTask(FROM_HERE, base::Bind(callback, file_path));
 }
 
+// Trace options used for monitoring. The ring buffer discards the oldest
+// events once full. TraceConfig does not expose the ring buffer size or a
+// duration limit, so neither can be passed through CefBeginTraceMonitoring.
+const char kMonitoringTraceOptions[] = "record-continuously";
+
+// Wrapping used by TracingController::CreateFileSink for the trace events.
+const char kTraceDataPrefix[] = "{\"traceEvents\":[";
+const char kTraceDataSeparator[] = ",";
+const char kTraceDataSuffix[] = "]}";
+
+// Delivers trace data to a CefTraceDataCallback in memory using the same JSON
+// layout as the tracing file. Chunks received on the UI thread are passed
+// through without copying. Chunks received on other threads are copied when
+// bound to the task that posts them to the UI thread.
+class CefTraceDataSink : public content::TracingController::TraceDataSink {
+ public:
+  CefTraceDataSink(CefRefPtr<CefTraceDataCallback> callback,
+                   const base::Closure& done_callback)
+      : callback_(callback),
+        done_callback_(done_callback),
+        started_(false) {
+  }
+
+  // TracingController::TraceDataSink methods.
+  void AddTraceChunk(const std::string& chunk) override {
+    if (!CEF_CURRENTLY_ON_UIT()) {
+      CEF_POST_TASK(CEF_UIT,
+          base::Bind(&CefTraceDataSink::AddTraceChunk, this, chunk));
+      return;
+    }
+
+    if (chunk.empty())
+      return;
+
+    if (!started_) {
+      Write(kTraceDataPrefix, sizeof(kTraceDataPrefix) - 1);
+      started_ = true;
+    } else {
+      Write(kTraceDataSeparator, sizeof(kTraceDataSeparator) - 1);
+    }
+    Write(chunk.data(), chunk.size());
+  }
+
+  void Close() override {
+    if (!CEF_CURRENTLY_ON_UIT()) {
+      CEF_POST_TASK(CEF_UIT, base::Bind(&CefTraceDataSink::Close, this));
+      return;
+    }
+
+    if (!started_)
+      Write(kTraceDataPrefix, sizeof(kTraceDataPrefix) - 1);
+    Write(kTraceDataSuffix, sizeof(kTraceDataSuffix) - 1);
+
+    callback_->OnTraceDataComplete();
+    callback_ = NULL;
+
+    if (!done_callback_.is_null())
+      done_callback_.Run();
+  }
+
+ private:
+  ~CefTraceDataSink() override {}
+
+  void Write(const char* data, size_t data_size) {
+    callback_->OnTraceDataChunk(data, data_size);
+  }
+
+  CefRefPtr<CefTraceDataCallback> callback_;
+  base::Closure done_callback_;
+  bool started_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefTraceDataSink);
+};
+
 }  // namespace
 
 using content::TracingController;
 
 CefTraceSubscriber::CefTraceSubscriber()
     : collecting_trace_data_(false),
+      monitoring_trace_data_(false),
+      capturing_monitoring_snapshot_(false),
       weak_factory_(this) {
   CEF_REQUIRE_UIT();
 }
@@ -38,6 +114,10 @@ CefTraceSubscriber::~CefTraceSubscriber() {
   CEF_REQUIRE_UIT();
   if (collecting_trace_data_)
     TracingController::GetInstance()->DisableRecording(NULL);
+  if (monitoring_trace_data_) {
+    TracingController::GetInstance()->DisableMonitoring(
+        TracingController::DisableMonitoringDoneCallback());
+  }
 }
 
 bool CefTraceSubscriber::BeginTracing(
@@ -96,6 +176,81 @@ bool CefTraceSubscriber::EndTracing(
   return true;
 }
 
+bool CefTraceSubscriber::EndTracing(
+    CefRefPtr<CefTraceDataCallback> callback) {
+  CEF_REQUIRE_UIT();
+  DCHECK(callback.get());
+
+  if (!collecting_trace_data_)
+    return false;
+
+  scoped_refptr<TracingController::TraceDataSink> sink =
+      new CefTraceDataSink(callback,
+          base::Bind(&CefTraceSubscriber::OnTracingDataResult,
+                     weak_factory_.GetWeakPtr()));
+  return TracingController::GetInstance()->DisableRecording(sink);
+}
+
+bool CefTraceSubscriber::BeginMonitoring(
+    const std::string& categories,
+    CefRefPtr<CefCompletionCallback> callback) {
+  CEF_REQUIRE_UIT();
+
+  if (monitoring_trace_data_)
+    return false;
+
+  TracingController::EnableMonitoringDoneCallback done_callback;
+  if (callback.get()) {
+    done_callback =
+        base::Bind(&CefCompletionCallback::OnComplete, callback.get());
+  }
+
+  if (!TracingController::GetInstance()->EnableMonitoring(
+          base::trace_event::TraceConfig(categories, kMonitoringTraceOptions),
+          done_callback)) {
+    return false;
+  }
+
+  monitoring_trace_data_ = true;
+  return true;
+}
+
+bool CefTraceSubscriber::CaptureMonitoringSnapshot(
+    CefRefPtr<CefTraceDataCallback> callback) {
+  CEF_REQUIRE_UIT();
+  DCHECK(callback.get());
+
+  if (!monitoring_trace_data_ || capturing_monitoring_snapshot_)
+    return false;
+
+  scoped_refptr<TracingController::TraceDataSink> sink =
+      new CefTraceDataSink(callback,
+          base::Bind(&CefTraceSubscriber::OnMonitoringSnapshotResult,
+                     weak_factory_.GetWeakPtr()));
+  if (!TracingController::GetInstance()->CaptureMonitoringSnapshot(sink))
+    return false;
+
+  capturing_monitoring_snapshot_ = true;
+  return true;
+}
+
+bool CefTraceSubscriber::EndMonitoring(
+    CefRefPtr<CefCompletionCallback> callback) {
+  CEF_REQUIRE_UIT();
+
+  if (!monitoring_trace_data_)
+    return false;
+
+  TracingController::DisableMonitoringDoneCallback done_callback;
+  if (callback.get()) {
+    done_callback =
+        base::Bind(&CefCompletionCallback::OnComplete, callback.get());
+  }
+
+  monitoring_trace_data_ = false;
+  return TracingController::GetInstance()->DisableMonitoring(done_callback);
+}
+
 void CefTraceSubscriber::ContinueEndTracing(
     CefRefPtr<CefEndTracingCallback> callback,
     const base::FilePath& tracing_file) {
@@ -113,3 +268,13 @@ void CefTraceSubscriber::OnTracingFileResult(
 
   callback->OnEndTracingComplete(tracing_file.value());
 }
+
+void CefTraceSubscriber::OnTracingDataResult() {
+  CEF_REQUIRE_UIT();
+  collecting_trace_data_ = false;
+}
+
+void CefTraceSubscriber::OnMonitoringSnapshotResult() {
+  CEF_REQUIRE_UIT();
+  capturing_monitoring_snapshot_ = false;
+}
@@ -23,14 +23,24 @@ class CefTraceSubscriber {
                     CefRefPtr<CefCompletionCallback> callback);
   bool EndTracing(const base::FilePath& tracing_file,
                   CefRefPtr<CefEndTracingCallback> callback);
+  bool EndTracing(CefRefPtr<CefTraceDataCallback> callback);
+
+  bool BeginMonitoring(const std::string& categories,
+                       CefRefPtr<CefCompletionCallback> callback);
+  bool CaptureMonitoringSnapshot(CefRefPtr<CefTraceDataCallback> callback);
+  bool EndMonitoring(CefRefPtr<CefCompletionCallback> callback);
 
  private:
   void ContinueEndTracing(CefRefPtr<CefEndTracingCallback> callback,
                           const base::FilePath& tracing_file);
   void OnTracingFileResult(CefRefPtr<CefEndTracingCallback> callback,
                            const base::FilePath& tracing_file);
+  void OnTracingDataResult();
+  void OnMonitoringSnapshotResult();
 
   bool collecting_trace_data_;
+  bool monitoring_trace_data_;
+  bool capturing_monitoring_snapshot_;
   base::WeakPtrFactory<CefTraceSubscriber> weak_factory_;
 };
 
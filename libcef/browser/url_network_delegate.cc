@@ -320,6 +320,24 @@ net::NetworkDelegate::AuthRequiredResponse CefNetworkDelegate::OnAuthRequired(
   return AUTH_REQUIRED_RESPONSE_NO_ACTION;
 }
 
+void CefNetworkDelegate::OnCompleted(net::URLRequest* request, bool started) {
+  if (!started || !request->status().is_success() ||
+      !request->url().SchemeIsHTTPOrHTTPS()) {
+    return;
+  }
+
+  if (request->was_cached()) {
+    cache_statistics_.hit_count++;
+    cache_statistics_.cached_bytes +=
+        request->received_response_content_length();
+  } else {
+    cache_statistics_.miss_count++;
+  }
+
+  // Includes the bytes received when revalidating a cached response.
+  cache_statistics_.network_bytes += request->GetTotalReceivedBytes();
+}
+
 bool CefNetworkDelegate::OnCanAccessFile(const net::URLRequest& request,
                                          const base::FilePath& path) const {
   return true;
@@ -6,6 +6,7 @@
 #define CEF_LIBCEF_BROWSER_URL_NETWORK_DELEGATE_H_
 #pragma once
 
+#include "base/basictypes.h"
 #include "net/base/network_delegate_impl.h"
 
 // Used for intercepting resource requests, redirects and responses. The single
@@ -15,6 +16,23 @@ class CefNetworkDelegate : public net::NetworkDelegateImpl {
   CefNetworkDelegate();
   ~CefNetworkDelegate() override;
 
+  // HTTP cache usage for HTTP and HTTPS requests completed via this delegate.
+  struct CacheStatistics {
+    CacheStatistics()
+        : hit_count(0),
+          miss_count(0),
+          cached_bytes(0),
+          network_bytes(0) {}
+
+    int64 hit_count;
+    int64 miss_count;
+    int64 cached_bytes;
+    int64 network_bytes;
+  };
+
+  // Only accessed on the IO thread.
+  const CacheStatistics& cache_statistics() const { return cache_statistics_; }
+
  private:
   // net::NetworkDelegate methods.
   int OnBeforeURLRequest(net::URLRequest* request,
@@ -25,9 +43,12 @@ class CefNetworkDelegate : public net::NetworkDelegateImpl {
       const net::AuthChallengeInfo& auth_info,
       const AuthCallback& callback,
       net::AuthCredentials* credentials) override;
+  void OnCompleted(net::URLRequest* request, bool started) override;
   bool OnCanAccessFile(const net::URLRequest& request,
                        const base::FilePath& path) const override;
 
+  CacheStatistics cache_statistics_;
+
   DISALLOW_COPY_AND_ASSIGN(CefNetworkDelegate);
 };
 
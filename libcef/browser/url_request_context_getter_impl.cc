@@ -7,6 +7,7 @@
 #if defined(OS_WIN)
 #include <winhttp.h>
 #endif
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -18,6 +19,7 @@
 #include "libcef/common/cef_switches.h"
 #include "libcef/common/content_client.h"
 
+#include "base/bind.h"
 #include "base/command_line.h"
 #include "base/files/file_util.h"
 #include "base/logging.h"
@@ -30,6 +32,7 @@
 #include "content/public/common/content_client.h"
 #include "content/public/common/content_switches.h"
 #include "content/public/common/url_constants.h"
+#include "net/base/net_errors.h"
 #include "net/cert/cert_verifier.h"
 #include "net/cookies/cookie_monster.h"
 #include "net/extras/sqlite/sqlite_persistent_cookie_store.h"
@@ -46,8 +49,12 @@
 #include "net/ssl/ssl_config_service_defaults.h"
 #include "url/url_constants.h"
 #include "net/url_request/http_user_agent_settings.h"
+#include "net/url_request/url_fetcher.h"
+#include "net/url_request/url_fetcher_delegate.h"
+#include "net/url_request/url_fetcher_response_writer.h"
 #include "net/url_request/url_request.h"
 #include "net/url_request/url_request_context.h"
+#include "net/url_request/url_request_context_getter.h"
 #include "net/url_request/url_request_context_storage.h"
 #include "net/url_request/url_request_intercepting_job_factory.h"
 #include "net/url_request/url_request_job_factory_impl.h"
@@ -93,6 +100,38 @@ class CefHttpUserAgentSettings : public net::HttpUserAgentSettings {
   DISALLOW_COPY_AND_ASSIGN(CefHttpUserAgentSettings);
 };
 
+// Response writer that discards the response body. The HTTP cache stores the
+// body independently as it's read from the network.
+class DiscardResponseWriter : public net::URLFetcherResponseWriter {
+ public:
+  DiscardResponseWriter() {}
+
+  // net::URLFetcherResponseWriter methods.
+  int Initialize(const net::CompletionCallback& callback) override {
+    return net::OK;
+  }
+
+  int Write(net::IOBuffer* buffer,
+            int num_bytes,
+            const net::CompletionCallback& callback) override {
+    return num_bytes;
+  }
+
+  int Finish(const net::CompletionCallback& callback) override {
+    return net::OK;
+  }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(DiscardResponseWriter);
+};
+
+void OnGotCacheBackend(
+    const CefURLRequestContextGetterImpl::CacheBackendCallback& callback,
+    disk_cache::Backend** backend,
+    int rv) {
+  callback.Run(rv == net::OK ? *backend : NULL);
+}
+
 }  // namespace
 
 CefURLRequestContextGetterImpl::CefURLRequestContextGetterImpl(
@@ -106,6 +145,7 @@ CefURLRequestContextGetterImpl::CefURLRequestContextGetterImpl(
       io_loop_(io_loop),
       file_loop_(file_loop),
       proxy_config_service_(proxy_config_service.Pass()),
+      network_delegate_(NULL),
       request_interceptors_(request_interceptors.Pass()) {
   // Must first be created on the UI thread.
   CEF_REQUIRE_UIT();
@@ -113,9 +153,55 @@ CefURLRequestContextGetterImpl::CefURLRequestContextGetterImpl(
   std::swap(protocol_handlers_, *protocol_handlers);
 }
 
+// Loads a URL so that the response is written to the HTTP cache. Owned by
+// the CefURLRequestContextGetterImpl that created it. Only accessed on the IO
+// thread.
+class CefURLRequestContextGetterImpl::CachePreloader
+    : public net::URLFetcherDelegate {
+ public:
+  CachePreloader(CefURLRequestContextGetterImpl* owner,
+                 const GURL& url,
+                 const CachePreloadCallback& callback)
+      : owner_(owner),
+        callback_(callback) {
+    fetcher_ = net::URLFetcher::Create(url, net::URLFetcher::GET, this);
+    // Don't keep |owner| alive. The fetch is canceled when |owner| deletes
+    // this object.
+    fetcher_->SetRequestContext(new net::TrivialURLRequestContextGetter(
+        owner->url_request_context_.get(), owner->GetNetworkTaskRunner()));
+    fetcher_->SaveResponseWithWriter(
+        make_scoped_ptr(new DiscardResponseWriter()));
+  }
+
+  void Start() {
+    fetcher_->Start();
+  }
+
+  const CachePreloadCallback& callback() const { return callback_; }
+
+  // net::URLFetcherDelegate methods.
+  void OnURLFetchComplete(const net::URLFetcher* source) override {
+    const bool success = source->GetStatus().is_success() &&
+                         source->GetResponseCode() / 100 == 2;
+    // Deletes this object.
+    owner_->OnCachePreloadComplete(this, success);
+  }
+
+ private:
+  CefURLRequestContextGetterImpl* owner_;
+  CachePreloadCallback callback_;
+  scoped_ptr<net::URLFetcher> fetcher_;
+
+  DISALLOW_COPY_AND_ASSIGN(CachePreloader);
+};
+
 CefURLRequestContextGetterImpl::~CefURLRequestContextGetterImpl() {
   CEF_REQUIRE_IOT();
 
+  // Cancel pending cache preloads before the URLRequestContext that they use
+  // is destroyed.
+  STLDeleteElements(&cache_preloaders_);
+
   // Delete the ProxyService object here so that any pending requests will be
   // canceled before the associated URLRequestContext is destroyed in this
   // object's destructor.
@@ -140,8 +226,9 @@ net::URLRequestContext* CefURLRequestContextGetterImpl::GetURLRequestContext() {
     SetCookieStoragePath(cache_path,
                          settings_.persist_session_cookies ? true : false);
 
+    network_delegate_ = new CefNetworkDelegate();
     storage_->set_network_delegate(
-        make_scoped_ptr<net::NetworkDelegate>(new CefNetworkDelegate));
+        make_scoped_ptr<net::NetworkDelegate>(network_delegate_));
 
     storage_->set_channel_id_service(make_scoped_ptr(
         new net::ChannelIDService(
@@ -194,12 +281,18 @@ net::URLRequestContext* CefURLRequestContextGetterImpl::GetURLRequestContext() {
         make_scoped_ptr<net::HttpServerProperties>(
             new net::HttpServerPropertiesImpl));
 
+    // Keep the HTTP cache in memory if requested even when other storage is
+    // persisted to |cache_path|. A max size of 0 lets the backend choose.
+    const bool memory_cache =
+        cache_path.empty() || settings_.cache_in_memory;
+    const int cache_max_size = std::max(0, memory_cache ?
+        settings_.memory_cache_max_size : settings_.cache_max_size);
     scoped_ptr<net::HttpCache::DefaultBackend> main_backend(
         new net::HttpCache::DefaultBackend(
-            cache_path.empty() ? net::MEMORY_CACHE : net::DISK_CACHE,
+            memory_cache ? net::MEMORY_CACHE : net::DISK_CACHE,
             net::CACHE_BACKEND_DEFAULT,
-            cache_path,
-            0,
+            memory_cache ? base::FilePath() : cache_path,
+            cache_max_size,
             BrowserThread::GetMessageLoopProxyForThread(
                 BrowserThread::CACHE)));
 
@@ -360,6 +453,57 @@ net::CookieMonster* CefURLRequestContextGetterImpl::GetCookieMonster() const {
   return url_request_context_->cookie_store()->GetCookieMonster();
 }
 
+const CefNetworkDelegate::CacheStatistics&
+    CefURLRequestContextGetterImpl::GetCacheStatistics() const {
+  CEF_REQUIRE_IOT();
+  DCHECK(network_delegate_);
+  return network_delegate_->cache_statistics();
+}
+
+void CefURLRequestContextGetterImpl::GetCacheBackend(
+    const CacheBackendCallback& callback) {
+  CEF_REQUIRE_IOT();
+
+  net::HttpCache* http_cache =
+      url_request_context_->http_transaction_factory()->GetCache();
+  if (!http_cache) {
+    callback.Run(NULL);
+    return;
+  }
+
+  // The backend may still be initializing, in which case |completion| will be
+  // executed asynchronously.
+  disk_cache::Backend** backend = new disk_cache::Backend*(NULL);
+  net::CompletionCallback completion =
+      base::Bind(&OnGotCacheBackend, callback, base::Owned(backend));
+  const int rv = http_cache->GetBackend(backend, completion);
+  if (rv != net::ERR_IO_PENDING)
+    completion.Run(rv);
+}
+
+void CefURLRequestContextGetterImpl::PreloadCacheEntry(
+    const GURL& url,
+    const CachePreloadCallback& callback) {
+  CEF_REQUIRE_IOT();
+  DCHECK(url_request_context_.get());
+
+  CachePreloader* preloader = new CachePreloader(this, url, callback);
+  cache_preloaders_.insert(preloader);
+  preloader->Start();
+}
+
+void CefURLRequestContextGetterImpl::OnCachePreloadComplete(
+    CachePreloader* preloader,
+    bool success) {
+  CEF_REQUIRE_IOT();
+
+  const CachePreloadCallback callback = preloader->callback();
+  cache_preloaders_.erase(preloader);
+  delete preloader;
+
+  callback.Run(success);
+}
+
 void CefURLRequestContextGetterImpl::CreateProxyConfigService() {
   if (proxy_config_service_.get())
     return;
@@ -10,10 +10,12 @@
 #include <string>
 
 #include "include/internal/cef_types_wrappers.h"
+#include "libcef/browser/url_network_delegate.h"
 #include "libcef/browser/url_request_context_getter.h"
 #include "libcef/browser/url_request_context_impl.h"
 #include "libcef/browser/url_request_manager.h"
 
+#include "base/callback_forward.h"
 #include "base/compiler_specific.h"
 #include "base/files/file_path.h"
 #include "base/memory/ref_counted.h"
@@ -21,10 +23,16 @@
 #include "content/public/browser/content_browser_client.h"
 #include "net/url_request/url_request_job_factory.h"
 
+class GURL;
+
 namespace base {
 class MessageLoop;
 }
 
+namespace disk_cache {
+class Backend;
+}
+
 namespace net {
 class CookieMonster;
 class FtpTransactionFactory;
@@ -68,12 +76,32 @@ class CefURLRequestContextGetterImpl : public CefURLRequestContextGetter {
 
   net::CookieMonster* GetCookieMonster() const;
 
+  // Returns the HTTP cache statistics collected for this context.
+  const CefNetworkDelegate::CacheStatistics& GetCacheStatistics() const;
+
+  // Executes |callback| with the HTTP cache backend once it's available. The
+  // backend will be NULL if it could not be created. Must be called on the IO
+  // thread after GetURLRequestContext().
+  typedef base::Callback<void(disk_cache::Backend*)> CacheBackendCallback;
+  void GetCacheBackend(const CacheBackendCallback& callback);
+
+  // Loads |url| so that the response is written to the HTTP cache and then
+  // executes |callback| with the result. Pending loads are canceled without
+  // executing |callback| when this object is destroyed. Must be called on the
+  // IO thread after GetURLRequestContext().
+  typedef base::Callback<void(bool /* success */)> CachePreloadCallback;
+  void PreloadCacheEntry(const GURL& url,
+                         const CachePreloadCallback& callback);
+
   CefURLRequestManager* request_manager() const {
     return url_request_manager_.get();
   }
 
  private:
+  class CachePreloader;
+
   void CreateProxyConfigService();
+  void OnCachePreloadComplete(CachePreloader* preloader, bool success);
 
   const CefRequestContextSettings settings_;
 
@@ -84,6 +112,8 @@ class CefURLRequestContextGetterImpl : public CefURLRequestContextGetter {
   scoped_ptr<net::URLRequestContextStorage> storage_;
   scoped_ptr<CefURLRequestContextImpl> url_request_context_;
   scoped_ptr<CefURLRequestManager> url_request_manager_;
+  // Owned by |storage_|.
+  CefNetworkDelegate* network_delegate_;
   scoped_ptr<net::URLSecurityManager> url_security_manager_;
   scoped_ptr<net::FtpTransactionFactory> ftp_transaction_factory_;
   content::ProtocolHandlerMap protocol_handlers_;
@@ -94,6 +124,9 @@ class CefURLRequestContextGetterImpl : public CefURLRequestContextGetter {
 
   std::vector<CefRefPtr<CefRequestContextHandler> > handler_list_;
 
+  // Pending PreloadCacheEntry() requests. Owned by this object.
+  std::set<CachePreloader*> cache_preloaders_;
+
   DISALLOW_COPY_AND_ASSIGN(CefURLRequestContextGetterImpl);
 };
 
@@ -4,8 +4,11 @@
 
 #include "libcef/browser/url_request_user_data.h"
 
-CefURLRequestUserData::CefURLRequestUserData(CefRefPtr<CefURLRequestClient> client)
-    : client_(client) {}
+CefURLRequestUserData::CefURLRequestUserData(
+    CefRefPtr<CefURLRequestClient> client,
+    CefRefPtr<CefPostData> post_data)
+    : client_(client),
+      post_data_(post_data) {}
 
 CefURLRequestUserData::~CefURLRequestUserData() {}
 
@@ -13,6 +16,10 @@ CefRefPtr<CefURLRequestClient> CefURLRequestUserData::GetClient() {
   return client_;
 }
 
+CefRefPtr<CefPostData> CefURLRequestUserData::GetPostData() {
+  return post_data_;
+}
+
 // static
 const void* CefURLRequestUserData::kUserDataKey =
     static_cast<const void*>(&CefURLRequestUserData::kUserDataKey);
@@ -8,20 +8,29 @@
 #include "include/cef_base.h"
 #include "base/supports_user_data.h"
 
+#include "include/cef_request.h"
 #include "include/cef_urlrequest.h"
 
 // Used to annotate all URLRequests for which the request can be associated
 // with the CefURLRequestClient.
 class CefURLRequestUserData : public base::SupportsUserData::Data {
  public:
-  CefURLRequestUserData(CefRefPtr<CefURLRequestClient> client);
+  CefURLRequestUserData(CefRefPtr<CefURLRequestClient> client,
+                        CefRefPtr<CefPostData> post_data);
   ~CefURLRequestUserData() override;
 
   CefRefPtr<CefURLRequestClient> GetClient();
+
+  // Returns the read-only post data that the request body is uploaded from, if
+  // any. Used to recover elements, such as streams, that cannot be represented
+  // by the net::UploadDataStream.
+  CefRefPtr<CefPostData> GetPostData();
+
   static const void* kUserDataKey;
 
 private:
   CefRefPtr<CefURLRequestClient> client_;
+  CefRefPtr<CefPostData> post_data_;
 };
 
 #endif  // CEF_LIBCEF_BROWSER_URL_REQUEST_USER_DATA_H_
@@ -80,6 +80,19 @@ void base_impl_stub() {}
 #endif
 
 
+CEF_EXPORT const unsigned char* cef_trace_event_get_category_enabled(
+    const char* category) {
+  DCHECK(category);
+  if (!category) {
+    static const unsigned char kDisabled = 0;
+    return &kDisabled;
+  }
+
+  // The returned flag has application lifetime and is updated by TraceLog
+  // whenever the category filter changes in this process.
+  return TRACE_EVENT_API_GET_CATEGORY_GROUP_ENABLED(category);
+}
+
 CEF_EXPORT void cef_trace_event_instant(const char* category,
                                         const char* name,
                                         const char* arg1_name,
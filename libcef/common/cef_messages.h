@@ -57,6 +57,20 @@ struct ParamTraits<scoped_refptr<net::UploadData> > {
 
 // Common types.
 
+// Parameters structure for a binary argument that is transferred using shared
+// memory instead of being serialized into the message.
+IPC_STRUCT_BEGIN(Cef_SharedBinary_Params)
+  // Position of the binary value in a depth-first traversal of the argument
+  // list, counting all binary values.
+  IPC_STRUCT_MEMBER(int, index)
+
+  // Read-only handle to the shared memory segment.
+  IPC_STRUCT_MEMBER(base::SharedMemoryHandle, handle)
+
+  // Size of the binary value in bytes.
+  IPC_STRUCT_MEMBER(uint32, size)
+IPC_STRUCT_END()
+
 // Parameters structure for a request.
 IPC_STRUCT_BEGIN(Cef_Request_Params)
   // Unique request id to match requests and responses.
@@ -76,6 +90,10 @@ IPC_STRUCT_BEGIN(Cef_Request_Params)
 
   // List of message arguments.
   IPC_STRUCT_MEMBER(base::ListValue, arguments)
+
+  // Binary arguments that were moved to shared memory. Each has an empty
+  // placeholder value in |arguments|. Ordered by index.
+  IPC_STRUCT_MEMBER(std::vector<Cef_SharedBinary_Params>, shared_binaries)
 IPC_STRUCT_END()
 
 // Parameters structure for a response.
@@ -163,6 +181,13 @@ IPC_MESSAGE_ROUTED1(CefMsg_Response,
 IPC_MESSAGE_ROUTED1(CefMsg_ResponseAck,
                     int /* request_id */)
 
+// Sent after the browser has processed a CefHostMsg_StringChunk. The renderer
+// will send another chunk unless |cancel| is true, in which case the remaining
+// chunks are discarded.
+IPC_MESSAGE_ROUTED2(CefMsg_StringChunkAck,
+                    int /* request_id */,
+                    bool /* cancel */)
+
 // Tells the render frame to load all blocked plugins with the given identifier.
 // Based on ChromeViewMsg_LoadBlockedPlugins.
 IPC_MESSAGE_ROUTED1(CefViewMsg_LoadBlockedPlugins,
@@ -276,6 +301,15 @@ IPC_MESSAGE_ROUTED1(CefHostMsg_Response,
 IPC_MESSAGE_ROUTED1(CefHostMsg_ResponseAck,
                     int /* request_id */)
 
+// Sent in response to a "get-string-chunks" CefMsg_Request. Chunks are sent in
+// order and a limited number may be in flight before a CefMsg_StringChunkAck
+// is received. |last| is true for the final chunk or on failure.
+IPC_MESSAGE_ROUTED4(CefHostMsg_StringChunk,
+                    int /* request_id */,
+                    std::string /* chunk */,
+                    bool /* last */,
+                    bool /* success */)
+
 // Sent by the renderer when the draggable regions are updated.
 IPC_MESSAGE_ROUTED1(CefHostMsg_UpdateDraggableRegions,
                     std::vector<Cef_DraggableRegion_Params> /* regions */)
@@ -32,6 +32,10 @@ const char kUncaughtExceptionStackSize[]  = "uncaught-exception-stack-size";
 // Context safety implementation type.
 const char kContextSafetyImplementation[] = "context-safety-implementation";
 
+// Minimum size of process message binary arguments sent via shared memory.
+const char kProcessMessageSharedMemoryThreshold[] =
+    "process-message-shared-memory-threshold";
+
 // Default encoding.
 const char kDefaultEncoding[]             = "default-encoding";
 
@@ -22,6 +22,7 @@ extern const char kLocalesDirPath[];
 extern const char kDisablePackLoading[];
 extern const char kUncaughtExceptionStackSize[];
 extern const char kContextSafetyImplementation[];
+extern const char kProcessMessageSharedMemoryThreshold[];
 extern const char kDefaultEncoding[];
 extern const char kDisableJavascriptOpenWindows[];
 extern const char kDisableJavascriptCloseWindows[];
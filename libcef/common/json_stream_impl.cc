@@ -0,0 +1,839 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#include <string.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "include/cef_parser.h"
+
+#include "base/basictypes.h"
+#include "base/json/json_reader.h"
+#include "base/json/string_escape.h"
+#include "base/logging.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
+#include "base/strings/utf_string_conversion_utils.h"
+#include "base/third_party/icu/icu_utf.h"
+#include "base/threading/platform_thread.h"
+
+namespace {
+
+// Size of the chunks that are read from or written to the stream.
+const size_t kStreamBufferSize = 32 * 1024;
+
+// Same nesting limit as base::JSONReader.
+const int kStackMaxDepth = 100;
+
+const int kEndOfInput = -1;
+
+#if defined(OS_WIN)
+const char kPrettyPrintLineEnding[] = "\r\n";
+#else
+const char kPrettyPrintLineEnding[] = "\n";
+#endif
+
+// Parses JSON from a CefStreamReader and reports the contents to a
+// CefJSONParserHandler. Accepts the same syntax as base::JSONReader (including
+// comments and the extra escape sequences) and reports the same error codes.
+class JSONStreamParser {
+ public:
+  JSONStreamParser(CefRefPtr<CefStreamReader> stream,
+                   CefRefPtr<CefJSONParserHandler> handler,
+                   cef_json_parser_options_t options)
+      : stream_(stream),
+        handler_(handler),
+        allow_trailing_commas_(
+            (options & JSON_PARSER_ALLOW_TRAILING_COMMAS) != 0),
+        buffer_(kStreamBufferSize),
+        pos_(0),
+        end_(0),
+        eof_(false),
+        line_(1),
+        column_(0),
+        after_carriage_return_(false),
+        error_code_(JSON_NO_ERROR) {
+  }
+
+  // Returns true if the complete document was parsed.
+  bool Parse() {
+    // Skip the UTF-8 byte order mark if present.
+    if (EnsureAvailable(3) && memcmp(&buffer_[pos_], "\xEF\xBB\xBF", 3) == 0)
+      pos_ += 3;
+
+    if (!ParseValue(0))
+      return false;
+
+    if (!SkipWhitespace())
+      return false;
+    if (Peek() != kEndOfInput)
+      return ReportError(JSON_UNEXPECTED_DATA_AFTER_ROOT);
+    return true;
+  }
+
+  cef_json_parser_error_t error_code() const { return error_code_; }
+  const std::string& error_message() const { return error_message_; }
+
+ private:
+  // Make at least |count| unconsumed bytes available in the buffer. Returns
+  // false if the end of the stream is reached first.
+  bool EnsureAvailable(size_t count) {
+    DCHECK_LE(count, buffer_.size());
+    if (end_ - pos_ >= count)
+      return true;
+    if (eof_)
+      return false;
+
+    if (pos_ > 0) {
+      if (end_ > pos_)
+        memmove(&buffer_[0], &buffer_[pos_], end_ - pos_);
+      end_ -= pos_;
+      pos_ = 0;
+    }
+
+    while (end_ < count && !eof_) {
+      const size_t read =
+          stream_->Read(&buffer_[end_], 1, buffer_.size() - end_);
+      if (read == 0)
+        eof_ = true;
+      else
+        end_ += read;
+    }
+    return end_ - pos_ >= count;
+  }
+
+  int Peek() {
+    if (pos_ == end_ && !EnsureAvailable(1))
+      return kEndOfInput;
+    return static_cast<unsigned char>(buffer_[pos_]);
+  }
+
+  // Consume the current character, which must be available. Line and column
+  // numbers are tracked the same way as base::JSONParser: "\r\n" counts as a
+  // single line break and columns on subsequent lines are relative to the
+  // line break character.
+  void Advance() {
+    DCHECK_LT(pos_, end_);
+    const char c = buffer_[pos_++];
+    if (c == '\n' || c == '\r') {
+      if (c == '\r' || !after_carriage_return_)
+        line_++;
+      column_ = 1;
+    } else {
+      column_++;
+    }
+    after_carriage_return_ = (c == '\r');
+  }
+
+  // Consume whitespace and comments. Returns false on an unterminated
+  // comment.
+  bool SkipWhitespace() {
+    while (true) {
+      switch (Peek()) {
+        case ' ':
+        case '\t':
+        case '\r':
+        case '\n':
+          Advance();
+          break;
+        case '/':
+          if (!SkipComment())
+            return false;
+          break;
+        default:
+          return true;
+      }
+    }
+  }
+
+  bool SkipComment() {
+    if (!EnsureAvailable(2))
+      return ReportError(JSON_SYNTAX_ERROR);
+
+    const char type = buffer_[pos_ + 1];
+    if (type != '/' && type != '*')
+      return ReportError(JSON_SYNTAX_ERROR);
+    Advance();
+    Advance();
+
+    if (type == '/') {
+      int c;
+      while ((c = Peek()) != kEndOfInput) {
+        Advance();
+        if (c == '\n' || c == '\r')
+          break;
+      }
+      return true;
+    }
+
+    int c;
+    while ((c = Peek()) != kEndOfInput) {
+      Advance();
+      if (c == '*' && Peek() == '/') {
+        Advance();
+        return true;
+      }
+    }
+    return ReportError(JSON_SYNTAX_ERROR);
+  }
+
+  bool ParseValue(int depth) {
+    if (!SkipWhitespace())
+      return false;
+
+    switch (Peek()) {
+      case '{':
+        return ParseDictionary(depth);
+      case '[':
+        return ParseList(depth);
+      case '"': {
+        std::string value;
+        if (!ParseString(&value))
+          return false;
+        return handler_->OnString(value);
+      }
+      case '-':
+      case '0':
+      case '1':
+      case '2':
+      case '3':
+      case '4':
+      case '5':
+      case '6':
+      case '7':
+      case '8':
+      case '9':
+        return ParseNumber();
+      case 't':
+        return ParseLiteral("true") && handler_->OnBool(true);
+      case 'f':
+        return ParseLiteral("false") && handler_->OnBool(false);
+      case 'n':
+        return ParseLiteral("null") && handler_->OnNull();
+      default:
+        return ReportError(JSON_UNEXPECTED_TOKEN);
+    }
+  }
+
+  bool ParseDictionary(int depth) {
+    if (depth + 1 > kStackMaxDepth)
+      return ReportError(JSON_TOO_MUCH_NESTING);
+    Advance();  // '{'
+    if (!handler_->OnBeginDictionary())
+      return false;
+
+    if (!SkipWhitespace())
+      return false;
+    if (Peek() != '}') {
+      while (true) {
+        if (Peek() != '"')
+          return ReportError(JSON_UNQUOTED_DICTIONARY_KEY);
+        std::string key;
+        if (!ParseString(&key) || !handler_->OnKey(key))
+          return false;
+
+        if (!SkipWhitespace())
+          return false;
+        if (Peek() != ':')
+          return ReportError(JSON_SYNTAX_ERROR);
+        Advance();
+
+        if (!ParseValue(depth + 1) || !SkipWhitespace())
+          return false;
+
+        const int c = Peek();
+        if (c == '}')
+          break;
+        if (c != ',')
+          return ReportError(JSON_SYNTAX_ERROR);
+        Advance();
+
+        if (!SkipWhitespace())
+          return false;
+        if (Peek() == '}') {
+          if (!allow_trailing_commas_)
+            return ReportError(JSON_TRAILING_COMMA);
+          break;
+        }
+      }
+    }
+
+    Advance();  // '}'
+    return handler_->OnEndDictionary();
+  }
+
+  bool ParseList(int depth) {
+    if (depth + 1 > kStackMaxDepth)
+      return ReportError(JSON_TOO_MUCH_NESTING);
+    Advance();  // '['
+    if (!handler_->OnBeginList())
+      return false;
+
+    if (!SkipWhitespace())
+      return false;
+    if (Peek() != ']') {
+      while (true) {
+        if (!ParseValue(depth + 1) || !SkipWhitespace())
+          return false;
+
+        const int c = Peek();
+        if (c == ']')
+          break;
+        if (c != ',')
+          return ReportError(JSON_SYNTAX_ERROR);
+        Advance();
+
+        if (!SkipWhitespace())
+          return false;
+        if (Peek() == ']') {
+          if (!allow_trailing_commas_)
+            return ReportError(JSON_TRAILING_COMMA);
+          break;
+        }
+      }
+    }
+
+    Advance();  // ']'
+    return handler_->OnEndList();
+  }
+
+  // Parse a quoted string into |out| as UTF-8.
+  bool ParseString(std::string* out) {
+    Advance();  // '"'
+
+    // Start of the unescaped run in |out| that has not yet been validated.
+    size_t run_start = 0;
+    bool run_has_non_ascii = false;
+
+    while (true) {
+      if (pos_ == end_ && !EnsureAvailable(1))
+        return ReportError(JSON_SYNTAX_ERROR);
+
+      // Copy unescaped characters directly from the buffer.
+      const char* start = &buffer_[pos_];
+      const char* const limit = &buffer_[0] + end_;
+      const char* p = start;
+      while (p < limit && *p != '"' && *p != '\\') {
+        if (static_cast<unsigned char>(*p) >= 0x80)
+          run_has_non_ascii = true;
+        ++p;
+      }
+      // Line breaks inside strings are not counted, as in base::JSONParser.
+      out->append(start, p - start);
+      pos_ += p - start;
+      column_ += static_cast<int>(p - start);
+      after_carriage_return_ = false;
+      if (p == limit)
+        continue;
+
+      // A run always ends on an ASCII character so it can be validated
+      // independently of the escape sequences that surround it.
+      if (run_has_non_ascii &&
+          !base::IsStringUTF8(base::StringPiece(out->data() + run_start,
+                                                out->size() - run_start))) {
+        return ReportError(JSON_UNSUPPORTED_ENCODING);
+      }
+
+      if (*p == '"') {
+        Advance();
+        return true;
+      }
+
+      if (!ParseEscape(out))
+        return false;
+      run_start = out->size();
+      run_has_non_ascii = false;
+    }
+  }
+
+  bool ParseEscape(std::string* out) {
+    Advance();  // '\\'
+    const int c = Peek();
+    if (c == kEndOfInput)
+      return ReportError(JSON_INVALID_ESCAPE);
+    Advance();
+
+    switch (c) {
+      case '"':
+      case '\\':
+      case '/':
+        out->push_back(static_cast<char>(c));
+        return true;
+      case 'b':
+        out->push_back('\b');
+        return true;
+      case 'f':
+        out->push_back('\f');
+        return true;
+      case 'n':
+        out->push_back('\n');
+        return true;
+      case 'r':
+        out->push_back('\r');
+        return true;
+      case 't':
+        out->push_back('\t');
+        return true;
+      case 'v':
+        out->push_back('\v');
+        return true;
+      case 'x': {
+        uint32 value;
+        if (!ParseHex(2, &value))
+          return ReportError(JSON_INVALID_ESCAPE);
+        base::WriteUnicodeCharacter(value, out);
+        return true;
+      }
+      case 'u': {
+        uint32 code_unit;
+        if (!ParseHex(4, &code_unit))
+          return ReportError(JSON_INVALID_ESCAPE);
+
+        uint32 code_point = code_unit;
+        if (CBU16_IS_SURROGATE(code_unit)) {
+          // A lead surrogate must be followed by an escaped trail surrogate.
+          uint32 trail;
+          if (!CBU16_IS_SURROGATE_LEAD(code_unit) || !EnsureAvailable(2) ||
+              buffer_[pos_] != '\\' || buffer_[pos_ + 1] != 'u') {
+            return ReportError(JSON_INVALID_ESCAPE);
+          }
+          Advance();
+          Advance();
+          if (!ParseHex(4, &trail) || !CBU16_IS_TRAIL(trail))
+            return ReportError(JSON_INVALID_ESCAPE);
+          code_point = CBU16_GET_SUPPLEMENTARY(code_unit, trail);
+        }
+
+        if (!CBU_IS_UNICODE_CHAR(code_point))
+          return ReportError(JSON_UNSUPPORTED_ENCODING);
+        base::WriteUnicodeCharacter(code_point, out);
+        return true;
+      }
+      default:
+        return ReportError(JSON_INVALID_ESCAPE);
+    }
+  }
+
+  // Parse |digits| hexadecimal digits into |value|.
+  bool ParseHex(int digits, uint32* value) {
+    if (!EnsureAvailable(digits))
+      return false;
+
+    uint32 result = 0;
+    for (int i = 0; i < digits; ++i) {
+      const char c = buffer_[pos_];
+      int digit;
+      if (c >= '0' && c <= '9')
+        digit = c - '0';
+      else if (c >= 'a' && c <= 'f')
+        digit = c - 'a' + 10;
+      else if (c >= 'A' && c <= 'F')
+        digit = c - 'A' + 10;
+      else
+        return false;
+      result = (result << 4) | digit;
+      Advance();
+    }
+    *value = result;
+    return true;
+  }
+
+  // Consume a run of decimal digits into |out|. Returns false if there are
+  // none.
+  bool ReadDigits(std::string* out) {
+    const size_t start = out->size();
+    int c;
+    while ((c = Peek()) >= '0' && c <= '9') {
+      out->push_back(static_cast<char>(c));
+      Advance();
+    }
+    return out->size() > start;
+  }
+
+  bool ParseNumber() {
+    std::string number;
+    bool is_integer = true;
+
+    if (Peek() == '-') {
+      number.push_back('-');
+      Advance();
+    }
+
+    // Leading zeros are not allowed.
+    if (Peek() == '0') {
+      number.push_back('0');
+      Advance();
+      const int c = Peek();
+      if (c >= '0' && c <= '9')
+        return ReportError(JSON_SYNTAX_ERROR);
+    } else if (!ReadDigits(&number)) {
+      return ReportError(JSON_SYNTAX_ERROR);
+    }
+
+    if (Peek() == '.') {
+      is_integer = false;
+      number.push_back('.');
+      Advance();
+      if (!ReadDigits(&number))
+        return ReportError(JSON_SYNTAX_ERROR);
+    }
+
+    int c = Peek();
+    if (c == 'e' || c == 'E') {
+      is_integer = false;
+      number.push_back('e');
+      Advance();
+      c = Peek();
+      if (c == '-' || c == '+') {
+        number.push_back(static_cast<char>(c));
+        Advance();
+      }
+      if (!ReadDigits(&number))
+        return ReportError(JSON_SYNTAX_ERROR);
+    }
+
+    if (is_integer) {
+      int value;
+      if (base::StringToInt(number, &value))
+        return handler_->OnInt(value);
+    }
+
+    double value;
+    if (!base::StringToDouble(number, &value))
+      return ReportError(JSON_SYNTAX_ERROR);
+    return handler_->OnDouble(value);
+  }
+
+  bool ParseLiteral(const char* literal) {
+    const size_t length = strlen(literal);
+    if (!EnsureAvailable(length) ||
+        memcmp(&buffer_[pos_], literal, length) != 0) {
+      return ReportError(JSON_SYNTAX_ERROR);
+    }
+    for (size_t i = 0; i < length; ++i)
+      Advance();
+    return true;
+  }
+
+  bool ReportError(cef_json_parser_error_t code) {
+    error_code_ = code;
+    error_message_ = base::StringPrintf(
+        "Line: %i, column: %i, %s", line_, column_ + 1,
+        base::JSONReader::ErrorCodeToString(
+            static_cast<base::JSONReader::JsonParseError>(code)).c_str());
+    return false;
+  }
+
+  CefRefPtr<CefStreamReader> stream_;
+  CefRefPtr<CefJSONParserHandler> handler_;
+  const bool allow_trailing_commas_;
+
+  // Input buffer. Bytes in the range [pos_, end_) have not been consumed.
+  std::vector<char> buffer_;
+  size_t pos_;
+  size_t end_;
+  bool eof_;
+
+  // Position of the next unconsumed character for error reporting.
+  int line_;
+  int column_;
+  bool after_carriage_return_;
+
+  cef_json_parser_error_t error_code_;
+  std::string error_message_;
+
+  DISALLOW_COPY_AND_ASSIGN(JSONStreamParser);
+};
+
+// Implementation of CefJSONWriter. Produces the same output as
+// base::JSONWriter.
+class CefJSONWriterImpl : public CefJSONWriter {
+ public:
+  CefJSONWriterImpl(CefRefPtr<CefStreamWriter> stream,
+                    cef_json_writer_options_t options)
+      : supported_thread_id_(base::PlatformThread::CurrentId()),
+        stream_(stream),
+        omit_double_type_preservation_(
+            (options & JSON_WRITER_OMIT_DOUBLE_TYPE_PRESERVATION) != 0),
+        pretty_print_((options & JSON_WRITER_PRETTY_PRINT) != 0),
+        key_pending_(false),
+        complete_(false),
+        failed_(false) {
+    buffer_.reserve(kStreamBufferSize);
+  }
+
+  ~CefJSONWriterImpl() override {
+    WriteBuffer();
+  }
+
+  bool BeginDictionary() override {
+    if (!BeginValue())
+      return false;
+    buffer_.push_back('{');
+    if (pretty_print_)
+      buffer_.append(kPrettyPrintLineEnding);
+    stack_.push_back(Container(true));
+    return true;
+  }
+
+  bool EndDictionary() override {
+    if (!VerifyContext() || stack_.empty() || !stack_.back().is_dictionary ||
+        key_pending_) {
+      return false;
+    }
+    stack_.pop_back();
+    if (pretty_print_) {
+      buffer_.append(kPrettyPrintLineEnding);
+      Indent(stack_.size());
+    }
+    buffer_.push_back('}');
+    return EndValue();
+  }
+
+  bool BeginList() override {
+    if (!BeginValue())
+      return false;
+    buffer_.push_back('[');
+    if (pretty_print_)
+      buffer_.push_back(' ');
+    stack_.push_back(Container(false));
+    return true;
+  }
+
+  bool EndList() override {
+    if (!VerifyContext() || stack_.empty() || stack_.back().is_dictionary)
+      return false;
+    stack_.pop_back();
+    if (pretty_print_)
+      buffer_.push_back(' ');
+    buffer_.push_back(']');
+    return EndValue();
+  }
+
+  bool WriteKey(const CefString& key) override {
+    if (!VerifyContext() || stack_.empty() || !stack_.back().is_dictionary ||
+        key_pending_) {
+      return false;
+    }
+
+    Container& container = stack_.back();
+    if (container.count > 0) {
+      buffer_.push_back(',');
+      if (pretty_print_)
+        buffer_.append(kPrettyPrintLineEnding);
+    }
+    if (pretty_print_)
+      Indent(stack_.size());
+    container.count++;
+
+    base::EscapeJSONString(key.ToString(), true, &buffer_);
+    buffer_.push_back(':');
+    if (pretty_print_)
+      buffer_.push_back(' ');
+    key_pending_ = true;
+    return true;
+  }
+
+  bool WriteNull() override {
+    if (!BeginValue())
+      return false;
+    buffer_.append("null");
+    return EndValue();
+  }
+
+  bool WriteBool(bool value) override {
+    if (!BeginValue())
+      return false;
+    buffer_.append(value ? "true" : "false");
+    return EndValue();
+  }
+
+  bool WriteInt(int value) override {
+    if (!BeginValue())
+      return false;
+    buffer_.append(base::IntToString(value));
+    return EndValue();
+  }
+
+  bool WriteDouble(double value) override {
+    if (!std::isfinite(value) || !BeginValue())
+      return false;
+
+    if (omit_double_type_preservation_ &&
+        value <= kint64max && value >= kint64min &&
+        std::floor(value) == value) {
+      buffer_.append(base::Int64ToString(static_cast<int64>(value)));
+      return EndValue();
+    }
+
+    std::string real = base::DoubleToString(value);
+    // Ensure that the number has a .0 if there's no decimal or 'e'. This
+    // makes sure that when we read the JSON back, it's interpreted as a real
+    // rather than an int.
+    if (real.find_first_of(".eE") == std::string::npos)
+      real.append(".0");
+    // The JSON spec requires that non-integer values in the range (-1,1)
+    // have a zero before the decimal point.
+    if (real[0] == '.')
+      real.insert(static_cast<size_t>(0), static_cast<size_t>(1), '0');
+    else if (real.length() > 1 && real[0] == '-' && real[1] == '.')
+      real.insert(static_cast<size_t>(1), static_cast<size_t>(1), '0');
+    buffer_.append(real);
+    return EndValue();
+  }
+
+  bool WriteString(const CefString& value) override {
+    if (!BeginValue())
+      return false;
+    base::EscapeJSONString(value.ToString(), true, &buffer_);
+    return EndValue();
+  }
+
+  bool IsComplete() override {
+    return complete_;
+  }
+
+  bool Flush() override {
+    if (!VerifyContext() || !WriteBuffer())
+      return false;
+    return stream_->Flush() == 0;
+  }
+
+ private:
+  struct Container {
+    explicit Container(bool is_dictionary)
+        : is_dictionary(is_dictionary),
+          count(0) {
+    }
+
+    bool is_dictionary;
+    size_t count;
+  };
+
+  // Verify that the writer is being accessed from the correct thread and is
+  // still usable.
+  bool VerifyContext() {
+    if (base::PlatformThread::CurrentId() != supported_thread_id_) {
+      // This object should only be accessed from the thread that created it.
+      NOTREACHED();
+      return false;
+    }
+    return !failed_;
+  }
+
+  // Check that a value may be written at the current position and write any
+  // separator that precedes it.
+  bool BeginValue() {
+    if (!VerifyContext() || complete_)
+      return false;
+    if (stack_.empty())
+      return true;
+
+    Container& container = stack_.back();
+    if (container.is_dictionary) {
+      // Dictionary values must follow a key.
+      if (!key_pending_)
+        return false;
+      key_pending_ = false;
+      return true;
+    }
+
+    if (container.count > 0) {
+      buffer_.push_back(',');
+      if (pretty_print_)
+        buffer_.push_back(' ');
+    }
+    container.count++;
+    return true;
+  }
+
+  // Called after a complete value has been written.
+  bool EndValue() {
+    if (stack_.empty()) {
+      complete_ = true;
+      if (pretty_print_)
+        buffer_.append(kPrettyPrintLineEnding);
+    }
+    if (buffer_.size() >= kStreamBufferSize)
+      return WriteBuffer();
+    return true;
+  }
+
+  void Indent(size_t depth) {
+    buffer_.append(depth * 3U, ' ');
+  }
+
+  // Write the buffered output to the stream.
+  bool WriteBuffer() {
+    if (failed_)
+      return false;
+    if (buffer_.empty())
+      return true;
+
+    const size_t written = stream_->Write(buffer_.data(), 1, buffer_.size());
+    if (written != buffer_.size()) {
+      LOG(ERROR) << "Failed to write JSON data to stream";
+      failed_ = true;
+    }
+    buffer_.clear();
+    return !failed_;
+  }
+
+  base::PlatformThreadId supported_thread_id_;
+  CefRefPtr<CefStreamWriter> stream_;
+  const bool omit_double_type_preservation_;
+  const bool pretty_print_;
+
+  // Containers that have been started but not yet ended.
+  std::vector<Container> stack_;
+  // True if a dictionary key has been written without its value.
+  bool key_pending_;
+  // True if a complete root value has been written.
+  bool complete_;
+  // True if a stream write has failed.
+  bool failed_;
+
+  std::string buffer_;
+
+  IMPLEMENT_REFCOUNTING(CefJSONWriterImpl);
+  DISALLOW_COPY_AND_ASSIGN(CefJSONWriterImpl);
+};
+
+}  // namespace
+
+bool CefParseJSONStream(CefRefPtr<CefStreamReader> stream,
+                        CefRefPtr<CefJSONParserHandler> handler,
+                        cef_json_parser_options_t options,
+                        cef_json_parser_error_t& error_code_out,
+                        CefString& error_msg_out) {
+  // Verify param.
+  if (!stream.get() || !handler.get()) {
+    NOTREACHED() << "invalid parameter";
+    return false;
+  }
+
+  JSONStreamParser parser(stream, handler, options);
+  if (parser.Parse())
+    return true;
+
+  error_code_out = parser.error_code();
+  error_msg_out = parser.error_message();
+  return false;
+}
+
+// static
+CefRefPtr<CefJSONWriter> CefJSONWriter::Create(
+    CefRefPtr<CefStreamWriter> stream,
+    cef_json_writer_options_t options) {
+  // Verify param.
+  if (!stream.get()) {
+    NOTREACHED() << "invalid parameter";
+    return NULL;
+  }
+
+  return new CefJSONWriterImpl(stream, options);
+}
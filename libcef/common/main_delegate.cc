@@ -458,6 +458,12 @@ bool CefMainDelegate::BasicStartupComplete(int* exit_code) {
       command_line->AppendSwitchASCII(switches::kContextSafetyImplementation,
           base::IntToString(settings.context_safety_implementation));
     }
+
+    if (settings.process_message_shared_memory_threshold != 0) {
+      command_line->AppendSwitchASCII(
+          switches::kProcessMessageSharedMemoryThreshold,
+          base::IntToString(settings.process_message_shared_memory_threshold));
+    }
   }
 
   if (content_client_.application().get()) {
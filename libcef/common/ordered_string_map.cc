@@ -0,0 +1,135 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include "libcef/common/ordered_string_map.h"
+
+#include "base/logging.h"
+
+namespace {
+
+// HTTP header sets are the most common use so start with room for a typical
+// number of keys.
+const size_t kInitialBucketCount = 16;
+
+}  // namespace
+
+// static
+const size_t CefOrderedStringMap::kNone = static_cast<size_t>(-1);
+
+CefOrderedStringMap::CefOrderedStringMap(bool allow_duplicates)
+    : allow_duplicates_(allow_duplicates),
+      key_count_(0) {
+}
+
+CefOrderedStringMap::~CefOrderedStringMap() {
+}
+
+bool CefOrderedStringMap::Append(const CefString& key,
+                                 const CefString& value) {
+  if (buckets_.empty())
+    buckets_.resize(kInitialBucketCount, kNone);
+
+  const size_t hash = Hash(key);
+  const size_t first = FindFirst(key, hash);
+  if (first != kNone && !allow_duplicates_)
+    return false;
+
+  const size_t index = entries_.size();
+  entries_.push_back(Entry());
+  Entry& entry = entries_.back();
+  entry.key = key;
+  entry.value = value;
+  entry.hash = hash;
+  entry.bucket_next = kNone;
+  entry.same_key_next = kNone;
+  entry.same_key_last = index;
+
+  if (first != kNone) {
+    // Link to the end of the existing chain for this key.
+    entry.same_key_count = 0;
+    Entry& first_entry = entries_[first];
+    entries_[first_entry.same_key_last].same_key_next = index;
+    first_entry.same_key_last = index;
+    first_entry.same_key_count++;
+    return true;
+  }
+
+  entry.same_key_count = 1;
+  size_t& bucket = buckets_[hash & (buckets_.size() - 1)];
+  entry.bucket_next = bucket;
+  bucket = index;
+
+  // Keep the load factor at or below 1.
+  if (++key_count_ > buckets_.size())
+    Rehash(buckets_.size() * 2);
+  return true;
+}
+
+size_t CefOrderedStringMap::Count(const CefString& key) const {
+  if (entries_.empty())
+    return 0;
+  const size_t first = FindFirst(key, Hash(key));
+  if (first == kNone)
+    return 0;
+  return entries_[first].same_key_count;
+}
+
+const CefString* CefOrderedStringMap::Find(const CefString& key,
+                                           size_t value_index) const {
+  if (entries_.empty())
+    return NULL;
+  size_t index = FindFirst(key, Hash(key));
+  if (index == kNone || value_index >= entries_[index].same_key_count)
+    return NULL;
+
+  while (value_index-- > 0)
+    index = entries_[index].same_key_next;
+  DCHECK_NE(index, kNone);
+  return &entries_[index].value;
+}
+
+void CefOrderedStringMap::Clear() {
+  entries_.clear();
+  buckets_.clear();
+  key_count_ = 0;
+}
+
+// static
+size_t CefOrderedStringMap::Hash(const CefString& key) {
+  // FNV-1a over the string characters.
+  size_t hash = 2166136261U;
+  const CefString::char_type* str = key.c_str();
+  const size_t length = key.length();
+  for (size_t i = 0; i < length; ++i) {
+    hash ^= static_cast<size_t>(str[i]);
+    hash *= 16777619U;
+  }
+  return hash;
+}
+
+size_t CefOrderedStringMap::FindFirst(const CefString& key,
+                                      size_t hash) const {
+  size_t index = buckets_[hash & (buckets_.size() - 1)];
+  while (index != kNone) {
+    const Entry& entry = entries_[index];
+    if (entry.hash == hash && entry.key == key)
+      return index;
+    index = entry.bucket_next;
+  }
+  return kNone;
+}
+
+void CefOrderedStringMap::Rehash(size_t bucket_count) {
+  DCHECK_EQ(0U, bucket_count & (bucket_count - 1));
+  buckets_.assign(bucket_count, kNone);
+  for (size_t index = 0; index < entries_.size(); ++index) {
+    Entry& entry = entries_[index];
+    // Only the first entry of each key is linked into a bucket.
+    if (entry.same_key_count == 0)
+      continue;
+    size_t& bucket = buckets_[entry.hash & (bucket_count - 1)];
+    entry.bucket_next = bucket;
+    bucket = index;
+  }
+}
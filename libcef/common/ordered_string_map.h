@@ -0,0 +1,80 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_COMMON_ORDERED_STRING_MAP_H_
+#define CEF_LIBCEF_COMMON_ORDERED_STRING_MAP_H_
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "include/internal/cef_string.h"
+
+#include "base/macros.h"
+
+// Insertion-ordered collection of key/value string pairs with hashed key
+// lookup. Backs the cef_string_map_t and cef_string_multimap_t C APIs.
+// Entries are stored in a std::deque so that access by index is O(1) and
+// existing entries are never copied as the collection grows. Keys are not
+// duplicated for the hash index; buckets chain entry indexes instead.
+class CefOrderedStringMap {
+ public:
+  // If |allow_duplicates| is false Append() will ignore keys that already
+  // exist, matching std::map::insert.
+  explicit CefOrderedStringMap(bool allow_duplicates);
+  ~CefOrderedStringMap();
+
+  size_t size() const { return entries_.size(); }
+  const CefString& key(size_t index) const { return entries_[index].key; }
+  const CefString& value(size_t index) const { return entries_[index].value; }
+
+  // Add a new entry at the end of the collection. Returns false if
+  // duplicates are not allowed and |key| already exists.
+  bool Append(const CefString& key, const CefString& value);
+
+  // Returns the number of entries with the specified |key|.
+  size_t Count(const CefString& key) const;
+
+  // Returns the |value_index|th value assigned to |key|, in insertion order,
+  // or NULL if no such value exists.
+  const CefString* Find(const CefString& key, size_t value_index) const;
+
+  void Clear();
+
+ private:
+  static const size_t kNone;
+
+  struct Entry {
+    CefString key;
+    CefString value;
+    size_t hash;
+    // Next entry with a different key in the same bucket. Only used for the
+    // first entry of each key.
+    size_t bucket_next;
+    // Next and last entries with the same key, and the total number of
+    // entries with this key. |same_key_last| and |same_key_count| are only
+    // used for the first entry of each key.
+    size_t same_key_next;
+    size_t same_key_last;
+    size_t same_key_count;
+  };
+
+  static size_t Hash(const CefString& key);
+
+  // Returns the index of the first entry for |key| or kNone.
+  size_t FindFirst(const CefString& key, size_t hash) const;
+
+  void Rehash(size_t bucket_count);
+
+  const bool allow_duplicates_;
+  std::deque<Entry> entries_;
+  // Index of the first entry in each bucket. The size is a power of 2.
+  std::vector<size_t> buckets_;
+  // Number of distinct keys.
+  size_t key_count_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefOrderedStringMap);
+};
+
+#endif  // CEF_LIBCEF_COMMON_ORDERED_STRING_MAP_H_
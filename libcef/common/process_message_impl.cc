@@ -4,12 +4,295 @@
 
 #include "libcef/common/process_message_impl.h"
 #include "libcef/common/cef_messages.h"
+#include "libcef/common/cef_switches.h"
+#include "libcef/common/shared_binary_value.h"
 #include "libcef/common/values_impl.h"
 
+#include <string.h>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "base/command_line.h"
+#include "base/lazy_instance.h"
 #include "base/logging.h"
+#include "base/strings/string_number_conversions.h"
 
 namespace {
 
+// Default value for GetSharedMemoryThreshold().
+const size_t kDefaultSharedMemoryThreshold = 64 * 1024;
+
+struct SharedMemoryThreshold {
+  SharedMemoryThreshold() : value(kDefaultSharedMemoryThreshold) {
+    const base::CommandLine* command_line =
+        base::CommandLine::ForCurrentProcess();
+    const std::string& threshold_str = command_line->GetSwitchValueASCII(
+        switches::kProcessMessageSharedMemoryThreshold);
+    int threshold = 0;
+    if (!threshold_str.empty() &&
+        base::StringToInt(threshold_str, &threshold)) {
+      // Values <= 0 disable shared memory transport.
+      value = threshold > 0 ? static_cast<size_t>(threshold) : 0;
+    }
+  }
+
+  size_t value;
+};
+
+base::LazyInstance<SharedMemoryThreshold>::Leaky g_shared_memory_threshold =
+    LAZY_INSTANCE_INITIALIZER;
+
+// Copies a value tree while moving large binary values into shared memory.
+// Each moved value is replaced with an empty placeholder and described by an
+// entry in |shared_binaries|.
+class SharedBinaryWriter {
+ public:
+  SharedBinaryWriter(base::ProcessHandle peer_process,
+                     size_t threshold,
+                     std::vector<Cef_SharedBinary_Params>* shared_binaries)
+      : peer_process_(peer_process),
+        threshold_(threshold),
+        shared_binaries_(shared_binaries),
+        binary_count_(0) {
+  }
+
+  void CopyList(const base::ListValue& source, base::ListValue& target) {
+    base::ListValue::const_iterator it = source.begin();
+    for (; it != source.end(); ++it)
+      target.Append(Copy(**it));
+  }
+
+ private:
+  base::Value* Copy(const base::Value& value) {
+    switch (value.GetType()) {
+      case base::Value::TYPE_BINARY:
+        return CopyBinary(static_cast<const base::BinaryValue&>(value));
+      case base::Value::TYPE_LIST: {
+        base::ListValue* list = new base::ListValue();
+        CopyList(static_cast<const base::ListValue&>(value), *list);
+        return list;
+      }
+      case base::Value::TYPE_DICTIONARY: {
+        base::DictionaryValue* dict = new base::DictionaryValue();
+        base::DictionaryValue::Iterator it(
+            static_cast<const base::DictionaryValue&>(value));
+        for (; !it.IsAtEnd(); it.Advance())
+          dict->SetWithoutPathExpansion(it.key(), Copy(it.value()));
+        return dict;
+      }
+      default:
+        return value.DeepCopy();
+    }
+  }
+
+  base::Value* CopyBinary(const base::BinaryValue& value) {
+    const int index = binary_count_++;
+
+    size_t size;
+    const char* data = CefSharedBinaryValue::GetData(value, &size);
+    if (size < threshold_ || size > std::numeric_limits<uint32>::max())
+      return value.DeepCopy();
+
+    base::SharedMemoryCreateOptions options;
+    options.size = size;
+    options.share_read_only = true;
+
+    base::SharedMemory memory;
+    Cef_SharedBinary_Params params;
+    if (!memory.Create(options) || !memory.Map(size)) {
+      LOG(ERROR) << "Failed to create shared memory for " << size << " bytes";
+      return value.DeepCopy();
+    }
+    memcpy(memory.memory(), data, size);
+    if (!memory.ShareReadOnlyToProcess(peer_process_, &params.handle)) {
+      LOG(ERROR) << "Failed to share memory with the peer process";
+      return value.DeepCopy();
+    }
+
+    params.index = index;
+    params.size = static_cast<uint32>(size);
+    shared_binaries_->push_back(params);
+    return new base::BinaryValue();
+  }
+
+  base::ProcessHandle peer_process_;
+  size_t threshold_;
+  std::vector<Cef_SharedBinary_Params>* shared_binaries_;
+  int binary_count_;
+
+  DISALLOW_COPY_AND_ASSIGN(SharedBinaryWriter);
+};
+
+// Returns true if the shared memory segment opened as |memory| is large enough
+// to contain |size| bytes. The size claimed by the sender cannot be trusted
+// because accessing pages past the end of the segment will crash the process.
+bool IsSegmentLargeEnough(const base::SharedMemory& memory, size_t size) {
+  if (!base::SharedMemory::IsHandleValid(memory.handle()))
+    return false;
+#if defined(OS_WIN)
+  // MapViewOfFile() fails if the view is larger than the section.
+  return true;
+#else
+  size_t segment_size = 0;
+  if (!base::SharedMemory::GetSizeFromSharedMemoryHandle(memory.handle(),
+                                                         &segment_size)) {
+    return false;
+  }
+  return segment_size >= size;
+#endif
+}
+
+// Opens a shared memory handle received from |source_process|.
+scoped_ptr<base::SharedMemory> OpenSharedMemory(
+    const base::SharedMemoryHandle& handle,
+    base::ProcessHandle source_process) {
+#if defined(OS_WIN)
+  if (source_process != base::kNullProcessHandle) {
+    return make_scoped_ptr(
+        new base::SharedMemory(handle, true, source_process));
+  }
+#endif
+  return make_scoped_ptr(new base::SharedMemory(handle, true));
+}
+
+// Replaces the placeholders left by SharedBinaryWriter with
+// CefSharedBinaryValue objects. Binary values are visited in the same order
+// as SharedBinaryWriter. The shared binary parameters come from another
+// process and are validated before use.
+class SharedBinaryReader {
+ public:
+  SharedBinaryReader(
+      const std::vector<Cef_SharedBinary_Params>& shared_binaries,
+      base::ProcessHandle source_process)
+      : shared_binaries_(shared_binaries),
+        source_process_(source_process),
+        binary_count_(0),
+        next_shared_(0),
+        error_(false) {
+  }
+
+  ~SharedBinaryReader() {
+    // Close any handles that were not mapped.
+    for (; next_shared_ < shared_binaries_.size(); ++next_shared_)
+      OpenSharedMemory(shared_binaries_[next_shared_].handle, source_process_);
+  }
+
+  // Returns true if every shared binary parameter matched a placeholder and
+  // described a valid segment. Must be called after MapList().
+  bool is_valid() const {
+    return !error_ && next_shared_ == shared_binaries_.size();
+  }
+
+  void MapList(base::ListValue* list) {
+    for (size_t i = 0; i < list->GetSize(); ++i) {
+      base::Value* value = NULL;
+      list->Get(i, &value);
+      base::Value* new_value = Map(value);
+      if (new_value)
+        list->Set(i, new_value);
+    }
+  }
+
+ private:
+  // Returns a replacement for |value| or NULL if no replacement is required.
+  base::Value* Map(base::Value* value) {
+    switch (value->GetType()) {
+      case base::Value::TYPE_BINARY:
+        return MapBinary();
+      case base::Value::TYPE_LIST:
+        MapList(static_cast<base::ListValue*>(value));
+        return NULL;
+      case base::Value::TYPE_DICTIONARY:
+        MapDictionary(static_cast<base::DictionaryValue*>(value));
+        return NULL;
+      default:
+        return NULL;
+    }
+  }
+
+  void MapDictionary(base::DictionaryValue* dict) {
+    std::vector<std::string> keys;
+    base::DictionaryValue::Iterator it(*dict);
+    for (; !it.IsAtEnd(); it.Advance())
+      keys.push_back(it.key());
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+      base::Value* value = NULL;
+      dict->GetWithoutPathExpansion(keys[i], &value);
+      base::Value* new_value = Map(value);
+      if (new_value)
+        dict->SetWithoutPathExpansion(keys[i], new_value);
+    }
+  }
+
+  base::Value* MapBinary() {
+    const int index = binary_count_++;
+    if (next_shared_ >= shared_binaries_.size() ||
+        shared_binaries_[next_shared_].index != index) {
+      return NULL;
+    }
+
+    const Cef_SharedBinary_Params& params = shared_binaries_[next_shared_++];
+    scoped_ptr<base::SharedMemory> memory =
+        OpenSharedMemory(params.handle, source_process_);
+    if (params.size == 0 || !IsSegmentLargeEnough(*memory, params.size)) {
+      LOG(ERROR) << "Invalid shared binary value of " << params.size
+                 << " bytes";
+      error_ = true;
+      return NULL;
+    }
+
+    // Leave the empty placeholder in place if mapping fails.
+    return CefSharedBinaryValue::Create(memory.Pass(), params.size);
+  }
+
+  const std::vector<Cef_SharedBinary_Params>& shared_binaries_;
+  base::ProcessHandle source_process_;
+  int binary_count_;
+  size_t next_shared_;
+  bool error_;
+
+  DISALLOW_COPY_AND_ASSIGN(SharedBinaryReader);
+};
+
+// Returns true if |value| contains binary values that must be copied before
+// serialization. This includes values received using shared memory, whose
+// contents are not stored in the base::BinaryValue buffer, and values of at
+// least |threshold| bytes that will be sent using shared memory. A
+// |threshold| of 0 disables the size check.
+bool RequiresCopy(const base::Value& value, size_t threshold) {
+  switch (value.GetType()) {
+    case base::Value::TYPE_BINARY: {
+      const base::BinaryValue& binary =
+          static_cast<const base::BinaryValue&>(value);
+      if (CefSharedBinaryValue::FromValue(&binary))
+        return true;
+      return threshold > 0 && binary.GetSize() >= threshold;
+    }
+    case base::Value::TYPE_LIST: {
+      const base::ListValue& list = static_cast<const base::ListValue&>(value);
+      base::ListValue::const_iterator it = list.begin();
+      for (; it != list.end(); ++it) {
+        if (RequiresCopy(**it, threshold))
+          return true;
+      }
+      return false;
+    }
+    case base::Value::TYPE_DICTIONARY: {
+      base::DictionaryValue::Iterator it(
+          static_cast<const base::DictionaryValue&>(value));
+      for (; !it.IsAtEnd(); it.Advance()) {
+        if (RequiresCopy(it.value(), threshold))
+          return true;
+      }
+      return false;
+    }
+    default:
+      return false;
+  }
+}
+
 void CopyList(const base::ListValue& source,
               base::ListValue& target) {
   base::ListValue::const_iterator it = source.begin();
@@ -32,6 +315,33 @@ CefRefPtr<CefProcessMessage> CefProcessMessage::Create(const CefString& name) {
   return new CefProcessMessageImpl(params, true, false);
 }
 
+CefProcessMessageImpl::ScopedSendParams::ScopedSendParams(
+    CefProcessMessageImpl* message,
+    base::ProcessHandle peer_process,
+    Cef_Request_Params* params)
+    : message_(message),
+      params_(params),
+      moved_(false),
+      valid_(false) {
+  if (!message->VerifyAttached())
+    return;
+
+  lock_.reset(new CefValueController::AutoLock(message->controller()));
+  if (!lock_->verified())
+    return;
+
+  if (message->MoveToLocked(*params, peer_process))
+    moved_ = true;
+  else
+    message->CopyToLocked(*params, peer_process);
+  valid_ = true;
+}
+
+CefProcessMessageImpl::ScopedSendParams::~ScopedSendParams() {
+  if (moved_)
+    message_->RestoreFromLocked(*params_);
+}
+
 CefProcessMessageImpl::CefProcessMessageImpl(Cef_Request_Params* value,
                                              bool will_delete,
                                              bool read_only)
@@ -40,12 +350,106 @@ CefProcessMessageImpl::CefProcessMessageImpl(Cef_Request_Params* value,
         read_only, NULL) {
 }
 
-bool CefProcessMessageImpl::CopyTo(Cef_Request_Params& target) {
+bool CefProcessMessageImpl::CopyTo(Cef_Request_Params& target,
+                                   base::ProcessHandle peer_process) {
   CEF_VALUE_VERIFY_RETURN(false, false);
-  CopyValue(const_value(), target);
+  CopyToLocked(target, peer_process);
   return true;
 }
 
+void CefProcessMessageImpl::CopyToLocked(Cef_Request_Params& target,
+                                         base::ProcessHandle peer_process) {
+  const size_t threshold = GetSharedMemoryThreshold();
+  if (peer_process == base::kNullProcessHandle || threshold == 0) {
+    CopyValue(const_value(), target);
+    return;
+  }
+
+  target.name = const_value().name;
+  SharedBinaryWriter writer(peer_process, threshold, &target.shared_binaries);
+  writer.CopyList(const_value().arguments, target.arguments);
+}
+
+bool CefProcessMessageImpl::MoveToLocked(Cef_Request_Params& target,
+                                         base::ProcessHandle peer_process) {
+  // Read-only messages are never modified, even temporarily.
+  if (read_only())
+    return false;
+
+  const size_t threshold = peer_process == base::kNullProcessHandle ?
+      0 : GetSharedMemoryThreshold();
+  if (RequiresCopy(const_value().arguments, threshold))
+    return false;
+
+  target.name = const_value().name;
+  mutable_value()->arguments.Swap(&target.arguments);
+  return true;
+}
+
+void CefProcessMessageImpl::RestoreFromLocked(Cef_Request_Params& source) {
+  mutable_value()->arguments.Swap(&source.arguments);
+}
+
+// static
+bool CefProcessMessageImpl::MapSharedBinaries(
+    Cef_Request_Params& params,
+    base::ProcessHandle source_process) {
+  if (params.shared_binaries.empty())
+    return true;
+
+  SharedBinaryReader reader(params.shared_binaries, source_process);
+  reader.MapList(&params.arguments);
+  if (!reader.is_valid()) {
+    LOG(ERROR) << "Shared binary values do not match the message arguments";
+    return false;
+  }
+  return true;
+}
+
+// static
+bool CefProcessMessageImpl::ShareSharedBinaries(
+    Cef_Request_Params& params,
+    base::ProcessHandle peer_process) {
+#if defined(OS_WIN)
+  if (params.shared_binaries.empty())
+    return true;
+
+  if (peer_process == base::kNullProcessHandle) {
+    ReleaseSharedBinaries(params);
+    return false;
+  }
+
+  for (size_t i = 0; i < params.shared_binaries.size(); ++i) {
+    Cef_SharedBinary_Params& shared = params.shared_binaries[i];
+    base::SharedMemory memory(shared.handle, true);
+    if (!memory.GiveReadOnlyToProcess(peer_process, &shared.handle)) {
+      LOG(ERROR) << "Failed to share memory with the peer process";
+      // Handles before |i| now belong to |peer_process| and |shared.handle|
+      // was closed by GiveReadOnlyToProcess().
+      params.shared_binaries.erase(params.shared_binaries.begin(),
+                                   params.shared_binaries.begin() + i + 1);
+      ReleaseSharedBinaries(params);
+      return false;
+    }
+  }
+#endif
+  return true;
+}
+
+// static
+void CefProcessMessageImpl::ReleaseSharedBinaries(Cef_Request_Params& params) {
+  for (size_t i = 0; i < params.shared_binaries.size(); ++i) {
+    OpenSharedMemory(params.shared_binaries[i].handle,
+                     base::kNullProcessHandle);
+  }
+  params.shared_binaries.clear();
+}
+
+// static
+size_t CefProcessMessageImpl::GetSharedMemoryThreshold() {
+  return g_shared_memory_threshold.Get().value;
+}
+
 bool CefProcessMessageImpl::IsValid() {
   return !detached();
 }
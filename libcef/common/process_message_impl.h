@@ -9,18 +9,82 @@
 #include "include/cef_process_message.h"
 #include "libcef/common/value_base.h"
 
+#include "base/memory/scoped_ptr.h"
+#include "base/process/process_handle.h"
+
 struct Cef_Request_Params;
 
 // CefProcessMessage implementation
 class CefProcessMessageImpl
     : public CefValueBase<CefProcessMessage, Cef_Request_Params> {
  public:
+  // Makes the contents of |message| available in |params| for the lifetime of
+  // this object so that an IPC message can be created from |params|. When
+  // possible the argument tree of a writable message is moved into |params|
+  // and moved back on destruction instead of being copied. CopyTo() is used if
+  // the message is read-only or any binary arguments require special
+  // handling. The controller lock of |message| is held for the lifetime of
+  // this object so other threads cannot observe the moved arguments.
+  // |message| and |params| must outlive this object and |message| must not be
+  // accessed on the current thread in the meantime.
+  class ScopedSendParams {
+   public:
+    ScopedSendParams(CefProcessMessageImpl* message,
+                     base::ProcessHandle peer_process,
+                     Cef_Request_Params* params);
+    ~ScopedSendParams();
+
+    // Returns false if the message is invalid.
+    bool is_valid() const { return valid_; }
+
+   private:
+    CefProcessMessageImpl* message_;
+    Cef_Request_Params* params_;
+    scoped_ptr<CefValueController::AutoLock> lock_;
+    bool moved_;
+    bool valid_;
+
+    DISALLOW_COPY_AND_ASSIGN(ScopedSendParams);
+  };
+
   CefProcessMessageImpl(Cef_Request_Params* value,
                         bool will_delete,
                         bool read_only);
 
-  // Copies the underlying value to the specified |target| structure.
-  bool CopyTo(Cef_Request_Params& target);
+  // Copies the underlying value to the specified |target| structure. If
+  // |peer_process| is valid then binary arguments of at least
+  // GetSharedMemoryThreshold() bytes are written to read-only shared memory
+  // segments for |peer_process| instead of being copied into
+  // |target.arguments|. On Windows the handles are duplicated into
+  // |peer_process|. On other platforms |peer_process| is only checked for
+  // validity.
+  bool CopyTo(Cef_Request_Params& target, base::ProcessHandle peer_process);
+
+  // Replaces the placeholders that CopyTo() left in |params.arguments| with
+  // read-only views of the segments in |params.shared_binaries|. On Windows
+  // |source_process| is the process that the handles were created in, or
+  // base::kNullProcessHandle if they are already valid in this process.
+  // Returns false if |params.shared_binaries| does not match the placeholders
+  // or describes a segment that is smaller than the claimed size. The message
+  // must be discarded in that case.
+  static bool MapSharedBinaries(Cef_Request_Params& params,
+                                base::ProcessHandle source_process);
+
+  // Makes the segments in |params.shared_binaries| available to
+  // |peer_process| when |params| was filled by CopyTo() with the current
+  // process as the peer. On Windows the handles are moved into |peer_process|.
+  // On other platforms the handles are already valid for sending. Returns
+  // false and closes all handles if the segments cannot be shared.
+  static bool ShareSharedBinaries(Cef_Request_Params& params,
+                                  base::ProcessHandle peer_process);
+
+  // Closes the handles in |params.shared_binaries| when |params| will not be
+  // sent.
+  static void ReleaseSharedBinaries(Cef_Request_Params& params);
+
+  // Returns the minimum size in bytes of binary arguments that will be
+  // transferred using shared memory, or 0 if shared memory is disabled.
+  static size_t GetSharedMemoryThreshold();
 
   // CefProcessMessage methods.
   bool IsValid() override;
@@ -29,6 +93,19 @@ class CefProcessMessageImpl
   CefString GetName() override;
   CefRefPtr<CefListValue> GetArgumentList() override;
 
+ private:
+  // The below methods must be called with the controller lock held.
+
+  // Implementation of CopyTo().
+  void CopyToLocked(Cef_Request_Params& target,
+                    base::ProcessHandle peer_process);
+  // Moves the name and arguments to |target| without copying. Returns false
+  // if CopyToLocked() must be used instead.
+  bool MoveToLocked(Cef_Request_Params& target,
+                    base::ProcessHandle peer_process);
+  // Moves the arguments back from |source| after a successful MoveToLocked().
+  void RestoreFromLocked(Cef_Request_Params& source);
+
   DISALLOW_COPY_AND_ASSIGN(CefProcessMessageImpl);
 };
 
@@ -2,19 +2,25 @@
 // reserved. Use of this source code is governed by a BSD-style license that
 // can be found in the LICENSE file.
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
+#include "libcef/browser/url_request_user_data.h"
 #include "libcef/common/http_header_utils.h"
 #include "libcef/common/request_impl.h"
 #include "libcef/common/task_runner_impl.h"
 #include "libcef/common/upload_data.h"
 
 #include "base/logging.h"
+#include "base/memory/weak_ptr.h"
+#include "base/task_runner_util.h"
 #include "components/navigation_interception/navigation_params.h"
 #include "content/public/browser/resource_request_info.h"
 #include "content/public/common/resource_type.h"
 #include "net/base/elements_upload_data_stream.h"
+#include "net/base/io_buffer.h"
+#include "net/base/net_errors.h"
 #include "net/base/upload_data_stream.h"
 #include "net/base/upload_element_reader.h"
 #include "net/base/upload_bytes_element_reader.h"
@@ -46,6 +52,24 @@ class BytesElementReader : public net::UploadBytesElementReader {
   DISALLOW_COPY_AND_ASSIGN(BytesElementReader);
 };
 
+// A subclass of net::UploadBytesElementReader that references the contents of
+// a read-only CefPostDataElementImpl and keeps it alive until the request
+// completes.
+class SharedBytesElementReader : public net::UploadBytesElementReader {
+ public:
+  SharedBytesElementReader(CefRefPtr<CefPostDataElement> element,
+                           const char* bytes,
+                           uint64 length)
+      : net::UploadBytesElementReader(bytes, length),
+        element_(element) {
+  }
+
+ private:
+  CefRefPtr<CefPostDataElement> element_;
+
+  DISALLOW_COPY_AND_ASSIGN(SharedBytesElementReader);
+};
+
 base::TaskRunner* GetFileTaskRunner() {
   scoped_refptr<base::SequencedTaskRunner> task_runner =
       CefTaskRunnerImpl::GetTaskRunner(TID_FILE);
@@ -53,6 +77,20 @@ base::TaskRunner* GetFileTaskRunner() {
   return task_runner.get();
 }
 
+// Convert between the CefPostDataElement file range length, where -1 means
+// the remainder of the file, and the net::UploadElement representation.
+int64 FileRangeLength(uint64 range_length) {
+  if (range_length == kuint64max)
+    return -1;
+  return static_cast<int64>(range_length);
+}
+
+uint64 UploadRangeLength(int64 length) {
+  if (length < 0)
+    return kuint64max;
+  return static_cast<uint64>(length);
+}
+
 // A subclass of net::UploadFileElementReader that keeps the associated
 // UploadElement alive until the request completes.
 class FileElementReader : public net::UploadFileElementReader {
@@ -74,6 +112,119 @@ class FileElementReader : public net::UploadFileElementReader {
   DISALLOW_COPY_AND_ASSIGN(FileElementReader);
 };
 
+// Reads up to |num_bytes| from |stream| into |buf|. Returns the number of
+// bytes read or a net error code.
+int ReadStream(CefRefPtr<CefStreamReader> stream,
+               scoped_refptr<net::IOBuffer> buf,
+               int num_bytes) {
+  const size_t bytes_read = stream->Read(buf->data(), 1, num_bytes);
+  if (bytes_read == 0) {
+    // The stream ended before the expected number of bytes were read.
+    return net::ERR_UPLOAD_FILE_CHANGED;
+  }
+  return static_cast<int>(bytes_read);
+}
+
+// Moves |stream| to |offset|. Returns a net error code.
+int SeekStream(CefRefPtr<CefStreamReader> stream, int64 offset) {
+  if (stream->Tell() == offset)
+    return net::OK;
+  if (stream->Seek(offset, SEEK_SET) != 0)
+    return net::ERR_UPLOAD_STREAM_REWIND_NOT_SUPPORTED;
+  return net::OK;
+}
+
+// A net::UploadElementReader that reads the contents of a CefStreamReader
+// incrementally so that the data is never fully buffered in memory. Streams
+// that may block are accessed on the FILE thread.
+class StreamElementReader : public net::UploadElementReader {
+ public:
+  StreamElementReader(CefRefPtr<CefStreamReader> stream,
+                      int64 offset,
+                      int64 length)
+      : stream_(stream),
+        offset_(offset),
+        length_(length),
+        bytes_remaining_(0),
+        weak_ptr_factory_(this) {
+  }
+
+  // net::UploadElementReader methods.
+  int Init(const net::CompletionCallback& callback) override {
+    // Discard pending callbacks from a previous read.
+    weak_ptr_factory_.InvalidateWeakPtrs();
+    bytes_remaining_ = 0;
+
+    // Return to the starting position in case the request is being resent.
+    if (!stream_->MayBlock())
+      return DidInit(SeekStream(stream_, offset_));
+
+    base::PostTaskAndReplyWithResult(GetFileTaskRunner(), FROM_HERE,
+        base::Bind(&SeekStream, stream_, offset_),
+        base::Bind(&StreamElementReader::OnInitCompleted,
+                   weak_ptr_factory_.GetWeakPtr(), callback));
+    return net::ERR_IO_PENDING;
+  }
+
+  uint64 GetContentLength() const override {
+    return length_;
+  }
+
+  uint64 BytesRemaining() const override {
+    return bytes_remaining_;
+  }
+
+  int Read(net::IOBuffer* buf,
+           int buf_length,
+           const net::CompletionCallback& callback) override {
+    DCHECK_GT(buf_length, 0);
+    const int num_bytes = static_cast<int>(
+        std::min(bytes_remaining_, static_cast<uint64>(buf_length)));
+    if (num_bytes == 0)
+      return 0;
+
+    if (!stream_->MayBlock())
+      return DidRead(ReadStream(stream_, buf, num_bytes));
+
+    base::PostTaskAndReplyWithResult(GetFileTaskRunner(), FROM_HERE,
+        base::Bind(&ReadStream, stream_, make_scoped_refptr(buf), num_bytes),
+        base::Bind(&StreamElementReader::OnReadCompleted,
+                   weak_ptr_factory_.GetWeakPtr(), callback));
+    return net::ERR_IO_PENDING;
+  }
+
+ private:
+  int DidInit(int result) {
+    if (result == net::OK)
+      bytes_remaining_ = length_;
+    return result;
+  }
+
+  int DidRead(int result) {
+    if (result > 0) {
+      DCHECK_LE(static_cast<uint64>(result), bytes_remaining_);
+      bytes_remaining_ -= result;
+    }
+    return result;
+  }
+
+  void OnInitCompleted(const net::CompletionCallback& callback, int result) {
+    callback.Run(DidInit(result));
+  }
+
+  void OnReadCompleted(const net::CompletionCallback& callback, int result) {
+    callback.Run(DidRead(result));
+  }
+
+  CefRefPtr<CefStreamReader> stream_;
+  const int64 offset_;
+  const uint64 length_;
+  uint64 bytes_remaining_;
+  base::WeakPtrFactory<StreamElementReader> weak_ptr_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(StreamElementReader);
+};
+
 }  // namespace
 
 
@@ -237,7 +388,17 @@ void CefRequestImpl::Set(net::URLRequest* request) {
   const net::UploadDataStream* data = request->get_upload();
   if (data) {
     postdata_ = CefPostData::Create();
-    static_cast<CefPostDataImpl*>(postdata_.get())->Set(*data);
+
+    // Requests sent via CefURLRequest keep the original post data, which may
+    // contain elements that cannot be recovered from |data|.
+    CefURLRequestUserData* user_data = static_cast<CefURLRequestUserData*>(
+        request->GetUserData(CefURLRequestUserData::kUserDataKey));
+    if (user_data && user_data->GetPostData().get()) {
+      static_cast<CefPostDataImpl*>(postdata_.get())->Set(
+          user_data->GetPostData());
+    } else {
+      static_cast<CefPostDataImpl*>(postdata_.get())->Set(*data);
+    }
   }
 
   const content::ResourceRequestInfo* info =
@@ -544,17 +705,42 @@ void CefPostDataImpl::Set(const net::UploadDataStream& data_stream) {
     for (; it != elements->end(); ++it) {
       postelem = CefPostDataElement::Create();
       static_cast<CefPostDataElementImpl*>(postelem.get())->Set(**it);
-      AddElement(postelem);
+      // Skip readers that cannot be represented.
+      if (postelem->GetType() != PDE_TYPE_EMPTY)
+        AddElement(postelem);
     }
   }
 }
 
+void CefPostDataImpl::Set(CefRefPtr<CefPostData> post_data) {
+  {
+    base::AutoLock lock_scope(lock_);
+    CHECK_READONLY_RETURN_VOID();
+  }
+
+  CefRefPtr<CefPostDataElement> postelem;
+
+  ElementVector elements;
+  post_data->GetElements(elements);
+  ElementVector::const_iterator it = elements.begin();
+  for (; it != elements.end(); ++it) {
+    if ((*it)->GetType() == PDE_TYPE_EMPTY)
+      continue;
+    postelem = CefPostDataElement::Create();
+    static_cast<CefPostDataElementImpl*>(postelem.get())->Set(
+        static_cast<CefPostDataElementImpl*>(it->get()));
+    AddElement(postelem);
+  }
+}
+
 void CefPostDataImpl::Get(net::UploadData& data) {
   base::AutoLock lock_scope(lock_);
 
   ScopedVector<net::UploadElement> data_elements;
   ElementVector::const_iterator it = elements_.begin();
   for (; it != elements_.end(); ++it) {
+    if ((*it)->GetType() == PDE_TYPE_EMPTY)
+      continue;
     net::UploadElement* element = new net::UploadElement();
     static_cast<CefPostDataElementImpl*>(it->get())->Get(*element);
     data_elements.push_back(element);
@@ -568,8 +754,12 @@ net::UploadDataStream* CefPostDataImpl::Get() {
   ScopedVector<net::UploadElementReader> element_readers;
   ElementVector::const_iterator it = elements_.begin();
   for (; it != elements_.end(); ++it) {
-    element_readers.push_back(
-        static_cast<CefPostDataElementImpl*>(it->get())->Get());
+    if ((*it)->GetType() == PDE_TYPE_EMPTY)
+      continue;
+    net::UploadElementReader* reader =
+        static_cast<CefPostDataElementImpl*>(it->get())->Get();
+    if (reader)
+      element_readers.push_back(reader);
   }
 
   return new net::ElementsUploadDataStream(element_readers.Pass(), 0);
@@ -599,6 +789,8 @@ void CefPostDataImpl::Get(blink::WebHTTPBody& data) {
   blink::WebHTTPBody::Element element;
   ElementVector::iterator it = elements_.begin();
   for (; it != elements_.end(); ++it) {
+    if ((*it)->GetType() == PDE_TYPE_EMPTY)
+      continue;
     static_cast<CefPostDataElementImpl*>(it->get())->Get(element);
     if (element.type == blink::WebHTTPBody::Element::TypeData) {
       data.appendData(element.data);
@@ -657,15 +849,48 @@ void CefPostDataElementImpl::SetToEmpty() {
 }
 
 void CefPostDataElementImpl::SetToFile(const CefString& fileName) {
+  SetToFileRange(fileName, 0, -1);
+}
+
+void CefPostDataElementImpl::SetToFileRange(const CefString& fileName,
+                                            int64 offset,
+                                            int64 length) {
   base::AutoLock lock_scope(lock_);
   CHECK_READONLY_RETURN_VOID();
 
+  DCHECK_GE(offset, 0);
+  DCHECK_GE(length, -1);
+  if (offset < 0 || length < -1)
+    return;
+
   // Clear any data currently in the element
   Cleanup();
 
   // Assign the new data
   type_ = PDE_TYPE_FILE;
-  cef_string_copy(fileName.c_str(), fileName.length(), &data_.filename);
+  cef_string_copy(fileName.c_str(), fileName.length(), &data_.file.name);
+  data_.file.offset = offset;
+  data_.file.length = length;
+}
+
+void CefPostDataElementImpl::SetToStream(CefRefPtr<CefStreamReader> stream,
+                                         int64 length) {
+  base::AutoLock lock_scope(lock_);
+  CHECK_READONLY_RETURN_VOID();
+
+  DCHECK(stream.get());
+  DCHECK_GE(length, 0);
+  if (!stream.get() || length < 0)
+    return;
+
+  // Clear any data currently in the element
+  Cleanup();
+
+  // Assign the new data
+  type_ = PDE_TYPE_STREAM;
+  stream_ = stream;
+  data_.stream.offset = stream->Tell();
+  data_.stream.length = length;
 }
 
 void CefPostDataElementImpl::SetToBytes(size_t size, const void* bytes) {
@@ -698,10 +923,40 @@ CefString CefPostDataElementImpl::GetFile() {
   DCHECK(type_ == PDE_TYPE_FILE);
   CefString filename;
   if (type_ == PDE_TYPE_FILE)
-    filename.FromString(data_.filename.str, data_.filename.length, false);
+    filename.FromString(data_.file.name.str, data_.file.name.length, false);
   return filename;
 }
 
+int64 CefPostDataElementImpl::GetFileOffset() {
+  base::AutoLock lock_scope(lock_);
+  DCHECK(type_ == PDE_TYPE_FILE);
+  if (type_ == PDE_TYPE_FILE)
+    return data_.file.offset;
+  return 0;
+}
+
+int64 CefPostDataElementImpl::GetFileLength() {
+  base::AutoLock lock_scope(lock_);
+  DCHECK(type_ == PDE_TYPE_FILE);
+  if (type_ == PDE_TYPE_FILE)
+    return data_.file.length;
+  return 0;
+}
+
+CefRefPtr<CefStreamReader> CefPostDataElementImpl::GetStream() {
+  base::AutoLock lock_scope(lock_);
+  DCHECK(type_ == PDE_TYPE_STREAM);
+  return stream_;
+}
+
+int64 CefPostDataElementImpl::GetStreamLength() {
+  base::AutoLock lock_scope(lock_);
+  DCHECK(type_ == PDE_TYPE_STREAM);
+  if (type_ == PDE_TYPE_STREAM)
+    return data_.stream.length;
+  return 0;
+}
+
 size_t CefPostDataElementImpl::GetBytesCount() {
   base::AutoLock lock_scope(lock_);
   DCHECK(type_ == PDE_TYPE_BYTES);
@@ -731,7 +986,9 @@ void CefPostDataElementImpl::Set(const net::UploadElement& element) {
   if (element.type() == net::UploadElement::TYPE_BYTES) {
     SetToBytes(element.bytes_length(), element.bytes());
   } else if (element.type() == net::UploadElement::TYPE_FILE) {
-    SetToFile(element.file_path().value());
+    SetToFileRange(element.file_path().value(),
+                   element.file_range_offset(),
+                   FileRangeLength(element.file_range_length()));
   } else {
     NOTREACHED();
   }
@@ -754,11 +1011,42 @@ void CefPostDataElementImpl::Set(
   const net::UploadFileElementReader* file_reader =
       element_reader.AsFileReader();
   if (file_reader) {
-    SetToFile(file_reader->path().value());
+    SetToFileRange(file_reader->path().value(),
+                   file_reader->range_offset(),
+                   FileRangeLength(file_reader->range_length()));
     return;
   }
 
-  NOTREACHED();
+  // Other reader types, such as those created for PDE_TYPE_STREAM elements,
+  // cannot be represented and will result in an empty element.
+}
+
+void CefPostDataElementImpl::Set(CefPostDataElementImpl* element) {
+  DCHECK_NE(this, element);
+
+  {
+    base::AutoLock lock_scope(lock_);
+    CHECK_READONLY_RETURN_VOID();
+  }
+
+  base::AutoLock element_lock_scope(element->lock_);
+
+  if (element->type_ == PDE_TYPE_BYTES) {
+    SetToBytes(element->data_.bytes.size, element->data_.bytes.bytes);
+  } else if (element->type_ == PDE_TYPE_FILE) {
+    SetToFileRange(CefString(&element->data_.file.name),
+                   element->data_.file.offset, element->data_.file.length);
+  } else if (element->type_ == PDE_TYPE_STREAM) {
+    // Only describe the stream. Reading it would interfere with the network
+    // stack, which owns the read position until the request completes.
+    base::AutoLock lock_scope(lock_);
+    Cleanup();
+    type_ = PDE_TYPE_STREAM;
+    data_.stream.offset = element->data_.stream.offset;
+    data_.stream.length = element->data_.stream.length;
+  } else {
+    SetToEmpty();
+  }
 }
 
 void CefPostDataElementImpl::Get(net::UploadElement& element) {
@@ -767,9 +1055,12 @@ void CefPostDataElementImpl::Get(net::UploadElement& element) {
   if (type_ == PDE_TYPE_BYTES) {
     element.SetToBytes(static_cast<char*>(data_.bytes.bytes), data_.bytes.size);
   } else if (type_ == PDE_TYPE_FILE) {
-    base::FilePath path = base::FilePath(CefString(&data_.filename));
-    element.SetToFilePath(path);
+    base::FilePath path = base::FilePath(CefString(&data_.file.name));
+    element.SetToFilePathRange(path, data_.file.offset,
+                               UploadRangeLength(data_.file.length),
+                               base::Time());
   } else {
+    // Streams cannot be represented as net::UploadElement.
     NOTREACHED();
   }
 }
@@ -778,15 +1069,30 @@ net::UploadElementReader* CefPostDataElementImpl::Get() {
   base::AutoLock lock_scope(lock_);
 
   if (type_ == PDE_TYPE_BYTES) {
+    if (read_only_) {
+      // The contents can no longer change so reference them directly instead
+      // of making a copy.
+      return new SharedBytesElementReader(this,
+          static_cast<char*>(data_.bytes.bytes), data_.bytes.size);
+    }
     net::UploadElement* element = new net::UploadElement();
     element->SetToBytes(static_cast<char*>(data_.bytes.bytes),
                         data_.bytes.size);
     return new BytesElementReader(make_scoped_ptr(element));
   } else if (type_ == PDE_TYPE_FILE) {
     net::UploadElement* element = new net::UploadElement();
-    base::FilePath path = base::FilePath(CefString(&data_.filename));
-    element->SetToFilePath(path);
+    base::FilePath path = base::FilePath(CefString(&data_.file.name));
+    element->SetToFilePathRange(path, data_.file.offset,
+                                UploadRangeLength(data_.file.length),
+                                base::Time());
     return new FileElementReader(make_scoped_ptr(element));
+  } else if (type_ == PDE_TYPE_STREAM) {
+    // Elements copied by CefPostDataImpl::Set(CefRefPtr<CefPostData>) have no
+    // stream and cannot be sent.
+    if (!stream_.get())
+      return NULL;
+    return new StreamElementReader(stream_, data_.stream.offset,
+                                   data_.stream.length);
   } else {
     NOTREACHED();
     return NULL;
@@ -803,7 +1109,8 @@ void CefPostDataElementImpl::Set(const blink::WebHTTPBody::Element& element) {
     SetToBytes(element.data.size(),
         static_cast<const void*>(element.data.data()));
   } else if (element.type == blink::WebHTTPBody::Element::TypeFile) {
-    SetToFile(base::string16(element.filePath));
+    SetToFileRange(base::string16(element.filePath), element.fileStart,
+                   element.fileLength);
   } else {
     NOTREACHED();
   }
@@ -818,8 +1125,11 @@ void CefPostDataElementImpl::Get(blink::WebHTTPBody::Element& element) {
         static_cast<char*>(data_.bytes.bytes), data_.bytes.size);
   } else if (type_ == PDE_TYPE_FILE) {
     element.type = blink::WebHTTPBody::Element::TypeFile;
-    element.filePath.assign(base::string16(CefString(&data_.filename)));
+    element.filePath.assign(base::string16(CefString(&data_.file.name)));
+    element.fileStart = data_.file.offset;
+    element.fileLength = data_.file.length;
   } else {
+    // Streams are not supported in the render process.
     NOTREACHED();
   }
 }
@@ -839,7 +1149,9 @@ void CefPostDataElementImpl::Cleanup() {
   if (type_ == PDE_TYPE_BYTES)
     free(data_.bytes.bytes);
   else if (type_ == PDE_TYPE_FILE)
-    cef_string_clear(&data_.filename);
+    cef_string_clear(&data_.file.name);
+  else if (type_ == PDE_TYPE_STREAM)
+    stream_ = NULL;
   type_ = PDE_TYPE_EMPTY;
   memset(&data_, 0, sizeof(data_));
 }
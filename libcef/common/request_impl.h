@@ -118,6 +118,10 @@ class CefPostDataImpl : public CefPostData {
 
   void Set(const net::UploadData& data);
   void Set(const net::UploadDataStream& data_stream);
+  // Copy the elements of |post_data| for exposure to handler callbacks while
+  // the request is in progress. Stream elements only keep their length
+  // because the CefStreamReader is being read by the network stack.
+  void Set(CefRefPtr<CefPostData> post_data);
   void Get(net::UploadData& data);
   net::UploadDataStream* Get();
   void Set(const blink::WebHTTPBody& data);
@@ -145,9 +149,18 @@ class CefPostDataElementImpl : public CefPostDataElement {
   bool IsReadOnly() override;
   void SetToEmpty() override;
   void SetToFile(const CefString& fileName) override;
+  void SetToFileRange(const CefString& fileName,
+                      int64 offset,
+                      int64 length) override;
+  void SetToStream(CefRefPtr<CefStreamReader> stream,
+                   int64 length) override;
   void SetToBytes(size_t size, const void* bytes) override;
   Type GetType() override;
   CefString GetFile() override;
+  int64 GetFileOffset() override;
+  int64 GetFileLength() override;
+  CefRefPtr<CefStreamReader> GetStream() override;
+  int64 GetStreamLength() override;
   size_t GetBytesCount() override;
   size_t GetBytes(size_t size, void* bytes) override;
 
@@ -155,6 +168,7 @@ class CefPostDataElementImpl : public CefPostDataElement {
 
   void Set(const net::UploadElement& element);
   void Set(const net::UploadElementReader& element_reader);
+  void Set(CefPostDataElementImpl* element);
   void Get(net::UploadElement& element);
   net::UploadElementReader* Get();
   void Set(const blink::WebHTTPBody::Element& element);
@@ -171,9 +185,20 @@ class CefPostDataElementImpl : public CefPostDataElement {
       void* bytes;
       size_t size;
     } bytes;
-    cef_string_t filename;
+    struct {
+      cef_string_t name;
+      int64 offset;
+      int64 length;
+    } file;
+    struct {
+      int64 offset;
+      int64 length;
+    } stream;
   } data_;
 
+  // Only used with PDE_TYPE_STREAM.
+  CefRefPtr<CefStreamReader> stream_;
+
   // True if this object is read-only.
   bool read_only_;
 
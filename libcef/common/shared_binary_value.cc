@@ -0,0 +1,133 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include "libcef/common/shared_binary_value.h"
+
+#include <string.h>
+
+#include "base/logging.h"
+
+namespace {
+
+// Identifies CefSharedBinaryValue objects via GetTypeKey().
+const char kSharedBinaryValueTypeKey = 0;
+
+bool ListValuesEqual(const base::ListValue* a, const base::ListValue* b) {
+  if (a->GetSize() != b->GetSize())
+    return false;
+
+  base::ListValue::const_iterator it_a = a->begin();
+  base::ListValue::const_iterator it_b = b->begin();
+  for (; it_a != a->end(); ++it_a, ++it_b) {
+    if (!CefSharedBinaryValue::ValuesEqual(*it_a, *it_b))
+      return false;
+  }
+  return true;
+}
+
+bool DictionaryValuesEqual(const base::DictionaryValue* a,
+                           const base::DictionaryValue* b) {
+  if (a->size() != b->size())
+    return false;
+
+  // Keys are iterated in sorted order.
+  base::DictionaryValue::Iterator it_a(*a);
+  base::DictionaryValue::Iterator it_b(*b);
+  for (; !it_a.IsAtEnd(); it_a.Advance(), it_b.Advance()) {
+    if (it_b.IsAtEnd() || it_a.key() != it_b.key() ||
+        !CefSharedBinaryValue::ValuesEqual(&it_a.value(), &it_b.value())) {
+      return false;
+    }
+  }
+  return it_b.IsAtEnd();
+}
+
+}  // namespace
+
+// static
+CefSharedBinaryValue* CefSharedBinaryValue::Create(
+    scoped_ptr<base::SharedMemory> memory,
+    size_t size) {
+  DCHECK(memory);
+  DCHECK_GT(size, 0U);
+  if (memory->mapped_size() < size && !memory->Map(size)) {
+    LOG(ERROR) << "Failed to map shared binary value of " << size << " bytes";
+    return NULL;
+  }
+
+  return new CefSharedBinaryValue(memory.Pass(), size);
+}
+
+// static
+const CefSharedBinaryValue* CefSharedBinaryValue::FromValue(
+    const base::BinaryValue* value) {
+  if (value->GetTypeKey() != &kSharedBinaryValueTypeKey)
+    return NULL;
+  return static_cast<const CefSharedBinaryValue*>(value);
+}
+
+// static
+const char* CefSharedBinaryValue::GetData(const base::BinaryValue& value,
+                                          size_t* size) {
+  const CefSharedBinaryValue* shared_value = FromValue(&value);
+  if (shared_value) {
+    *size = shared_value->data_size();
+    return shared_value->data();
+  }
+
+  *size = value.GetSize();
+  return value.GetBuffer();
+}
+
+// static
+bool CefSharedBinaryValue::ValuesEqual(const base::Value* a,
+                                       const base::Value* b) {
+  if (!a || !b)
+    return a == b;
+  if (a->GetType() != b->GetType())
+    return false;
+
+  switch (a->GetType()) {
+    case base::Value::TYPE_BINARY: {
+      size_t a_size, b_size;
+      const char* a_data =
+          GetData(*static_cast<const base::BinaryValue*>(a), &a_size);
+      const char* b_data =
+          GetData(*static_cast<const base::BinaryValue*>(b), &b_size);
+      return a_size == b_size &&
+             (a_size == 0 || memcmp(a_data, b_data, a_size) == 0);
+    }
+    case base::Value::TYPE_LIST:
+      return ListValuesEqual(static_cast<const base::ListValue*>(a),
+                             static_cast<const base::ListValue*>(b));
+    case base::Value::TYPE_DICTIONARY:
+      return DictionaryValuesEqual(
+          static_cast<const base::DictionaryValue*>(a),
+          static_cast<const base::DictionaryValue*>(b));
+    default:
+      return a->Equals(b);
+  }
+}
+
+CefSharedBinaryValue::~CefSharedBinaryValue() {
+}
+
+base::BinaryValue* CefSharedBinaryValue::DeepCopy() const {
+  return base::BinaryValue::CreateWithCopiedBuffer(data(), data_size_);
+}
+
+bool CefSharedBinaryValue::Equals(const base::Value* other) const {
+  return ValuesEqual(this, other);
+}
+
+const void* CefSharedBinaryValue::GetTypeKey() const {
+  return &kSharedBinaryValueTypeKey;
+}
+
+CefSharedBinaryValue::CefSharedBinaryValue(
+    scoped_ptr<base::SharedMemory> memory,
+    size_t size)
+    : memory_(memory.Pass()),
+      data_size_(size) {
+}
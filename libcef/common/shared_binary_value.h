@@ -0,0 +1,62 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_COMMON_SHARED_BINARY_VALUE_H_
+#define CEF_LIBCEF_COMMON_SHARED_BINARY_VALUE_H_
+#pragma once
+
+#include "base/memory/scoped_ptr.h"
+#include "base/memory/shared_memory.h"
+#include "base/values.h"
+
+// Read-only binary value that exposes the contents of a shared memory segment
+// mapped into the current process. Used to receive large CefProcessMessage
+// binary arguments without copying them. The base::BinaryValue buffer is
+// always empty so the contents must be accessed via GetData().
+class CefSharedBinaryValue : public base::BinaryValue {
+ public:
+  // Create a value that exposes the first |size| bytes of |memory|. The caller
+  // must verify that the segment contains at least |size| bytes. |memory| will
+  // be mapped if necessary and is unmapped when the value, and therefore the
+  // message argument tree that contains it, is destroyed. Returns NULL if
+  // mapping fails.
+  static CefSharedBinaryValue* Create(scoped_ptr<base::SharedMemory> memory,
+                                      size_t size);
+
+  // Returns |value| as a CefSharedBinaryValue or NULL if it is some other
+  // type of binary value.
+  static const CefSharedBinaryValue* FromValue(const base::BinaryValue* value);
+
+  // Returns the contents of |value| regardless of how they are stored.
+  static const char* GetData(const base::BinaryValue& value, size_t* size);
+
+  // Same as base::Value::Equals but compares binary values by contents
+  // regardless of how they are stored.
+  static bool ValuesEqual(const base::Value* a, const base::Value* b);
+
+  ~CefSharedBinaryValue() override;
+
+  const char* data() const {
+    return static_cast<const char*>(memory_->memory());
+  }
+  size_t data_size() const { return data_size_; }
+
+  // base::Value methods.
+  base::BinaryValue* DeepCopy() const override;
+  bool Equals(const base::Value* other) const override;
+
+  // base::BinaryValue methods.
+  const void* GetTypeKey() const override;
+
+ private:
+  CefSharedBinaryValue(scoped_ptr<base::SharedMemory> memory,
+                       size_t size);
+
+  scoped_ptr<base::SharedMemory> memory_;
+  size_t data_size_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefSharedBinaryValue);
+};
+
+#endif  // CEF_LIBCEF_COMMON_SHARED_BINARY_VALUE_H_
@@ -0,0 +1,55 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include "libcef/common/string_chunker.h"
+
+#include <algorithm>
+
+#include "base/logging.h"
+
+namespace {
+
+// Returns true if |c| is a UTF-8 continuation byte (10xxxxxx).
+inline bool IsContinuationByte(char c) {
+  return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+}
+
+}  // namespace
+
+// static
+const size_t CefStringChunker::kDefaultChunkSize = 256 * 1024;
+
+CefStringChunker::CefStringChunker(std::string* data, size_t chunk_size)
+    : chunk_size_(chunk_size),
+      offset_(0),
+      started_(false) {
+  // A UTF-8 character is at most 4 bytes.
+  DCHECK_GE(chunk_size_, 4U);
+  data_.swap(*data);
+}
+
+base::StringPiece CefStringChunker::Next() {
+  DCHECK(HasNext());
+  started_ = true;
+
+  const size_t remaining = data_.size() - offset_;
+  size_t length = std::min(remaining, chunk_size_);
+
+  // Back up to the start of the character that would be split. Invalid
+  // sequences longer than a character are split anyway.
+  if (length < remaining) {
+    size_t end = offset_ + length;
+    size_t backed_up = 0;
+    while (backed_up < 3 && IsContinuationByte(data_[end])) {
+      --end;
+      ++backed_up;
+    }
+    if (end > offset_ && !IsContinuationByte(data_[end]))
+      length = end - offset_;
+  }
+
+  base::StringPiece chunk(data_.data() + offset_, length);
+  offset_ += length;
+  return chunk;
+}
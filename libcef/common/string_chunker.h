@@ -0,0 +1,44 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_COMMON_STRING_CHUNKER_H_
+#define CEF_LIBCEF_COMMON_STRING_CHUNKER_H_
+#pragma once
+
+#include <string>
+
+#include "base/macros.h"
+#include "base/strings/string_piece.h"
+
+// Splits a UTF-8 string into chunks of at most |chunk_size| bytes without
+// splitting multi-byte characters. Takes ownership of the string contents so
+// that no additional copy is made.
+class CefStringChunker {
+ public:
+  // Default chunk size used for frame source and text retrieval.
+  static const size_t kDefaultChunkSize;
+
+  // |data| will be swapped into this object.
+  CefStringChunker(std::string* data, size_t chunk_size);
+
+  // Returns true if chunks remain. An empty string produces a single empty
+  // chunk.
+  bool HasNext() const { return !started_ || offset_ < data_.size(); }
+
+  // Returns the next chunk. The result is valid for the lifespan of this
+  // object.
+  base::StringPiece Next();
+
+  size_t size() const { return data_.size(); }
+
+ private:
+  std::string data_;
+  const size_t chunk_size_;
+  size_t offset_;
+  bool started_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefStringChunker);
+};
+
+#endif  // CEF_LIBCEF_COMMON_STRING_CHUNKER_H_
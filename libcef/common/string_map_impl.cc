@@ -2,14 +2,14 @@
 // reserved. Use of this source code is governed by a BSD-style license that
 // can be found in the LICENSE file.
 
-#include <map>
 #include "include/internal/cef_string_map.h"
+#include "libcef/common/ordered_string_map.h"
 #include "base/logging.h"
 
-typedef std::map<CefString, CefString> StringMap;
+typedef CefOrderedStringMap StringMap;
 
 CEF_EXPORT cef_string_map_t cef_string_map_alloc() {
-  return new StringMap;
+  return new StringMap(false);
 }
 
 CEF_EXPORT int cef_string_map_size(cef_string_map_t map) {
@@ -24,12 +24,11 @@ CEF_EXPORT int cef_string_map_find(cef_string_map_t map,
   DCHECK(map);
   DCHECK(value);
   StringMap* impl = reinterpret_cast<StringMap*>(map);
-  StringMap::const_iterator it = impl->find(CefString(key));
-  if (it == impl->end())
+  const CefString* val = impl->Find(CefString(key), 0);
+  if (!val)
     return 0;
 
-  const CefString& val = it->second;
-  return cef_string_set(val.c_str(), val.length(), value, true);
+  return cef_string_set(val->c_str(), val->length(), value, true);
 }
 
 CEF_EXPORT int cef_string_map_key(cef_string_map_t map, int index,
@@ -42,12 +41,8 @@ CEF_EXPORT int cef_string_map_key(cef_string_map_t map, int index,
   if (index < 0 || index >= static_cast<int>(impl->size()))
     return 0;
 
-  StringMap::const_iterator it = impl->begin();
-  for (int ct = 0; it != impl->end(); ++it, ct++) {
-    if (ct == index)
-      return cef_string_set(it->first.c_str(), it->first.length(), key, true);
-  }
-  return 0;
+  const CefString& val = impl->key(index);
+  return cef_string_set(val.c_str(), val.length(), key, true);
 }
 
 CEF_EXPORT int cef_string_map_value(cef_string_map_t map, int index,
@@ -60,14 +55,8 @@ CEF_EXPORT int cef_string_map_value(cef_string_map_t map, int index,
   if (index < 0 || index >= static_cast<int>(impl->size()))
     return 0;
 
-  StringMap::const_iterator it = impl->begin();
-  for (int ct = 0; it != impl->end(); ++it, ct++) {
-    if (ct == index) {
-      return cef_string_set(it->second.c_str(), it->second.length(), value,
-          true);
-    }
-  }
-  return 0;
+  const CefString& val = impl->value(index);
+  return cef_string_set(val.c_str(), val.length(), value, true);
 }
 
 CEF_EXPORT int cef_string_map_append(cef_string_map_t map,
@@ -75,14 +64,14 @@ CEF_EXPORT int cef_string_map_append(cef_string_map_t map,
                                      const cef_string_t* value) {
   DCHECK(map);
   StringMap* impl = reinterpret_cast<StringMap*>(map);
-  impl->insert(std::make_pair(CefString(key), CefString(value)));
+  impl->Append(CefString(key), CefString(value));
   return 1;
 }
 
 CEF_EXPORT void cef_string_map_clear(cef_string_map_t map) {
   DCHECK(map);
   StringMap* impl = reinterpret_cast<StringMap*>(map);
-  impl->clear();
+  impl->Clear();
 }
 
 CEF_EXPORT void cef_string_map_free(cef_string_map_t map) {
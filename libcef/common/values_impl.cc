@@ -3,6 +3,7 @@
 // can be found in the LICENSE file.
 
 #include "libcef/common/values_impl.h"
+#include "libcef/common/shared_binary_value.h"
 
 #include <algorithm>
 #include <vector>
@@ -487,7 +488,7 @@ bool CefBinaryValueImpl::IsSameValue(const base::BinaryValue* that) {
 
 bool CefBinaryValueImpl::IsEqualValue(const base::BinaryValue* that) {
   CEF_VALUE_VERIFY_RETURN(false, false);
-  return const_value().Equals(that);
+  return CefSharedBinaryValue::ValuesEqual(&const_value(), that);
 }
 
 base::BinaryValue* CefBinaryValueImpl::GetValueUnsafe() {
@@ -535,7 +536,9 @@ CefRefPtr<CefBinaryValue> CefBinaryValueImpl::Copy() {
 
 size_t CefBinaryValueImpl::GetSize() {
   CEF_VALUE_VERIFY_RETURN(false, 0);
-  return const_value().GetSize();
+  size_t size;
+  CefSharedBinaryValue::GetData(const_value(), &size);
+  return size;
 }
 
 size_t CefBinaryValueImpl::GetData(void* buffer,
@@ -548,17 +551,25 @@ size_t CefBinaryValueImpl::GetData(void* buffer,
 
   CEF_VALUE_VERIFY_RETURN(false, 0);
 
-  size_t size = const_value().GetSize();
+  size_t size;
+  const char* data = CefSharedBinaryValue::GetData(const_value(), &size);
   DCHECK_LT(data_offset, size);
   if (data_offset >= size)
     return 0;
 
   size = std::min(buffer_size, size-data_offset);
-  const char* data = const_value().GetBuffer();
   memcpy(buffer, data+data_offset, size);
   return size;
 }
 
+void* CefBinaryValueImpl::GetRawData() {
+  CEF_VALUE_VERIFY_RETURN(false, NULL);
+
+  size_t size;
+  const char* data = CefSharedBinaryValue::GetData(const_value(), &size);
+  return size > 0 ? const_cast<char*>(data) : NULL;
+}
+
 CefBinaryValueImpl::CefBinaryValueImpl(base::BinaryValue* value,
                                        void* parent_value,
                                        ValueMode value_mode,
@@ -625,7 +636,7 @@ bool CefDictionaryValueImpl::IsSameValue(const base::DictionaryValue* that) {
 
 bool CefDictionaryValueImpl::IsEqualValue(const base::DictionaryValue* that) {
   CEF_VALUE_VERIFY_RETURN(false, false);
-  return const_value().Equals(that);
+  return CefSharedBinaryValue::ValuesEqual(&const_value(), that);
 }
 
 base::DictionaryValue* CefDictionaryValueImpl::GetValueUnsafe() {
@@ -1039,7 +1050,7 @@ bool CefListValueImpl::IsSameValue(const base::ListValue* that) {
 
 bool CefListValueImpl::IsEqualValue(const base::ListValue* that) {
   CEF_VALUE_VERIFY_RETURN(false, false);
-  return const_value().Equals(that);
+  return CefSharedBinaryValue::ValuesEqual(&const_value(), that);
 }
 
 base::ListValue* CefListValueImpl::GetValueUnsafe() {
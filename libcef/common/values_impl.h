@@ -173,6 +173,7 @@ class CefBinaryValueImpl
   size_t GetData(void* buffer,
                  size_t buffer_size,
                  size_t data_offset) override;
+  void* GetRawData() override;
 
  private:
   // See the CefValueBase constructor for usage. Binary values are always
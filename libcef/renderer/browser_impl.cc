@@ -5,6 +5,7 @@
 
 #include "libcef/renderer/browser_impl.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -267,17 +268,50 @@ void CefBrowserImpl::GetFrameNames(std::vector<CefString>& names) {
   }
 }
 
+void CefBrowserImpl::GetFrames(std::vector<CefRefPtr<CefFrame> >& frames) {
+  CEF_REQUIRE_RT_RETURN_VOID();
+
+  if (frames.size() > 0)
+    frames.clear();
+
+  if (render_view()->GetWebView()) {
+    WebFrame* main_frame = render_view()->GetWebView()->mainFrame();
+    if (main_frame) {
+      WebFrame* cur = main_frame;
+      do {
+        frames.push_back(GetWebFrameImpl(cur).get());
+        cur = cur->traverseNext(true);
+      } while (cur != main_frame);
+    }
+  }
+}
+
 bool CefBrowserImpl::SendProcessMessage(CefProcessId target_process,
                                         CefRefPtr<CefProcessMessage> message) {
-  Cef_Request_Params params;
-  CefProcessMessageImpl* impl =
-      static_cast<CefProcessMessageImpl*>(message.get());
-  if (impl->CopyTo(params)) {
-    return SendProcessMessage(target_process, params.name, &params.arguments,
-                              true);
+  DCHECK_EQ(PID_BROWSER, target_process);
+
+  // Large binary arguments are transferred using shared memory. The browser
+  // process duplicates the handles from this process on Windows.
+  // The arguments are serialized in place when possible instead of being
+  // copied into |params| first. The message is locked until |send_params| is
+  // destroyed so only create the IPC message in this scope.
+  IPC::Message* ipc_message = NULL;
+  {
+    Cef_Request_Params params;
+    CefProcessMessageImpl::ScopedSendParams send_params(
+        static_cast<CefProcessMessageImpl*>(message.get()),
+        base::GetCurrentProcessHandle(), &params);
+    if (!send_params.is_valid())
+      return false;
+
+    params.frame_id = -1;
+    params.user_initiated = true;
+    params.request_id = -1;
+    params.expect_response = false;
+    ipc_message = new CefHostMsg_Request(routing_id(), params);
   }
 
-  return false;
+  return Send(ipc_message);
 }
 
 
@@ -590,6 +624,7 @@ bool CefBrowserImpl::OnMessageReceived(const IPC::Message& message) {
     IPC_MESSAGE_HANDLER(CefMsg_Request, OnRequest)
     IPC_MESSAGE_HANDLER(CefMsg_Response, OnResponse)
     IPC_MESSAGE_HANDLER(CefMsg_ResponseAck, OnResponseAck)
+    IPC_MESSAGE_HANDLER(CefMsg_StringChunkAck, OnStringChunkAck)
     IPC_MESSAGE_HANDLER(CefMsg_LoadRequest, LoadRequest)
     IPC_MESSAGE_UNHANDLED(handled = false)
   IPC_END_MESSAGE_MAP()
@@ -610,6 +645,13 @@ void CefBrowserImpl::OnRequest(const Cef_Request_Params& params) {
                "expect_response", params.expect_response ? 1 : 0);
 
   if (params.user_initiated) {
+    // Map binary arguments that were transferred using shared memory.
+    if (!CefProcessMessageImpl::MapSharedBinaries(
+            const_cast<Cef_Request_Params&>(params),
+            base::kNullProcessHandle)) {
+      return;
+    }
+
     // Give the user a chance to handle the request.
     CefRefPtr<CefApp> app = CefContentClient::Get()->application();
     if (app.get()) {
@@ -679,6 +721,48 @@ void CefBrowserImpl::OnRequest(const Cef_Request_Params& params) {
         }
       }
     }
+  } else if (params.name == "get-string-chunks") {
+    // Retrieve the result of a command in chunks.
+    DCHECK_EQ(params.arguments.GetSize(), (size_t)3);
+
+    std::string command;
+    int chunk_size = 0;
+    int max_chunks_in_flight = 0;
+
+    params.arguments.GetString(0, &command);
+    params.arguments.GetInteger(1, &chunk_size);
+    params.arguments.GetInteger(2, &max_chunks_in_flight);
+    DCHECK_GT(chunk_size, 0);
+    DCHECK_GT(max_chunks_in_flight, 0);
+
+    bool found = false;
+    std::string data;
+
+    CefRefPtr<CefFrameImpl> framePtr = GetWebFrameImpl(params.frame_id);
+    if (framePtr.get()) {
+      WebFrame* web_frame = framePtr->web_frame();
+      if (web_frame) {
+        if (base::LowerCaseEqualsASCII(command, "getsource")) {
+          data = web_frame->contentAsMarkup().utf8();
+          found = true;
+        } else if (base::LowerCaseEqualsASCII(command, "gettext")) {
+          data = webkit_glue::DumpDocumentText(web_frame);
+          found = true;
+        }
+      }
+    }
+
+    if (found) {
+      // |data| is swapped into the request object without copying.
+      string_chunks_requests_[params.request_id] = make_linked_ptr(
+          new StringChunksRequest(&data,
+                                  std::max(chunk_size, 4),
+                                  std::max(max_chunks_in_flight, 1)));
+      SendStringChunks(params.request_id);
+    } else {
+      Send(new CefHostMsg_StringChunk(routing_id(), params.request_id,
+                                      std::string(), true, false));
+    }
   } else if (params.name == "load-string") {
     // Load a string.
     CefRefPtr<CefFrameImpl> framePtr = GetWebFrameImpl(params.frame_id);
@@ -723,6 +807,43 @@ void CefBrowserImpl::OnResponseAck(int request_id) {
   response_manager_->RunAckHandler(request_id);
 }
 
+void CefBrowserImpl::OnStringChunkAck(int request_id, bool cancel) {
+  StringChunksRequestMap::iterator it =
+      string_chunks_requests_.find(request_id);
+  if (it == string_chunks_requests_.end())
+    return;
+
+  if (cancel) {
+    string_chunks_requests_.erase(it);
+    return;
+  }
+
+  it->second->credits++;
+  SendStringChunks(request_id);
+}
+
+void CefBrowserImpl::SendStringChunks(int request_id) {
+  StringChunksRequestMap::iterator it =
+      string_chunks_requests_.find(request_id);
+  if (it == string_chunks_requests_.end())
+    return;
+
+  StringChunksRequest* request = it->second.get();
+  while (request->credits > 0) {
+    const base::StringPiece& chunk = request->chunker.Next();
+    const bool last = !request->chunker.HasNext();
+    request->credits--;
+
+    Send(new CefHostMsg_StringChunk(routing_id(), request_id,
+                                    chunk.as_string(), last, true));
+
+    if (last) {
+      string_chunks_requests_.erase(it);
+      return;
+    }
+  }
+}
+
 void CefBrowserImpl::OnLoadingStateChange(bool isLoading) {
   if (is_swapped_out())
     return;
@@ -13,9 +13,11 @@
 
 #include "include/cef_browser.h"
 #include "include/cef_client.h"
+#include "libcef/common/string_chunker.h"
 #include "libcef/common/tracker.h"
 #include "libcef/renderer/frame_impl.h"
 
+#include "base/memory/linked_ptr.h"
 #include "base/memory/scoped_ptr.h"
 #include "content/public/renderer/render_view_observer.h"
 
@@ -69,6 +71,7 @@ class CefBrowserImpl : public CefBrowser,
   size_t GetFrameCount() override;
   void GetFrameIdentifiers(std::vector<int64>& identifiers) override;
   void GetFrameNames(std::vector<CefString>& names) override;
+  void GetFrames(std::vector<CefRefPtr<CefFrame> >& frames) override;
   bool SendProcessMessage(
       CefProcessId target_process,
       CefRefPtr<CefProcessMessage> message) override;
@@ -126,6 +129,11 @@ class CefBrowserImpl : public CefBrowser,
   void OnRequest(const Cef_Request_Params& params);
   void OnResponse(const Cef_Response_Params& params);
   void OnResponseAck(int request_id);
+  void OnStringChunkAck(int request_id, bool cancel);
+
+  // Send chunks for the specified request until the in-flight limit is
+  // reached or no chunks remain.
+  void SendStringChunks(int request_id);
 
   void OnLoadingStateChange(bool isLoading);
   void OnLoadStart(blink::WebLocalFrame* frame);
@@ -152,6 +160,23 @@ class CefBrowserImpl : public CefBrowser,
   // Manages response registrations.
   scoped_ptr<CefResponseManager> response_manager_;
 
+  // State for a chunked string request that is waiting on the browser.
+  struct StringChunksRequest {
+    StringChunksRequest(std::string* data, size_t chunk_size, int credits)
+        : chunker(data, chunk_size),
+          credits(credits) {
+    }
+
+    CefStringChunker chunker;
+
+    // Number of chunks that may be sent before the next ack is received.
+    int credits;
+  };
+
+  // Map of request ids to pending chunked string requests.
+  typedef std::map<int, linked_ptr<StringChunksRequest> > StringChunksRequestMap;
+  StringChunksRequestMap string_chunks_requests_;
+
   IMPLEMENT_REFCOUNTING(CefBrowserImpl);
   DISALLOW_COPY_AND_ASSIGN(CefBrowserImpl);
 };
@@ -7,6 +7,7 @@
 #include "libcef/common/cef_messages.h"
 #include "libcef/common/http_header_utils.h"
 #include "libcef/common/request_impl.h"
+#include "libcef/common/string_chunker.h"
 #include "libcef/renderer/browser_impl.h"
 #include "libcef/renderer/dom_document_impl.h"
 #include "libcef/renderer/thread_util.h"
@@ -24,6 +25,23 @@
 
 using blink::WebString;
 
+namespace {
+
+// Deliver |data| to |visitor| in chunks. Stops early if the visitor cancels.
+void VisitStringChunks(std::string* data,
+                       CefRefPtr<CefStringChunkVisitor> visitor) {
+  CefStringChunker chunker(data, CefStringChunker::kDefaultChunkSize);
+  while (chunker.HasNext()) {
+    if (!visitor->VisitChunk(chunker.Next().as_string())) {
+      visitor->OnComplete(false);
+      return;
+    }
+  }
+  visitor->OnComplete(true);
+}
+
+}  // namespace
+
 CefFrameImpl::CefFrameImpl(CefBrowserImpl* browser,
                            blink::WebFrame* frame)
   : browser_(browser),
@@ -104,6 +122,28 @@ void CefFrameImpl::GetText(CefRefPtr<CefStringVisitor> visitor) {
   }
 }
 
+void CefFrameImpl::GetSourceChunked(CefRefPtr<CefStringChunkVisitor> visitor) {
+  CEF_REQUIRE_RT_RETURN_VOID();
+
+  if (frame_) {
+    std::string content = frame_->contentAsMarkup().utf8();
+    VisitStringChunks(&content, visitor);
+  } else {
+    visitor->OnComplete(false);
+  }
+}
+
+void CefFrameImpl::GetTextChunked(CefRefPtr<CefStringChunkVisitor> visitor) {
+  CEF_REQUIRE_RT_RETURN_VOID();
+
+  if (frame_) {
+    std::string content = webkit_glue::DumpDocumentText(frame_);
+    VisitStringChunks(&content, visitor);
+  } else {
+    visitor->OnComplete(false);
+  }
+}
+
 void CefFrameImpl::LoadRequest(CefRefPtr<CefRequest> request) {
   CEF_REQUIRE_RT_RETURN_VOID();
 
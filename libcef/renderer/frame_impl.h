@@ -37,6 +37,8 @@ class CefFrameImpl : public CefFrame {
   void ViewSource() override;
   void GetSource(CefRefPtr<CefStringVisitor> visitor) override;
   void GetText(CefRefPtr<CefStringVisitor> visitor) override;
+  void GetSourceChunked(CefRefPtr<CefStringChunkVisitor> visitor) override;
+  void GetTextChunked(CefRefPtr<CefStringChunkVisitor> visitor) override;
   void LoadRequest(CefRefPtr<CefRequest> request) override;
   void LoadURL(const CefString& url) override;
   void LoadString(const CefString& string,
@@ -6,8 +6,11 @@
 // Otherwise there will be compile errors in wtf/MathExtras.h.
 #define _USE_MATH_DEFINES
 
+#include <algorithm>
+#include <limits>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "base/command_line.h"
 #include "base/compiler_specific.h"
@@ -19,6 +22,7 @@ MSVC_PUSH_WARNING_LEVEL(0);
 #include "core/workers/WorkerGlobalScope.h"
 #include "bindings/core/v8/ScriptController.h"
 #include "bindings/core/v8/V8Binding.h"
+#include "bindings/core/v8/V8ScriptRunner.h"
 MSVC_POP_WARNING();
 #undef FROM_HERE
 #undef LOG
@@ -35,6 +39,7 @@ MSVC_POP_WARNING();
 
 #include "base/bind.h"
 #include "base/lazy_instance.h"
+#include "base/memory/scoped_vector.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/threading/thread_local.h"
 #include "third_party/WebKit/public/web/WebKit.h"
@@ -201,7 +206,59 @@ class CefV8IsolateManager {
     return worker_url_;
   }
 
+  // Returns a value wrapper for |value|, reusing a pooled wrapper if one is
+  // available. Used for CefV8Handler::Execute arguments.
+  CefRefPtr<CefV8ValueImpl> AcquireValue(v8::Local<v8::Value> value) {
+    DCHECK_EQ(isolate_, v8::Isolate::GetCurrent());
+    if (free_values_.empty())
+      return new CefV8ValueImpl(isolate_, value);
+
+    CefRefPtr<CefV8ValueImpl> impl = free_values_.back();
+    free_values_.pop_back();
+    impl->InitFromV8Value(value);
+    return impl;
+  }
+
+  // Returns |value| to the pool if nothing else holds a reference to it.
+  void ReleaseValue(CefRefPtr<CefV8Value>& value) {
+    DCHECK_EQ(isolate_, v8::Isolate::GetCurrent());
+    if (value->HasOneRef() && free_values_.size() < kMaxFreeValues) {
+      CefV8ValueImpl* impl = static_cast<CefV8ValueImpl*>(value.get());
+      impl->Reset();
+      free_values_.push_back(impl);
+    }
+    value = NULL;
+  }
+
+  // Returns an empty argument list, reusing a pooled list if one is
+  // available. Lists are not shared so nested calls each get their own.
+  CefV8ValueList* AcquireValueList() {
+    DCHECK_EQ(isolate_, v8::Isolate::GetCurrent());
+    if (free_lists_.empty())
+      return new CefV8ValueList();
+
+    CefV8ValueList* list = free_lists_.back();
+    free_lists_.weak_erase(free_lists_.end() - 1);
+    return list;
+  }
+
+  void ReleaseValueList(CefV8ValueList* list) {
+    DCHECK_EQ(isolate_, v8::Isolate::GetCurrent());
+    for (CefV8ValueList::iterator it = list->begin(); it != list->end(); ++it)
+      ReleaseValue(*it);
+    list->clear();
+    if (free_lists_.size() < kMaxFreeLists)
+      free_lists_.push_back(list);
+    else
+      delete list;
+  }
+
  private:
+  // Upper bounds on the number of pooled objects. Lists are only needed for
+  // each level of nested native calls.
+  static const size_t kMaxFreeValues = 64;
+  static const size_t kMaxFreeLists = 8;
+
   v8::Isolate* isolate_;
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
 
@@ -226,6 +283,10 @@ class CefV8IsolateManager {
   // Attributes associated with WebWorker threads.
   int worker_id_;
   GURL worker_url_;
+
+  // Pooled wrappers and argument lists for CefV8Handler::Execute calls.
+  std::vector<CefRefPtr<CefV8ValueImpl> > free_values_;
+  ScopedVector<CefV8ValueList> free_lists_;
 };
 
 // Chromium uses the default Isolate for the main render process thread and a
@@ -314,6 +375,16 @@ class V8TrackObject : public CefTrackNode {
     return handler_;
   }
 
+  // The function name is cached so that it doesn't need to be retrieved from
+  // V8 and converted for each call to the handler.
+  inline void SetFunctionName(const CefString& name) {
+    function_name_ = name;
+  }
+
+  inline const CefString& GetFunctionName() const {
+    return function_name_;
+  }
+
   inline void SetUserData(CefRefPtr<CefBase> user_data) {
     user_data_ = user_data;
   }
@@ -345,10 +416,69 @@ class V8TrackObject : public CefTrackNode {
   v8::Isolate* isolate_;
   CefRefPtr<CefV8Accessor> accessor_;
   CefRefPtr<CefV8Handler> handler_;
+  CefString function_name_;
   CefRefPtr<CefBase> user_data_;
   int external_memory_;
 };
 
+// Releases the native backing store of an externalized ArrayBuffer when V8
+// garbage collects the ArrayBuffer object. This is independent of CefV8Value
+// handles and context lifespan because the ArrayBuffer may remain reachable
+// from JS after those have been released. Deletes itself.
+class V8ArrayBufferReleaser {
+ public:
+  static void Attach(
+      v8::Isolate* isolate,
+      v8::Local<v8::ArrayBuffer> array_buffer,
+      void* buffer,
+      size_t length,
+      CefRefPtr<CefV8ArrayBufferReleaseCallback> release_callback) {
+    V8ArrayBufferReleaser* releaser =
+        new V8ArrayBufferReleaser(isolate, array_buffer, buffer, length,
+                                  release_callback);
+    releaser->handle_.SetWeak(releaser, Release);
+  }
+
+ private:
+  V8ArrayBufferReleaser(
+      v8::Isolate* isolate,
+      v8::Local<v8::ArrayBuffer> array_buffer,
+      void* buffer,
+      size_t length,
+      CefRefPtr<CefV8ArrayBufferReleaseCallback> release_callback)
+      : isolate_(isolate),
+        handle_(isolate, array_buffer),
+        buffer_(buffer),
+        external_memory_(static_cast<int>(std::min(
+            length, static_cast<size_t>(std::numeric_limits<int>::max())))),
+        release_callback_(release_callback) {
+    // The externally owned memory is reported to V8 so that it can be taken
+    // into account when scheduling collection.
+    isolate_->AdjustAmountOfExternalAllocatedMemory(external_memory_);
+  }
+
+  ~V8ArrayBufferReleaser() {
+    handle_.Reset();
+    isolate_->AdjustAmountOfExternalAllocatedMemory(-external_memory_);
+  }
+
+  static void Release(
+      const v8::WeakCallbackData<v8::ArrayBuffer, V8ArrayBufferReleaser>&
+          data) {
+    V8ArrayBufferReleaser* releaser = data.GetParameter();
+    releaser->release_callback_->ReleaseBuffer(releaser->buffer_);
+    delete releaser;
+  }
+
+  v8::Isolate* isolate_;
+  v8::Persistent<v8::ArrayBuffer> handle_;
+  void* buffer_;
+  int external_memory_;
+  CefRefPtr<CefV8ArrayBufferReleaseCallback> release_callback_;
+
+  DISALLOW_COPY_AND_ASSIGN(V8ArrayBufferReleaser);
+};
+
 class V8TrackString : public CefTrackNode {
  public:
   explicit V8TrackString(const std::string& str) : string_(str) {}
@@ -439,25 +569,53 @@ void GetCefString(v8::Local<v8::String> str, CefString& out) {
 #endif  // !defined(CEF_STRING_TYPE_WIDE)
 }
 
-// V8 function callback.
-void FunctionCallbackImpl(const v8::FunctionCallbackInfo<v8::Value>& info) {
-  v8::Isolate* isolate = info.GetIsolate();
+// Wraps the arguments for a CefV8Handler::Execute call using pooled objects
+// from the isolate manager. Wrappers that are not retained by the handler are
+// returned to the pool when the call completes.
+class ScopedHandlerArguments {
+ public:
+  explicit ScopedHandlerArguments(
+      const v8::FunctionCallbackInfo<v8::Value>& info)
+      : manager_(GetIsolateManager()),
+        params_(manager_->AcquireValueList()) {
+    const int length = info.Length();
+    params_->reserve(length);
+    for (int i = 0; i < length; i++)
+      params_->push_back(manager_->AcquireValue(info[i]).get());
+    object_ = manager_->AcquireValue(info.This()).get();
+  }
 
-  CefV8Handler* handler =
-      static_cast<CefV8Handler*>(v8::External::Cast(*info.Data())->Value());
+  ~ScopedHandlerArguments() {
+    manager_->ReleaseValue(object_);
+    manager_->ReleaseValueList(params_);
+  }
 
-  CefV8ValueList params;
-  for (int i = 0; i < info.Length(); i++)
-    params.push_back(new CefV8ValueImpl(isolate, info[i]));
+  CefRefPtr<CefV8Value> object() const { return object_; }
+  const CefV8ValueList& params() const { return *params_; }
+
+ private:
+  CefV8IsolateManager* manager_;
+  CefV8ValueList* params_;
+  CefRefPtr<CefV8Value> object_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedHandlerArguments);
+};
+
+// Execute |handler| for a call to a native function.
+void ExecuteHandler(const v8::FunctionCallbackInfo<v8::Value>& info,
+                    CefV8Handler* handler,
+                    const CefString& func_name) {
+  v8::Isolate* isolate = info.GetIsolate();
+
+  // Must be destroyed after |retval| so that a returned argument can still be
+  // reused.
+  ScopedHandlerArguments arguments(info);
 
-  CefString func_name;
-  GetCefString(v8::Handle<v8::String>::Cast(info.Callee()->GetName()),
-               func_name);
-  CefRefPtr<CefV8Value> object = new CefV8ValueImpl(isolate, info.This());
   CefRefPtr<CefV8Value> retval;
   CefString exception;
 
-  if (handler->Execute(func_name, object, params, retval, exception)) {
+  if (handler->Execute(func_name, arguments.object(), arguments.params(),
+                       retval, exception)) {
     if (!exception.empty()) {
       info.GetReturnValue().Set(
           isolate->ThrowException(
@@ -475,6 +633,26 @@ void FunctionCallbackImpl(const v8::FunctionCallbackInfo<v8::Value>& info) {
   info.GetReturnValue().SetUndefined();
 }
 
+// V8 function callback for functions created with CefV8Value::CreateFunction.
+void FunctionCallbackImpl(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  V8TrackObject* tracker =
+      static_cast<V8TrackObject*>(v8::External::Cast(*info.Data())->Value());
+  CefRefPtr<CefV8Handler> handler = tracker->GetHandler();
+  ExecuteHandler(info, handler.get(), tracker->GetFunctionName());
+}
+
+// V8 function callback for native functions declared by extensions.
+void ExtensionFunctionCallbackImpl(
+    const v8::FunctionCallbackInfo<v8::Value>& info) {
+  CefV8Handler* handler =
+      static_cast<CefV8Handler*>(v8::External::Cast(*info.Data())->Value());
+
+  CefString func_name;
+  GetCefString(v8::Handle<v8::String>::Cast(info.Callee()->GetName()),
+               func_name);
+  ExecuteHandler(info, handler, func_name);
+}
+
 // V8 Accessor callbacks
 void AccessorGetterCallbackImpl(
     v8::Local<v8::String> property,
@@ -568,6 +746,25 @@ v8::MaybeLocal<v8::Value> CallV8Function(v8::Local<v8::Context> context,
   return func_rv;
 }
 
+// Execute a compiled script in |context|.
+v8::MaybeLocal<v8::Value> RunV8Script(v8::Local<v8::Context> context,
+                                      v8::Local<v8::Script> script,
+                                      v8::Isolate* isolate) {
+  // Use the same restrictions as CallV8Function for frame contexts.
+  if (CEF_CURRENTLY_ON_RT()) {
+    RefPtr<blink::LocalFrame> frame =
+        toLocalFrame(blink::toFrameIfNotDetached(context));
+    DCHECK(frame);
+    if (!frame ||
+        !frame->script().canExecuteScripts(blink::AboutToExecuteScript)) {
+      return v8::MaybeLocal<v8::Value>();
+    }
+  }
+
+  return blink::V8ScriptRunner::runCompiledScript(
+      isolate, script, blink::toExecutionContext(context));
+}
+
 
 // V8 extension registration.
 
@@ -586,7 +783,7 @@ class ExtensionWrapper : public v8::Extension {
       return v8::Local<v8::FunctionTemplate>();
 
     return v8::FunctionTemplate::New(isolate,
-                                     FunctionCallbackImpl,
+                                     ExtensionFunctionCallbackImpl,
                                      v8::External::New(isolate, handler_));
   }
 
@@ -977,6 +1174,155 @@ blink::WebFrame* CefV8ContextImpl::GetWebFrame() {
 }
 
 
+// CefV8Script
+
+// static
+CefRefPtr<CefV8Script> CefV8Script::Create(
+    const CefString& code,
+    const CefString& script_url,
+    CefRefPtr<CefBinaryValue> cached_data,
+    CefRefPtr<CefV8Exception>& exception) {
+  CEF_V8_REQUIRE_ISOLATE_RETURN(NULL);
+
+  exception = NULL;
+
+  if (code.empty()) {
+    NOTREACHED() << "invalid input parameter";
+    return NULL;
+  }
+
+  v8::Isolate* isolate = GetIsolateManager()->isolate();
+  if (!isolate->InContext()) {
+    NOTREACHED() << "not currently in a V8 context";
+    return NULL;
+  }
+
+  v8::HandleScope handle_scope(isolate);
+
+  // The cached data buffer must remain valid until compilation completes.
+  std::vector<uint8_t> cached_buffer;
+  v8::ScriptCompiler::CachedData* v8_cached_data = NULL;
+  v8::ScriptCompiler::CompileOptions options =
+      v8::ScriptCompiler::kProduceCodeCache;
+  if (cached_data.get() && cached_data->GetSize() > 0) {
+    cached_buffer.resize(cached_data->GetSize());
+    cached_data->GetData(&cached_buffer[0], cached_buffer.size(), 0);
+    v8_cached_data = new v8::ScriptCompiler::CachedData(
+        &cached_buffer[0], static_cast<int>(cached_buffer.size()));
+    options = v8::ScriptCompiler::kConsumeCodeCache;
+  }
+
+  // |source| takes ownership of |v8_cached_data|.
+  v8::ScriptCompiler::Source source(GetV8String(isolate, code),
+      v8::ScriptOrigin(GetV8String(isolate, script_url)), v8_cached_data);
+
+  v8::TryCatch try_catch;
+  try_catch.SetVerbose(true);
+
+  v8::MaybeLocal<v8::UnboundScript> script =
+      v8::ScriptCompiler::CompileUnboundScript(isolate, &source, options);
+
+  if (try_catch.HasCaught()) {
+    exception = new CefV8ExceptionImpl(try_catch.Message());
+    return NULL;
+  } else if (script.IsEmpty()) {
+    return NULL;
+  }
+
+  CefRefPtr<CefBinaryValue> new_cached_data;
+  bool cached_data_rejected = false;
+  const v8::ScriptCompiler::CachedData* result_data = source.GetCachedData();
+  if (options == v8::ScriptCompiler::kConsumeCodeCache) {
+    cached_data_rejected = result_data->rejected;
+    if (!cached_data_rejected)
+      new_cached_data = cached_data;
+  } else if (result_data && result_data->length > 0) {
+    new_cached_data =
+        CefBinaryValue::Create(result_data->data, result_data->length);
+  }
+
+  return new CefV8ScriptImpl(isolate, script.ToLocalChecked(),
+                             new_cached_data, cached_data_rejected);
+}
+
+
+// CefV8ScriptImpl::Handle
+
+CefV8ScriptImpl::Handle::Handle(v8::Isolate* isolate, handleType v)
+    : CefV8Handle<v8::UnboundScript>(isolate, v8::Local<v8::Context>(), v) {
+  // Don't associate the script with the current context.
+  context_state_ = NULL;
+}
+
+
+// CefV8ScriptImpl
+
+CefV8ScriptImpl::CefV8ScriptImpl(v8::Isolate* isolate,
+                                 v8::Local<v8::UnboundScript> script,
+                                 CefRefPtr<CefBinaryValue> cached_data,
+                                 bool cached_data_rejected)
+    : handle_(new Handle(isolate, script)),
+      cached_data_(cached_data),
+      cached_data_rejected_(cached_data_rejected) {
+}
+
+CefV8ScriptImpl::~CefV8ScriptImpl() {
+}
+
+bool CefV8ScriptImpl::IsValid() {
+  return CEF_V8_IS_VALID();
+}
+
+bool CefV8ScriptImpl::Run(CefRefPtr<CefV8Context> context,
+                          CefRefPtr<CefV8Value>& retval,
+                          CefRefPtr<CefV8Exception>& exception) {
+  CEF_V8_REQUIRE_VALID_HANDLE_RETURN(false);
+
+  CefV8ContextImpl* context_impl =
+      static_cast<CefV8ContextImpl*>(context.get());
+  if (!context_impl || !context_impl->IsValid()) {
+    NOTREACHED() << "invalid input parameter";
+    return false;
+  }
+
+  v8::Isolate* isolate = handle_->isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> v8_context = context_impl->GetV8Context();
+  v8::Context::Scope context_scope(v8_context);
+
+  // Binding reuses the compiled code.
+  v8::Local<v8::Script> script =
+      handle_->GetNewV8Handle()->BindToCurrentContext();
+
+  v8::TryCatch try_catch;
+  try_catch.SetVerbose(true);
+
+  retval = NULL;
+  exception = NULL;
+
+  v8::MaybeLocal<v8::Value> script_rv =
+      RunV8Script(v8_context, script, isolate);
+
+  if (try_catch.HasCaught()) {
+    exception = new CefV8ExceptionImpl(try_catch.Message());
+    return false;
+  } else if (!script_rv.IsEmpty()) {
+    retval = new CefV8ValueImpl(isolate, script_rv.ToLocalChecked());
+  }
+  return true;
+}
+
+CefRefPtr<CefBinaryValue> CefV8ScriptImpl::GetCachedData() {
+  CEF_V8_REQUIRE_MLT_RETURN(NULL);
+  return cached_data_;
+}
+
+bool CefV8ScriptImpl::IsCachedDataRejected() {
+  CEF_V8_REQUIRE_MLT_RETURN(false);
+  return cached_data_rejected_;
+}
+
+
 // CefV8ValueImpl::Handle
 
 CefV8ValueImpl::Handle::Handle(v8::Isolate* isolate,
@@ -1207,6 +1553,48 @@ CefRefPtr<CefV8Value> CefV8Value::CreateArray(int length) {
   return impl.get();
 }
 
+// static
+CefRefPtr<CefV8Value> CefV8Value::CreateArrayBuffer(
+    void* buffer,
+    size_t length,
+    CefRefPtr<CefV8ArrayBufferReleaseCallback> release_callback) {
+  CEF_V8_REQUIRE_ISOLATE_RETURN(NULL);
+
+  if (!release_callback.get()) {
+    NOTREACHED() << "invalid parameter";
+    return NULL;
+  }
+
+  v8::Isolate* isolate = GetIsolateManager()->isolate();
+  v8::HandleScope handle_scope(isolate);
+
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  if (context.IsEmpty()) {
+    NOTREACHED() << "not currently in a V8 context";
+    return NULL;
+  }
+
+  // Create the new V8 ArrayBuffer. The memory is externalized so V8 will not
+  // attempt to free it and the contents are not copied.
+  v8::Local<v8::ArrayBuffer> arr =
+      v8::ArrayBuffer::New(isolate, buffer, length,
+                           v8::ArrayBufferCreationMode::kExternalized);
+
+  // |release_callback| will be executed when the ArrayBuffer is garbage
+  // collected.
+  V8ArrayBufferReleaser::Attach(isolate, arr, buffer, length,
+                                release_callback);
+
+  // Attach a tracker object so that user data can be associated with the
+  // value.
+  V8TrackObject* tracker = new V8TrackObject(isolate);
+  tracker->AttachTo(arr);
+
+  CefRefPtr<CefV8ValueImpl> impl = new CefV8ValueImpl(isolate);
+  impl->InitObject(arr, tracker);
+  return impl.get();
+}
+
 // static
 CefRefPtr<CefV8Value> CefV8Value::CreateFunction(
     const CefString& name,
@@ -1227,10 +1615,17 @@ CefRefPtr<CefV8Value> CefV8Value::CreateFunction(
     return NULL;
   }
 
+  // Create a tracker object that will cause the user data and/or handler
+  // reference to be released when the V8 object is destroyed. The tracker
+  // also provides the handler and name to the function callback.
+  V8TrackObject* tracker = new V8TrackObject(isolate);
+  tracker->SetHandler(handler);
+  tracker->SetFunctionName(name);
+
   // Create a new V8 function template.
   v8::Local<v8::FunctionTemplate> tmpl = v8::FunctionTemplate::New(isolate);
 
-  v8::Local<v8::Value> data = v8::External::New(isolate, handler.get());
+  v8::Local<v8::Value> data = v8::External::New(isolate, tracker);
 
   // Set the function handler callback.
   tmpl->SetCallHandler(FunctionCallbackImpl, data);
@@ -1239,16 +1634,12 @@ CefRefPtr<CefV8Value> CefV8Value::CreateFunction(
   v8::Local<v8::Function> func = tmpl->GetFunction();
   if (func.IsEmpty()) {
     NOTREACHED() << "failed to create V8 function";
+    delete tracker;
     return NULL;
   }
 
   func->SetName(GetV8String(isolate, name));
 
-  // Create a tracker object that will cause the user data and/or handler
-  // reference to be released when the V8 object is destroyed.
-  V8TrackObject* tracker = new V8TrackObject(isolate);
-  tracker->SetHandler(handler);
-
   // Attach the tracker object.
   tracker->AttachTo(func);
 
@@ -1285,6 +1676,18 @@ CefV8ValueImpl::~CefV8ValueImpl() {
     handle_->SetWeakIfNecessary();
 }
 
+void CefV8ValueImpl::Reset() {
+  if (type_ == TYPE_STRING)
+    cef_string_clear(&string_value_);
+  if (handle_.get()) {
+    handle_->SetWeakIfNecessary();
+    handle_ = NULL;
+  }
+  last_exception_ = NULL;
+  rethrow_exceptions_ = false;
+  type_ = TYPE_INVALID;
+}
+
 void CefV8ValueImpl::InitFromV8Value(v8::Local<v8::Value> value) {
   if (value->IsUndefined()) {
     InitUndefined();
@@ -1469,6 +1872,26 @@ bool CefV8ValueImpl::IsArray() {
   }
 }
 
+bool CefV8ValueImpl::IsArrayBuffer() {
+  CEF_V8_REQUIRE_MLT_RETURN(false);
+  if (type_ == TYPE_OBJECT) {
+    v8::HandleScope handle_scope(handle_->isolate());
+    return handle_->GetNewV8Handle(false)->IsArrayBuffer();
+  } else {
+    return false;
+  }
+}
+
+bool CefV8ValueImpl::IsArrayBufferView() {
+  CEF_V8_REQUIRE_MLT_RETURN(false);
+  if (type_ == TYPE_OBJECT) {
+    v8::HandleScope handle_scope(handle_->isolate());
+    return handle_->GetNewV8Handle(false)->IsArrayBufferView();
+  } else {
+    return false;
+  }
+}
+
 bool CefV8ValueImpl::IsFunction() {
   CEF_V8_REQUIRE_MLT_RETURN(false);
   if (type_ == TYPE_OBJECT) {
@@ -1883,6 +2306,42 @@ int CefV8ValueImpl::GetArrayLength() {
   return arr->Length();
 }
 
+void* CefV8ValueImpl::GetArrayBufferData() {
+  CEF_V8_REQUIRE_OBJECT_RETURN(NULL);
+
+  v8::HandleScope handle_scope(handle_->isolate());
+  v8::Local<v8::Value> value = handle_->GetNewV8Handle(false);
+  if (value->IsArrayBuffer()) {
+    v8::Local<v8::ArrayBuffer> arr = v8::Local<v8::ArrayBuffer>::Cast(value);
+    return arr->GetContents().Data();
+  } else if (value->IsArrayBufferView()) {
+    // Views share the backing store of their ArrayBuffer.
+    v8::Local<v8::ArrayBufferView> view =
+        v8::Local<v8::ArrayBufferView>::Cast(value);
+    char* data = static_cast<char*>(view->Buffer()->GetContents().Data());
+    if (!data)
+      return NULL;
+    return data + view->ByteOffset();
+  }
+
+  NOTREACHED() << "V8 value is not an ArrayBuffer or ArrayBuffer view";
+  return NULL;
+}
+
+size_t CefV8ValueImpl::GetArrayBufferByteLength() {
+  CEF_V8_REQUIRE_OBJECT_RETURN(0);
+
+  v8::HandleScope handle_scope(handle_->isolate());
+  v8::Local<v8::Value> value = handle_->GetNewV8Handle(false);
+  if (value->IsArrayBuffer())
+    return v8::Local<v8::ArrayBuffer>::Cast(value)->ByteLength();
+  else if (value->IsArrayBufferView())
+    return v8::Local<v8::ArrayBufferView>::Cast(value)->ByteLength();
+
+  NOTREACHED() << "V8 value is not an ArrayBuffer or ArrayBuffer view";
+  return 0;
+}
+
 CefString CefV8ValueImpl::GetFunctionName() {
   CefString rv;
   CEF_V8_REQUIRE_OBJECT_RETURN(rv);
@@ -201,6 +201,42 @@ class CefV8ContextImpl : public CefV8Context {
   DISALLOW_COPY_AND_ASSIGN(CefV8ContextImpl);
 };
 
+class CefV8ScriptImpl : public CefV8Script {
+ public:
+  CefV8ScriptImpl(v8::Isolate* isolate,
+                  v8::Local<v8::UnboundScript> script,
+                  CefRefPtr<CefBinaryValue> cached_data,
+                  bool cached_data_rejected);
+  ~CefV8ScriptImpl() override;
+
+  bool IsValid() override;
+  bool Run(CefRefPtr<CefV8Context> context,
+           CefRefPtr<CefV8Value>& retval,
+           CefRefPtr<CefV8Exception>& exception) override;
+  CefRefPtr<CefBinaryValue> GetCachedData() override;
+  bool IsCachedDataRejected() override;
+
+ protected:
+  // Unbound scripts are not associated with a context so the handle remains
+  // valid when the context that compiled the script is released.
+  class Handle : public CefV8Handle<v8::UnboundScript> {
+   public:
+    Handle(v8::Isolate* isolate, handleType v);
+
+   private:
+    ~Handle() override {}
+
+    DISALLOW_COPY_AND_ASSIGN(Handle);
+  };
+  scoped_refptr<Handle> handle_;
+
+  CefRefPtr<CefBinaryValue> cached_data_;
+  bool cached_data_rejected_;
+
+  IMPLEMENT_REFCOUNTING(CefV8ScriptImpl);
+  DISALLOW_COPY_AND_ASSIGN(CefV8ScriptImpl);
+};
+
 class CefV8ValueImpl : public CefV8Value {
  public:
   explicit CefV8ValueImpl(v8::Isolate* isolate);
@@ -221,6 +257,10 @@ class CefV8ValueImpl : public CefV8Value {
   void InitString(CefString& value);
   void InitObject(v8::Local<v8::Value> value, CefTrackNode* tracker);
 
+  // Return to the uninitialized state so that an Init method can be called
+  // again. Used when pooling values.
+  void Reset();
+
   // Creates a new V8 value for the underlying value or returns the existing
   // object handle.
   v8::Local<v8::Value> GetV8Value(bool should_persist);
@@ -236,6 +276,8 @@ class CefV8ValueImpl : public CefV8Value {
   bool IsString() override;
   bool IsObject() override;
   bool IsArray() override;
+  bool IsArrayBuffer() override;
+  bool IsArrayBufferView() override;
   bool IsFunction() override;
   bool IsSame(CefRefPtr<CefV8Value> value) override;
   bool GetBoolValue() override;
@@ -267,6 +309,8 @@ class CefV8ValueImpl : public CefV8Value {
   int GetExternallyAllocatedMemory() override;
   int AdjustExternallyAllocatedMemory(int change_in_bytes) override;
   int GetArrayLength() override;
+  void* GetArrayBufferData() override;
+  size_t GetArrayBufferByteLength() override;
   CefString GetFunctionName() override;
   CefRefPtr<CefV8Handler> GetFunctionHandler() override;
   CefRefPtr<CefV8Value> ExecuteFunction(
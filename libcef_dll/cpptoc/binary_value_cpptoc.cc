@@ -157,6 +157,20 @@ size_t CEF_CALLBACK binary_value_get_data(struct _cef_binary_value_t* self,
   return _retval;
 }
 
+void* CEF_CALLBACK binary_value_get_raw_data(struct _cef_binary_value_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  void* _retval = CefBinaryValueCppToC::Get(self)->GetRawData();
+
+  // Return type: simple
+  return _retval;
+}
+
 }  // namespace
 
 
@@ -170,6 +184,7 @@ CefBinaryValueCppToC::CefBinaryValueCppToC() {
   GetStruct()->copy = binary_value_copy;
   GetStruct()->get_size = binary_value_get_size;
   GetStruct()->get_data = binary_value_get_data;
+  GetStruct()->get_raw_data = binary_value_get_raw_data;
 }
 
 template<> CefRefPtr<CefBinaryValue> CefCppToC<CefBinaryValueCppToC,
@@ -333,6 +333,41 @@ void CEF_CALLBACK browser_get_frame_names(struct _cef_browser_t* self,
   transfer_string_list_contents(namesList, names);
 }
 
+void CEF_CALLBACK browser_get_frames(struct _cef_browser_t* self,
+    size_t* framesCount, struct _cef_frame_t** frames) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: frames; type: refptr_vec_same_byref
+  DCHECK(framesCount && (*framesCount == 0 || frames));
+  if (!framesCount || (*framesCount > 0 && !frames))
+    return;
+
+  // Translate param: frames; type: refptr_vec_same_byref
+  std::vector<CefRefPtr<CefFrame> > framesList;
+  if (framesCount && *framesCount > 0 && frames) {
+    for (size_t i = 0; i < *framesCount; ++i) {
+      framesList.push_back(CefFrameCppToC::Unwrap(frames[i]));
+    }
+  }
+
+  // Execute
+  CefBrowserCppToC::Get(self)->GetFrames(
+      framesList);
+
+  // Restore param: frames; type: refptr_vec_same_byref
+  if (framesCount && frames) {
+    *framesCount = std::min(framesList.size(), *framesCount);
+    if (*framesCount > 0) {
+      for (size_t i = 0; i < *framesCount; ++i) {
+        frames[i] = CefFrameCppToC::Wrap(framesList[i]);
+      }
+    }
+  }
+}
+
 int CEF_CALLBACK browser_send_process_message(struct _cef_browser_t* self,
     cef_process_id_t target_process, struct _cef_process_message_t* message) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -380,6 +415,7 @@ CefBrowserCppToC::CefBrowserCppToC() {
   GetStruct()->get_frame_count = browser_get_frame_count;
   GetStruct()->get_frame_identifiers = browser_get_frame_identifiers;
   GetStruct()->get_frame_names = browser_get_frame_names;
+  GetStruct()->get_frames = browser_get_frames;
   GetStruct()->send_process_message = browser_send_process_message;
 }
 
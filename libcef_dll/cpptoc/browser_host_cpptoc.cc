@@ -735,6 +735,47 @@ void CEF_CALLBACK browser_host_set_windowless_frame_rate(
       frame_rate);
 }
 
+void CEF_CALLBACK browser_host_send_external_begin_frame(
+    struct _cef_browser_host_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+
+  // Execute
+  CefBrowserHostCppToC::Get(self)->SendExternalBeginFrame();
+}
+
+int CEF_CALLBACK browser_host_get_windowless_frame_statistics(
+    struct _cef_browser_host_t* self, struct _cef_frame_statistics_t* stats) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: stats; type: struct_byref
+  DCHECK(stats);
+  if (!stats)
+    return 0;
+
+  // Translate param: stats; type: struct_byref
+  CefFrameStatistics statsObj;
+  if (stats)
+    statsObj.AttachTo(*stats);
+
+  // Execute
+  bool _retval = CefBrowserHostCppToC::Get(self)->GetWindowlessFrameStatistics(
+      statsObj);
+
+  // Restore param: stats; type: struct_byref
+  if (stats)
+    statsObj.DetachTo(*stats);
+
+  // Return type: bool
+  return _retval;
+}
+
 cef_text_input_context_t CEF_CALLBACK browser_host_get_nstext_input_context(
     struct _cef_browser_host_t* self) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -943,6 +984,10 @@ CefBrowserHostCppToC::CefBrowserHostCppToC() {
       browser_host_get_windowless_frame_rate;
   GetStruct()->set_windowless_frame_rate =
       browser_host_set_windowless_frame_rate;
+  GetStruct()->send_external_begin_frame =
+      browser_host_send_external_begin_frame;
+  GetStruct()->get_windowless_frame_statistics =
+      browser_host_get_windowless_frame_statistics;
   GetStruct()->get_nstext_input_context = browser_host_get_nstext_input_context;
   GetStruct()->handle_key_event_before_text_input_client =
       browser_host_handle_key_event_before_text_input_client;
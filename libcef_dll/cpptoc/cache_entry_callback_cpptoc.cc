@@ -0,0 +1,56 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/cache_entry_callback_cpptoc.h"
+
+
+namespace {
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void CEF_CALLBACK cache_entry_callback_on_complete(
+    struct _cef_cache_entry_callback_t* self, int success) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+
+  // Execute
+  CefCacheEntryCallbackCppToC::Get(self)->OnComplete(
+      success?true:false);
+}
+
+}  // namespace
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefCacheEntryCallbackCppToC::CefCacheEntryCallbackCppToC() {
+  GetStruct()->on_complete = cache_entry_callback_on_complete;
+}
+
+template<> CefRefPtr<CefCacheEntryCallback> CefCppToC<CefCacheEntryCallbackCppToC,
+    CefCacheEntryCallback, cef_cache_entry_callback_t>::UnwrapDerived(
+    CefWrapperType type, cef_cache_entry_callback_t* s) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCppToC<CefCacheEntryCallbackCppToC,
+    CefCacheEntryCallback, cef_cache_entry_callback_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCppToC<CefCacheEntryCallbackCppToC,
+    CefCacheEntryCallback, cef_cache_entry_callback_t>::kWrapperType =
+    WT_CACHE_ENTRY_CALLBACK;
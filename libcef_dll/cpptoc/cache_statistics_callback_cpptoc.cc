@@ -0,0 +1,65 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/cache_statistics_callback_cpptoc.h"
+
+
+namespace {
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void CEF_CALLBACK cache_statistics_callback_on_complete(
+    struct _cef_cache_statistics_callback_t* self, int64 hit_count,
+    int64 miss_count, int64 cached_bytes, int64 network_bytes,
+    int entry_count) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+
+  // Execute
+  CefCacheStatisticsCallbackCppToC::Get(self)->OnComplete(
+      hit_count,
+      miss_count,
+      cached_bytes,
+      network_bytes,
+      entry_count);
+}
+
+}  // namespace
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefCacheStatisticsCallbackCppToC::CefCacheStatisticsCallbackCppToC() {
+  GetStruct()->on_complete = cache_statistics_callback_on_complete;
+}
+
+template<> CefRefPtr<CefCacheStatisticsCallback> CefCppToC<CefCacheStatisticsCallbackCppToC,
+    CefCacheStatisticsCallback,
+    cef_cache_statistics_callback_t>::UnwrapDerived(CefWrapperType type,
+    cef_cache_statistics_callback_t* s) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCppToC<CefCacheStatisticsCallbackCppToC,
+    CefCacheStatisticsCallback, cef_cache_statistics_callback_t>::DebugObjCt =
+    0;
+#endif
+
+template<> CefWrapperType CefCppToC<CefCacheStatisticsCallbackCppToC,
+    CefCacheStatisticsCallback,
+    cef_cache_statistics_callback_t>::kWrapperType =
+    WT_CACHE_STATISTICS_CALLBACK;
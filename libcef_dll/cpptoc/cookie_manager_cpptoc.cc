@@ -10,11 +10,14 @@
 // for more information.
 //
 
+#include "libcef_dll/cpptoc/binary_value_cpptoc.h"
 #include "libcef_dll/cpptoc/cookie_manager_cpptoc.h"
 #include "libcef_dll/ctocpp/completion_callback_ctocpp.h"
 #include "libcef_dll/ctocpp/cookie_visitor_ctocpp.h"
 #include "libcef_dll/ctocpp/delete_cookies_callback_ctocpp.h"
+#include "libcef_dll/ctocpp/export_cookies_callback_ctocpp.h"
 #include "libcef_dll/ctocpp/set_cookie_callback_ctocpp.h"
+#include "libcef_dll/ctocpp/set_cookies_callback_ctocpp.h"
 #include "libcef_dll/transfer_util.h"
 
 
@@ -128,6 +131,39 @@ int CEF_CALLBACK cookie_manager_visit_url_cookies(
   return _retval;
 }
 
+int CEF_CALLBACK cookie_manager_visit_filtered_cookies(
+    struct _cef_cookie_manager_t* self, const cef_string_t* domain,
+    const cef_string_t* name, const cef_time_t* expires_after,
+    struct _cef_cookie_visitor_t* visitor) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: expires_after; type: simple_byref_const
+  DCHECK(expires_after);
+  if (!expires_after)
+    return 0;
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor);
+  if (!visitor)
+    return 0;
+  // Unverified params: domain, name
+
+  // Translate param: expires_after; type: simple_byref_const
+  CefTime expires_afterVal = expires_after?*expires_after:CefTime();
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->VisitFilteredCookies(
+      CefString(domain),
+      CefString(name),
+      expires_afterVal,
+      CefCookieVisitorCToCpp::Wrap(visitor));
+
+  // Return type: bool
+  return _retval;
+}
+
 int CEF_CALLBACK cookie_manager_set_cookie(struct _cef_cookie_manager_t* self,
     const cef_string_t* url, const struct _cef_cookie_t* cookie,
     struct _cef_set_cookie_callback_t* callback) {
@@ -161,6 +197,83 @@ int CEF_CALLBACK cookie_manager_set_cookie(struct _cef_cookie_manager_t* self,
   return _retval;
 }
 
+int CEF_CALLBACK cookie_manager_set_cookies(struct _cef_cookie_manager_t* self,
+    const cef_string_t* url, cef_string_list_t cookie_lines,
+    struct _cef_set_cookies_callback_t* callback) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: url; type: string_byref_const
+  DCHECK(url);
+  if (!url)
+    return 0;
+  // Verify param: cookie_lines; type: string_vec_byref_const
+  DCHECK(cookie_lines);
+  if (!cookie_lines)
+    return 0;
+  // Unverified params: callback
+
+  // Translate param: cookie_lines; type: string_vec_byref_const
+  std::vector<CefString> cookie_linesList;
+  transfer_string_list_contents(cookie_lines, cookie_linesList);
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->SetCookies(
+      CefString(url),
+      cookie_linesList,
+      CefSetCookiesCallbackCToCpp::Wrap(callback));
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK cookie_manager_export_cookies(
+    struct _cef_cookie_manager_t* self, cef_cookie_format_t format,
+    struct _cef_export_cookies_callback_t* callback) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: callback; type: refptr_diff
+  DCHECK(callback);
+  if (!callback)
+    return 0;
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->ExportCookies(
+      format,
+      CefExportCookiesCallbackCToCpp::Wrap(callback));
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK cookie_manager_import_cookies(
+    struct _cef_cookie_manager_t* self, struct _cef_binary_value_t* data,
+    struct _cef_set_cookies_callback_t* callback) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: data; type: refptr_same
+  DCHECK(data);
+  if (!data)
+    return 0;
+  // Unverified params: callback
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->ImportCookies(
+      CefBinaryValueCppToC::Unwrap(data),
+      CefSetCookiesCallbackCToCpp::Wrap(callback));
+
+  // Return type: bool
+  return _retval;
+}
+
 int CEF_CALLBACK cookie_manager_delete_cookies(
     struct _cef_cookie_manager_t* self, const cef_string_t* url,
     const cef_string_t* cookie_name,
@@ -228,7 +341,11 @@ CefCookieManagerCppToC::CefCookieManagerCppToC() {
   GetStruct()->set_supported_schemes = cookie_manager_set_supported_schemes;
   GetStruct()->visit_all_cookies = cookie_manager_visit_all_cookies;
   GetStruct()->visit_url_cookies = cookie_manager_visit_url_cookies;
+  GetStruct()->visit_filtered_cookies = cookie_manager_visit_filtered_cookies;
   GetStruct()->set_cookie = cookie_manager_set_cookie;
+  GetStruct()->set_cookies = cookie_manager_set_cookies;
+  GetStruct()->export_cookies = cookie_manager_export_cookies;
+  GetStruct()->import_cookies = cookie_manager_import_cookies;
   GetStruct()->delete_cookies = cookie_manager_delete_cookies;
   GetStruct()->set_storage_path = cookie_manager_set_storage_path;
   GetStruct()->flush_store = cookie_manager_flush_store;
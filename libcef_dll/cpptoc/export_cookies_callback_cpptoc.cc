@@ -0,0 +1,60 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/export_cookies_callback_cpptoc.h"
+#include "libcef_dll/ctocpp/binary_value_ctocpp.h"
+
+
+namespace {
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void CEF_CALLBACK export_cookies_callback_on_complete(
+    struct _cef_export_cookies_callback_t* self,
+    struct _cef_binary_value_t* data, int num_exported) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Unverified params: data
+
+  // Execute
+  CefExportCookiesCallbackCppToC::Get(self)->OnComplete(
+      CefBinaryValueCToCpp::Wrap(data),
+      num_exported);
+}
+
+}  // namespace
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefExportCookiesCallbackCppToC::CefExportCookiesCallbackCppToC() {
+  GetStruct()->on_complete = export_cookies_callback_on_complete;
+}
+
+template<> CefRefPtr<CefExportCookiesCallback> CefCppToC<CefExportCookiesCallbackCppToC,
+    CefExportCookiesCallback, cef_export_cookies_callback_t>::UnwrapDerived(
+    CefWrapperType type, cef_export_cookies_callback_t* s) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCppToC<CefExportCookiesCallbackCppToC,
+    CefExportCookiesCallback, cef_export_cookies_callback_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCppToC<CefExportCookiesCallbackCppToC,
+    CefExportCookiesCallback, cef_export_cookies_callback_t>::kWrapperType =
+    WT_EXPORT_COOKIES_CALLBACK;
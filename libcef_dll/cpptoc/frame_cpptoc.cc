@@ -15,6 +15,7 @@
 #include "libcef_dll/cpptoc/request_cpptoc.h"
 #include "libcef_dll/cpptoc/v8context_cpptoc.h"
 #include "libcef_dll/ctocpp/domvisitor_ctocpp.h"
+#include "libcef_dll/ctocpp/string_chunk_visitor_ctocpp.h"
 #include "libcef_dll/ctocpp/string_visitor_ctocpp.h"
 
 
@@ -158,6 +159,40 @@ void CEF_CALLBACK frame_get_text(struct _cef_frame_t* self,
       CefStringVisitorCToCpp::Wrap(visitor));
 }
 
+void CEF_CALLBACK frame_get_source_chunked(struct _cef_frame_t* self,
+    struct _cef_string_chunk_visitor_t* visitor) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor);
+  if (!visitor)
+    return;
+
+  // Execute
+  CefFrameCppToC::Get(self)->GetSourceChunked(
+      CefStringChunkVisitorCToCpp::Wrap(visitor));
+}
+
+void CEF_CALLBACK frame_get_text_chunked(struct _cef_frame_t* self,
+    struct _cef_string_chunk_visitor_t* visitor) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor);
+  if (!visitor)
+    return;
+
+  // Execute
+  CefFrameCppToC::Get(self)->GetTextChunked(
+      CefStringChunkVisitorCToCpp::Wrap(visitor));
+}
+
 void CEF_CALLBACK frame_load_request(struct _cef_frame_t* self,
     struct _cef_request_t* request) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -382,6 +417,8 @@ CefFrameCppToC::CefFrameCppToC() {
   GetStruct()->view_source = frame_view_source;
   GetStruct()->get_source = frame_get_source;
   GetStruct()->get_text = frame_get_text;
+  GetStruct()->get_source_chunked = frame_get_source_chunked;
+  GetStruct()->get_text_chunked = frame_get_text_chunked;
   GetStruct()->load_request = frame_load_request;
   GetStruct()->load_url = frame_load_url;
   GetStruct()->load_string = frame_load_string;
@@ -0,0 +1,209 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/jsonparser_handler_cpptoc.h"
+
+
+namespace {
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+int CEF_CALLBACK jsonparser_handler_on_begin_dictionary(
+    struct _cef_jsonparser_handler_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONParserHandlerCppToC::Get(self)->OnBeginDictionary();
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonparser_handler_on_end_dictionary(
+    struct _cef_jsonparser_handler_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONParserHandlerCppToC::Get(self)->OnEndDictionary();
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonparser_handler_on_begin_list(
+    struct _cef_jsonparser_handler_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONParserHandlerCppToC::Get(self)->OnBeginList();
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonparser_handler_on_end_list(
+    struct _cef_jsonparser_handler_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONParserHandlerCppToC::Get(self)->OnEndList();
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonparser_handler_on_key(
+    struct _cef_jsonparser_handler_t* self, const cef_string_t* key) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Unverified params: key
+
+  // Execute
+  bool _retval = CefJSONParserHandlerCppToC::Get(self)->OnKey(
+      CefString(key));
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonparser_handler_on_null(
+    struct _cef_jsonparser_handler_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONParserHandlerCppToC::Get(self)->OnNull();
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonparser_handler_on_bool(
+    struct _cef_jsonparser_handler_t* self, int value) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONParserHandlerCppToC::Get(self)->OnBool(
+      value?true:false);
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonparser_handler_on_int(
+    struct _cef_jsonparser_handler_t* self, int value) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONParserHandlerCppToC::Get(self)->OnInt(
+      value);
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonparser_handler_on_double(
+    struct _cef_jsonparser_handler_t* self, double value) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONParserHandlerCppToC::Get(self)->OnDouble(
+      value);
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonparser_handler_on_string(
+    struct _cef_jsonparser_handler_t* self, const cef_string_t* value) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Unverified params: value
+
+  // Execute
+  bool _retval = CefJSONParserHandlerCppToC::Get(self)->OnString(
+      CefString(value));
+
+  // Return type: bool
+  return _retval;
+}
+
+}  // namespace
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefJSONParserHandlerCppToC::CefJSONParserHandlerCppToC() {
+  GetStruct()->on_begin_dictionary = jsonparser_handler_on_begin_dictionary;
+  GetStruct()->on_end_dictionary = jsonparser_handler_on_end_dictionary;
+  GetStruct()->on_begin_list = jsonparser_handler_on_begin_list;
+  GetStruct()->on_end_list = jsonparser_handler_on_end_list;
+  GetStruct()->on_key = jsonparser_handler_on_key;
+  GetStruct()->on_null = jsonparser_handler_on_null;
+  GetStruct()->on_bool = jsonparser_handler_on_bool;
+  GetStruct()->on_int = jsonparser_handler_on_int;
+  GetStruct()->on_double = jsonparser_handler_on_double;
+  GetStruct()->on_string = jsonparser_handler_on_string;
+}
+
+template<> CefRefPtr<CefJSONParserHandler> CefCppToC<CefJSONParserHandlerCppToC,
+    CefJSONParserHandler, cef_jsonparser_handler_t>::UnwrapDerived(
+    CefWrapperType type, cef_jsonparser_handler_t* s) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCppToC<CefJSONParserHandlerCppToC,
+    CefJSONParserHandler, cef_jsonparser_handler_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCppToC<CefJSONParserHandlerCppToC,
+    CefJSONParserHandler, cef_jsonparser_handler_t>::kWrapperType =
+    WT_JSONPARSER_HANDLER;
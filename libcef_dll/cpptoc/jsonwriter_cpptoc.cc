@@ -0,0 +1,255 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/jsonwriter_cpptoc.h"
+#include "libcef_dll/cpptoc/stream_writer_cpptoc.h"
+
+
+// GLOBAL FUNCTIONS - Body may be edited by hand.
+
+CEF_EXPORT cef_jsonwriter_t* cef_jsonwriter_create(
+    struct _cef_stream_writer_t* stream, cef_json_writer_options_t options) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: stream; type: refptr_same
+  DCHECK(stream);
+  if (!stream)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefJSONWriter> _retval = CefJSONWriter::Create(
+      CefStreamWriterCppToC::Unwrap(stream),
+      options);
+
+  // Return type: refptr_same
+  return CefJSONWriterCppToC::Wrap(_retval);
+}
+
+
+namespace {
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+int CEF_CALLBACK jsonwriter_begin_dictionary(struct _cef_jsonwriter_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONWriterCppToC::Get(self)->BeginDictionary();
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonwriter_end_dictionary(struct _cef_jsonwriter_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONWriterCppToC::Get(self)->EndDictionary();
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonwriter_begin_list(struct _cef_jsonwriter_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONWriterCppToC::Get(self)->BeginList();
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonwriter_end_list(struct _cef_jsonwriter_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONWriterCppToC::Get(self)->EndList();
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonwriter_write_key(struct _cef_jsonwriter_t* self,
+    const cef_string_t* key) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Unverified params: key
+
+  // Execute
+  bool _retval = CefJSONWriterCppToC::Get(self)->WriteKey(
+      CefString(key));
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonwriter_write_null(struct _cef_jsonwriter_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONWriterCppToC::Get(self)->WriteNull();
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonwriter_write_bool(struct _cef_jsonwriter_t* self,
+    int value) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONWriterCppToC::Get(self)->WriteBool(
+      value?true:false);
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonwriter_write_int(struct _cef_jsonwriter_t* self,
+    int value) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONWriterCppToC::Get(self)->WriteInt(
+      value);
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonwriter_write_double(struct _cef_jsonwriter_t* self,
+    double value) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONWriterCppToC::Get(self)->WriteDouble(
+      value);
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonwriter_write_string(struct _cef_jsonwriter_t* self,
+    const cef_string_t* value) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Unverified params: value
+
+  // Execute
+  bool _retval = CefJSONWriterCppToC::Get(self)->WriteString(
+      CefString(value));
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonwriter_is_complete(struct _cef_jsonwriter_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONWriterCppToC::Get(self)->IsComplete();
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK jsonwriter_flush(struct _cef_jsonwriter_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefJSONWriterCppToC::Get(self)->Flush();
+
+  // Return type: bool
+  return _retval;
+}
+
+}  // namespace
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefJSONWriterCppToC::CefJSONWriterCppToC() {
+  GetStruct()->begin_dictionary = jsonwriter_begin_dictionary;
+  GetStruct()->end_dictionary = jsonwriter_end_dictionary;
+  GetStruct()->begin_list = jsonwriter_begin_list;
+  GetStruct()->end_list = jsonwriter_end_list;
+  GetStruct()->write_key = jsonwriter_write_key;
+  GetStruct()->write_null = jsonwriter_write_null;
+  GetStruct()->write_bool = jsonwriter_write_bool;
+  GetStruct()->write_int = jsonwriter_write_int;
+  GetStruct()->write_double = jsonwriter_write_double;
+  GetStruct()->write_string = jsonwriter_write_string;
+  GetStruct()->is_complete = jsonwriter_is_complete;
+  GetStruct()->flush = jsonwriter_flush;
+}
+
+template<> CefRefPtr<CefJSONWriter> CefCppToC<CefJSONWriterCppToC,
+    CefJSONWriter, cef_jsonwriter_t>::UnwrapDerived(CefWrapperType type,
+    cef_jsonwriter_t* s) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCppToC<CefJSONWriterCppToC, CefJSONWriter,
+    cef_jsonwriter_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCppToC<CefJSONWriterCppToC, CefJSONWriter,
+    cef_jsonwriter_t>::kWrapperType = WT_JSONWRITER;
@@ -11,6 +11,7 @@
 //
 
 #include "libcef_dll/cpptoc/post_data_element_cpptoc.h"
+#include "libcef_dll/cpptoc/stream_reader_cpptoc.h"
 
 
 // GLOBAL FUNCTIONS - Body may be edited by hand.
@@ -74,6 +75,45 @@ void CEF_CALLBACK post_data_element_set_to_file(
       CefString(fileName));
 }
 
+void CEF_CALLBACK post_data_element_set_to_file_range(
+    struct _cef_post_data_element_t* self, const cef_string_t* fileName,
+    int64 offset, int64 length) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: fileName; type: string_byref_const
+  DCHECK(fileName);
+  if (!fileName)
+    return;
+
+  // Execute
+  CefPostDataElementCppToC::Get(self)->SetToFileRange(
+      CefString(fileName),
+      offset,
+      length);
+}
+
+void CEF_CALLBACK post_data_element_set_to_stream(
+    struct _cef_post_data_element_t* self, struct _cef_stream_reader_t* stream,
+    int64 length) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: stream; type: refptr_same
+  DCHECK(stream);
+  if (!stream)
+    return;
+
+  // Execute
+  CefPostDataElementCppToC::Get(self)->SetToStream(
+      CefStreamReaderCppToC::Unwrap(stream),
+      length);
+}
+
 void CEF_CALLBACK post_data_element_set_to_bytes(
     struct _cef_post_data_element_t* self, size_t size, const void* bytes) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -123,6 +163,67 @@ cef_string_userfree_t CEF_CALLBACK post_data_element_get_file(
   return _retval.DetachToUserFree();
 }
 
+int64 CEF_CALLBACK post_data_element_get_file_offset(
+    struct _cef_post_data_element_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  int64 _retval = CefPostDataElementCppToC::Get(self)->GetFileOffset();
+
+  // Return type: simple
+  return _retval;
+}
+
+int64 CEF_CALLBACK post_data_element_get_file_length(
+    struct _cef_post_data_element_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  int64 _retval = CefPostDataElementCppToC::Get(self)->GetFileLength();
+
+  // Return type: simple
+  return _retval;
+}
+
+struct _cef_stream_reader_t* CEF_CALLBACK post_data_element_get_stream(
+    struct _cef_post_data_element_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefStreamReader> _retval = CefPostDataElementCppToC::Get(
+      self)->GetStream();
+
+  // Return type: refptr_same
+  return CefStreamReaderCppToC::Wrap(_retval);
+}
+
+int64 CEF_CALLBACK post_data_element_get_stream_length(
+    struct _cef_post_data_element_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  int64 _retval = CefPostDataElementCppToC::Get(self)->GetStreamLength();
+
+  // Return type: simple
+  return _retval;
+}
+
 size_t CEF_CALLBACK post_data_element_get_bytes_count(
     struct _cef_post_data_element_t* self) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -168,9 +269,15 @@ CefPostDataElementCppToC::CefPostDataElementCppToC() {
   GetStruct()->is_read_only = post_data_element_is_read_only;
   GetStruct()->set_to_empty = post_data_element_set_to_empty;
   GetStruct()->set_to_file = post_data_element_set_to_file;
+  GetStruct()->set_to_file_range = post_data_element_set_to_file_range;
+  GetStruct()->set_to_stream = post_data_element_set_to_stream;
   GetStruct()->set_to_bytes = post_data_element_set_to_bytes;
   GetStruct()->get_type = post_data_element_get_type;
   GetStruct()->get_file = post_data_element_get_file;
+  GetStruct()->get_file_offset = post_data_element_get_file_offset;
+  GetStruct()->get_file_length = post_data_element_get_file_length;
+  GetStruct()->get_stream = post_data_element_get_stream;
+  GetStruct()->get_stream_length = post_data_element_get_stream_length;
   GetStruct()->get_bytes_count = post_data_element_get_bytes_count;
   GetStruct()->get_bytes = post_data_element_get_bytes;
 }
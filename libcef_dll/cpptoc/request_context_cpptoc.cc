@@ -14,6 +14,8 @@
 #include "libcef_dll/cpptoc/dictionary_value_cpptoc.h"
 #include "libcef_dll/cpptoc/request_context_cpptoc.h"
 #include "libcef_dll/cpptoc/value_cpptoc.h"
+#include "libcef_dll/ctocpp/cache_entry_callback_ctocpp.h"
+#include "libcef_dll/ctocpp/cache_statistics_callback_ctocpp.h"
 #include "libcef_dll/ctocpp/completion_callback_ctocpp.h"
 #include "libcef_dll/ctocpp/request_context_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/scheme_handler_factory_ctocpp.h"
@@ -350,6 +352,64 @@ int CEF_CALLBACK request_context_set_preference(
   return _retval;
 }
 
+void CEF_CALLBACK request_context_get_cache_statistics(
+    struct _cef_request_context_t* self,
+    cef_cache_statistics_callback_t* callback) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: callback; type: refptr_diff
+  DCHECK(callback);
+  if (!callback)
+    return;
+
+  // Execute
+  CefRequestContextCppToC::Get(self)->GetCacheStatistics(
+      CefCacheStatisticsCallbackCToCpp::Wrap(callback));
+}
+
+void CEF_CALLBACK request_context_preload_cache_entry(
+    struct _cef_request_context_t* self, const cef_string_t* url,
+    cef_cache_entry_callback_t* callback) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: url; type: string_byref_const
+  DCHECK(url);
+  if (!url)
+    return;
+  // Unverified params: callback
+
+  // Execute
+  CefRequestContextCppToC::Get(self)->PreloadCacheEntry(
+      CefString(url),
+      CefCacheEntryCallbackCToCpp::Wrap(callback));
+}
+
+void CEF_CALLBACK request_context_evict_cache_entry(
+    struct _cef_request_context_t* self, const cef_string_t* url,
+    cef_cache_entry_callback_t* callback) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: url; type: string_byref_const
+  DCHECK(url);
+  if (!url)
+    return;
+  // Unverified params: callback
+
+  // Execute
+  CefRequestContextCppToC::Get(self)->EvictCacheEntry(
+      CefString(url),
+      CefCacheEntryCallbackCToCpp::Wrap(callback));
+}
+
 }  // namespace
 
 
@@ -374,6 +434,9 @@ CefRequestContextCppToC::CefRequestContextCppToC() {
   GetStruct()->get_all_preferences = request_context_get_all_preferences;
   GetStruct()->can_set_preference = request_context_can_set_preference;
   GetStruct()->set_preference = request_context_set_preference;
+  GetStruct()->get_cache_statistics = request_context_get_cache_statistics;
+  GetStruct()->preload_cache_entry = request_context_preload_cache_entry;
+  GetStruct()->evict_cache_entry = request_context_evict_cache_entry;
 }
 
 template<> CefRefPtr<CefRequestContext> CefCppToC<CefRequestContextCppToC,
@@ -0,0 +1,74 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/resource_data_block_cpptoc.h"
+
+
+namespace {
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void* CEF_CALLBACK resource_data_block_get_data(
+    struct _cef_resource_data_block_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  void* _retval = CefResourceDataBlockCppToC::Get(self)->GetData();
+
+  // Return type: simple
+  return _retval;
+}
+
+size_t CEF_CALLBACK resource_data_block_get_size(
+    struct _cef_resource_data_block_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  size_t _retval = CefResourceDataBlockCppToC::Get(self)->GetSize();
+
+  // Return type: simple
+  return _retval;
+}
+
+}  // namespace
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefResourceDataBlockCppToC::CefResourceDataBlockCppToC() {
+  GetStruct()->get_data = resource_data_block_get_data;
+  GetStruct()->get_size = resource_data_block_get_size;
+}
+
+template<> CefRefPtr<CefResourceDataBlock> CefCppToC<CefResourceDataBlockCppToC,
+    CefResourceDataBlock, cef_resource_data_block_t>::UnwrapDerived(
+    CefWrapperType type, cef_resource_data_block_t* s) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCppToC<CefResourceDataBlockCppToC,
+    CefResourceDataBlock, cef_resource_data_block_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCppToC<CefResourceDataBlockCppToC,
+    CefResourceDataBlock, cef_resource_data_block_t>::kWrapperType =
+    WT_RESOURCE_DATA_BLOCK;
@@ -10,6 +10,7 @@
 // for more information.
 //
 
+#include "libcef_dll/cpptoc/resource_data_block_cpptoc.h"
 #include "libcef_dll/cpptoc/resource_handler_cpptoc.h"
 #include "libcef_dll/ctocpp/callback_ctocpp.h"
 #include "libcef_dll/ctocpp/request_ctocpp.h"
@@ -122,6 +123,22 @@ int CEF_CALLBACK resource_handler_read_response(
   return _retval;
 }
 
+cef_resource_data_block_t* CEF_CALLBACK resource_handler_get_response_data_block(
+    struct _cef_resource_handler_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefResourceDataBlock> _retval = CefResourceHandlerCppToC::Get(
+      self)->GetResponseDataBlock();
+
+  // Return type: refptr_same
+  return CefResourceDataBlockCppToC::Wrap(_retval);
+}
+
 int CEF_CALLBACK resource_handler_can_get_cookie(
     struct _cef_resource_handler_t* self, const struct _cef_cookie_t* cookie) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -193,6 +210,8 @@ CefResourceHandlerCppToC::CefResourceHandlerCppToC() {
   GetStruct()->process_request = resource_handler_process_request;
   GetStruct()->get_response_headers = resource_handler_get_response_headers;
   GetStruct()->read_response = resource_handler_read_response;
+  GetStruct()->get_response_data_block =
+      resource_handler_get_response_data_block;
   GetStruct()->can_get_cookie = resource_handler_can_get_cookie;
   GetStruct()->can_set_cookie = resource_handler_can_set_cookie;
   GetStruct()->cancel = resource_handler_cancel;
@@ -0,0 +1,74 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/string_chunk_visitor_cpptoc.h"
+
+
+namespace {
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+int CEF_CALLBACK string_chunk_visitor_visit_chunk(
+    struct _cef_string_chunk_visitor_t* self, const cef_string_t* chunk) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Unverified params: chunk
+
+  // Execute
+  bool _retval = CefStringChunkVisitorCppToC::Get(self)->VisitChunk(
+      CefString(chunk));
+
+  // Return type: bool
+  return _retval;
+}
+
+void CEF_CALLBACK string_chunk_visitor_on_complete(
+    struct _cef_string_chunk_visitor_t* self, int success) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+
+  // Execute
+  CefStringChunkVisitorCppToC::Get(self)->OnComplete(
+      success?true:false);
+}
+
+}  // namespace
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefStringChunkVisitorCppToC::CefStringChunkVisitorCppToC() {
+  GetStruct()->visit_chunk = string_chunk_visitor_visit_chunk;
+  GetStruct()->on_complete = string_chunk_visitor_on_complete;
+}
+
+template<> CefRefPtr<CefStringChunkVisitor> CefCppToC<CefStringChunkVisitorCppToC,
+    CefStringChunkVisitor, cef_string_chunk_visitor_t>::UnwrapDerived(
+    CefWrapperType type, cef_string_chunk_visitor_t* s) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCppToC<CefStringChunkVisitorCppToC,
+    CefStringChunkVisitor, cef_string_chunk_visitor_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCppToC<CefStringChunkVisitorCppToC,
+    CefStringChunkVisitor, cef_string_chunk_visitor_t>::kWrapperType =
+    WT_STRING_CHUNK_VISITOR;
@@ -0,0 +1,76 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/trace_data_callback_cpptoc.h"
+
+
+namespace {
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void CEF_CALLBACK trace_data_callback_on_trace_data_chunk(
+    struct _cef_trace_data_callback_t* self, const void* data,
+    size_t data_size) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: data; type: simple_byaddr
+  DCHECK(data);
+  if (!data)
+    return;
+
+  // Execute
+  CefTraceDataCallbackCppToC::Get(self)->OnTraceDataChunk(
+      data,
+      data_size);
+}
+
+void CEF_CALLBACK trace_data_callback_on_trace_data_complete(
+    struct _cef_trace_data_callback_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+
+  // Execute
+  CefTraceDataCallbackCppToC::Get(self)->OnTraceDataComplete();
+}
+
+}  // namespace
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefTraceDataCallbackCppToC::CefTraceDataCallbackCppToC() {
+  GetStruct()->on_trace_data_chunk = trace_data_callback_on_trace_data_chunk;
+  GetStruct()->on_trace_data_complete =
+      trace_data_callback_on_trace_data_complete;
+}
+
+template<> CefRefPtr<CefTraceDataCallback> CefCppToC<CefTraceDataCallbackCppToC,
+    CefTraceDataCallback, cef_trace_data_callback_t>::UnwrapDerived(
+    CefWrapperType type, cef_trace_data_callback_t* s) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCppToC<CefTraceDataCallbackCppToC,
+    CefTraceDataCallback, cef_trace_data_callback_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCppToC<CefTraceDataCallbackCppToC,
+    CefTraceDataCallback, cef_trace_data_callback_t>::kWrapperType =
+    WT_TRACE_DATA_CALLBACK;
@@ -12,6 +12,7 @@
 
 #include "libcef_dll/cpptoc/urlrequest_client_cpptoc.h"
 #include "libcef_dll/ctocpp/auth_callback_ctocpp.h"
+#include "libcef_dll/ctocpp/stream_writer_ctocpp.h"
 #include "libcef_dll/ctocpp/urlrequest_ctocpp.h"
 
 
@@ -100,6 +101,27 @@ void CEF_CALLBACK urlrequest_client_on_download_data(
       data_length);
 }
 
+cef_stream_writer_t* CEF_CALLBACK urlrequest_client_get_download_stream_writer(
+    struct _cef_urlrequest_client_t* self, cef_urlrequest_t* request) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+  // Verify param: request; type: refptr_diff
+  DCHECK(request);
+  if (!request)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefStreamWriter> _retval = CefURLRequestClientCppToC::Get(
+      self)->GetDownloadStreamWriter(
+      CefURLRequestCToCpp::Wrap(request));
+
+  // Return type: refptr_diff
+  return CefStreamWriterCToCpp::Unwrap(_retval);
+}
+
 int CEF_CALLBACK urlrequest_client_get_auth_credentials(
     struct _cef_urlrequest_client_t* self, int isProxy,
     const cef_string_t* host, int port, const cef_string_t* realm,
@@ -146,6 +168,8 @@ CefURLRequestClientCppToC::CefURLRequestClientCppToC() {
   GetStruct()->on_upload_progress = urlrequest_client_on_upload_progress;
   GetStruct()->on_download_progress = urlrequest_client_on_download_progress;
   GetStruct()->on_download_data = urlrequest_client_on_download_data;
+  GetStruct()->get_download_stream_writer =
+      urlrequest_client_get_download_stream_writer;
   GetStruct()->get_auth_credentials = urlrequest_client_get_auth_credentials;
 }
 
@@ -0,0 +1,202 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/binary_value_cpptoc.h"
+#include "libcef_dll/cpptoc/v8context_cpptoc.h"
+#include "libcef_dll/cpptoc/v8exception_cpptoc.h"
+#include "libcef_dll/cpptoc/v8script_cpptoc.h"
+#include "libcef_dll/cpptoc/v8value_cpptoc.h"
+
+
+// GLOBAL FUNCTIONS - Body may be edited by hand.
+
+CEF_EXPORT cef_v8script_t* cef_v8script_create(const cef_string_t* code,
+    const cef_string_t* script_url, struct _cef_binary_value_t* cached_data,
+    struct _cef_v8exception_t** exception) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: code; type: string_byref_const
+  DCHECK(code);
+  if (!code)
+    return NULL;
+  // Verify param: exception; type: refptr_same_byref
+  DCHECK(exception);
+  if (!exception)
+    return NULL;
+  // Unverified params: script_url, cached_data
+
+  // Translate param: exception; type: refptr_same_byref
+  CefRefPtr<CefV8Exception> exceptionPtr;
+  if (exception && *exception)
+    exceptionPtr = CefV8ExceptionCppToC::Unwrap(*exception);
+  CefV8Exception* exceptionOrig = exceptionPtr.get();
+
+  // Execute
+  CefRefPtr<CefV8Script> _retval = CefV8Script::Create(
+      CefString(code),
+      CefString(script_url),
+      CefBinaryValueCppToC::Unwrap(cached_data),
+      exceptionPtr);
+
+  // Restore param: exception; type: refptr_same_byref
+  if (exception) {
+    if (exceptionPtr.get()) {
+      if (exceptionPtr.get() != exceptionOrig) {
+        *exception = CefV8ExceptionCppToC::Wrap(exceptionPtr);
+      }
+    } else {
+      *exception = NULL;
+    }
+  }
+
+  // Return type: refptr_same
+  return CefV8ScriptCppToC::Wrap(_retval);
+}
+
+
+namespace {
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+int CEF_CALLBACK v8script_is_valid(struct _cef_v8script_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefV8ScriptCppToC::Get(self)->IsValid();
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK v8script_run(struct _cef_v8script_t* self,
+    cef_v8context_t* context, struct _cef_v8value_t** retval,
+    struct _cef_v8exception_t** exception) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: context; type: refptr_same
+  DCHECK(context);
+  if (!context)
+    return 0;
+  // Verify param: retval; type: refptr_same_byref
+  DCHECK(retval);
+  if (!retval)
+    return 0;
+  // Verify param: exception; type: refptr_same_byref
+  DCHECK(exception);
+  if (!exception)
+    return 0;
+
+  // Translate param: retval; type: refptr_same_byref
+  CefRefPtr<CefV8Value> retvalPtr;
+  if (retval && *retval)
+    retvalPtr = CefV8ValueCppToC::Unwrap(*retval);
+  CefV8Value* retvalOrig = retvalPtr.get();
+  // Translate param: exception; type: refptr_same_byref
+  CefRefPtr<CefV8Exception> exceptionPtr;
+  if (exception && *exception)
+    exceptionPtr = CefV8ExceptionCppToC::Unwrap(*exception);
+  CefV8Exception* exceptionOrig = exceptionPtr.get();
+
+  // Execute
+  bool _retval = CefV8ScriptCppToC::Get(self)->Run(
+      CefV8ContextCppToC::Unwrap(context),
+      retvalPtr,
+      exceptionPtr);
+
+  // Restore param: retval; type: refptr_same_byref
+  if (retval) {
+    if (retvalPtr.get()) {
+      if (retvalPtr.get() != retvalOrig) {
+        *retval = CefV8ValueCppToC::Wrap(retvalPtr);
+      }
+    } else {
+      *retval = NULL;
+    }
+  }
+  // Restore param: exception; type: refptr_same_byref
+  if (exception) {
+    if (exceptionPtr.get()) {
+      if (exceptionPtr.get() != exceptionOrig) {
+        *exception = CefV8ExceptionCppToC::Wrap(exceptionPtr);
+      }
+    } else {
+      *exception = NULL;
+    }
+  }
+
+  // Return type: bool
+  return _retval;
+}
+
+struct _cef_binary_value_t* CEF_CALLBACK v8script_get_cached_data(
+    struct _cef_v8script_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return NULL;
+
+  // Execute
+  CefRefPtr<CefBinaryValue> _retval = CefV8ScriptCppToC::Get(
+      self)->GetCachedData();
+
+  // Return type: refptr_same
+  return CefBinaryValueCppToC::Wrap(_retval);
+}
+
+int CEF_CALLBACK v8script_is_cached_data_rejected(
+    struct _cef_v8script_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefV8ScriptCppToC::Get(self)->IsCachedDataRejected();
+
+  // Return type: bool
+  return _retval;
+}
+
+}  // namespace
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefV8ScriptCppToC::CefV8ScriptCppToC() {
+  GetStruct()->is_valid = v8script_is_valid;
+  GetStruct()->run = v8script_run;
+  GetStruct()->get_cached_data = v8script_get_cached_data;
+  GetStruct()->is_cached_data_rejected = v8script_is_cached_data_rejected;
+}
+
+template<> CefRefPtr<CefV8Script> CefCppToC<CefV8ScriptCppToC, CefV8Script,
+    cef_v8script_t>::UnwrapDerived(CefWrapperType type, cef_v8script_t* s) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCppToC<CefV8ScriptCppToC, CefV8Script,
+    cef_v8script_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCppToC<CefV8ScriptCppToC, CefV8Script,
+    cef_v8script_t>::kWrapperType = WT_V8SCRIPT;
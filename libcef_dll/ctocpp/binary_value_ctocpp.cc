@@ -155,6 +155,20 @@ size_t CefBinaryValueCToCpp::GetData(void* buffer, size_t buffer_size,
   return _retval;
 }
 
+void* CefBinaryValueCToCpp::GetRawData() {
+  cef_binary_value_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_raw_data))
+    return NULL;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  void* _retval = _struct->get_raw_data(_struct);
+
+  // Return type: simple
+  return _retval;
+}
+
 
 // CONSTRUCTOR - Do not edit by hand.
 
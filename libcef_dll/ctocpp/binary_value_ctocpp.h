@@ -38,6 +38,7 @@ class CefBinaryValueCToCpp
   CefRefPtr<CefBinaryValue> Copy() OVERRIDE;
   size_t GetSize() OVERRIDE;
   size_t GetData(void* buffer, size_t buffer_size, size_t data_offset) OVERRIDE;
+  void* GetRawData() OVERRIDE;
 };
 
 #endif  // USING_CEF_SHARED
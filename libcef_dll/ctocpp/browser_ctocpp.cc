@@ -331,6 +331,45 @@ void CefBrowserCToCpp::GetFrameNames(std::vector<CefString>& names) {
   }
 }
 
+void CefBrowserCToCpp::GetFrames(std::vector<CefRefPtr<CefFrame>>& frames) {
+  cef_browser_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_frames))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Translate param: frames; type: refptr_vec_same_byref
+  size_t framesSize = frames.size();
+  size_t framesCount = std::max(GetFrameCount(), framesSize);
+  cef_frame_t** framesList = NULL;
+  if (framesCount > 0) {
+    framesList = new cef_frame_t*[framesCount];
+    DCHECK(framesList);
+    if (framesList) {
+       memset(framesList, 0, sizeof(cef_frame_t*)*framesCount);
+    }
+    if (framesList && framesSize > 0) {
+      for (size_t i = 0; i < framesSize; ++i) {
+        framesList[i] = CefFrameCToCpp::Unwrap(frames[i]);
+      }
+    }
+  }
+
+  // Execute
+  _struct->get_frames(_struct,
+      &framesCount,
+      framesList);
+
+  // Restore param:frames; type: refptr_vec_same_byref
+  frames.clear();
+  if (framesCount > 0 && framesList) {
+    for (size_t i = 0; i < framesCount; ++i) {
+      frames.push_back(CefFrameCToCpp::Wrap(framesList[i]));
+    }
+    delete [] framesList;
+  }
+}
+
 bool CefBrowserCToCpp::SendProcessMessage(CefProcessId target_process,
     CefRefPtr<CefProcessMessage> message) {
   cef_browser_t* _struct = GetStruct();
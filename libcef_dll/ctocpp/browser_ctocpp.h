@@ -53,6 +53,7 @@ class CefBrowserCToCpp
   size_t GetFrameCount() OVERRIDE;
   void GetFrameIdentifiers(std::vector<int64>& identifiers) OVERRIDE;
   void GetFrameNames(std::vector<CefString>& names) OVERRIDE;
+  void GetFrames(std::vector<CefRefPtr<CefFrame>>& frames) OVERRIDE;
   bool SendProcessMessage(CefProcessId target_process,
       CefRefPtr<CefProcessMessage> message) OVERRIDE;
 };
@@ -612,6 +612,33 @@ void CefBrowserHostCToCpp::SetWindowlessFrameRate(int frame_rate) {
       frame_rate);
 }
 
+void CefBrowserHostCToCpp::SendExternalBeginFrame() {
+  cef_browser_host_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, send_external_begin_frame))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  _struct->send_external_begin_frame(_struct);
+}
+
+bool CefBrowserHostCToCpp::GetWindowlessFrameStatistics(
+    CefFrameStatistics& stats) {
+  cef_browser_host_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_windowless_frame_statistics))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->get_windowless_frame_statistics(_struct,
+      &stats);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 CefTextInputContext CefBrowserHostCToCpp::GetNSTextInputContext() {
   cef_browser_host_t* _struct = GetStruct();
   if (CEF_MEMBER_MISSING(_struct, get_nstext_input_context))
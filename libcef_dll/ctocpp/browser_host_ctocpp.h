@@ -81,6 +81,8 @@ class CefBrowserHostCToCpp
   void NotifyMoveOrResizeStarted() OVERRIDE;
   int GetWindowlessFrameRate() OVERRIDE;
   void SetWindowlessFrameRate(int frame_rate) OVERRIDE;
+  void SendExternalBeginFrame() OVERRIDE;
+  bool GetWindowlessFrameStatistics(CefFrameStatistics& stats) OVERRIDE;
   CefTextInputContext GetNSTextInputContext() OVERRIDE;
   void HandleKeyEventBeforeTextInputClient(CefEventHandle keyEvent) OVERRIDE;
   void HandleKeyEventAfterTextInputClient(CefEventHandle keyEvent) OVERRIDE;
@@ -0,0 +1,50 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/cache_entry_callback_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefCacheEntryCallbackCToCpp::OnComplete(bool success) {
+  cef_cache_entry_callback_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_complete))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  _struct->on_complete(_struct,
+      success);
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefCacheEntryCallbackCToCpp::CefCacheEntryCallbackCToCpp() {
+}
+
+template<> cef_cache_entry_callback_t* CefCToCpp<CefCacheEntryCallbackCToCpp,
+    CefCacheEntryCallback, cef_cache_entry_callback_t>::UnwrapDerived(
+    CefWrapperType type, CefCacheEntryCallback* c) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCToCpp<CefCacheEntryCallbackCToCpp,
+    CefCacheEntryCallback, cef_cache_entry_callback_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCToCpp<CefCacheEntryCallbackCToCpp,
+    CefCacheEntryCallback, cef_cache_entry_callback_t>::kWrapperType =
+    WT_CACHE_ENTRY_CALLBACK;
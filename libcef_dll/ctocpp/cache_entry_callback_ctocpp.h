@@ -0,0 +1,40 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#ifndef CEF_LIBCEF_DLL_CTOCPP_CACHE_ENTRY_CALLBACK_CTOCPP_H_
+#define CEF_LIBCEF_DLL_CTOCPP_CACHE_ENTRY_CALLBACK_CTOCPP_H_
+#pragma once
+
+#ifndef BUILDING_CEF_SHARED
+#pragma message("Warning: "__FILE__" may be accessed DLL-side only")
+#else  // BUILDING_CEF_SHARED
+
+#include "include/cef_request_context.h"
+#include "include/capi/cef_request_context_capi.h"
+#include "include/cef_scheme.h"
+#include "include/capi/cef_scheme_capi.h"
+#include "libcef_dll/ctocpp/ctocpp.h"
+
+// Wrap a C structure with a C++ class.
+// This class may be instantiated and accessed DLL-side only.
+class CefCacheEntryCallbackCToCpp
+    : public CefCToCpp<CefCacheEntryCallbackCToCpp, CefCacheEntryCallback,
+        cef_cache_entry_callback_t> {
+ public:
+  CefCacheEntryCallbackCToCpp();
+
+  // CefCacheEntryCallback methods.
+  void OnComplete(bool success) override;
+};
+
+#endif  // BUILDING_CEF_SHARED
+#endif  // CEF_LIBCEF_DLL_CTOCPP_CACHE_ENTRY_CALLBACK_CTOCPP_H_
@@ -0,0 +1,59 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/cache_statistics_callback_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefCacheStatisticsCallbackCToCpp::OnComplete(int64 hit_count,
+    int64 miss_count, int64 cached_bytes, int64 network_bytes,
+    int entry_count) {
+  cef_cache_statistics_callback_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_complete))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  _struct->on_complete(_struct,
+      hit_count,
+      miss_count,
+      cached_bytes,
+      network_bytes,
+      entry_count);
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefCacheStatisticsCallbackCToCpp::CefCacheStatisticsCallbackCToCpp() {
+}
+
+template<> cef_cache_statistics_callback_t* CefCToCpp<CefCacheStatisticsCallbackCToCpp,
+    CefCacheStatisticsCallback,
+    cef_cache_statistics_callback_t>::UnwrapDerived(CefWrapperType type,
+    CefCacheStatisticsCallback* c) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCToCpp<CefCacheStatisticsCallbackCToCpp,
+    CefCacheStatisticsCallback, cef_cache_statistics_callback_t>::DebugObjCt =
+    0;
+#endif
+
+template<> CefWrapperType CefCToCpp<CefCacheStatisticsCallbackCToCpp,
+    CefCacheStatisticsCallback,
+    cef_cache_statistics_callback_t>::kWrapperType =
+    WT_CACHE_STATISTICS_CALLBACK;
@@ -0,0 +1,41 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#ifndef CEF_LIBCEF_DLL_CTOCPP_CACHE_STATISTICS_CALLBACK_CTOCPP_H_
+#define CEF_LIBCEF_DLL_CTOCPP_CACHE_STATISTICS_CALLBACK_CTOCPP_H_
+#pragma once
+
+#ifndef BUILDING_CEF_SHARED
+#pragma message("Warning: "__FILE__" may be accessed DLL-side only")
+#else  // BUILDING_CEF_SHARED
+
+#include "include/cef_request_context.h"
+#include "include/capi/cef_request_context_capi.h"
+#include "include/cef_scheme.h"
+#include "include/capi/cef_scheme_capi.h"
+#include "libcef_dll/ctocpp/ctocpp.h"
+
+// Wrap a C structure with a C++ class.
+// This class may be instantiated and accessed DLL-side only.
+class CefCacheStatisticsCallbackCToCpp
+    : public CefCToCpp<CefCacheStatisticsCallbackCToCpp,
+        CefCacheStatisticsCallback, cef_cache_statistics_callback_t> {
+ public:
+  CefCacheStatisticsCallbackCToCpp();
+
+  // CefCacheStatisticsCallback methods.
+  void OnComplete(int64 hit_count, int64 miss_count, int64 cached_bytes,
+      int64 network_bytes, int entry_count) override;
+};
+
+#endif  // BUILDING_CEF_SHARED
+#endif  // CEF_LIBCEF_DLL_CTOCPP_CACHE_STATISTICS_CALLBACK_CTOCPP_H_
@@ -13,7 +13,10 @@
 #include "libcef_dll/cpptoc/completion_callback_cpptoc.h"
 #include "libcef_dll/cpptoc/cookie_visitor_cpptoc.h"
 #include "libcef_dll/cpptoc/delete_cookies_callback_cpptoc.h"
+#include "libcef_dll/cpptoc/export_cookies_callback_cpptoc.h"
 #include "libcef_dll/cpptoc/set_cookie_callback_cpptoc.h"
+#include "libcef_dll/cpptoc/set_cookies_callback_cpptoc.h"
+#include "libcef_dll/ctocpp/binary_value_ctocpp.h"
 #include "libcef_dll/ctocpp/cookie_manager_ctocpp.h"
 #include "libcef_dll/transfer_util.h"
 
@@ -129,6 +132,32 @@ bool CefCookieManagerCToCpp::VisitUrlCookies(const CefString& url,
   return _retval?true:false;
 }
 
+bool CefCookieManagerCToCpp::VisitFilteredCookies(const CefString& domain,
+    const CefString& name, const CefTime& expires_after,
+    CefRefPtr<CefCookieVisitor> visitor) {
+  cef_cookie_manager_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, visit_filtered_cookies))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor.get());
+  if (!visitor.get())
+    return false;
+  // Unverified params: domain, name
+
+  // Execute
+  int _retval = _struct->visit_filtered_cookies(_struct,
+      domain.GetStruct(),
+      name.GetStruct(),
+      &expires_after,
+      CefCookieVisitorCppToC::Wrap(visitor));
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 bool CefCookieManagerCToCpp::SetCookie(const CefString& url,
     const CefCookie& cookie, CefRefPtr<CefSetCookieCallback> callback) {
   cef_cookie_manager_t* _struct = GetStruct();
@@ -153,6 +182,86 @@ bool CefCookieManagerCToCpp::SetCookie(const CefString& url,
   return _retval?true:false;
 }
 
+bool CefCookieManagerCToCpp::SetCookies(const CefString& url,
+    const std::vector<CefString>& cookie_lines,
+    CefRefPtr<CefSetCookiesCallback> callback) {
+  cef_cookie_manager_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, set_cookies))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: url; type: string_byref_const
+  DCHECK(!url.empty());
+  if (url.empty())
+    return false;
+  // Unverified params: callback
+
+  // Translate param: cookie_lines; type: string_vec_byref_const
+  cef_string_list_t cookie_linesList = cef_string_list_alloc();
+  DCHECK(cookie_linesList);
+  if (cookie_linesList)
+    transfer_string_list_contents(cookie_lines, cookie_linesList);
+
+  // Execute
+  int _retval = _struct->set_cookies(_struct,
+      url.GetStruct(),
+      cookie_linesList,
+      CefSetCookiesCallbackCppToC::Wrap(callback));
+
+  // Restore param:cookie_lines; type: string_vec_byref_const
+  if (cookie_linesList)
+    cef_string_list_free(cookie_linesList);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefCookieManagerCToCpp::ExportCookies(cef_cookie_format_t format,
+    CefRefPtr<CefExportCookiesCallback> callback) {
+  cef_cookie_manager_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, export_cookies))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: callback; type: refptr_diff
+  DCHECK(callback.get());
+  if (!callback.get())
+    return false;
+
+  // Execute
+  int _retval = _struct->export_cookies(_struct,
+      format,
+      CefExportCookiesCallbackCppToC::Wrap(callback));
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefCookieManagerCToCpp::ImportCookies(CefRefPtr<CefBinaryValue> data,
+    CefRefPtr<CefSetCookiesCallback> callback) {
+  cef_cookie_manager_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, import_cookies))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: data; type: refptr_same
+  DCHECK(data.get());
+  if (!data.get())
+    return false;
+  // Unverified params: callback
+
+  // Execute
+  int _retval = _struct->import_cookies(_struct,
+      CefBinaryValueCToCpp::Unwrap(data),
+      CefSetCookiesCallbackCppToC::Wrap(callback));
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 bool CefCookieManagerCToCpp::DeleteCookies(const CefString& url,
     const CefString& cookie_name,
     CefRefPtr<CefDeleteCookiesCallback> callback) {
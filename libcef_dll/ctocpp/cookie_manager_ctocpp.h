@@ -37,8 +37,18 @@ class CefCookieManagerCToCpp
   bool VisitAllCookies(CefRefPtr<CefCookieVisitor> visitor) OVERRIDE;
   bool VisitUrlCookies(const CefString& url, bool includeHttpOnly,
       CefRefPtr<CefCookieVisitor> visitor) OVERRIDE;
+  bool VisitFilteredCookies(const CefString& domain, const CefString& name,
+      const CefTime& expires_after,
+      CefRefPtr<CefCookieVisitor> visitor) OVERRIDE;
   bool SetCookie(const CefString& url, const CefCookie& cookie,
       CefRefPtr<CefSetCookieCallback> callback) OVERRIDE;
+  bool SetCookies(const CefString& url,
+      const std::vector<CefString>& cookie_lines,
+      CefRefPtr<CefSetCookiesCallback> callback) OVERRIDE;
+  bool ExportCookies(cef_cookie_format_t format,
+      CefRefPtr<CefExportCookiesCallback> callback) OVERRIDE;
+  bool ImportCookies(CefRefPtr<CefBinaryValue> data,
+      CefRefPtr<CefSetCookiesCallback> callback) OVERRIDE;
   bool DeleteCookies(const CefString& url, const CefString& cookie_name,
       CefRefPtr<CefDeleteCookiesCallback> callback) OVERRIDE;
   bool SetStoragePath(const CefString& path, bool persist_session_cookies,
@@ -0,0 +1,55 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/binary_value_cpptoc.h"
+#include "libcef_dll/ctocpp/export_cookies_callback_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefExportCookiesCallbackCToCpp::OnComplete(CefRefPtr<CefBinaryValue> data,
+    int num_exported) {
+  cef_export_cookies_callback_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_complete))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: data
+
+  // Execute
+  _struct->on_complete(_struct,
+      CefBinaryValueCppToC::Wrap(data),
+      num_exported);
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefExportCookiesCallbackCToCpp::CefExportCookiesCallbackCToCpp() {
+}
+
+template<> cef_export_cookies_callback_t* CefCToCpp<CefExportCookiesCallbackCToCpp,
+    CefExportCookiesCallback, cef_export_cookies_callback_t>::UnwrapDerived(
+    CefWrapperType type, CefExportCookiesCallback* c) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCToCpp<CefExportCookiesCallbackCToCpp,
+    CefExportCookiesCallback, cef_export_cookies_callback_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCToCpp<CefExportCookiesCallbackCToCpp,
+    CefExportCookiesCallback, cef_export_cookies_callback_t>::kWrapperType =
+    WT_EXPORT_COOKIES_CALLBACK;
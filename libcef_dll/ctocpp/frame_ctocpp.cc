@@ -11,6 +11,7 @@
 //
 
 #include "libcef_dll/cpptoc/domvisitor_cpptoc.h"
+#include "libcef_dll/cpptoc/string_chunk_visitor_cpptoc.h"
 #include "libcef_dll/cpptoc/string_visitor_cpptoc.h"
 #include "libcef_dll/ctocpp/browser_ctocpp.h"
 #include "libcef_dll/ctocpp/frame_ctocpp.h"
@@ -156,6 +157,41 @@ void CefFrameCToCpp::GetText(CefRefPtr<CefStringVisitor> visitor) {
       CefStringVisitorCppToC::Wrap(visitor));
 }
 
+void CefFrameCToCpp::GetSourceChunked(
+    CefRefPtr<CefStringChunkVisitor> visitor) {
+  cef_frame_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_source_chunked))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor.get());
+  if (!visitor.get())
+    return;
+
+  // Execute
+  _struct->get_source_chunked(_struct,
+      CefStringChunkVisitorCppToC::Wrap(visitor));
+}
+
+void CefFrameCToCpp::GetTextChunked(CefRefPtr<CefStringChunkVisitor> visitor) {
+  cef_frame_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_text_chunked))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor.get());
+  if (!visitor.get())
+    return;
+
+  // Execute
+  _struct->get_text_chunked(_struct,
+      CefStringChunkVisitorCppToC::Wrap(visitor));
+}
+
 void CefFrameCToCpp::LoadRequest(CefRefPtr<CefRequest> request) {
   cef_frame_t* _struct = GetStruct();
   if (CEF_MEMBER_MISSING(_struct, load_request))
@@ -45,6 +45,8 @@ class CefFrameCToCpp
   void ViewSource() OVERRIDE;
   void GetSource(CefRefPtr<CefStringVisitor> visitor) OVERRIDE;
   void GetText(CefRefPtr<CefStringVisitor> visitor) OVERRIDE;
+  void GetSourceChunked(CefRefPtr<CefStringChunkVisitor> visitor) OVERRIDE;
+  void GetTextChunked(CefRefPtr<CefStringChunkVisitor> visitor) OVERRIDE;
   void LoadRequest(CefRefPtr<CefRequest> request) OVERRIDE;
   void LoadURL(const CefString& url) OVERRIDE;
   void LoadString(const CefString& string_val, const CefString& url) OVERRIDE;
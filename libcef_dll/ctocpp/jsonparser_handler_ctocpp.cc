@@ -0,0 +1,187 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/jsonparser_handler_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+bool CefJSONParserHandlerCToCpp::OnBeginDictionary() {
+  cef_jsonparser_handler_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_begin_dictionary))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->on_begin_dictionary(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONParserHandlerCToCpp::OnEndDictionary() {
+  cef_jsonparser_handler_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_end_dictionary))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->on_end_dictionary(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONParserHandlerCToCpp::OnBeginList() {
+  cef_jsonparser_handler_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_begin_list))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->on_begin_list(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONParserHandlerCToCpp::OnEndList() {
+  cef_jsonparser_handler_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_end_list))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->on_end_list(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONParserHandlerCToCpp::OnKey(const CefString& key) {
+  cef_jsonparser_handler_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_key))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: key
+
+  // Execute
+  int _retval = _struct->on_key(_struct,
+      key.GetStruct());
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONParserHandlerCToCpp::OnNull() {
+  cef_jsonparser_handler_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_null))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->on_null(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONParserHandlerCToCpp::OnBool(bool value) {
+  cef_jsonparser_handler_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_bool))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->on_bool(_struct,
+      value);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONParserHandlerCToCpp::OnInt(int value) {
+  cef_jsonparser_handler_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_int))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->on_int(_struct,
+      value);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONParserHandlerCToCpp::OnDouble(double value) {
+  cef_jsonparser_handler_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_double))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->on_double(_struct,
+      value);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONParserHandlerCToCpp::OnString(const CefString& value) {
+  cef_jsonparser_handler_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_string))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: value
+
+  // Execute
+  int _retval = _struct->on_string(_struct,
+      value.GetStruct());
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefJSONParserHandlerCToCpp::CefJSONParserHandlerCToCpp() {
+}
+
+template<> cef_jsonparser_handler_t* CefCToCpp<CefJSONParserHandlerCToCpp,
+    CefJSONParserHandler, cef_jsonparser_handler_t>::UnwrapDerived(
+    CefWrapperType type, CefJSONParserHandler* c) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCToCpp<CefJSONParserHandlerCToCpp,
+    CefJSONParserHandler, cef_jsonparser_handler_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCToCpp<CefJSONParserHandlerCToCpp,
+    CefJSONParserHandler, cef_jsonparser_handler_t>::kWrapperType =
+    WT_JSONPARSER_HANDLER;
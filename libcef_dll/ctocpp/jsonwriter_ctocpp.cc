@@ -0,0 +1,235 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/jsonwriter_ctocpp.h"
+#include "libcef_dll/ctocpp/stream_writer_ctocpp.h"
+
+
+// STATIC METHODS - Body may be edited by hand.
+
+CefRefPtr<CefJSONWriter> CefJSONWriter::Create(
+    CefRefPtr<CefStreamWriter> stream, cef_json_writer_options_t options) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: stream; type: refptr_same
+  DCHECK(stream.get());
+  if (!stream.get())
+    return NULL;
+
+  // Execute
+  cef_jsonwriter_t* _retval = cef_jsonwriter_create(
+      CefStreamWriterCToCpp::Unwrap(stream),
+      options);
+
+  // Return type: refptr_same
+  return CefJSONWriterCToCpp::Wrap(_retval);
+}
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+bool CefJSONWriterCToCpp::BeginDictionary() {
+  cef_jsonwriter_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, begin_dictionary))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->begin_dictionary(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONWriterCToCpp::EndDictionary() {
+  cef_jsonwriter_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, end_dictionary))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->end_dictionary(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONWriterCToCpp::BeginList() {
+  cef_jsonwriter_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, begin_list))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->begin_list(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONWriterCToCpp::EndList() {
+  cef_jsonwriter_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, end_list))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->end_list(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONWriterCToCpp::WriteKey(const CefString& key) {
+  cef_jsonwriter_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, write_key))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: key
+
+  // Execute
+  int _retval = _struct->write_key(_struct,
+      key.GetStruct());
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONWriterCToCpp::WriteNull() {
+  cef_jsonwriter_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, write_null))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->write_null(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONWriterCToCpp::WriteBool(bool value) {
+  cef_jsonwriter_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, write_bool))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->write_bool(_struct,
+      value);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONWriterCToCpp::WriteInt(int value) {
+  cef_jsonwriter_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, write_int))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->write_int(_struct,
+      value);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONWriterCToCpp::WriteDouble(double value) {
+  cef_jsonwriter_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, write_double))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->write_double(_struct,
+      value);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONWriterCToCpp::WriteString(const CefString& value) {
+  cef_jsonwriter_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, write_string))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: value
+
+  // Execute
+  int _retval = _struct->write_string(_struct,
+      value.GetStruct());
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONWriterCToCpp::IsComplete() {
+  cef_jsonwriter_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, is_complete))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->is_complete(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefJSONWriterCToCpp::Flush() {
+  cef_jsonwriter_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, flush))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->flush(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefJSONWriterCToCpp::CefJSONWriterCToCpp() {
+}
+
+template<> cef_jsonwriter_t* CefCToCpp<CefJSONWriterCToCpp, CefJSONWriter,
+    cef_jsonwriter_t>::UnwrapDerived(CefWrapperType type, CefJSONWriter* c) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCToCpp<CefJSONWriterCToCpp, CefJSONWriter,
+    cef_jsonwriter_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCToCpp<CefJSONWriterCToCpp, CefJSONWriter,
+    cef_jsonwriter_t>::kWrapperType = WT_JSONWRITER;
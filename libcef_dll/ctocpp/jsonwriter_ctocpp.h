@@ -0,0 +1,48 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#ifndef CEF_LIBCEF_DLL_CTOCPP_JSONWRITER_CTOCPP_H_
+#define CEF_LIBCEF_DLL_CTOCPP_JSONWRITER_CTOCPP_H_
+#pragma once
+
+#ifndef USING_CEF_SHARED
+#pragma message("Warning: "__FILE__" may be accessed wrapper-side only")
+#else  // USING_CEF_SHARED
+
+#include "include/cef_parser.h"
+#include "include/capi/cef_parser_capi.h"
+#include "libcef_dll/ctocpp/ctocpp.h"
+
+// Wrap a C structure with a C++ class.
+// This class may be instantiated and accessed wrapper-side only.
+class CefJSONWriterCToCpp
+    : public CefCToCpp<CefJSONWriterCToCpp, CefJSONWriter, cef_jsonwriter_t> {
+ public:
+  CefJSONWriterCToCpp();
+
+  // CefJSONWriter methods.
+  bool BeginDictionary() OVERRIDE;
+  bool EndDictionary() OVERRIDE;
+  bool BeginList() OVERRIDE;
+  bool EndList() OVERRIDE;
+  bool WriteKey(const CefString& key) OVERRIDE;
+  bool WriteNull() OVERRIDE;
+  bool WriteBool(bool value) OVERRIDE;
+  bool WriteInt(int value) OVERRIDE;
+  bool WriteDouble(double value) OVERRIDE;
+  bool WriteString(const CefString& value) OVERRIDE;
+  bool IsComplete() OVERRIDE;
+  bool Flush() OVERRIDE;
+};
+
+#endif  // USING_CEF_SHARED
+#endif  // CEF_LIBCEF_DLL_CTOCPP_JSONWRITER_CTOCPP_H_
@@ -11,6 +11,7 @@
 //
 
 #include "libcef_dll/ctocpp/post_data_element_ctocpp.h"
+#include "libcef_dll/ctocpp/stream_reader_ctocpp.h"
 
 
 // STATIC METHODS - Body may be edited by hand.
@@ -70,6 +71,45 @@ void CefPostDataElementCToCpp::SetToFile(const CefString& fileName) {
       fileName.GetStruct());
 }
 
+void CefPostDataElementCToCpp::SetToFileRange(const CefString& fileName,
+    int64 offset, int64 length) {
+  cef_post_data_element_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, set_to_file_range))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: fileName; type: string_byref_const
+  DCHECK(!fileName.empty());
+  if (fileName.empty())
+    return;
+
+  // Execute
+  _struct->set_to_file_range(_struct,
+      fileName.GetStruct(),
+      offset,
+      length);
+}
+
+void CefPostDataElementCToCpp::SetToStream(CefRefPtr<CefStreamReader> stream,
+    int64 length) {
+  cef_post_data_element_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, set_to_stream))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: stream; type: refptr_same
+  DCHECK(stream.get());
+  if (!stream.get())
+    return;
+
+  // Execute
+  _struct->set_to_stream(_struct,
+      CefStreamReaderCToCpp::Unwrap(stream),
+      length);
+}
+
 void CefPostDataElementCToCpp::SetToBytes(size_t size, const void* bytes) {
   cef_post_data_element_t* _struct = GetStruct();
   if (CEF_MEMBER_MISSING(_struct, set_to_bytes))
@@ -118,6 +158,62 @@ CefString CefPostDataElementCToCpp::GetFile() {
   return _retvalStr;
 }
 
+int64 CefPostDataElementCToCpp::GetFileOffset() {
+  cef_post_data_element_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_file_offset))
+    return 0;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int64 _retval = _struct->get_file_offset(_struct);
+
+  // Return type: simple
+  return _retval;
+}
+
+int64 CefPostDataElementCToCpp::GetFileLength() {
+  cef_post_data_element_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_file_length))
+    return 0;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int64 _retval = _struct->get_file_length(_struct);
+
+  // Return type: simple
+  return _retval;
+}
+
+CefRefPtr<CefStreamReader> CefPostDataElementCToCpp::GetStream() {
+  cef_post_data_element_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_stream))
+    return NULL;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_stream_reader_t* _retval = _struct->get_stream(_struct);
+
+  // Return type: refptr_same
+  return CefStreamReaderCToCpp::Wrap(_retval);
+}
+
+int64 CefPostDataElementCToCpp::GetStreamLength() {
+  cef_post_data_element_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_stream_length))
+    return 0;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int64 _retval = _struct->get_stream_length(_struct);
+
+  // Return type: simple
+  return _retval;
+}
+
 size_t CefPostDataElementCToCpp::GetBytesCount() {
   cef_post_data_element_t* _struct = GetStruct();
   if (CEF_MEMBER_MISSING(_struct, get_bytes_count))
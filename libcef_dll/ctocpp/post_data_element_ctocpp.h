@@ -34,9 +34,16 @@ class CefPostDataElementCToCpp
   bool IsReadOnly() OVERRIDE;
   void SetToEmpty() OVERRIDE;
   void SetToFile(const CefString& fileName) OVERRIDE;
+  void SetToFileRange(const CefString& fileName, int64 offset,
+      int64 length) OVERRIDE;
+  void SetToStream(CefRefPtr<CefStreamReader> stream, int64 length) OVERRIDE;
   void SetToBytes(size_t size, const void* bytes) OVERRIDE;
   Type GetType() OVERRIDE;
   CefString GetFile() OVERRIDE;
+  int64 GetFileOffset() OVERRIDE;
+  int64 GetFileLength() OVERRIDE;
+  CefRefPtr<CefStreamReader> GetStream() OVERRIDE;
+  int64 GetStreamLength() OVERRIDE;
   size_t GetBytesCount() OVERRIDE;
   size_t GetBytes(size_t size, void* bytes) OVERRIDE;
 };
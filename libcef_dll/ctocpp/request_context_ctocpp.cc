@@ -10,6 +10,8 @@
 // for more information.
 //
 
+#include "libcef_dll/cpptoc/cache_entry_callback_cpptoc.h"
+#include "libcef_dll/cpptoc/cache_statistics_callback_cpptoc.h"
 #include "libcef_dll/cpptoc/completion_callback_cpptoc.h"
 #include "libcef_dll/cpptoc/request_context_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/scheme_handler_factory_cpptoc.h"
@@ -325,6 +327,64 @@ bool CefRequestContextCToCpp::SetPreference(const CefString& name,
   return _retval?true:false;
 }
 
+void CefRequestContextCToCpp::GetCacheStatistics(
+    CefRefPtr<CefCacheStatisticsCallback> callback) {
+  cef_request_context_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_cache_statistics))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: callback; type: refptr_diff
+  DCHECK(callback.get());
+  if (!callback.get())
+    return;
+
+  // Execute
+  _struct->get_cache_statistics(_struct,
+      CefCacheStatisticsCallbackCppToC::Wrap(callback));
+}
+
+void CefRequestContextCToCpp::PreloadCacheEntry(const CefString& url,
+    CefRefPtr<CefCacheEntryCallback> callback) {
+  cef_request_context_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, preload_cache_entry))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: url; type: string_byref_const
+  DCHECK(!url.empty());
+  if (url.empty())
+    return;
+  // Unverified params: callback
+
+  // Execute
+  _struct->preload_cache_entry(_struct,
+      url.GetStruct(),
+      CefCacheEntryCallbackCppToC::Wrap(callback));
+}
+
+void CefRequestContextCToCpp::EvictCacheEntry(const CefString& url,
+    CefRefPtr<CefCacheEntryCallback> callback) {
+  cef_request_context_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, evict_cache_entry))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: url; type: string_byref_const
+  DCHECK(!url.empty());
+  if (url.empty())
+    return;
+  // Unverified params: callback
+
+  // Execute
+  _struct->evict_cache_entry(_struct,
+      url.GetStruct(),
+      CefCacheEntryCallbackCppToC::Wrap(callback));
+}
+
 
 // CONSTRUCTOR - Do not edit by hand.
 
@@ -52,6 +52,12 @@ class CefRequestContextCToCpp
   bool CanSetPreference(const CefString& name) OVERRIDE;
   bool SetPreference(const CefString& name, CefRefPtr<CefValue> value,
       CefString& error) OVERRIDE;
+  void GetCacheStatistics(
+      CefRefPtr<CefCacheStatisticsCallback> callback) OVERRIDE;
+  void PreloadCacheEntry(const CefString& url,
+      CefRefPtr<CefCacheEntryCallback> callback) OVERRIDE;
+  void EvictCacheEntry(const CefString& url,
+      CefRefPtr<CefCacheEntryCallback> callback) OVERRIDE;
 };
 
 #endif  // USING_CEF_SHARED
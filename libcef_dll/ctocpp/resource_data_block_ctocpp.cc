@@ -0,0 +1,66 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/resource_data_block_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void* CefResourceDataBlockCToCpp::GetData() {
+  cef_resource_data_block_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_data))
+    return NULL;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  void* _retval = _struct->get_data(_struct);
+
+  // Return type: simple
+  return _retval;
+}
+
+size_t CefResourceDataBlockCToCpp::GetSize() {
+  cef_resource_data_block_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_size))
+    return 0;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  size_t _retval = _struct->get_size(_struct);
+
+  // Return type: simple
+  return _retval;
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefResourceDataBlockCToCpp::CefResourceDataBlockCToCpp() {
+}
+
+template<> cef_resource_data_block_t* CefCToCpp<CefResourceDataBlockCToCpp,
+    CefResourceDataBlock, cef_resource_data_block_t>::UnwrapDerived(
+    CefWrapperType type, CefResourceDataBlock* c) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCToCpp<CefResourceDataBlockCToCpp,
+    CefResourceDataBlock, cef_resource_data_block_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCToCpp<CefResourceDataBlockCToCpp,
+    CefResourceDataBlock, cef_resource_data_block_t>::kWrapperType =
+    WT_RESOURCE_DATA_BLOCK;
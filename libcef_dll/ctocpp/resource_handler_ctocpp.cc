@@ -13,6 +13,7 @@
 #include "libcef_dll/cpptoc/callback_cpptoc.h"
 #include "libcef_dll/cpptoc/request_cpptoc.h"
 #include "libcef_dll/cpptoc/response_cpptoc.h"
+#include "libcef_dll/ctocpp/resource_data_block_ctocpp.h"
 #include "libcef_dll/ctocpp/resource_handler_ctocpp.h"
 
 
@@ -93,6 +94,22 @@ bool CefResourceHandlerCToCpp::ReadResponse(void* data_out, int bytes_to_read,
   return _retval?true:false;
 }
 
+CefRefPtr<CefResourceDataBlock> CefResourceHandlerCToCpp::GetResponseDataBlock(
+    ) {
+  cef_resource_handler_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_response_data_block))
+    return NULL;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_resource_data_block_t* _retval = _struct->get_response_data_block(
+      _struct);
+
+  // Return type: refptr_same
+  return CefResourceDataBlockCToCpp::Wrap(_retval);
+}
+
 bool CefResourceHandlerCToCpp::CanGetCookie(const CefCookie& cookie) {
   cef_resource_handler_t* _struct = GetStruct();
   if (CEF_MEMBER_MISSING(_struct, can_get_cookie))
@@ -37,6 +37,7 @@ class CefResourceHandlerCToCpp
       int64& response_length, CefString& redirectUrl) override;
   bool ReadResponse(void* data_out, int bytes_to_read, int& bytes_read,
       CefRefPtr<CefCallback> callback) override;
+  CefRefPtr<CefResourceDataBlock> GetResponseDataBlock() override;
   bool CanGetCookie(const CefCookie& cookie) override;
   bool CanSetCookie(const CefCookie& cookie) override;
   void Cancel() override;
@@ -0,0 +1,67 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/string_chunk_visitor_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+bool CefStringChunkVisitorCToCpp::VisitChunk(const CefString& chunk) {
+  cef_string_chunk_visitor_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, visit_chunk))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: chunk
+
+  // Execute
+  int _retval = _struct->visit_chunk(_struct,
+      chunk.GetStruct());
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+void CefStringChunkVisitorCToCpp::OnComplete(bool success) {
+  cef_string_chunk_visitor_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_complete))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  _struct->on_complete(_struct,
+      success);
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefStringChunkVisitorCToCpp::CefStringChunkVisitorCToCpp() {
+}
+
+template<> cef_string_chunk_visitor_t* CefCToCpp<CefStringChunkVisitorCToCpp,
+    CefStringChunkVisitor, cef_string_chunk_visitor_t>::UnwrapDerived(
+    CefWrapperType type, CefStringChunkVisitor* c) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCToCpp<CefStringChunkVisitorCToCpp,
+    CefStringChunkVisitor, cef_string_chunk_visitor_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCToCpp<CefStringChunkVisitorCToCpp,
+    CefStringChunkVisitor, cef_string_chunk_visitor_t>::kWrapperType =
+    WT_STRING_CHUNK_VISITOR;
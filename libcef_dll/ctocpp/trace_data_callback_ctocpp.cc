@@ -0,0 +1,68 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/trace_data_callback_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefTraceDataCallbackCToCpp::OnTraceDataChunk(const void* data,
+    size_t data_size) {
+  cef_trace_data_callback_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_trace_data_chunk))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: data; type: simple_byaddr
+  DCHECK(data);
+  if (!data)
+    return;
+
+  // Execute
+  _struct->on_trace_data_chunk(_struct,
+      data,
+      data_size);
+}
+
+void CefTraceDataCallbackCToCpp::OnTraceDataComplete() {
+  cef_trace_data_callback_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, on_trace_data_complete))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  _struct->on_trace_data_complete(_struct);
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefTraceDataCallbackCToCpp::CefTraceDataCallbackCToCpp() {
+}
+
+template<> cef_trace_data_callback_t* CefCToCpp<CefTraceDataCallbackCToCpp,
+    CefTraceDataCallback, cef_trace_data_callback_t>::UnwrapDerived(
+    CefWrapperType type, CefTraceDataCallback* c) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCToCpp<CefTraceDataCallbackCToCpp,
+    CefTraceDataCallback, cef_trace_data_callback_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCToCpp<CefTraceDataCallbackCToCpp,
+    CefTraceDataCallback, cef_trace_data_callback_t>::kWrapperType =
+    WT_TRACE_DATA_CALLBACK;
@@ -11,6 +11,7 @@
 //
 
 #include "libcef_dll/cpptoc/auth_callback_cpptoc.h"
+#include "libcef_dll/cpptoc/stream_writer_cpptoc.h"
 #include "libcef_dll/cpptoc/urlrequest_cpptoc.h"
 #include "libcef_dll/ctocpp/urlrequest_client_ctocpp.h"
 
@@ -99,6 +100,27 @@ void CefURLRequestClientCToCpp::OnDownloadData(CefRefPtr<CefURLRequest> request,
       data_length);
 }
 
+CefRefPtr<CefStreamWriter> CefURLRequestClientCToCpp::GetDownloadStreamWriter(
+    CefRefPtr<CefURLRequest> request) {
+  cef_urlrequest_client_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_download_stream_writer))
+    return NULL;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: request; type: refptr_diff
+  DCHECK(request.get());
+  if (!request.get())
+    return NULL;
+
+  // Execute
+  cef_stream_writer_t* _retval = _struct->get_download_stream_writer(_struct,
+      CefURLRequestCppToC::Wrap(request));
+
+  // Return type: refptr_diff
+  return CefStreamWriterCppToC::Unwrap(_retval);
+}
+
 bool CefURLRequestClientCToCpp::GetAuthCredentials(bool isProxy,
     const CefString& host, int port, const CefString& realm,
     const CefString& scheme, CefRefPtr<CefAuthCallback> callback) {
@@ -38,6 +38,8 @@ class CefURLRequestClientCToCpp
       int64 total) override;
   void OnDownloadData(CefRefPtr<CefURLRequest> request, const void* data,
       size_t data_length) override;
+  CefRefPtr<CefStreamWriter> GetDownloadStreamWriter(
+      CefRefPtr<CefURLRequest> request) override;
   bool GetAuthCredentials(bool isProxy, const CefString& host, int port,
       const CefString& realm, const CefString& scheme,
       CefRefPtr<CefAuthCallback> callback) override;
@@ -0,0 +1,173 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/binary_value_ctocpp.h"
+#include "libcef_dll/ctocpp/v8context_ctocpp.h"
+#include "libcef_dll/ctocpp/v8exception_ctocpp.h"
+#include "libcef_dll/ctocpp/v8script_ctocpp.h"
+#include "libcef_dll/ctocpp/v8value_ctocpp.h"
+
+
+// STATIC METHODS - Body may be edited by hand.
+
+CefRefPtr<CefV8Script> CefV8Script::Create(const CefString& code,
+    const CefString& script_url, CefRefPtr<CefBinaryValue> cached_data,
+    CefRefPtr<CefV8Exception>& exception) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: code; type: string_byref_const
+  DCHECK(!code.empty());
+  if (code.empty())
+    return NULL;
+  // Unverified params: script_url, cached_data
+
+  // Translate param: exception; type: refptr_same_byref
+  cef_v8exception_t* exceptionStruct = NULL;
+  if (exception.get())
+    exceptionStruct = CefV8ExceptionCToCpp::Unwrap(exception);
+  cef_v8exception_t* exceptionOrig = exceptionStruct;
+
+  // Execute
+  cef_v8script_t* _retval = cef_v8script_create(
+      code.GetStruct(),
+      script_url.GetStruct(),
+      CefBinaryValueCToCpp::Unwrap(cached_data),
+      &exceptionStruct);
+
+  // Restore param:exception; type: refptr_same_byref
+  if (exceptionStruct) {
+    if (exceptionStruct != exceptionOrig) {
+      exception = CefV8ExceptionCToCpp::Wrap(exceptionStruct);
+    }
+  } else {
+    exception = NULL;
+  }
+
+  // Return type: refptr_same
+  return CefV8ScriptCToCpp::Wrap(_retval);
+}
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+bool CefV8ScriptCToCpp::IsValid() {
+  cef_v8script_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, is_valid))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->is_valid(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefV8ScriptCToCpp::Run(CefRefPtr<CefV8Context> context,
+    CefRefPtr<CefV8Value>& retval, CefRefPtr<CefV8Exception>& exception) {
+  cef_v8script_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, run))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: context; type: refptr_same
+  DCHECK(context.get());
+  if (!context.get())
+    return false;
+
+  // Translate param: retval; type: refptr_same_byref
+  cef_v8value_t* retvalStruct = NULL;
+  if (retval.get())
+    retvalStruct = CefV8ValueCToCpp::Unwrap(retval);
+  cef_v8value_t* retvalOrig = retvalStruct;
+  // Translate param: exception; type: refptr_same_byref
+  cef_v8exception_t* exceptionStruct = NULL;
+  if (exception.get())
+    exceptionStruct = CefV8ExceptionCToCpp::Unwrap(exception);
+  cef_v8exception_t* exceptionOrig = exceptionStruct;
+
+  // Execute
+  int _retval = _struct->run(_struct,
+      CefV8ContextCToCpp::Unwrap(context),
+      &retvalStruct,
+      &exceptionStruct);
+
+  // Restore param:retval; type: refptr_same_byref
+  if (retvalStruct) {
+    if (retvalStruct != retvalOrig) {
+      retval = CefV8ValueCToCpp::Wrap(retvalStruct);
+    }
+  } else {
+    retval = NULL;
+  }
+  // Restore param:exception; type: refptr_same_byref
+  if (exceptionStruct) {
+    if (exceptionStruct != exceptionOrig) {
+      exception = CefV8ExceptionCToCpp::Wrap(exceptionStruct);
+    }
+  } else {
+    exception = NULL;
+  }
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+CefRefPtr<CefBinaryValue> CefV8ScriptCToCpp::GetCachedData() {
+  cef_v8script_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, get_cached_data))
+    return NULL;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  cef_binary_value_t* _retval = _struct->get_cached_data(_struct);
+
+  // Return type: refptr_same
+  return CefBinaryValueCToCpp::Wrap(_retval);
+}
+
+bool CefV8ScriptCToCpp::IsCachedDataRejected() {
+  cef_v8script_t* _struct = GetStruct();
+  if (CEF_MEMBER_MISSING(_struct, is_cached_data_rejected))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = _struct->is_cached_data_rejected(_struct);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefV8ScriptCToCpp::CefV8ScriptCToCpp() {
+}
+
+template<> cef_v8script_t* CefCToCpp<CefV8ScriptCToCpp, CefV8Script,
+    cef_v8script_t>::UnwrapDerived(CefWrapperType type, CefV8Script* c) {
+  NOTREACHED() << "Unexpected class type: " << type;
+  return NULL;
+}
+
+#ifndef NDEBUG
+template<> base::AtomicRefCount CefCToCpp<CefV8ScriptCToCpp, CefV8Script,
+    cef_v8script_t>::DebugObjCt = 0;
+#endif
+
+template<> CefWrapperType CefCToCpp<CefV8ScriptCToCpp, CefV8Script,
+    cef_v8script_t>::kWrapperType = WT_V8SCRIPT;
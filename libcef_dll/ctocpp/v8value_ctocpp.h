@@ -42,6 +42,8 @@ class CefV8ValueCToCpp
   bool IsString() OVERRIDE;
   bool IsObject() OVERRIDE;
   bool IsArray() OVERRIDE;
+  bool IsArrayBuffer() OVERRIDE;
+  bool IsArrayBufferView() OVERRIDE;
   bool IsFunction() OVERRIDE;
   bool IsSame(CefRefPtr<CefV8Value> that) OVERRIDE;
   bool GetBoolValue() OVERRIDE;
@@ -73,6 +75,8 @@ class CefV8ValueCToCpp
   int GetExternallyAllocatedMemory() OVERRIDE;
   int AdjustExternallyAllocatedMemory(int change_in_bytes) OVERRIDE;
   int GetArrayLength() OVERRIDE;
+  void* GetArrayBufferData() OVERRIDE;
+  size_t GetArrayBufferByteLength() OVERRIDE;
   CefString GetFunctionName() OVERRIDE;
   CefRefPtr<CefV8Handler> GetFunctionHandler() OVERRIDE;
   CefRefPtr<CefV8Value> ExecuteFunction(CefRefPtr<CefV8Value> object,
@@ -5,16 +5,27 @@
 #include "include/wrapper/cef_resource_manager.h"
 
 #include <algorithm>
+#include <sstream>
 #include <vector>
 
 #include "include/base/cef_macros.h"
 #include "include/base/cef_weak_ptr.h"
 #include "include/cef_parser.h"
+#include "include/cef_trace.h"
 #include "include/wrapper/cef_stream_resource_handler.h"
 #include "include/wrapper/cef_zip_archive.h"
 
+#if defined(OS_WIN)
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#endif
+
 namespace {
 
+// Default value for CefResourceManager::SetCacheValidationInterval.
+const int64 kDefaultCacheValidationIntervalMs = 1000;
+
 #if defined(OS_WIN)
 #define PATH_SEP '\\'
 #else
@@ -31,6 +42,15 @@ std::string GetUrlWithoutQueryOrFragment(const std::string& url) {
   return url;
 }
 
+// Returns |url| without the fragment component, if any.
+std::string GetUrlWithoutFragment(const std::string& url) {
+  const size_t pos = url.find('#');
+  if (pos != std::string::npos)
+    return url.substr(0, pos);
+
+  return url;
+}
+
 // Determine the mime type based on the |url| file extension.
 std::string GetMimeType(const std::string& url) {
   std::string mime_type;
@@ -49,6 +69,124 @@ std::string GetFilteredUrl(const std::string& url) {
   return url;
 }
 
+// Returns |url_path| with a trailing slash.
+std::string GetNormalizedUrlPath(const std::string& url_path) {
+  if (!url_path.empty() && url_path[url_path.size() - 1] == '/')
+    return url_path;
+  return url_path + '/';
+}
+
+// Returns an entity tag for the file at |file_path| based on the modification
+// time and size, or an empty string if the file does not exist. Sub-second
+// time resolution is used where available so that rewrites within the same
+// second are detected. Must be called on the FILE thread.
+std::string GetFileETag(const std::string& file_path) {
+  std::stringstream ss;
+#if defined(OS_WIN)
+  WIN32_FILE_ATTRIBUTE_DATA attributes;
+  if (!GetFileAttributesExW(CefString(file_path).ToWString().c_str(),
+                            GetFileExInfoStandard, &attributes)) {
+    return std::string();
+  }
+  ss << std::hex << attributes.ftLastWriteTime.dwHighDateTime << "-" <<
+        attributes.ftLastWriteTime.dwLowDateTime << "-" <<
+        attributes.nFileSizeHigh << "-" << attributes.nFileSizeLow;
+#else
+  struct stat file_stat;
+  if (stat(file_path.c_str(), &file_stat) != 0)
+    return std::string();
+#if defined(OS_MACOSX)
+  const struct timespec& mtime = file_stat.st_mtimespec;
+  const struct timespec& ctime = file_stat.st_ctimespec;
+#else
+  const struct timespec& mtime = file_stat.st_mtim;
+  const struct timespec& ctime = file_stat.st_ctim;
+#endif
+  // The change time is also included because the modification time can be set
+  // explicitly by the application that wrote the file.
+  ss << std::hex << static_cast<int64>(mtime.tv_sec) << "." <<
+        static_cast<int64>(mtime.tv_nsec) << "-" <<
+        static_cast<int64>(ctime.tv_sec) << "." <<
+        static_cast<int64>(ctime.tv_nsec) << "-" <<
+        static_cast<int64>(file_stat.st_size);
+#endif
+  return ss.str();
+}
+
+// Returns true if the file at |file_path| still matches |etag|. Used as a
+// CacheValidator so it will be called on the FILE thread.
+bool IsFileUnchanged(const std::string& file_path, const std::string& etag) {
+  CEF_REQUIRE_FILE_THREAD();
+  return GetFileETag(file_path) == etag;
+}
+
+
+// Data block that owns a copy of a string.
+class StringDataBlock : public CefResourceDataBlock {
+ public:
+  explicit StringDataBlock(const std::string& data)
+    : data_(data) {
+  }
+
+  void* GetData() OVERRIDE {
+    return const_cast<char*>(data_.data());
+  }
+
+  size_t GetSize() OVERRIDE {
+    return data_.size();
+  }
+
+ private:
+  const std::string data_;
+
+  IMPLEMENT_REFCOUNTING(StringDataBlock);
+  DISALLOW_COPY_AND_ASSIGN(StringDataBlock);
+};
+
+// Data block that references the contents of an archive file. Must be created
+// on the FILE thread because retrieving the data may decompress the file or
+// read it from a memory mapping. The data is only referenced afterwards.
+class ArchiveFileDataBlock : public CefResourceDataBlock {
+ public:
+  explicit ArchiveFileDataBlock(CefRefPtr<CefZipArchive::File> file)
+    : file_(file),
+      data_(file->GetData()),
+      size_(file->GetDataSize()) {
+    CEF_REQUIRE_FILE_THREAD();
+
+    if (data_) {
+      // Touch each page so that mapped data is paged in on this thread instead
+      // of when the data is read on the IO thread.
+      volatile unsigned char touch = 0;
+      for (size_t offset = 0; offset < size_; offset += kPageSize)
+        touch ^= data_[offset];
+    }
+  }
+
+  bool IsValid() const {
+    return data_ != NULL;
+  }
+
+  void* GetData() OVERRIDE {
+    return const_cast<unsigned char*>(data_);
+  }
+
+  size_t GetSize() OVERRIDE {
+    return size_;
+  }
+
+ private:
+  static const size_t kPageSize = 4096;
+
+  // Keeps |data_| alive.
+  CefRefPtr<CefZipArchive::File> file_;
+  const unsigned char* data_;
+  size_t size_;
+
+  IMPLEMENT_REFCOUNTING(ArchiveFileDataBlock);
+  DISALLOW_COPY_AND_ASSIGN(ArchiveFileDataBlock);
+};
+
 
 // Provider of fixed contents.
 class ContentProvider : public CefResourceManager::Provider {
@@ -57,7 +195,7 @@ class ContentProvider : public CefResourceManager::Provider {
                   const std::string& content,
                   const std::string& mime_type)
     : url_(url),
-      content_(content),
+      content_(new StringDataBlock(content)),
       mime_type_(mime_type) {
     DCHECK(!url.empty());
     DCHECK(!content.empty());
@@ -72,22 +210,18 @@ class ContentProvider : public CefResourceManager::Provider {
       return false;
     }
 
-    CefRefPtr<CefStreamReader> stream =
-        CefStreamReader::CreateForData(
-            static_cast<void*>(const_cast<char*>(content_.data())),
-            content_.length());
-
     // Determine the mime type a single time if it isn't already set.
     if (mime_type_.empty())
       mime_type_ = request->mime_type_resolver().Run(url);
 
-    request->Continue(new CefStreamResourceHandler(mime_type_, stream));
+    // The content is shared with the handler instead of being copied.
+    request->Continue(new CefStreamResourceHandler(mime_type_, content_.get()));
     return true;
   }
 
  private:
   std::string url_;
-  std::string content_;
+  CefRefPtr<StringDataBlock> content_;
   std::string mime_type_;
 
   DISALLOW_COPY_AND_ASSIGN(ContentProvider);
@@ -99,14 +233,12 @@ class DirectoryProvider : public CefResourceManager::Provider {
  public:
   DirectoryProvider(const std::string& url_path,
                     const std::string& directory_path)
-    : url_path_(url_path),
+    : url_path_(GetNormalizedUrlPath(url_path)),
       directory_path_(directory_path) {
-    DCHECK(!url_path_.empty());
+    DCHECK(!url_path.empty());
     DCHECK(!directory_path_.empty());
 
     // Normalize the path values.
-    if (url_path_[url_path_.size() - 1] != '/')
-      url_path_ += '/';
     if (directory_path_[directory_path_.size() - 1] != PATH_SEP)
       directory_path_ += PATH_SEP;
   }
@@ -142,18 +274,23 @@ class DirectoryProvider : public CefResourceManager::Provider {
       scoped_refptr<CefResourceManager::Request> request) {
     CEF_REQUIRE_FILE_THREAD();
 
+    // Retrieve the entity tag first so that a file modified while being read
+    // will fail validation.
+    const std::string& etag = GetFileETag(file_path);
     CefRefPtr<CefStreamReader> stream =
         CefStreamReader::CreateForFile(file_path);
 
     // Continue loading on the IO thread.
     CefPostTask(TID_IO,
         base::Bind(&DirectoryProvider::ContinueOpenOnIOThread, request,
-                   stream));
+                   stream, file_path, etag));
   }
 
   static void ContinueOpenOnIOThread(
       scoped_refptr<CefResourceManager::Request> request,
-      CefRefPtr<CefStreamReader> stream) {
+      CefRefPtr<CefStreamReader> stream,
+      const std::string& file_path,
+      const std::string& etag) {
     CEF_REQUIRE_IO_THREAD();
 
     CefRefPtr<CefStreamResourceHandler> handler;
@@ -161,6 +298,10 @@ class DirectoryProvider : public CefResourceManager::Provider {
       handler = new CefStreamResourceHandler(
           request->mime_type_resolver().Run(request->url()),
           stream);
+      if (!etag.empty()) {
+        request->AllowCaching(
+            base::Bind(&IsFileUnchanged, file_path, etag));
+      }
     }
     request->Continue(handler);
   }
@@ -178,18 +319,14 @@ class ArchiveProvider : public CefResourceManager::Provider {
   ArchiveProvider(const std::string& url_path,
                   const std::string& archive_path,
                   const std::string& password)
-    : url_path_(url_path),
+    : url_path_(GetNormalizedUrlPath(url_path)),
       archive_path_(archive_path),
       password_(password),
       archive_load_started_(false),
       archive_load_ended_(false),
       ALLOW_THIS_IN_INITIALIZER_LIST(weak_ptr_factory_(this)) {
-    DCHECK(!url_path_.empty());
+    DCHECK(!url_path.empty());
     DCHECK(!archive_path_.empty());
-
-    // Normalize the path values.
-    if (url_path_[url_path_.size() - 1] != '/')
-      url_path_ += '/';
   }
 
   bool OnRequest(scoped_refptr<CefResourceManager::Request> request) OVERRIDE {
@@ -229,18 +366,23 @@ class ArchiveProvider : public CefResourceManager::Provider {
                                const std::string& password) {
     CEF_REQUIRE_FILE_THREAD();
 
-    CefRefPtr<CefZipArchive> archive;
-
-    CefRefPtr<CefStreamReader> stream =
-        CefStreamReader::CreateForFile(archive_path);
-    if (stream.get()) {
-      archive = new CefZipArchive;
-      if (archive->Load(stream, password, true) == 0) {
-        DLOG(WARNING) << "Empty archive file: " << archive_path;
+    CefRefPtr<CefZipArchive> archive = new CefZipArchive;
+
+    // Prefer memory mapping so that only the requested files are
+    // decompressed. Fall back to reading the whole archive if the file cannot
+    // be mapped or uses unsupported features.
+    if (archive->LoadMapped(archive_path, password, true) == 0) {
+      CefRefPtr<CefStreamReader> stream =
+          CefStreamReader::CreateForFile(archive_path);
+      if (stream.get()) {
+        if (archive->Load(stream, password, true) == 0) {
+          DLOG(WARNING) << "Empty archive file: " << archive_path;
+          archive = NULL;
+        }
+      } else {
+        DLOG(WARNING) << "Failed to load archive file: " << archive_path;
         archive = NULL;
       }
-    } else {
-      DLOG(WARNING) << "Failed to load archive file: " << archive_path;
     }
 
     CefPostTask(TID_IO,
@@ -263,27 +405,56 @@ class ArchiveProvider : public CefResourceManager::Provider {
   }
 
   bool ContinueRequest(scoped_refptr<CefResourceManager::Request> request) {
-    CefRefPtr<CefResourceHandler> handler;
+    CEF_REQUIRE_IO_THREAD();
 
     // |archive_| will be NULL if the archive file failed to load or was empty.
-    if (archive_.get()) {
-      const std::string& url = request->url();
-      const std::string& relative_path = url.substr(url_path_.length());
-      CefRefPtr<CefZipArchive::File> file = archive_->GetFile(relative_path);
-      if (file.get()) {
-        handler = new CefStreamResourceHandler(
-            request->mime_type_resolver().Run(url),
-            file->GetStreamReader());
-      }
-    }
+    if (!archive_.get())
+      return false;
 
-    if (!handler.get())
+    const std::string& url = request->url();
+    const std::string& relative_path = url.substr(url_path_.length());
+    CefRefPtr<CefZipArchive::File> file = archive_->GetFile(relative_path);
+    if (!file.get())
       return false;
 
-    request->Continue(handler);
+    // Retrieving the file data may decompress the file so do it on the FILE
+    // thread.
+    CefPostTask(TID_FILE,
+        base::Bind(&ArchiveProvider::ReadFileOnFileThread, request, file));
     return true;
   }
 
+  static void ReadFileOnFileThread(
+      scoped_refptr<CefResourceManager::Request> request,
+      CefRefPtr<CefZipArchive::File> file) {
+    CEF_REQUIRE_FILE_THREAD();
+
+    CefRefPtr<ArchiveFileDataBlock> data = new ArchiveFileDataBlock(file);
+    if (!data->IsValid())
+      data = NULL;
+
+    // Continue the request on the IO thread.
+    CefPostTask(TID_IO,
+        base::Bind(&ArchiveProvider::ContinueReadOnIOThread, request, data));
+  }
+
+  static void ContinueReadOnIOThread(
+      scoped_refptr<CefResourceManager::Request> request,
+      CefRefPtr<ArchiveFileDataBlock> data) {
+    CEF_REQUIRE_IO_THREAD();
+
+    CefRefPtr<CefStreamResourceHandler> handler;
+    if (data.get()) {
+      // Read directly from the archive file data.
+      handler = new CefStreamResourceHandler(
+          request->mime_type_resolver().Run(request->url()), data.get());
+
+      // The archive contents will not change after loading.
+      request->AllowCaching(CefResourceManager::CacheValidator());
+    }
+    request->Continue(handler);
+  }
+
   std::string url_path_;
   std::string archive_path_;
   std::string password_;
@@ -311,17 +482,41 @@ class ArchiveProvider : public CefResourceManager::Provider {
 struct CefResourceManager::ProviderEntry {
   ProviderEntry(Provider* provider,
                 int order,
-                const std::string& identifier)
+                const std::string& identifier,
+                const std::string& url,
+                bool url_is_prefix,
+                uint64 sequence)
     : provider_(provider),
       order_(order),
       identifier_(identifier),
+      url_(url),
+      url_is_prefix_(url_is_prefix),
+      sequence_(sequence),
       deletion_pending_(false) {
   }
 
+  // Returns true if |a| is called before |b|. Matches the ordering of the
+  // |providers_| list.
+  static bool IsBefore(const ProviderEntry* a, const ProviderEntry* b) {
+    if (a->order_ != b->order_)
+      return a->order_ < b->order_;
+    return a->sequence_ < b->sequence_;
+  }
+
   scoped_ptr<Provider> provider_;
   int order_;
   std::string identifier_;
 
+  // URL or URL prefix handled by this provider. Empty for all URLs.
+  std::string url_;
+  bool url_is_prefix_;
+
+  // Order in which this provider was added.
+  uint64 sequence_;
+
+  // Position of this entry in the |providers_| list.
+  ProviderEntryList::iterator pos_;
+
   // List of pending requests currently associated with this provider.
   RequestList pending_requests_;
 
@@ -330,8 +525,174 @@ struct CefResourceManager::ProviderEntry {
 };
 
 
+// CefResourceManager::ProviderIndex implementation.
+
+// Providers are indexed by exact URL, by URL prefix using a character trie, or
+// as matching all URLs. Finding the next provider for a URL is therefore
+// proportional to the URL length instead of the number of providers.
+class CefResourceManager::ProviderIndex {
+ public:
+  ProviderIndex() : root_('\0') {}
+
+  void Add(ProviderEntry* entry) {
+    if (entry->url_.empty()) {
+      Insert(&all_entries_, entry);
+    } else if (!entry->url_is_prefix_) {
+      Insert(&exact_entries_[entry->url_], entry);
+    } else {
+      Node* node = &root_;
+      const std::string& url = entry->url_;
+      for (size_t i = 0; i < url.size(); ++i)
+        node = node->GetOrCreateChild(url[i]);
+      Insert(&node->entries_, entry);
+    }
+  }
+
+  void Remove(ProviderEntry* entry) {
+    if (entry->url_.empty()) {
+      Erase(&all_entries_, entry);
+    } else if (!entry->url_is_prefix_) {
+      ExactMap::iterator it = exact_entries_.find(entry->url_);
+      if (it != exact_entries_.end()) {
+        Erase(&it->second, entry);
+        if (it->second.empty())
+          exact_entries_.erase(it);
+      }
+    } else {
+      RemoveFromNode(&root_, entry, 0);
+    }
+  }
+
+  // Returns the first entry that may handle |url| and that is ordered after
+  // |after|, or NULL if no such entry exists. If |after| is NULL the first
+  // entry that may handle |url| will be returned.
+  ProviderEntry* FindNext(const std::string& url,
+                          const ProviderEntry* after) const {
+    ProviderEntry* next = NULL;
+    UpdateNext(all_entries_, after, &next);
+
+    ExactMap::const_iterator it = exact_entries_.find(url);
+    if (it != exact_entries_.end())
+      UpdateNext(it->second, after, &next);
+
+    const Node* node = &root_;
+    for (size_t i = 0; i < url.size(); ++i) {
+      node = node->FindChild(url[i]);
+      if (!node)
+        break;
+      UpdateNext(node->entries_, after, &next);
+    }
+
+    return next;
+  }
+
+ private:
+  // Entries sorted in provider order.
+  typedef std::vector<ProviderEntry*> EntryVector;
+  typedef std::map<std::string, EntryVector> ExactMap;
+
+  // Trie node. Children are owned by their parent as a singly-linked list of
+  // siblings. URLs branch rarely so the lists are short.
+  struct Node {
+    explicit Node(char key) : key_(key) {}
+
+    // Returns the child for |key| or NULL if no such child exists.
+    Node* FindChild(char key) const {
+      Node* child = first_child_.get();
+      while (child && child->key_ != key)
+        child = child->next_sibling_.get();
+      return child;
+    }
+
+    Node* GetOrCreateChild(char key) {
+      Node* child = FindChild(key);
+      if (!child) {
+        child = new Node(key);
+        child->next_sibling_ = first_child_.Pass();
+        first_child_.reset(child);
+      }
+      return child;
+    }
+
+    // Deletes the child for |key| and its subtree.
+    void RemoveChild(char key) {
+      scoped_ptr<Node>* link = &first_child_;
+      while (link->get() && (*link)->key_ != key)
+        link = &(*link)->next_sibling_;
+      if (link->get()) {
+        scoped_ptr<Node> child = link->Pass();
+        *link = child->next_sibling_.Pass();
+      }
+    }
+
+    const char key_;
+    scoped_ptr<Node> first_child_;
+    scoped_ptr<Node> next_sibling_;
+    EntryVector entries_;
+
+    DISALLOW_COPY_AND_ASSIGN(Node);
+  };
+
+  static void Insert(EntryVector* entries, ProviderEntry* entry) {
+    entries->insert(std::upper_bound(entries->begin(), entries->end(), entry,
+                                     ProviderEntry::IsBefore),
+                    entry);
+  }
+
+  static void Erase(EntryVector* entries, ProviderEntry* entry) {
+    EntryVector::iterator it =
+        std::find(entries->begin(), entries->end(), entry);
+    if (it != entries->end())
+      entries->erase(it);
+  }
+
+  // Remove |entry| from the subtree at |node| and prune empty nodes. Returns
+  // true if |node| is empty.
+  static bool RemoveFromNode(Node* node, ProviderEntry* entry, size_t depth) {
+    const std::string& url = entry->url_;
+    if (depth == url.size()) {
+      Erase(&node->entries_, entry);
+    } else {
+      Node* child = node->FindChild(url[depth]);
+      if (child && RemoveFromNode(child, entry, depth + 1))
+        node->RemoveChild(url[depth]);
+    }
+    return node->entries_.empty() && !node->first_child_.get();
+  }
+
+  // Update |next| if |entries| contains an earlier entry after |after|.
+  static void UpdateNext(const EntryVector& entries,
+                         const ProviderEntry* after,
+                         ProviderEntry** next) {
+    if (entries.empty())
+      return;
+
+    EntryVector::const_iterator it = entries.begin();
+    if (after) {
+      it = std::upper_bound(entries.begin(), entries.end(), after,
+                            ProviderEntry::IsBefore);
+      if (it == entries.end())
+        return;
+    }
+
+    if (!*next || ProviderEntry::IsBefore(*it, *next))
+      *next = *it;
+  }
+
+  Node root_;
+  ExactMap exact_entries_;
+  EntryVector all_entries_;
+
+  DISALLOW_COPY_AND_ASSIGN(ProviderIndex);
+};
+
+
 // CefResourceManager::RequestState implementation.
 
+CefResourceManager::RequestState::RequestState()
+    : cacheable_(false) {
+}
+
 CefResourceManager::RequestState::~RequestState() {
   // Always execute the callback.
   if (callback_.get())
@@ -339,6 +700,186 @@ CefResourceManager::RequestState::~RequestState() {
 }
 
 
+// CefResourceManager::CachedResponse implementation.
+
+struct CefResourceManager::CachedResponse : public CefResourceDataBlock {
+  CachedResponse()
+    : status_code_(0),
+      validated_time_(0) {
+  }
+
+  // Returns a new handler that reads from the cached data.
+  CefRefPtr<CefResourceHandler> CreateHandler() {
+    return new CefStreamResourceHandler(status_code_, status_text_,
+                                        mime_type_, header_map_, this);
+  }
+
+  // CefResourceDataBlock methods.
+  void* GetData() OVERRIDE {
+    return const_cast<char*>(data_.data());
+  }
+
+  size_t GetSize() OVERRIDE {
+    return data_.size();
+  }
+
+  int status_code_;
+  CefString status_text_;
+  CefString mime_type_;
+  CefResponse::HeaderMap header_map_;
+  std::string data_;
+  CacheValidator validator_;
+
+  // Time in microseconds when the response was last known to be valid. Only
+  // accessed on the IO thread.
+  int64 validated_time_;
+
+  IMPLEMENT_REFCOUNTING(CachedResponse);
+};
+
+
+// CefResourceManager::CachingHandler implementation.
+
+class CefResourceManager::CachingHandler : public CefResourceHandler {
+ public:
+  CachingHandler(CefRefPtr<CefResourceHandler> handler,
+                 base::WeakPtr<CefResourceManager> manager,
+                 const std::string& cache_key,
+                 const CacheValidator& validator,
+                 size_t max_size)
+    : handler_(handler),
+      manager_(manager),
+      cache_key_(cache_key),
+      validator_(validator),
+      max_size_(max_size),
+      expected_size_(-1),
+      got_data_block_(false) {
+  }
+
+  bool ProcessRequest(CefRefPtr<CefRequest> request,
+                      CefRefPtr<CefCallback> callback) OVERRIDE {
+    return handler_->ProcessRequest(request, callback);
+  }
+
+  void GetResponseHeaders(CefRefPtr<CefResponse> response,
+                          int64& response_length,
+                          CefString& redirectUrl) OVERRIDE {
+    CEF_REQUIRE_IO_THREAD();
+    handler_->GetResponseHeaders(response, response_length, redirectUrl);
+
+    // Only cache complete successful responses.
+    if (!redirectUrl.empty() || response->GetStatus() != 200 ||
+        response_length > static_cast<int64>(max_size_)) {
+      return;
+    }
+
+    cached_response_ = new CachedResponse();
+    cached_response_->status_code_ = response->GetStatus();
+    cached_response_->status_text_ = response->GetStatusText();
+    cached_response_->mime_type_ = response->GetMimeType();
+    response->GetHeaderMap(cached_response_->header_map_);
+    cached_response_->validator_ = validator_;
+    cached_response_->validated_time_ = CefNowFromSystemTraceTime();
+    if (response_length > 0)
+      cached_response_->data_.reserve(static_cast<size_t>(response_length));
+    expected_size_ = response_length;
+    if (expected_size_ == 0)
+      Complete();
+  }
+
+  bool ReadResponse(void* data_out,
+                    int bytes_to_read,
+                    int& bytes_read,
+                    CefRefPtr<CefCallback> callback) OVERRIDE {
+    CEF_REQUIRE_IO_THREAD();
+    const bool result =
+        handler_->ReadResponse(data_out, bytes_to_read, bytes_read, callback);
+
+    if (cached_response_.get()) {
+      if (!result)
+        Complete();
+      else if (bytes_read > 0)
+        AppendData(data_out, bytes_read);
+    }
+
+    return result;
+  }
+
+  CefRefPtr<CefResourceDataBlock> GetResponseDataBlock() OVERRIDE {
+    CEF_REQUIRE_IO_THREAD();
+    CefRefPtr<CefResourceDataBlock> block = handler_->GetResponseDataBlock();
+
+    if (cached_response_.get()) {
+      if (block.get()) {
+        got_data_block_ = true;
+        AppendData(block->GetData(), block->GetSize());
+      } else if (got_data_block_) {
+        // If no blocks were returned the response will instead be recorded
+        // via ReadResponse().
+        Complete();
+      }
+    }
+
+    return block;
+  }
+
+  bool CanGetCookie(const CefCookie& cookie) OVERRIDE {
+    return handler_->CanGetCookie(cookie);
+  }
+
+  bool CanSetCookie(const CefCookie& cookie) OVERRIDE {
+    return handler_->CanSetCookie(cookie);
+  }
+
+  void Cancel() OVERRIDE {
+    cached_response_ = NULL;
+    handler_->Cancel();
+  }
+
+ private:
+  void AppendData(const void* data, size_t size) {
+    std::string& cached_data = cached_response_->data_;
+    if (cached_data.size() + size > max_size_) {
+      cached_response_ = NULL;
+      return;
+    }
+
+    if (size > 0)
+      cached_data.append(static_cast<const char*>(data), size);
+
+    // Reading stops without further calls once the expected size is reached.
+    if (expected_size_ >= 0 &&
+        cached_data.size() == static_cast<size_t>(expected_size_)) {
+      Complete();
+    }
+  }
+
+  void Complete() {
+    if (manager_)
+      manager_->AddCachedResponse(cache_key_, cached_response_);
+    cached_response_ = NULL;
+  }
+
+  CefRefPtr<CefResourceHandler> handler_;
+  base::WeakPtr<CefResourceManager> manager_;
+  std::string cache_key_;
+  CacheValidator validator_;
+  size_t max_size_;
+
+  // Response being recorded. Will be NULL if the response cannot be cached.
+  CefRefPtr<CachedResponse> cached_response_;
+
+  // Expected response size or -1 if unknown.
+  int64 expected_size_;
+
+  // True if the response is provided via data blocks.
+  bool got_data_block_;
+
+  IMPLEMENT_REFCOUNTING(CachingHandler);
+  DISALLOW_COPY_AND_ASSIGN(CachingHandler);
+};
+
+
 // CefResourceManager::Request implementation.
 
 void CefResourceManager::Request::Continue(
@@ -378,6 +919,22 @@ void CefResourceManager::Request::Stop() {
                  base::Passed(&state_)));
 }
 
+void CefResourceManager::Request::AllowCaching(
+    const CefResourceManager::CacheValidator& validator) {
+  if (!CefCurrentlyOn(TID_IO)) {
+    CefPostTask(TID_IO,
+        base::Bind(&CefResourceManager::Request::AllowCaching, this,
+                   validator));
+    return;
+  }
+
+  if (!state_.get())
+    return;
+
+  state_->cacheable_ = true;
+  state_->cache_validator_ = validator;
+}
+
 CefResourceManager::Request::Request(scoped_ptr<RequestState> state)
     : state_(state.Pass()),
       params_(state_->params_) {
@@ -435,8 +992,12 @@ void CefResourceManager::Request::StopOnIOThread(
 // CefResourceManager implementation.
 
 CefResourceManager::CefResourceManager()
-    : url_filter_(base::Bind(GetFilteredUrl)),
-      mime_type_resolver_(base::Bind(GetMimeType)) {
+    : provider_index_(new ProviderIndex()),
+      next_provider_sequence_(0),
+      url_filter_(base::Bind(GetFilteredUrl)),
+      mime_type_resolver_(base::Bind(GetMimeType)),
+      cache_limit_(0),
+      cache_validation_interval_ms_(kDefaultCacheValidationIntervalMs) {
 }
 
 CefResourceManager::~CefResourceManager() {
@@ -458,7 +1019,8 @@ void CefResourceManager::AddContentProvider(const std::string& url,
                                             const std::string& mime_type,
                                             int order,
                                             const std::string& identifier) {
-  AddProvider(new ContentProvider(url, content, mime_type), order, identifier);
+  AddProviderInternal(new ContentProvider(url, content, mime_type), order,
+                      identifier, url, false);
 }
 
 void CefResourceManager::AddDirectoryProvider(
@@ -466,8 +1028,8 @@ void CefResourceManager::AddDirectoryProvider(
     const std::string& directory_path,
     int order,
     const std::string& identifier) {
-  AddProvider(new DirectoryProvider(url_path, directory_path),
-              order, identifier);
+  AddProviderInternal(new DirectoryProvider(url_path, directory_path),
+                      order, identifier, GetNormalizedUrlPath(url_path), true);
 }
                     
 void CefResourceManager::AddArchiveProvider(const std::string& url_path,
@@ -475,31 +1037,38 @@ void CefResourceManager::AddArchiveProvider(const std::string& url_path,
                                             const std::string& password,
                                             int order,
                                             const std::string& identifier) {
-  AddProvider(new ArchiveProvider(url_path, archive_path, password),
-              order, identifier);
+  AddProviderInternal(new ArchiveProvider(url_path, archive_path, password),
+                      order, identifier, GetNormalizedUrlPath(url_path), true);
 }
 
 void CefResourceManager::AddProvider(Provider* provider,
                                      int order,
                                      const std::string& identifier) {
+  AddProviderInternal(provider, order, identifier, std::string(), false);
+}
+
+void CefResourceManager::AddProviderInternal(Provider* provider,
+                                             int order,
+                                             const std::string& identifier,
+                                             const std::string& url,
+                                             bool url_is_prefix) {
   DCHECK(provider);
   if (!provider)
     return;
 
   if (!CefCurrentlyOn(TID_IO)) {
     CefPostTask(TID_IO,
-        base::Bind(&CefResourceManager::AddProvider, this, provider, order,
-                   identifier));
+        base::Bind(&CefResourceManager::AddProviderInternal, this, provider,
+                   order, identifier, url, url_is_prefix));
     return;
   }
 
-  scoped_ptr<ProviderEntry> new_entry(
-      new ProviderEntry(provider, order, identifier));
+  // The new provider may handle requests that were previously cached.
+  ClearCacheInternal();
 
-  if (providers_.empty()) {
-    providers_.push_back(new_entry.release());
-    return;
-  }
+  ProviderEntry* new_entry =
+      new ProviderEntry(provider, order, identifier, url, url_is_prefix,
+                        next_provider_sequence_++);
 
   // Insert before the first entry with a higher |order| value.
   ProviderEntryList::iterator it = providers_.begin();
@@ -508,7 +1077,8 @@ void CefResourceManager::AddProvider(Provider* provider,
       break;
   }
 
-  providers_.insert(it, new_entry.release());
+  new_entry->pos_ = providers_.insert(it, new_entry);
+  provider_index_->Add(new_entry);
 }
 
 void CefResourceManager::RemoveProviders(const std::string& identifier) {
@@ -521,6 +1091,8 @@ void CefResourceManager::RemoveProviders(const std::string& identifier) {
   if (providers_.empty())
     return;
 
+  ClearCacheInternal();
+
   ProviderEntryList::iterator it = providers_.begin();
   while (it != providers_.end()) {
     if ((*it)->identifier_ == identifier)
@@ -540,6 +1112,8 @@ void CefResourceManager::RemoveAllProviders() {
   if (providers_.empty())
     return;
 
+  ClearCacheInternal();
+
   ProviderEntryList::iterator it = providers_.begin();
   while (it != providers_.end())
     DeleteProvider(it, true);
@@ -569,6 +1143,47 @@ void CefResourceManager::SetUrlFilter(const UrlFilter& filter) {
     url_filter_ = filter;
   else
     url_filter_ = base::Bind(GetFilteredUrl);
+
+  // Cached responses are keyed on the filtered URL.
+  ClearCacheInternal();
+}
+
+void CefResourceManager::SetCacheLimit(size_t cache_limit) {
+  if (!CefCurrentlyOn(TID_IO)) {
+    CefPostTask(TID_IO,
+        base::Bind(&CefResourceManager::SetCacheLimit, this, cache_limit));
+    return;
+  }
+
+  cache_limit_ = cache_limit;
+  EvictCachedResponses(0);
+}
+
+void CefResourceManager::SetCacheValidationInterval(int64 interval_ms) {
+  if (!CefCurrentlyOn(TID_IO)) {
+    CefPostTask(TID_IO,
+        base::Bind(&CefResourceManager::SetCacheValidationInterval, this,
+                   interval_ms));
+    return;
+  }
+
+  cache_validation_interval_ms_ = interval_ms;
+}
+
+void CefResourceManager::ClearCache() {
+  if (!CefCurrentlyOn(TID_IO)) {
+    CefPostTask(TID_IO,
+        base::Bind(&CefResourceManager::ClearCache, this));
+    return;
+  }
+
+  ClearCacheInternal();
+}
+
+CefResourceManager::CacheStatistics
+    CefResourceManager::GetCacheStatistics() const {
+  CEF_REQUIRE_IO_THREAD();
+  return cache_statistics_;
 }
 
 cef_return_value_t CefResourceManager::OnBeforeResourceLoad(
@@ -578,15 +1193,36 @@ cef_return_value_t CefResourceManager::OnBeforeResourceLoad(
     CefRefPtr<CefRequestCallback> callback) {
   CEF_REQUIRE_IO_THREAD();
 
-  // Find the first provider that is not pending deletion.
-  ProviderEntryList::iterator current_entry_pos = providers_.begin();
-  GetNextValidProvider(current_entry_pos);
- 
-  if (current_entry_pos == providers_.end()) {
+  if (providers_.empty()) {
     // No providers so continue the request immediately.
     return RV_CONTINUE;
   }
 
+  const std::string& filtered_url = url_filter_.Run(request->GetURL());
+  const std::string& url = GetUrlWithoutQueryOrFragment(filtered_url);
+
+  // Find the first provider that may handle the request.
+  ProviderEntryList::iterator current_entry_pos = GetNextProvider(url, NULL);
+  if (current_entry_pos == providers_.end()) {
+    // No matching providers so continue the request immediately.
+    return RV_CONTINUE;
+  }
+
+  const std::string& cache_key = GetUrlWithoutFragment(filtered_url);
+
+  CefRefPtr<CachedResponse> cached_response;
+  if (cache_limit_ > 0 && request->GetMethod() == "GET") {
+    CacheMap::iterator it = cache_.find(cache_key);
+    if (it != cache_.end()) {
+      if (!NeedsValidation(it->second.first)) {
+        // Return the cached response without calling any providers.
+        UseCachedResponse(it, request->GetIdentifier());
+        return RV_CONTINUE;
+      }
+      cached_response = it->second.first;
+    }
+  }
+
   scoped_ptr<RequestState> state(new RequestState);
 
   if (!weak_ptr_factory_.get()) {
@@ -600,13 +1236,23 @@ cef_return_value_t CefResourceManager::OnBeforeResourceLoad(
   state->manager_ = weak_ptr_factory_->GetWeakPtr();
   state->callback_ = callback;
 
-  state->params_.url_ =
-      GetUrlWithoutQueryOrFragment(url_filter_.Run(request->GetURL()));
+  state->params_.url_ = url;
   state->params_.browser_ = browser;
   state->params_.frame_ = frame;
   state->params_.request_ = request;
   state->params_.url_filter_ = url_filter_;
   state->params_.mime_type_resolver_ = mime_type_resolver_;
+  state->cache_key_ = cache_key;
+
+  if (cached_response.get()) {
+    // Validate the cached response on the FILE thread. The provider will be
+    // determined again if validation fails.
+    state->current_entry_pos_ = providers_.end();
+    CefPostTask(TID_FILE,
+        base::Bind(&CefResourceManager::ValidateOnFileThread, state->manager_,
+                   cached_response, base::Passed(&state)));
+    return RV_CONTINUE_ASYNC;
+  }
 
   state->current_entry_pos_ = current_entry_pos;
 
@@ -666,11 +1312,24 @@ void CefResourceManager::ContinueRequest(
   CEF_REQUIRE_IO_THREAD();
 
   if (handler.get()) {
+    if (state->cacheable_ && cache_limit_ > 0 &&
+        state->params_.request_->GetMethod() == "GET") {
+      // Record the response for the response cache.
+      handler = new CachingHandler(handler, weak_ptr_factory_->GetWeakPtr(),
+                                   state->cache_key_,
+                                   state->cache_validator_, cache_limit_);
+      cache_statistics_.miss_count++;
+    }
+
     // The request has been handled. Associate the request ID with the handler.
     pending_handlers_.insert(
         std::make_pair(state->params_.request_->GetIdentifier(), handler));
     StopRequest(state.Pass());
   } else {
+    // Caching only applies to the provider that allowed it.
+    state->cacheable_ = false;
+    state->cache_validator_.Reset();
+
     // Move to the next provider if any.
     if (IncrementProvider(state.get()))
       SendRequest(state.Pass());
@@ -693,8 +1352,8 @@ void CefResourceManager::StopRequest(scoped_ptr<RequestState> state) {
 // providers.
 bool CefResourceManager::IncrementProvider(RequestState* state) {
   // Identify the next provider.
-  ProviderEntryList::iterator next_entry_pos = state->current_entry_pos_;
-  GetNextValidProvider(++next_entry_pos);
+  ProviderEntryList::iterator next_entry_pos =
+      GetNextProvider(state->params_.url_, *state->current_entry_pos_);
 
   // Detach from the current provider.
   DetachRequestFromProvider(state);
@@ -729,12 +1388,18 @@ void CefResourceManager::DetachRequestFromProvider(RequestState* state) {
   }
 }
 
-// Move to the next provider that is not pending deletion.
-void CefResourceManager::GetNextValidProvider(
-    ProviderEntryList::iterator& iterator) {
-  while (iterator != providers_.end() && (*iterator)->deletion_pending_) {
-    ++iterator;
-  }
+// Returns the next provider after |after| that may handle |url| and that is
+// not pending deletion.
+CefResourceManager::ProviderEntryList::iterator
+    CefResourceManager::GetNextProvider(const std::string& url,
+                                        const ProviderEntry* after) {
+  ProviderEntry* entry = provider_index_->FindNext(url, after);
+  if (!entry)
+    return providers_.end();
+
+  // Entries pending deletion are removed from the index.
+  DCHECK(!entry->deletion_pending_);
+  return entry->pos_;
 }
 
 void CefResourceManager::DeleteProvider(ProviderEntryList::iterator& iterator,
@@ -746,6 +1411,9 @@ void CefResourceManager::DeleteProvider(ProviderEntryList::iterator& iterator,
   if (current_entry->deletion_pending_)
     return;
 
+  // Stop sending new requests to this provider.
+  provider_index_->Remove(current_entry);
+
   if (!current_entry->pending_requests_.empty()) {
     // Don't delete the provider entry until all pending requests have cleared.
     current_entry->deletion_pending_ = true;
@@ -770,3 +1438,140 @@ void CefResourceManager::DeleteProvider(ProviderEntryList::iterator& iterator,
     delete current_entry;
   }
 }
+
+// Returns true if |response| must be validated before it is used.
+bool CefResourceManager::NeedsValidation(
+    CefRefPtr<CachedResponse> response) const {
+  CEF_REQUIRE_IO_THREAD();
+
+  if (response->validator_.is_null())
+    return false;
+  if (cache_validation_interval_ms_ <= 0)
+    return true;
+
+  const int64 elapsed_us =
+      CefNowFromSystemTraceTime() - response->validated_time_;
+  return elapsed_us >= cache_validation_interval_ms_ * 1000;
+}
+
+// Return the cached response at |it| for the request with |request_id|.
+void CefResourceManager::UseCachedResponse(CacheMap::iterator it,
+                                           uint64 request_id) {
+  CEF_REQUIRE_IO_THREAD();
+
+  // Move to the front of the LRU list.
+  cache_lru_.splice(cache_lru_.begin(), cache_lru_, it->second.second);
+  cache_statistics_.hit_count++;
+
+  pending_handlers_.insert(
+      std::make_pair(request_id, it->second.first->CreateHandler()));
+}
+
+// static
+void CefResourceManager::ValidateOnFileThread(
+    base::WeakPtr<CefResourceManager> manager,
+    CefRefPtr<CachedResponse> response,
+    scoped_ptr<RequestState> state) {
+  CEF_REQUIRE_FILE_THREAD();
+
+  const bool valid = response->validator_.Run();
+
+  // If |manager| has been destroyed |state| will be deleted on the IO thread
+  // and the callback will be executed.
+  CefPostTask(TID_IO,
+      base::Bind(&CefResourceManager::ContinueAfterValidation, manager,
+                 response, valid, base::Passed(&state)));
+}
+
+void CefResourceManager::ContinueAfterValidation(
+    CefRefPtr<CachedResponse> response,
+    bool valid,
+    scoped_ptr<RequestState> state) {
+  CEF_REQUIRE_IO_THREAD();
+
+  // The response may have been removed from the cache while validating. In
+  // that case the set of providers may also have changed so don't use it.
+  CacheMap::iterator it = cache_.find(state->cache_key_);
+  const bool cached =
+      it != cache_.end() && it->second.first.get() == response.get();
+
+  if (cached && valid) {
+    response->validated_time_ = CefNowFromSystemTraceTime();
+    UseCachedResponse(it, state->params_.request_->GetIdentifier());
+
+    // Delete the state object and execute the callback.
+    state.reset();
+    return;
+  }
+
+  if (cached) {
+    // The cached response is stale.
+    RemoveCachedResponse(it);
+  }
+
+  // Send the request to providers as though it had not been cached.
+  state->current_entry_pos_ = GetNextProvider(state->params_.url_, NULL);
+  if (state->current_entry_pos_ == providers_.end()) {
+    // Delete the state object and execute the callback.
+    state.reset();
+    return;
+  }
+
+  SendRequest(state.Pass());
+}
+
+void CefResourceManager::AddCachedResponse(
+    const std::string& cache_key,
+    CefRefPtr<CachedResponse> response) {
+  CEF_REQUIRE_IO_THREAD();
+
+  const size_t size = response->data_.size();
+  if (size > cache_limit_)
+    return;
+
+  // Replace any existing response for the same key.
+  CacheMap::iterator it = cache_.find(cache_key);
+  if (it != cache_.end())
+    RemoveCachedResponse(it);
+
+  EvictCachedResponses(size);
+
+  cache_lru_.push_front(cache_key);
+  cache_.insert(std::make_pair(cache_key,
+                               std::make_pair(response, cache_lru_.begin())));
+  cache_statistics_.size += size;
+  cache_statistics_.entry_count = cache_.size();
+}
+
+void CefResourceManager::RemoveCachedResponse(CacheMap::iterator it) {
+  CEF_REQUIRE_IO_THREAD();
+
+  cache_statistics_.size -= it->second.first->data_.size();
+  cache_lru_.erase(it->second.second);
+  cache_.erase(it);
+  cache_statistics_.entry_count = cache_.size();
+}
+
+// Evict least recently used responses until |new_size| additional bytes fit
+// within the cache limit.
+void CefResourceManager::EvictCachedResponses(size_t new_size) {
+  CEF_REQUIRE_IO_THREAD();
+
+  while (!cache_lru_.empty() &&
+         cache_statistics_.size + new_size > cache_limit_) {
+    CacheMap::iterator it = cache_.find(cache_lru_.back());
+    DCHECK(it != cache_.end());
+    cache_statistics_.size -= it->second.first->data_.size();
+    cache_.erase(it);
+    cache_lru_.pop_back();
+  }
+  cache_statistics_.entry_count = cache_.size();
+}
+
+void CefResourceManager::ClearCacheInternal() {
+  CEF_REQUIRE_IO_THREAD();
+  cache_.clear();
+  cache_lru_.clear();
+  cache_statistics_.entry_count = 0;
+  cache_statistics_.size = 0;
+}
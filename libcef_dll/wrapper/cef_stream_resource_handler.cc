@@ -104,7 +104,9 @@ CefStreamResourceHandler::CefStreamResourceHandler(
       status_text_(status_text),
       mime_type_(mime_type),
       header_map_(header_map),
-      stream_(stream)
+      stream_(stream),
+      data_block_offset_(0),
+      data_block_returned_(false)
 #ifndef NDEBUG
       , buffer_owned_by_file_thread_(false)
 #endif
@@ -114,6 +116,46 @@ CefStreamResourceHandler::CefStreamResourceHandler(
   read_on_file_thread_ = stream_->MayBlock();
 }
 
+CefStreamResourceHandler::CefStreamResourceHandler(
+    const CefString& mime_type,
+    CefRefPtr<CefResourceDataBlock> data_block)
+    : status_code_(200),
+      status_text_("OK"),
+      mime_type_(mime_type),
+      read_on_file_thread_(false),
+      data_block_(data_block),
+      data_block_offset_(0),
+      data_block_returned_(false)
+#ifndef NDEBUG
+      , buffer_owned_by_file_thread_(false)
+#endif
+{
+  DCHECK(!mime_type_.empty());
+  DCHECK(data_block_.get());
+}
+
+CefStreamResourceHandler::CefStreamResourceHandler(
+    int status_code,
+    const CefString& status_text,
+    const CefString& mime_type,
+    CefResponse::HeaderMap header_map,
+    CefRefPtr<CefResourceDataBlock> data_block)
+    : status_code_(status_code),
+      status_text_(status_text),
+      mime_type_(mime_type),
+      header_map_(header_map),
+      read_on_file_thread_(false),
+      data_block_(data_block),
+      data_block_offset_(0),
+      data_block_returned_(false)
+#ifndef NDEBUG
+      , buffer_owned_by_file_thread_(false)
+#endif
+{
+  DCHECK(!mime_type_.empty());
+  DCHECK(data_block_.get());
+}
+
 CefStreamResourceHandler::~CefStreamResourceHandler() {
 }
 
@@ -134,7 +176,10 @@ void CefStreamResourceHandler::GetResponseHeaders(
   if (!header_map_.empty())
     response->SetHeaderMap(header_map_);
 
-  response_length = -1;
+  if (data_block_.get())
+    response_length = static_cast<int64>(data_block_->GetSize());
+  else
+    response_length = -1;
 }
 
 bool CefStreamResourceHandler::ReadResponse(void* data_out,
@@ -143,6 +188,24 @@ bool CefStreamResourceHandler::ReadResponse(void* data_out,
                                             CefRefPtr<CefCallback> callback) {
   DCHECK_GT(bytes_to_read, 0);
 
+  if (data_block_.get()) {
+    // Copy from the data block. Only used if GetResponseDataBlock() was not
+    // called, for example when this object is wrapped by another handler.
+    DCHECK(!data_block_returned_);
+    const size_t size = data_block_->GetSize();
+    bytes_read = static_cast<int>(
+        std::min(static_cast<size_t>(bytes_to_read),
+                 size - std::min(size, data_block_offset_)));
+    if (bytes_read > 0) {
+      memcpy(data_out,
+             static_cast<const char*>(data_block_->GetData()) +
+                 data_block_offset_,
+             bytes_read);
+      data_block_offset_ += bytes_read;
+    }
+    return (bytes_read > 0);
+  }
+
   if (read_on_file_thread_) {
 #ifndef NDEBUG
     DCHECK(!buffer_owned_by_file_thread_);
@@ -184,6 +247,15 @@ bool CefStreamResourceHandler::ReadResponse(void* data_out,
   }
 }
 
+CefRefPtr<CefResourceDataBlock>
+    CefStreamResourceHandler::GetResponseDataBlock() {
+  // Return the data block a single time if ReadResponse() has not been used.
+  if (!data_block_.get() || data_block_returned_ || data_block_offset_ > 0)
+    return NULL;
+  data_block_returned_ = true;
+  return data_block_;
+}
+
 void CefStreamResourceHandler::Cancel() {
 }
 
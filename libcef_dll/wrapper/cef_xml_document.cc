@@ -0,0 +1,790 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include "include/wrapper/cef_xml_document.h"
+
+#include <algorithm>
+#include <new>
+#include <sstream>
+
+#include "include/base/cef_logging.h"
+#include "include/cef_stream.h"
+
+namespace {
+
+// Number of bytes read from the stream at a time by CefXmlSaxParser::Parse.
+const size_t kReadChunkSize = 64 * 1024;
+
+// Size of the memory blocks allocated by CefXmlDocument. Larger allocations
+// receive a dedicated block.
+const size_t kBlockSize = 64 * 1024;
+const size_t kMaxBlockAllocation = kBlockSize / 4;
+
+// Initial size of the interned name table. Must be a power of 2.
+const size_t kInitialNameTableSize = 64;
+
+const char kAbortedError[] = "Parsing stopped by handler";
+
+bool IsWhitespace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+bool IsWhitespace(const char* data, size_t length) {
+  for (size_t i = 0; i < length; ++i) {
+    if (!IsWhitespace(data[i]))
+      return false;
+  }
+  return true;
+}
+
+const char* SkipWhitespace(const char* pos, const char* end) {
+  while (pos < end && IsWhitespace(*pos))
+    ++pos;
+  return pos;
+}
+
+bool IsNameStartChar(unsigned char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' ||
+         c == ':' || c >= 0x80;
+}
+
+bool IsNameChar(unsigned char c) {
+  return IsNameStartChar(c) || (c >= '0' && c <= '9') || c == '-' ||
+         c == '.';
+}
+
+// Returns the end of the name starting at |pos|. Returns |pos| if there is no
+// valid name.
+const char* ScanName(const char* pos, const char* end) {
+  if (pos == end || !IsNameStartChar(*pos))
+    return pos;
+  ++pos;
+  while (pos < end && IsNameChar(*pos))
+    ++pos;
+  return pos;
+}
+
+void AppendUTF8(unsigned int code_point, std::string* output) {
+  if (code_point < 0x80) {
+    output->push_back(static_cast<char>(code_point));
+  } else if (code_point < 0x800) {
+    output->push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+    output->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else if (code_point < 0x10000) {
+    output->push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+    output->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    output->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  } else {
+    output->push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+    output->push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+    output->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    output->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  }
+}
+
+// Append the value of the entity or character reference |name| (without the
+// surrounding '&' and ';') to |output|. Returns false if |name| is invalid.
+bool AppendEntity(const CefXmlStringRef& name, std::string* output) {
+  if (name.Equals("lt")) {
+    output->push_back('<');
+  } else if (name.Equals("gt")) {
+    output->push_back('>');
+  } else if (name.Equals("amp")) {
+    output->push_back('&');
+  } else if (name.Equals("apos")) {
+    output->push_back('\'');
+  } else if (name.Equals("quot")) {
+    output->push_back('"');
+  } else if (name.length > 1 && name.data[0] == '#') {
+    const bool hex = (name.data[1] == 'x');
+    const size_t start = hex ? 2 : 1;
+    if (start == name.length || name.length - start > 8)
+      return false;
+
+    unsigned int code_point = 0;
+    for (size_t i = start; i < name.length; ++i) {
+      const char c = name.data[i];
+      unsigned int digit;
+      if (c >= '0' && c <= '9')
+        digit = c - '0';
+      else if (hex && c >= 'a' && c <= 'f')
+        digit = c - 'a' + 10;
+      else if (hex && c >= 'A' && c <= 'F')
+        digit = c - 'A' + 10;
+      else
+        return false;
+      code_point = code_point * (hex ? 16 : 10) + digit;
+    }
+
+    if (code_point == 0 || code_point > 0x10FFFF ||
+        (code_point >= 0xD800 && code_point <= 0xDFFF)) {
+      return false;
+    }
+    AppendUTF8(code_point, output);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// Append |data| to |output| with line endings normalized to '\n'.
+void AppendNormalizedLineEndings(const char* data, size_t length,
+                                 std::string* output) {
+  const char* end = data + length;
+  const char* run = data;
+  for (const char* pos = data; pos < end; ++pos) {
+    if (*pos != '\r')
+      continue;
+    output->append(run, pos - run);
+    output->push_back('\n');
+    if (pos + 1 < end && pos[1] == '\n')
+      ++pos;
+    run = pos + 1;
+  }
+  output->append(run, end - run);
+}
+
+// FNV-1a.
+size_t HashName(const char* name, size_t length) {
+  size_t hash = 2166136261U;
+  for (size_t i = 0; i < length; ++i) {
+    hash ^= static_cast<unsigned char>(name[i]);
+    hash *= 16777619U;
+  }
+  return hash;
+}
+
+}  // namespace
+
+
+// CefXmlSaxParser
+
+CefXmlSaxParser::CefXmlSaxParser(CefXmlSaxHandler* handler)
+    : handler_(handler),
+      pos_(0),
+      search_pos_(0),
+      started_(false),
+      has_root_(false),
+      failed_(false),
+      line_number_(1) {
+  DCHECK(handler_);
+}
+
+CefXmlSaxParser::~CefXmlSaxParser() {
+}
+
+bool CefXmlSaxParser::Push(const char* data, size_t size) {
+  if (failed_)
+    return false;
+
+  buffer_.append(data, size);
+  const bool result = ParseBuffer(false);
+
+  // Discard the parsed data.
+  if (pos_ > 0) {
+    buffer_.erase(0, pos_);
+    search_pos_ -= pos_;
+    pos_ = 0;
+  }
+  return result;
+}
+
+bool CefXmlSaxParser::Finish() {
+  if (failed_ || !ParseBuffer(true))
+    return false;
+
+  if (!open_name_offsets_.empty()) {
+    return SetError("Premature end of data in tag " +
+                    open_names_.substr(open_name_offsets_.back()));
+  }
+  if (!has_root_)
+    return SetError("Document is empty");
+  return true;
+}
+
+bool CefXmlSaxParser::Parse(CefRefPtr<CefStreamReader> stream) {
+  DCHECK(stream.get());
+
+  std::vector<char> chunk(kReadChunkSize);
+  while (true) {
+    const size_t read = stream->Read(&chunk[0], 1, chunk.size());
+    if (read == 0)
+      break;
+    if (!Push(&chunk[0], read))
+      return false;
+  }
+  return Finish();
+}
+
+bool CefXmlSaxParser::ParseBuffer(bool final) {
+  if (failed_)
+    return false;
+
+  if (!started_) {
+    // Skip the UTF-8 byte order mark.
+    const PrefixMatch bom = MatchPrefix("\xEF\xBB\xBF", final);
+    if (bom == PREFIX_NEED_MORE)
+      return true;
+    if (bom == PREFIX_MATCH)
+      Consume(pos_ + 3);
+    started_ = true;
+  }
+
+  while (pos_ < buffer_.size()) {
+    size_t end;
+
+    if (buffer_[pos_] != '<') {
+      end = FindTerminator("<", pos_);
+      if (end == std::string::npos) {
+        if (!final)
+          break;
+        end = buffer_.size();
+      }
+      if (!HandleText(pos_, end, false))
+        return false;
+      Consume(end);
+      continue;
+    }
+
+    // Markup. Wait for more data if the type cannot be determined yet.
+    PrefixMatch match;
+    if ((match = MatchPrefix("<?", final)) != PREFIX_NO_MATCH) {
+      if (match == PREFIX_NEED_MORE)
+        break;
+      // Processing instruction or XML declaration.
+      end = FindTerminator("?>", pos_ + 2);
+      if (end == std::string::npos)
+        break;
+      Consume(end + 2);
+    } else if ((match = MatchPrefix("<!--", final)) != PREFIX_NO_MATCH) {
+      if (match == PREFIX_NEED_MORE)
+        break;
+      end = FindTerminator("-->", pos_ + 4);
+      if (end == std::string::npos)
+        break;
+      Consume(end + 3);
+    } else if ((match = MatchPrefix("<![CDATA[", final)) != PREFIX_NO_MATCH) {
+      if (match == PREFIX_NEED_MORE)
+        break;
+      end = FindTerminator("]]>", pos_ + 9);
+      if (end == std::string::npos)
+        break;
+      if (!HandleText(pos_ + 9, end, true))
+        return false;
+      Consume(end + 3);
+    } else if ((match = MatchPrefix("<!DOCTYPE", final)) != PREFIX_NO_MATCH) {
+      if (match == PREFIX_NEED_MORE)
+        break;
+      if (has_root_)
+        return SetError("Misplaced DOCTYPE declaration");
+      end = FindTagEnd(true);
+      if (end == std::string::npos)
+        break;
+      Consume(end + 1);
+    } else if ((match = MatchPrefix("</", final)) != PREFIX_NO_MATCH) {
+      if (match == PREFIX_NEED_MORE)
+        break;
+      end = FindTerminator(">", pos_ + 2);
+      if (end == std::string::npos)
+        break;
+      if (!ParseEndTag(end))
+        return false;
+      Consume(end + 1);
+    } else {
+      end = FindTagEnd(false);
+      if (end == std::string::npos)
+        break;
+      if (!ParseStartTag(end))
+        return false;
+      Consume(end + 1);
+    }
+  }
+
+  if (final && pos_ < buffer_.size())
+    return SetError("Premature end of data");
+  return true;
+}
+
+CefXmlSaxParser::PrefixMatch CefXmlSaxParser::MatchPrefix(const char* prefix,
+                                                          bool final) const {
+  const size_t length = strlen(prefix);
+  const size_t available = std::min(length, buffer_.size() - pos_);
+  if (buffer_.compare(pos_, available, prefix, available) != 0)
+    return PREFIX_NO_MATCH;
+  if (available < length)
+    return final ? PREFIX_NO_MATCH : PREFIX_NEED_MORE;
+  return PREFIX_MATCH;
+}
+
+size_t CefXmlSaxParser::FindTerminator(const char* terminator, size_t from) {
+  const size_t result = buffer_.find(terminator, std::max(from, search_pos_));
+  if (result == std::string::npos) {
+    // The terminator may be split between this data and the next push.
+    const size_t length = strlen(terminator);
+    if (buffer_.size() >= length)
+      search_pos_ = std::max(from, buffer_.size() - length + 1);
+  }
+  return result;
+}
+
+size_t CefXmlSaxParser::FindTagEnd(bool brackets) const {
+  const char* data = buffer_.data();
+  const size_t size = buffer_.size();
+  char quote = 0;
+  int depth = 0;
+  for (size_t i = pos_ + 1; i < size; ++i) {
+    const char c = data[i];
+    if (quote) {
+      if (c == quote)
+        quote = 0;
+    } else if (c == '"' || c == '\'') {
+      quote = c;
+    } else if (brackets && c == '[') {
+      depth++;
+    } else if (brackets && c == ']') {
+      depth--;
+    } else if (c == '>' && depth <= 0) {
+      return i;
+    }
+  }
+  return std::string::npos;
+}
+
+bool CefXmlSaxParser::ParseStartTag(size_t end) {
+  const char* pos = buffer_.data() + pos_ + 1;
+  const char* tag_end = buffer_.data() + end;
+
+  bool empty = false;
+  if (tag_end > pos && tag_end[-1] == '/') {
+    empty = true;
+    --tag_end;
+  }
+
+  const char* name_end = ScanName(pos, tag_end);
+  if (name_end == pos)
+    return SetError("Invalid element name");
+  const CefXmlStringRef name(pos, name_end - pos);
+
+  if (open_name_offsets_.empty()) {
+    if (has_root_)
+      return SetError("Extra content at the end of the document");
+    has_root_ = true;
+  }
+
+  attributes_.clear();
+  attribute_value_offsets_.clear();
+  attribute_values_.clear();
+
+  pos = name_end;
+  while (true) {
+    const char* attr = SkipWhitespace(pos, tag_end);
+    if (attr == tag_end)
+      break;
+    if (attr == pos)
+      return SetError("Attributes must be separated by whitespace");
+
+    const char* attr_name_end = ScanName(attr, tag_end);
+    if (attr_name_end == attr)
+      return SetError("Invalid attribute name");
+
+    const char* value = SkipWhitespace(attr_name_end, tag_end);
+    if (value == tag_end || *value != '=')
+      return SetError("Attribute without value");
+    value = SkipWhitespace(value + 1, tag_end);
+    if (value == tag_end || (*value != '"' && *value != '\''))
+      return SetError("Attribute value must be quoted");
+
+    const char* value_end = static_cast<const char*>(
+        memchr(value + 1, *value, tag_end - value - 1));
+    if (!value_end)
+      return SetError("Unterminated attribute value");
+
+    CefXmlAttributeRef attribute;
+    attribute.name = CefXmlStringRef(attr, attr_name_end - attr);
+    attributes_.push_back(attribute);
+    attribute_value_offsets_.push_back(attribute_values_.size());
+    if (!DecodeText(value + 1, value_end - value - 1, true,
+                    &attribute_values_)) {
+      return false;
+    }
+
+    pos = value_end + 1;
+  }
+
+  // Values are referenced after decoding because |attribute_values_| may be
+  // reallocated as it grows.
+  attribute_value_offsets_.push_back(attribute_values_.size());
+  for (size_t i = 0; i < attributes_.size(); ++i) {
+    attributes_[i].value = CefXmlStringRef(
+        attribute_values_.data() + attribute_value_offsets_[i],
+        attribute_value_offsets_[i + 1] - attribute_value_offsets_[i]);
+  }
+
+  if (!handler_->OnStartElement(name,
+                                attributes_.empty() ? NULL : &attributes_[0],
+                                attributes_.size())) {
+    return SetError(kAbortedError);
+  }
+
+  if (empty) {
+    if (!handler_->OnEndElement(name))
+      return SetError(kAbortedError);
+  } else {
+    open_name_offsets_.push_back(open_names_.size());
+    open_names_.append(name.data, name.length);
+  }
+  return true;
+}
+
+bool CefXmlSaxParser::ParseEndTag(size_t end) {
+  const char* pos = buffer_.data() + pos_ + 2;
+  const char* tag_end = buffer_.data() + end;
+
+  const char* name_end = ScanName(pos, tag_end);
+  if (name_end == pos || SkipWhitespace(name_end, tag_end) != tag_end)
+    return SetError("Invalid end tag");
+  const CefXmlStringRef name(pos, name_end - pos);
+
+  if (open_name_offsets_.empty())
+    return SetError("Unexpected end tag " + name.ToString());
+
+  const size_t offset = open_name_offsets_.back();
+  if (!name.Equals(open_names_.data() + offset, open_names_.size() - offset)) {
+    return SetError("Opening and ending tag mismatch: " +
+                    open_names_.substr(offset) + " and " + name.ToString());
+  }
+
+  if (!handler_->OnEndElement(name))
+    return SetError(kAbortedError);
+
+  open_names_.resize(offset);
+  open_name_offsets_.pop_back();
+  return true;
+}
+
+bool CefXmlSaxParser::HandleText(size_t begin, size_t end, bool cdata) {
+  const char* data = buffer_.data() + begin;
+  const size_t length = end - begin;
+
+  if (open_name_offsets_.empty()) {
+    if (cdata || !IsWhitespace(data, length)) {
+      return SetError(has_root_ ? "Extra content at the end of the document" :
+                                  "Start tag expected");
+    }
+    return true;
+  }
+
+  if (length == 0)
+    return true;
+
+  if (!memchr(data, '\r', length) && (cdata || !memchr(data, '&', length))) {
+    // Report the text directly from the buffer.
+    if (!handler_->OnText(CefXmlStringRef(data, length)))
+      return SetError(kAbortedError);
+    return true;
+  }
+
+  text_.clear();
+  if (cdata)
+    AppendNormalizedLineEndings(data, length, &text_);
+  else if (!DecodeText(data, length, false, &text_))
+    return false;
+
+  if (!handler_->OnText(CefXmlStringRef(text_.data(), text_.size())))
+    return SetError(kAbortedError);
+  return true;
+}
+
+bool CefXmlSaxParser::DecodeText(const char* data, size_t length,
+                                 bool attribute, std::string* output) {
+  const char* end = data + length;
+  const char* run = data;
+  for (const char* pos = data; pos < end; ++pos) {
+    const char c = *pos;
+    if (c == '&') {
+      output->append(run, pos - run);
+      const char* semicolon =
+          static_cast<const char*>(memchr(pos + 1, ';', end - pos - 1));
+      if (!semicolon)
+        return SetError("Unterminated entity reference");
+      const CefXmlStringRef name(pos + 1, semicolon - pos - 1);
+      if (!AppendEntity(name, output))
+        return SetError("Undefined entity " + name.ToString());
+      pos = semicolon;
+      run = pos + 1;
+    } else if (c == '\r') {
+      output->append(run, pos - run);
+      output->push_back(attribute ? ' ' : '\n');
+      if (pos + 1 < end && pos[1] == '\n')
+        ++pos;
+      run = pos + 1;
+    } else if (attribute && (c == '\n' || c == '\t')) {
+      output->append(run, pos - run);
+      output->push_back(' ');
+      run = pos + 1;
+    }
+  }
+  output->append(run, end - run);
+  return true;
+}
+
+void CefXmlSaxParser::Consume(size_t pos) {
+  DCHECK_GE(pos, pos_);
+  const char* data = buffer_.data();
+  const char* end = data + pos;
+  for (const char* line = data + pos_;
+       (line = static_cast<const char*>(memchr(line, '\n', end - line)));
+       ++line) {
+    line_number_++;
+  }
+  pos_ = pos;
+  search_pos_ = pos;
+}
+
+bool CefXmlSaxParser::SetError(const std::string& error) {
+  error_ = error;
+  failed_ = true;
+  return false;
+}
+
+
+// CefXmlDocumentBuilder
+
+// Builds a CefXmlDocument from CefXmlSaxParser notifications.
+class CefXmlDocumentBuilder : public CefXmlSaxHandler {
+ public:
+  explicit CefXmlDocumentBuilder(CefXmlDocument* document)
+      : document_(document) {
+  }
+
+  bool OnStartElement(const CefXmlStringRef& name,
+                      const CefXmlAttributeRef* attributes,
+                      size_t attribute_count) override {
+    CefXmlDocument::Element* element = new(
+        document_->Allocate(sizeof(CefXmlDocument::Element)))
+        CefXmlDocument::Element();
+    element->name_ = document_->InternName(name);
+    element->attributes_ = NULL;
+    element->attribute_count_ = attribute_count;
+    element->parent_ = NULL;
+    element->first_child_ = NULL;
+    element->next_sibling_ = NULL;
+    element->child_count_ = 0;
+
+    if (attribute_count > 0) {
+      CefXmlAttributeRef* element_attributes =
+          static_cast<CefXmlAttributeRef*>(document_->Allocate(
+              sizeof(CefXmlAttributeRef) * attribute_count));
+      for (size_t i = 0; i < attribute_count; ++i) {
+        CefXmlAttributeRef* attribute =
+            new(&element_attributes[i]) CefXmlAttributeRef();
+        attribute->name = document_->InternName(attributes[i].name);
+        attribute->value = document_->CopyString(attributes[i].value);
+      }
+      element->attributes_ = element_attributes;
+    }
+
+    if (stack_.empty()) {
+      document_->root_ = element;
+    } else {
+      Frame& parent = stack_.back();
+      element->parent_ = parent.element;
+      if (parent.last_child)
+        parent.last_child->next_sibling_ = element;
+      else
+        parent.element->first_child_ = element;
+      parent.last_child = element;
+      parent.element->child_count_++;
+    }
+    document_->element_count_++;
+
+    stack_.push_back(Frame(element));
+    // Text buffers are kept for reuse by later elements at the same depth.
+    if (text_.size() < stack_.size())
+      text_.resize(stack_.size());
+    return true;
+  }
+
+  bool OnEndElement(const CefXmlStringRef& name) override {
+    DCHECK(!stack_.empty());
+    std::string& text = text_[stack_.size() - 1];
+    if (!text.empty()) {
+      stack_.back().element->value_ =
+          document_->CopyString(CefXmlStringRef(text.data(), text.size()));
+      text.clear();
+    }
+    stack_.pop_back();
+    return true;
+  }
+
+  bool OnText(const CefXmlStringRef& text) override {
+    DCHECK(!stack_.empty());
+    if (!IsWhitespace(text.data, text.length))
+      text_[stack_.size() - 1].append(text.data, text.length);
+    return true;
+  }
+
+ private:
+  struct Frame {
+    explicit Frame(CefXmlDocument::Element* element)
+        : element(element),
+          last_child(NULL) {}
+
+    CefXmlDocument::Element* element;
+    CefXmlDocument::Element* last_child;
+  };
+
+  CefXmlDocument* document_;
+  std::vector<Frame> stack_;
+  // Text of the open elements indexed by depth.
+  std::vector<std::string> text_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefXmlDocumentBuilder);
+};
+
+
+// CefXmlDocument::Element
+
+bool CefXmlDocument::Element::HasAttribute(const char* name) const {
+  const size_t length = strlen(name);
+  for (size_t i = 0; i < attribute_count_; ++i) {
+    if (attributes_[i].name.Equals(name, length))
+      return true;
+  }
+  return false;
+}
+
+CefXmlStringRef CefXmlDocument::Element::GetAttributeValue(
+    const char* name) const {
+  const size_t length = strlen(name);
+  for (size_t i = 0; i < attribute_count_; ++i) {
+    if (attributes_[i].name.Equals(name, length))
+      return attributes_[i].value;
+  }
+  return CefXmlStringRef();
+}
+
+const CefXmlDocument::Element* CefXmlDocument::Element::FindChild(
+    const char* name) const {
+  const size_t length = strlen(name);
+  for (const Element* child = first_child_; child;
+       child = child->next_sibling_) {
+    if (child->name_.Equals(name, length))
+      return child;
+  }
+  return NULL;
+}
+
+const CefXmlDocument::Element* CefXmlDocument::Element::FindNextSibling(
+    const char* name) const {
+  const size_t length = strlen(name);
+  for (const Element* sibling = next_sibling_; sibling;
+       sibling = sibling->next_sibling_) {
+    if (sibling->name_.Equals(name, length))
+      return sibling;
+  }
+  return NULL;
+}
+
+
+// CefXmlDocument
+
+// static
+CefRefPtr<CefXmlDocument> CefXmlDocument::Load(
+    CefRefPtr<CefStreamReader> stream,
+    CefString* loadError) {
+  DCHECK(stream.get());
+
+  CefRefPtr<CefXmlDocument> document = new CefXmlDocument();
+  CefXmlDocumentBuilder builder(document.get());
+  CefXmlSaxParser parser(&builder);
+  if (!parser.Parse(stream)) {
+    if (loadError) {
+      std::stringstream ss;
+      ss << parser.GetError() << ", line " << parser.GetLineNumber();
+      *loadError = ss.str();
+    }
+    return NULL;
+  }
+  return document;
+}
+
+CefXmlStringRef CefXmlDocument::GetInternedName(const char* name) const {
+  return name_table_[FindNameSlot(name, strlen(name))];
+}
+
+CefXmlDocument::CefXmlDocument()
+    : root_(NULL),
+      element_count_(0),
+      block_pos_(NULL),
+      block_remaining_(0),
+      name_table_(kInitialNameTableSize),
+      name_count_(0) {
+}
+
+CefXmlDocument::~CefXmlDocument() {
+  for (size_t i = 0; i < blocks_.size(); ++i)
+    delete [] blocks_[i];
+}
+
+void* CefXmlDocument::Allocate(size_t size) {
+  // Keep all allocations pointer aligned.
+  size = (size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+
+  if (size > block_remaining_) {
+    if (size > kMaxBlockAllocation) {
+      // Use a dedicated block so that the current block can still be used.
+      char* block = new char[size];
+      blocks_.push_back(block);
+      return block;
+    }
+
+    block_pos_ = new char[kBlockSize];
+    blocks_.push_back(block_pos_);
+    block_remaining_ = kBlockSize;
+  }
+
+  void* result = block_pos_;
+  block_pos_ += size;
+  block_remaining_ -= size;
+  return result;
+}
+
+CefXmlStringRef CefXmlDocument::CopyString(const CefXmlStringRef& str) {
+  if (str.empty())
+    return CefXmlStringRef();
+  char* data = static_cast<char*>(Allocate(str.length));
+  memcpy(data, str.data, str.length);
+  return CefXmlStringRef(data, str.length);
+}
+
+CefXmlStringRef CefXmlDocument::InternName(const CefXmlStringRef& name) {
+  size_t slot = FindNameSlot(name.data, name.length);
+  if (name_table_[slot].data)
+    return name_table_[slot];
+
+  const CefXmlStringRef interned = CopyString(name);
+  name_table_[slot] = interned;
+
+  // Keep the load factor at or below 1/2.
+  if (++name_count_ * 2 > name_table_.size()) {
+    std::vector<CefXmlStringRef> old_table(name_table_.size() * 2);
+    old_table.swap(name_table_);
+    for (size_t i = 0; i < old_table.size(); ++i) {
+      if (old_table[i].data) {
+        name_table_[FindNameSlot(old_table[i].data, old_table[i].length)] =
+            old_table[i];
+      }
+    }
+  }
+  return interned;
+}
+
+size_t CefXmlDocument::FindNameSlot(const char* name, size_t length) const {
+  const size_t mask = name_table_.size() - 1;
+  size_t slot = HashName(name, length) & mask;
+  while (name_table_[slot].data && !name_table_[slot].Equals(name, length))
+    slot = (slot + 1) & mask;
+  return slot;
+}
@@ -4,8 +4,19 @@
 
 #include "include/wrapper/cef_zip_archive.h"
 
-#include <algorithm>
+#include <stddef.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "include/base/cef_basictypes.h"
 #include "include/base/cef_logging.h"
 #include "include/base/cef_macros.h"
 #include "include/base/cef_scoped_ptr.h"
@@ -13,6 +24,15 @@
 #include "include/cef_zip_reader.h"
 #include "include/wrapper/cef_byte_read_handler.h"
 
+#if defined(OS_WIN)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #if defined(OS_LINUX)
 #include <wctype.h>
 #endif
@@ -26,7 +46,51 @@ CefString ToLower(const CefString& str) {
   return wstr;
 }
 
-class CefZipFile : public CefZipArchive::File {
+// Default value for CefZipArchive::SetCacheLimit().
+const size_t kDefaultCacheLimit = 32 * 1024 * 1024;
+
+// Zip format signatures and record sizes.
+const uint32 kLocalFileHeaderSignature = 0x04034b50;
+const uint32 kCentralDirectorySignature = 0x02014b50;
+const uint32 kEndOfCentralDirectorySignature = 0x06054b50;
+const size_t kLocalFileHeaderSize = 30;
+const size_t kCentralDirectoryHeaderSize = 46;
+const size_t kEndOfCentralDirectorySize = 22;
+const size_t kMaxCommentSize = 0xFFFF;
+
+// Zip format values.
+const int kMethodStored = 0;
+const int kFlagEncrypted = 1 << 0;
+
+inline int ReadUInt16(const unsigned char* data) {
+  return data[0] | (data[1] << 8);
+}
+
+inline uint32 ReadUInt32(const unsigned char* data) {
+  return static_cast<uint32>(data[0]) |
+         (static_cast<uint32>(data[1]) << 8) |
+         (static_cast<uint32>(data[2]) << 16) |
+         (static_cast<uint32>(data[3]) << 24);
+}
+
+inline void WriteUInt16(unsigned char* data, int value) {
+  data[0] = static_cast<unsigned char>(value & 0xFF);
+  data[1] = static_cast<unsigned char>((value >> 8) & 0xFF);
+}
+
+inline void WriteUInt32(unsigned char* data, uint32 value) {
+  WriteUInt16(data, static_cast<int>(value & 0xFFFF));
+  WriteUInt16(data + 2, static_cast<int>(value >> 16));
+}
+
+// Base class for all file objects stored in the archive.
+class CefZipFileBase : public CefZipArchive::File {
+ public:
+  // Returns the object that will be given to clients for this file.
+  virtual CefRefPtr<CefZipArchive::File> GetHandle() { return this; }
+};
+
+class CefZipFile : public CefZipFileBase {
  public:
   CefZipFile() : data_size_(0) {}
 
@@ -63,11 +127,621 @@ class CefZipFile : public CefZipArchive::File {
   DISALLOW_COPY_AND_ASSIGN(CefZipFile);
 };
 
+// Read-only memory mapping of an archive file.
+class CefZipMapping : public CefBase {
+ public:
+  static CefRefPtr<CefZipMapping> Create(const CefString& path) {
+    CefRefPtr<CefZipMapping> mapping = new CefZipMapping();
+    if (!mapping->Map(path))
+      return NULL;
+    return mapping;
+  }
+
+  const unsigned char* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  CefZipMapping()
+      : data_(NULL),
+        size_(0)
+#if defined(OS_WIN)
+        , mapping_(NULL)
+#endif
+  {
+  }
+
+  ~CefZipMapping() {
+    if (!data_)
+      return;
+#if defined(OS_WIN)
+    UnmapViewOfFile(data_);
+    CloseHandle(mapping_);
+#else
+    munmap(const_cast<unsigned char*>(data_), size_);
+#endif
+  }
+
+  bool Map(const CefString& path) {
+#if defined(OS_WIN)
+    HANDLE file = CreateFileW(path.ToWString().c_str(), GENERIC_READ,
+                              FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+      return false;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0 ||
+        static_cast<uint64>(file_size.QuadPart) >
+            static_cast<uint64>(static_cast<size_t>(-1))) {
+      CloseHandle(file);
+      return false;
+    }
+
+    // The mapping keeps the file open.
+    mapping_ = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping_)
+      return false;
+
+    void* view = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+      CloseHandle(mapping_);
+      mapping_ = NULL;
+      return false;
+    }
+
+    data_ = static_cast<const unsigned char*>(view);
+    size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+    int fd = open(path.ToString().c_str(), O_RDONLY);
+    if (fd < 0)
+      return false;
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+      close(fd);
+      return false;
+    }
+
+    const size_t size = static_cast<size_t>(file_stat.st_size);
+    void* view = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps the file open.
+    close(fd);
+    if (view == MAP_FAILED)
+      return false;
+
+    data_ = static_cast<const unsigned char*>(view);
+    size_ = size;
+#endif
+    return true;
+  }
+
+  const unsigned char* data_;
+  size_t size_;
+#if defined(OS_WIN)
+  HANDLE mapping_;
+#endif
+
+  IMPLEMENT_REFCOUNTING(CefZipMapping);
+  DISALLOW_COPY_AND_ASSIGN(CefZipMapping);
+};
+
+// File that is read directly from the archive mapping.
+class CefZipMappedFile : public CefZipFileBase {
+ public:
+  CefZipMappedFile(CefRefPtr<CefZipMapping> mapping,
+                   const unsigned char* data,
+                   size_t data_size)
+      : mapping_(mapping),
+        data_(data),
+        data_size_(data_size) {
+  }
+
+  virtual const unsigned char* GetData() const OVERRIDE { return data_; }
+
+  virtual size_t GetDataSize() const OVERRIDE { return data_size_; }
+
+  virtual CefRefPtr<CefStreamReader> GetStreamReader() const OVERRIDE {
+    CefRefPtr<CefReadHandler> handler(
+        new CefByteReadHandler(data_, data_size_, mapping_.get()));
+    return CefStreamReader::CreateForHandler(handler);
+  }
+
+ private:
+  CefRefPtr<CefZipMapping> mapping_;
+  const unsigned char* data_;
+  size_t data_size_;
+
+  IMPLEMENT_REFCOUNTING(CefZipMappedFile);
+  DISALLOW_COPY_AND_ASSIGN(CefZipMappedFile);
+};
+
+// Block of decompressed file data.
+class CefZipData : public CefBase {
+ public:
+  explicit CefZipData(size_t size)
+      : data_(new unsigned char[size]),
+        size_(size) {
+  }
+
+  unsigned char* data() const { return data_.get(); }
+  size_t size() const { return size_; }
+
+ private:
+  scoped_ptr<unsigned char[]> data_;
+  size_t size_;
+
+  IMPLEMENT_REFCOUNTING(CefZipData);
+  DISALLOW_COPY_AND_ASSIGN(CefZipData);
+};
+
+// Entry from the archive central directory.
+struct CefZipEntry {
+  std::string name;
+  int flags;
+  int method;
+  uint32 compressed_size;
+  uint32 uncompressed_size;
+  uint32 local_header_offset;
+  uint32 central_header_offset;
+};
+
+// Presents a single archive entry as a complete archive. The local header and
+// file data are read directly from the mapping at |offset| and are followed by
+// a central directory that only describes that entry. This allows the entry
+// to be decompressed with CefZipReader without scanning the central directory
+// of the original archive.
+class CefZipEntryReadHandler : public CefReadHandler {
+ public:
+  CefZipEntryReadHandler(CefRefPtr<CefZipMapping> mapping,
+                         size_t offset,
+                         size_t size,
+                         const std::vector<unsigned char>& directory)
+      : mapping_(mapping),
+        data_(mapping->data() + offset),
+        data_size_(size),
+        directory_(directory),
+        offset_(0) {
+  }
+
+  virtual size_t Read(void* ptr, size_t size, size_t n) OVERRIDE {
+    base::AutoLock lock_scope(lock_);
+    const size_t total_size = data_size_ + directory_.size();
+    const size_t ret =
+        std::min(n, static_cast<size_t>(total_size - offset_) / size);
+    unsigned char* dest = static_cast<unsigned char*>(ptr);
+    size_t remaining = ret * size;
+    while (remaining > 0) {
+      size_t copy_size;
+      if (offset_ < data_size_) {
+        copy_size = std::min(remaining, data_size_ - offset_);
+        memcpy(dest, data_ + offset_, copy_size);
+      } else {
+        copy_size = remaining;
+        memcpy(dest, &directory_[offset_ - data_size_], copy_size);
+      }
+      dest += copy_size;
+      offset_ += copy_size;
+      remaining -= copy_size;
+    }
+    return ret;
+  }
+
+  virtual int Seek(int64 offset, int whence) OVERRIDE {
+    base::AutoLock lock_scope(lock_);
+    const int64 total_size = data_size_ + directory_.size();
+    int64 new_offset;
+    switch (whence) {
+    case SEEK_CUR:
+      new_offset = static_cast<int64>(offset_) + offset;
+      break;
+    case SEEK_END:
+#if defined(OS_WIN)
+      new_offset = total_size - _abs64(offset);
+#else
+      new_offset = total_size - std::abs(offset);
+#endif
+      break;
+    case SEEK_SET:
+      new_offset = offset;
+      break;
+    default:
+      return -1;
+    }
+
+    if (new_offset < 0 || new_offset > total_size)
+      return -1;
+    offset_ = static_cast<size_t>(new_offset);
+    return 0;
+  }
+
+  virtual int64 Tell() OVERRIDE {
+    base::AutoLock lock_scope(lock_);
+    return offset_;
+  }
+
+  virtual int Eof() OVERRIDE {
+    base::AutoLock lock_scope(lock_);
+    return offset_ >= data_size_ + directory_.size();
+  }
+
+  virtual bool MayBlock() OVERRIDE { return false; }
+
+ private:
+  CefRefPtr<CefZipMapping> mapping_;
+  const unsigned char* data_;
+  size_t data_size_;
+  std::vector<unsigned char> directory_;
+  size_t offset_;
+  base::Lock lock_;
+
+  IMPLEMENT_REFCOUNTING(CefZipEntryReadHandler);
+  DISALLOW_COPY_AND_ASSIGN(CefZipEntryReadHandler);
+};
+
+// Read the central directory of the archive at |data|. Returns false if the
+// archive is invalid or uses unsupported features.
+bool ReadCentralDirectory(const unsigned char* data,
+                          size_t size,
+                          std::vector<CefZipEntry>* entries) {
+  if (size < kEndOfCentralDirectorySize)
+    return false;
+
+  // Search backwards for the end of central directory record. It may be
+  // followed by a variable length comment.
+  const size_t max_record_size = kEndOfCentralDirectorySize + kMaxCommentSize;
+  const size_t min_offset = size > max_record_size ? size - max_record_size : 0;
+  size_t eocd_offset = size - kEndOfCentralDirectorySize;
+  while (ReadUInt32(data + eocd_offset) != kEndOfCentralDirectorySignature) {
+    if (eocd_offset == min_offset)
+      return false;
+    eocd_offset--;
+  }
+
+  const unsigned char* eocd = data + eocd_offset;
+  const int entry_count = ReadUInt16(eocd + 10);
+  const uint32 cd_size = ReadUInt32(eocd + 12);
+  const uint32 cd_offset = ReadUInt32(eocd + 16);
+  if (entry_count == 0xFFFF || cd_offset == 0xFFFFFFFF) {
+    DLOG(ERROR) << "ZIP64 archives are not supported";
+    return false;
+  }
+  if (static_cast<uint64>(cd_offset) + cd_size > eocd_offset)
+    return false;
+
+  const unsigned char* pos = data + cd_offset;
+  const unsigned char* end = pos + cd_size;
+  entries->reserve(entry_count);
+
+  for (int i = 0; i < entry_count; ++i) {
+    if (end - pos < static_cast<ptrdiff_t>(kCentralDirectoryHeaderSize) ||
+        ReadUInt32(pos) != kCentralDirectorySignature) {
+      return false;
+    }
+
+    const size_t name_length = ReadUInt16(pos + 28);
+    const size_t extra_length = ReadUInt16(pos + 30);
+    const size_t comment_length = ReadUInt16(pos + 32);
+    const size_t record_size = kCentralDirectoryHeaderSize + name_length +
+                               extra_length + comment_length;
+    if (static_cast<size_t>(end - pos) < record_size)
+      return false;
+
+    CefZipEntry entry;
+    entry.central_header_offset = static_cast<uint32>(pos - data);
+    entry.flags = ReadUInt16(pos + 8);
+    entry.method = ReadUInt16(pos + 10);
+    entry.compressed_size = ReadUInt32(pos + 20);
+    entry.uncompressed_size = ReadUInt32(pos + 24);
+    entry.local_header_offset = ReadUInt32(pos + 42);
+    entry.name.assign(
+        reinterpret_cast<const char*>(pos + kCentralDirectoryHeaderSize),
+        name_length);
+    entries->push_back(entry);
+
+    pos += record_size;
+  }
+
+  return true;
+}
+
+// Returns the location of the data for |entry| if it can be read directly
+// from the archive mapping or NULL otherwise.
+const unsigned char* GetMappedData(const unsigned char* data,
+                                   size_t size,
+                                   const CefZipEntry& entry) {
+  if (entry.method != kMethodStored || (entry.flags & kFlagEncrypted) ||
+      entry.compressed_size != entry.uncompressed_size) {
+    return NULL;
+  }
+
+  const uint64 header_offset = entry.local_header_offset;
+  if (header_offset + kLocalFileHeaderSize > size)
+    return NULL;
+
+  const unsigned char* header = data + header_offset;
+  if (ReadUInt32(header) != kLocalFileHeaderSignature)
+    return NULL;
+
+  // The local header name and extra field lengths may differ from the
+  // central directory.
+  const uint64 data_offset = header_offset + kLocalFileHeaderSize +
+                             ReadUInt16(header + 26) + ReadUInt16(header + 28);
+  if (data_offset + entry.uncompressed_size > size)
+    return NULL;
+
+  return data + data_offset;
+}
+
+// Creates a stream that contains |entry| as the only file of an archive.
+// Returns NULL if the local header of |entry| is invalid.
+CefRefPtr<CefStreamReader> CreateEntryStream(CefRefPtr<CefZipMapping> mapping,
+                                             const CefZipEntry& entry) {
+  const unsigned char* data = mapping->data();
+  const size_t size = mapping->size();
+
+  const uint64 header_offset = entry.local_header_offset;
+  if (header_offset + kLocalFileHeaderSize > size)
+    return NULL;
+
+  const unsigned char* header = data + header_offset;
+  if (ReadUInt32(header) != kLocalFileHeaderSignature)
+    return NULL;
+
+  // Include the local header and the compressed data. The optional data
+  // descriptor is not needed because the central directory record provides
+  // the sizes and CRC.
+  const uint64 entry_size = kLocalFileHeaderSize + ReadUInt16(header + 26) +
+                            ReadUInt16(header + 28) + entry.compressed_size;
+  if (header_offset + entry_size > size)
+    return NULL;
+
+  // Copy the central directory record without the extra field and comment,
+  // and point it at the start of the stream.
+  const size_t name_length = entry.name.size();
+  const size_t record_size = kCentralDirectoryHeaderSize + name_length;
+  std::vector<unsigned char> directory(record_size +
+                                       kEndOfCentralDirectorySize);
+  memcpy(&directory[0], data + entry.central_header_offset, record_size);
+  unsigned char* record = &directory[0];
+  WriteUInt16(record + 30, 0);
+  WriteUInt16(record + 32, 0);
+  WriteUInt16(record + 34, 0);
+  WriteUInt32(record + 42, 0);
+
+  unsigned char* eocd = record + record_size;
+  WriteUInt32(eocd, kEndOfCentralDirectorySignature);
+  WriteUInt16(eocd + 4, 0);
+  WriteUInt16(eocd + 6, 0);
+  WriteUInt16(eocd + 8, 1);
+  WriteUInt16(eocd + 10, 1);
+  WriteUInt32(eocd + 12, static_cast<uint32>(record_size));
+  WriteUInt32(eocd + 16, static_cast<uint32>(entry_size));
+  WriteUInt16(eocd + 20, 0);
+
+  CefRefPtr<CefReadHandler> handler(
+      new CefZipEntryReadHandler(mapping, static_cast<size_t>(header_offset),
+                                 static_cast<size_t>(entry_size), directory));
+  return CefStreamReader::CreateForHandler(handler);
+}
+
 }  // namespace
 
+
+// Cache of decompressed data for files loaded with LoadMapped(). Files that
+// are not read directly from the mapping are represented by an Entry object
+// in the archive and a Handle object for each client that requests them.
+class CefZipArchive::DecompressedCache
+    : public base::RefCountedThreadSafe<CefZipArchive::DecompressedCache> {
+ public:
+  // File entry stored in the archive contents map.
+  class Entry : public CefZipFileBase {
+   public:
+    Entry(scoped_refptr<DecompressedCache> cache,
+          CefRefPtr<CefZipMapping> mapping,
+          const CefZipEntry& entry,
+          const CefString& password)
+        : cache_(cache),
+          mapping_(mapping),
+          entry_(entry),
+          password_(password),
+          data_size_(entry.uncompressed_size) {
+    }
+
+    ~Entry() {
+      cache_->Remove(this);
+    }
+
+    // Returns the decompressed data, reading from the cache if possible.
+    CefRefPtr<CefZipData> GetDecompressedData() {
+      CefRefPtr<CefZipData> data = cache_->Get(this);
+      if (data.get())
+        return data;
+
+      data = Decompress();
+      if (data.get())
+        cache_->Add(this, data);
+      return data;
+    }
+
+    virtual CefRefPtr<CefZipArchive::File> GetHandle() OVERRIDE {
+      return new Handle(this);
+    }
+
+    // Entry objects are never given to clients.
+    virtual const unsigned char* GetData() const OVERRIDE {
+      NOTREACHED();
+      return NULL;
+    }
+
+    virtual size_t GetDataSize() const OVERRIDE { return data_size_; }
+
+    virtual CefRefPtr<CefStreamReader> GetStreamReader() const OVERRIDE {
+      NOTREACHED();
+      return NULL;
+    }
+
+   private:
+    CefRefPtr<CefZipData> Decompress() {
+      // Read from the local header that was recorded by LoadMapped() instead
+      // of searching the archive for the file name.
+      CefRefPtr<CefStreamReader> stream = CreateEntryStream(mapping_, entry_);
+      CefRefPtr<CefZipReader> reader;
+      if (stream.get())
+        reader = CefZipReader::Create(stream);
+      if (!reader.get() || !reader->MoveToFirstFile() ||
+          !reader->OpenFile(password_)) {
+        DLOG(ERROR) << "Failed to open archive file " << entry_.name;
+        return NULL;
+      }
+
+      CefRefPtr<CefZipData> data = new CefZipData(data_size_);
+      size_t offset = 0;
+
+      // Read the file contents.
+      do {
+        const int read = reader->ReadFile(data->data() + offset,
+                                          data_size_ - offset);
+        if (read <= 0)
+          break;
+        offset += read;
+      } while (offset < data_size_ && !reader->Eof());
+
+      reader->CloseFile();
+
+      if (offset != data_size_) {
+        DLOG(ERROR) << "Failed to read archive file " << entry_.name;
+        return NULL;
+      }
+      return data;
+    }
+
+    scoped_refptr<DecompressedCache> cache_;
+    CefRefPtr<CefZipMapping> mapping_;
+    const CefZipEntry entry_;
+    CefString password_;
+    size_t data_size_;
+
+    IMPLEMENT_REFCOUNTING(Entry);
+    DISALLOW_COPY_AND_ASSIGN(Entry);
+  };
+
+  // File object given to clients. Keeps the decompressed data alive after it
+  // has been retrieved.
+  class Handle : public CefZipArchive::File {
+   public:
+    explicit Handle(CefRefPtr<Entry> entry)
+        : entry_(entry) {
+    }
+
+    virtual const unsigned char* GetData() const OVERRIDE {
+      CefRefPtr<CefZipData> data = GetDecompressedData();
+      return data.get() ? data->data() : NULL;
+    }
+
+    virtual size_t GetDataSize() const OVERRIDE {
+      return entry_->GetDataSize();
+    }
+
+    virtual CefRefPtr<CefStreamReader> GetStreamReader() const OVERRIDE {
+      CefRefPtr<CefZipData> data = GetDecompressedData();
+      if (!data.get())
+        return NULL;
+      CefRefPtr<CefReadHandler> handler(
+          new CefByteReadHandler(data->data(), data->size(), data.get()));
+      return CefStreamReader::CreateForHandler(handler);
+    }
+
+   private:
+    CefRefPtr<CefZipData> GetDecompressedData() const {
+      base::AutoLock lock_scope(lock_);
+      if (!data_.get())
+        data_ = entry_->GetDecompressedData();
+      return data_;
+    }
+
+    CefRefPtr<Entry> entry_;
+    mutable CefRefPtr<CefZipData> data_;
+    mutable base::Lock lock_;
+
+    IMPLEMENT_REFCOUNTING(Handle);
+    DISALLOW_COPY_AND_ASSIGN(Handle);
+  };
+
+  DecompressedCache()
+      : limit_(kDefaultCacheLimit),
+        size_(0) {
+  }
+
+  void SetLimit(size_t limit) {
+    base::AutoLock lock_scope(lock_);
+    limit_ = limit;
+    EvictIfNecessary(0);
+  }
+
+ private:
+  friend class base::RefCountedThreadSafe<DecompressedCache>;
+
+  typedef std::list<std::pair<const Entry*, CefRefPtr<CefZipData> > > LRUList;
+  typedef std::map<const Entry*, LRUList::iterator> EntryMap;
+
+  ~DecompressedCache() {}
+
+  // Returns the cached data for |entry| and marks it as most recently used.
+  CefRefPtr<CefZipData> Get(const Entry* entry) {
+    base::AutoLock lock_scope(lock_);
+    EntryMap::iterator it = entries_.find(entry);
+    if (it == entries_.end())
+      return NULL;
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->second;
+  }
+
+  void Add(const Entry* entry, CefRefPtr<CefZipData> data) {
+    base::AutoLock lock_scope(lock_);
+    if (data->size() > limit_ || entries_.find(entry) != entries_.end())
+      return;
+
+    EvictIfNecessary(data->size());
+    lru_.push_front(std::make_pair(entry, data));
+    entries_.insert(std::make_pair(entry, lru_.begin()));
+    size_ += data->size();
+  }
+
+  void Remove(const Entry* entry) {
+    base::AutoLock lock_scope(lock_);
+    EntryMap::iterator it = entries_.find(entry);
+    if (it == entries_.end())
+      return;
+    size_ -= it->second->second->size();
+    lru_.erase(it->second);
+    entries_.erase(it);
+  }
+
+  // Evict least recently used data until |new_size| additional bytes fit
+  // within the limit.
+  void EvictIfNecessary(size_t new_size) {
+    lock_.AssertAcquired();
+    while (!lru_.empty() && size_ + new_size > limit_) {
+      size_ -= lru_.back().second->size();
+      entries_.erase(lru_.back().first);
+      lru_.pop_back();
+    }
+  }
+
+  size_t limit_;
+  size_t size_;
+  LRUList lru_;
+  EntryMap entries_;
+  base::Lock lock_;
+
+  DISALLOW_COPY_AND_ASSIGN(DecompressedCache);
+};
+
 // CefZipArchive implementation
 
-CefZipArchive::CefZipArchive() {
+CefZipArchive::CefZipArchive()
+    : cache_(new DecompressedCache()) {
 }
 
 CefZipArchive::~CefZipArchive() {
@@ -131,6 +805,62 @@ size_t CefZipArchive::Load(CefRefPtr<CefStreamReader> stream,
   return count;
 }
 
+size_t CefZipArchive::LoadMapped(const CefString& path,
+                                 const CefString& password,
+                                 bool overwriteExisting) {
+  CefRefPtr<CefZipMapping> mapping = CefZipMapping::Create(path);
+  if (!mapping.get())
+    return 0;
+
+  std::vector<CefZipEntry> entries;
+  if (!ReadCentralDirectory(mapping->data(), mapping->size(), &entries))
+    return 0;
+
+  base::AutoLock lock_scope(lock_);
+
+  FileMap::iterator it;
+  size_t count = 0;
+
+  std::vector<CefZipEntry>::const_iterator entry_it = entries.begin();
+  for (; entry_it != entries.end(); ++entry_it) {
+    const CefZipEntry& entry = *entry_it;
+    if (entry.uncompressed_size == 0) {
+      // Skip directories and empty files.
+      continue;
+    }
+
+    const CefString& name = ToLower(entry.name);
+
+    it = contents_.find(name);
+    if (it != contents_.end()) {
+      if (overwriteExisting)
+        contents_.erase(it);
+      else  // Skip files that already exist.
+        continue;
+    }
+
+    CefRefPtr<CefZipFileBase> contents;
+    const unsigned char* data =
+        GetMappedData(mapping->data(), mapping->size(), entry);
+    if (data) {
+      contents = new CefZipMappedFile(mapping, data, entry.uncompressed_size);
+    } else {
+      contents = new DecompressedCache::Entry(cache_, mapping, entry,
+                                              password);
+    }
+    count++;
+
+    // Add the file to the map.
+    contents_.insert(std::make_pair(name, contents.get()));
+  }
+
+  return count;
+}
+
+void CefZipArchive::SetCacheLimit(size_t cache_limit) {
+  cache_->SetLimit(cache_limit);
+}
+
 void CefZipArchive::Clear() {
   base::AutoLock lock_scope(lock_);
   contents_.clear();
@@ -152,7 +882,7 @@ CefRefPtr<CefZipArchive::File> CefZipArchive::GetFile(
   base::AutoLock lock_scope(lock_);
   FileMap::const_iterator it = contents_.find(ToLower(fileName));
   if (it != contents_.end())
-    return it->second;
+    return static_cast<CefZipFileBase*>(it->second.get())->GetHandle();
   return NULL;
 }
 
@@ -168,6 +898,11 @@ bool CefZipArchive::RemoveFile(const CefString& fileName) {
 
 size_t CefZipArchive::GetFiles(FileMap& map) const {
   base::AutoLock lock_scope(lock_);
-  map = contents_;
+  map.clear();
+  FileMap::const_iterator it = contents_.begin();
+  for (; it != contents_.end(); ++it) {
+    map.insert(std::make_pair(it->first,
+        static_cast<CefZipFileBase*>(it->second.get())->GetHandle()));
+  }
   return contents_.size();
 }
@@ -23,6 +23,8 @@ enum CefWrapperType {
   WT_BROWSER,
   WT_BROWSER_HOST,
   WT_BROWSER_PROCESS_HANDLER,
+  WT_CACHE_ENTRY_CALLBACK,
+  WT_CACHE_STATISTICS_CALLBACK,
   WT_CALLBACK,
   WT_CLIENT,
   WT_COMMAND_LINE,
@@ -44,6 +46,7 @@ enum CefWrapperType {
   WT_DRAG_DATA,
   WT_DRAG_HANDLER,
   WT_END_TRACING_CALLBACK,
+  WT_EXPORT_COOKIES_CALLBACK,
   WT_FILE_DIALOG_CALLBACK,
   WT_FIND_HANDLER,
   WT_FOCUS_HANDLER,
@@ -53,6 +56,8 @@ enum CefWrapperType {
   WT_GET_GEOLOCATION_CALLBACK,
   WT_JSDIALOG_CALLBACK,
   WT_JSDIALOG_HANDLER,
+  WT_JSONPARSER_HANDLER,
+  WT_JSONWRITER,
   WT_KEYBOARD_HANDLER,
   WT_LIFE_SPAN_HANDLER,
   WT_LIST_VALUE,
@@ -78,6 +83,7 @@ enum CefWrapperType {
   WT_REQUEST_HANDLER,
   WT_RESOURCE_BUNDLE,
   WT_RESOURCE_BUNDLE_HANDLER,
+  WT_RESOURCE_DATA_BLOCK,
   WT_RESOURCE_HANDLER,
   WT_RESPONSE,
   WT_RUN_CONTEXT_MENU_CALLBACK,
@@ -87,11 +93,14 @@ enum CefWrapperType {
   WT_SCHEME_HANDLER_FACTORY,
   WT_SCHEME_REGISTRAR,
   WT_SET_COOKIE_CALLBACK,
+  WT_SET_COOKIES_CALLBACK,
   WT_STREAM_READER,
   WT_STREAM_WRITER,
+  WT_STRING_CHUNK_VISITOR,
   WT_STRING_VISITOR,
   WT_TASK,
   WT_TASK_RUNNER,
+  WT_TRACE_DATA_CALLBACK,
   WT_TRANSLATOR_TEST,
   WT_TRANSLATOR_TEST_HANDLER,
   WT_TRANSLATOR_TEST_HANDLER_CHILD,
@@ -101,9 +110,11 @@ enum CefWrapperType {
   WT_URLREQUEST,
   WT_URLREQUEST_CLIENT,
   WT_V8ACCESSOR,
+  WT_V8ARRAY_BUFFER_RELEASE_CALLBACK,
   WT_V8CONTEXT,
   WT_V8EXCEPTION,
   WT_V8HANDLER,
+  WT_V8SCRIPT,
   WT_V8STACK_FRAME,
   WT_V8STACK_TRACE,
   WT_V8VALUE,
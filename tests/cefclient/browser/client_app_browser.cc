@@ -82,4 +82,10 @@ void ClientAppBrowser::OnRenderProcessThreadCreated(
     (*it)->OnRenderProcessThreadCreated(this, extra_info);
 }
 
+void ClientAppBrowser::OnScheduleMessagePumpWork(int64 delay_ms) {
+  DelegateSet::iterator it = delegates_.begin();
+  for (; it != delegates_.end(); ++it)
+    (*it)->OnScheduleMessagePumpWork(this, delay_ms);
+}
+
 }  // namespace client
@@ -34,6 +34,10 @@ class ClientAppBrowser : public ClientApp,
     virtual void OnRenderProcessThreadCreated(
         CefRefPtr<ClientAppBrowser> app,
         CefRefPtr<CefListValue> extra_info) {}
+
+    virtual void OnScheduleMessagePumpWork(
+        CefRefPtr<ClientAppBrowser> app,
+        int64 delay_ms) {}
   };
 
   typedef std::set<CefRefPtr<Delegate> > DelegateSet;
@@ -66,6 +70,7 @@ class ClientAppBrowser : public ClientApp,
   CefRefPtr<CefPrintHandler> GetPrintHandler() OVERRIDE {
     return print_handler_;
   }
+  void OnScheduleMessagePumpWork(int64 delay_ms) OVERRIDE;
 
   // Set of supported Delegates.
   DelegateSet delegates_;
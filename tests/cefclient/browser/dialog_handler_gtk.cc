@@ -10,6 +10,7 @@
 #include "include/cef_browser.h"
 #include "include/cef_parser.h"
 #include "include/wrapper/cef_helpers.h"
+#include "cefclient/browser/main_message_loop.h"
 #include "cefclient/browser/root_window.h"
 
 namespace client {
@@ -152,6 +153,48 @@ bool ClientDialogHandlerGtk::OnFileDialog(
     const std::vector<CefString>& accept_filters,
     int selected_accept_filter,
     CefRefPtr<CefFileDialogCallback> callback) {
+  CEF_REQUIRE_UI_THREAD();
+
+  // Remove any modifier flags.
+  FileDialogMode mode_type =
+     static_cast<FileDialogMode>(mode & FILE_DIALOG_TYPE_MASK);
+  if (mode_type != FILE_DIALOG_OPEN &&
+      mode_type != FILE_DIALOG_OPEN_MULTIPLE &&
+      mode_type != FILE_DIALOG_OPEN_FOLDER &&
+      mode_type != FILE_DIALOG_SAVE) {
+    NOTREACHED();
+    return false;
+  }
+
+  OnFileDialogParams params;
+  params.browser = browser;
+  params.mode = mode;
+  params.title = title;
+  params.default_file_path = default_file_path;
+  params.accept_filters = accept_filters;
+  params.selected_accept_filter = selected_accept_filter;
+  params.callback = callback;
+
+  if (!CURRENTLY_ON_MAIN_THREAD()) {
+    // Run the dialog on the main thread.
+    MAIN_POST_CLOSURE(
+        base::Bind(&ClientDialogHandlerGtk::RunFileDialog, this, params));
+  } else {
+    RunFileDialog(params);
+  }
+
+  return true;
+}
+
+void ClientDialogHandlerGtk::RunFileDialog(const OnFileDialogParams& params) {
+  REQUIRE_MAIN_THREAD();
+
+  const FileDialogMode mode = params.mode;
+  const CefString& title = params.title;
+  const CefString& default_file_path = params.default_file_path;
+  const int selected_accept_filter = params.selected_accept_filter;
+  CefRefPtr<CefFileDialogCallback> callback = params.callback;
+
   std::vector<CefString> files;
 
   GtkFileChooserAction action;
@@ -167,12 +210,9 @@ bool ClientDialogHandlerGtk::OnFileDialog(
   } else if (mode_type == FILE_DIALOG_OPEN_FOLDER) {
     action = GTK_FILE_CHOOSER_ACTION_SELECT_FOLDER;
     accept_button = GTK_STOCK_OPEN;
-  } else if (mode_type == FILE_DIALOG_SAVE) {
+  } else {
     action = GTK_FILE_CHOOSER_ACTION_SAVE;
     accept_button = GTK_STOCK_SAVE;
-  } else {
-    NOTREACHED();
-    return false;
   }
 
   std::string title_str;
@@ -197,7 +237,7 @@ bool ClientDialogHandlerGtk::OnFileDialog(
     }
   }
 
-  GtkWidget* window = GetWindow(browser);
+  GtkWidget* window = GetWindow(params.browser);
   DCHECK(window);
 
   GtkWidget* dialog = gtk_file_chooser_dialog_new(
@@ -243,7 +283,8 @@ bool ClientDialogHandlerGtk::OnFileDialog(
   }
 
   std::vector<GtkFileFilter*> filters;
-  AddFilters(GTK_FILE_CHOOSER(dialog), accept_filters, true, &filters);
+  AddFilters(GTK_FILE_CHOOSER(dialog), params.accept_filters, true,
+             &filters);
   if (selected_accept_filter < static_cast<int>(filters.size())) {
     gtk_file_chooser_set_filter(GTK_FILE_CHOOSER(dialog),
                                 filters[selected_accept_filter]);
@@ -293,8 +334,6 @@ bool ClientDialogHandlerGtk::OnFileDialog(
     callback->Continue(filter_index, files);
   else
     callback->Cancel();
-
-  return true;
 }
 
 bool ClientDialogHandlerGtk::OnJSDialog(
@@ -308,6 +347,31 @@ bool ClientDialogHandlerGtk::OnJSDialog(
     bool& suppress_message) {
   CEF_REQUIRE_UI_THREAD();
 
+  OnJSDialogParams params;
+  params.browser = browser;
+  params.origin_url = origin_url;
+  params.accept_lang = accept_lang;
+  params.dialog_type = dialog_type;
+  params.message_text = message_text;
+  params.default_prompt_text = default_prompt_text;
+  params.callback = callback;
+
+  if (!CURRENTLY_ON_MAIN_THREAD()) {
+    // Run the dialog on the main thread.
+    MAIN_POST_CLOSURE(
+        base::Bind(&ClientDialogHandlerGtk::RunJSDialog, this, params));
+  } else {
+    RunJSDialog(params);
+  }
+
+  return true;
+}
+
+void ClientDialogHandlerGtk::RunJSDialog(const OnJSDialogParams& params) {
+  REQUIRE_MAIN_THREAD();
+
+  const JSDialogType dialog_type = params.dialog_type;
+
   GtkButtonsType buttons = GTK_BUTTONS_NONE;
   GtkMessageType gtk_message_type = GTK_MESSAGE_OTHER;
   std::string title;
@@ -332,14 +396,15 @@ bool ClientDialogHandlerGtk::OnJSDialog(
       break;
   }
 
-  js_dialog_callback_ = callback;
+  js_dialog_callback_ = params.callback;
 
-  if (!origin_url.empty()) {
+  if (!params.origin_url.empty()) {
     title += " - ";
-    title += CefFormatUrlForSecurityDisplay(origin_url, accept_lang).ToString();
+    title += CefFormatUrlForSecurityDisplay(params.origin_url,
+                                            params.accept_lang).ToString();
   }
 
-  GtkWidget* window = GetWindow(browser);
+  GtkWidget* window = GetWindow(params.browser);
   DCHECK(window);
 
   gtk_dialog_ = gtk_message_dialog_new(GTK_WINDOW(window),
@@ -347,7 +412,7 @@ bool ClientDialogHandlerGtk::OnJSDialog(
                                        gtk_message_type,
                                        buttons,
                                        "%s",
-                                       message_text.ToString().c_str());
+                                       params.message_text.ToString().c_str());
   g_signal_connect(gtk_dialog_,
                    "delete-event",
                    G_CALLBACK(gtk_widget_hide_on_delete),
@@ -367,7 +432,7 @@ bool ClientDialogHandlerGtk::OnJSDialog(
         gtk_dialog_get_content_area(GTK_DIALOG(gtk_dialog_));
     GtkWidget* text_box = gtk_entry_new();
     gtk_entry_set_text(GTK_ENTRY(text_box),
-                       default_prompt_text.ToString().c_str());
+                       params.default_prompt_text.ToString().c_str());
     gtk_box_pack_start(GTK_BOX(content_area), text_box, TRUE, TRUE, 0);
     g_object_set_data(G_OBJECT(gtk_dialog_), kPromptTextId, text_box);
     gtk_entry_set_activates_default(GTK_ENTRY(text_box), TRUE);
@@ -376,8 +441,6 @@ bool ClientDialogHandlerGtk::OnJSDialog(
   gtk_dialog_set_default_response(GTK_DIALOG(gtk_dialog_), GTK_RESPONSE_OK);
   g_signal_connect(gtk_dialog_, "response", G_CALLBACK(OnDialogResponse), this);
   gtk_widget_show_all(GTK_WIDGET(gtk_dialog_));
-
-  return true;
 }
 
 bool ClientDialogHandlerGtk::OnBeforeUnloadDialog(
@@ -396,7 +459,13 @@ bool ClientDialogHandlerGtk::OnBeforeUnloadDialog(
 }
 
 void ClientDialogHandlerGtk::OnResetDialogState(CefRefPtr<CefBrowser> browser) {
-  CEF_REQUIRE_UI_THREAD();
+  if (!CURRENTLY_ON_MAIN_THREAD()) {
+    // Execute this method on the main thread.
+    MAIN_POST_CLOSURE(
+        base::Bind(&ClientDialogHandlerGtk::OnResetDialogState, this,
+                   browser));
+    return;
+  }
 
   if (!gtk_dialog_)
     return;
@@ -409,7 +478,7 @@ void ClientDialogHandlerGtk::OnResetDialogState(CefRefPtr<CefBrowser> browser) {
 void ClientDialogHandlerGtk::OnDialogResponse(GtkDialog* dialog,
                                               gint response_id,
                                               ClientDialogHandlerGtk* handler) {
-  CEF_REQUIRE_UI_THREAD();
+  REQUIRE_MAIN_THREAD();
 
   DCHECK_EQ(dialog, GTK_DIALOG(handler->gtk_dialog_));
   switch (response_id) {
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <gtk/gtk.h>
+#include <vector>
 
 #include "include/cef_dialog_handler.h"
 #include "include/cef_jsdialog_handler.h"
@@ -44,6 +45,33 @@ class ClientDialogHandlerGtk : public CefDialogHandler,
   void OnResetDialogState(CefRefPtr<CefBrowser> browser) OVERRIDE;
 
  private:
+  // Arguments that are passed to the main thread when using multi-threaded
+  // message loop mode.
+  struct OnFileDialogParams {
+    CefRefPtr<CefBrowser> browser;
+    FileDialogMode mode;
+    CefString title;
+    CefString default_file_path;
+    std::vector<CefString> accept_filters;
+    int selected_accept_filter;
+    CefRefPtr<CefFileDialogCallback> callback;
+  };
+
+  struct OnJSDialogParams {
+    CefRefPtr<CefBrowser> browser;
+    CefString origin_url;
+    CefString accept_lang;
+    JSDialogType dialog_type;
+    CefString message_text;
+    CefString default_prompt_text;
+    CefRefPtr<CefJSDialogCallback> callback;
+  };
+
+  // The GTK+ dialogs and the browser's root window are only accessed on the
+  // main thread.
+  void RunFileDialog(const OnFileDialogParams& params);
+  void RunJSDialog(const OnJSDialogParams& params);
+
   static void OnDialogResponse(GtkDialog *dialog,
                                gint response_id,
                                ClientDialogHandlerGtk* handler);
@@ -57,7 +57,7 @@ cef_color_t MainContextImpl::GetBackgroundColor() {
 }
 
 void MainContextImpl::PopulateSettings(CefSettings* settings) {
-#if defined(OS_WIN)
+#if defined(OS_WIN) || defined(OS_LINUX)
   settings->multi_threaded_message_loop =
       command_line_->HasSwitch(switches::kMultiThreadedMessageLoop);
 #endif
@@ -76,6 +76,9 @@ void MainContextImpl::PopulateBrowserSettings(CefBrowserSettings* settings) {
     settings->windowless_frame_rate = atoi(command_line_->
         GetSwitchValue(switches::kOffScreenFrameRate).ToString().c_str());
   }
+
+  if (command_line_->HasSwitch(switches::kOffScreenPartialPaint))
+    settings->windowless_partial_paint = true;
 }
 
 void MainContextImpl::PopulateOsrSettings(OsrRenderer::Settings* settings) {
@@ -0,0 +1,67 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include "cefclient/browser/main_message_loop_multithreaded_gtk.h"
+
+#include <gtk/gtk.h>
+
+#include "include/base/cef_bind.h"
+#include "include/base/cef_logging.h"
+
+namespace client {
+
+MainMessageLoopMultithreadedGtk::MainMessageLoopMultithreadedGtk()
+    : thread_id_(base::PlatformThread::CurrentId()) {
+  // Enable the GDK lock so that GTK+ can be called from the CEF UI thread.
+  // Must be called before gtk_init().
+  gdk_threads_init();
+}
+
+MainMessageLoopMultithreadedGtk::~MainMessageLoopMultithreadedGtk() {
+  DCHECK(RunsTasksOnCurrentThread());
+}
+
+int MainMessageLoopMultithreadedGtk::Run() {
+  DCHECK(RunsTasksOnCurrentThread());
+
+  // GTK+ releases the lock while waiting for events and acquires it before
+  // dispatching them.
+  gdk_threads_enter();
+  gtk_main();
+  gdk_threads_leave();
+
+  return 0;
+}
+
+void MainMessageLoopMultithreadedGtk::Quit() {
+  // Execute gtk_main_quit() on the main thread.
+  PostClosure(base::Bind(gtk_main_quit));
+}
+
+void MainMessageLoopMultithreadedGtk::PostTask(CefRefPtr<CefTask> task) {
+  // Add a reference that will be released in TaskCallback. Tasks posted before
+  // Run() is called will execute once the GTK+ main loop starts.
+  task->AddRef();
+  gdk_threads_add_idle(TaskCallback, task.get());
+}
+
+bool MainMessageLoopMultithreadedGtk::RunsTasksOnCurrentThread() const {
+  return (thread_id_ == base::PlatformThread::CurrentId());
+}
+
+// static
+gboolean MainMessageLoopMultithreadedGtk::TaskCallback(gpointer data) {
+  // Execute the task. The GDK lock is held.
+  CefTask* task = static_cast<CefTask*>(data);
+  task->Execute();
+
+  // Release the reference added in PostTask. This will likely result in |task|
+  // being deleted.
+  task->Release();
+
+  // Remove the idle source.
+  return FALSE;
+}
+
+}  // namespace client
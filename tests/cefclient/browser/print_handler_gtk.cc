@@ -10,6 +10,7 @@
 #include "include/base/cef_logging.h"
 #include "include/base/cef_macros.h"
 #include "include/wrapper/cef_helpers.h"
+#include "cefclient/browser/util_gtk.h"
 
 namespace client {
 
@@ -288,6 +289,8 @@ void ClientPrintHandlerGtk::OnPrintStart(CefRefPtr<CefBrowser> browser) {
 void ClientPrintHandlerGtk::OnPrintSettings(
     CefRefPtr<CefPrintSettings> settings,
     bool get_defaults) {
+  ScopedGdkThreadsEnter scoped_gdk_threads;
+
   if (get_defaults) {
     DCHECK(!page_setup_);
     DCHECK(!printer_);
@@ -359,6 +362,8 @@ void ClientPrintHandlerGtk::OnPrintSettings(
 bool ClientPrintHandlerGtk::OnPrintDialog(
     bool has_selection,
     CefRefPtr<CefPrintDialogCallback> callback) {
+  ScopedGdkThreadsEnter scoped_gdk_threads;
+
   dialog_callback_ = callback;
 
   // TODO(cef): Identify the correct parent window.
@@ -401,6 +406,8 @@ bool ClientPrintHandlerGtk::OnPrintJob(
     const CefString& document_name,
     const CefString& pdf_file_path,
     CefRefPtr<CefPrintJobCallback> callback) {
+  ScopedGdkThreadsEnter scoped_gdk_threads;
+
   // If |printer_| is NULL then somehow the GTK printer list changed out under
   // us. In which case, just bail out.
   if (!printer_)
@@ -425,6 +432,8 @@ bool ClientPrintHandlerGtk::OnPrintJob(
 }
 
 void ClientPrintHandlerGtk::OnPrintReset() {
+  ScopedGdkThreadsEnter scoped_gdk_threads;
+
   if (dialog_) {
     gtk_widget_destroy(dialog_);
     dialog_ = NULL;
@@ -444,6 +453,8 @@ void ClientPrintHandlerGtk::OnPrintReset() {
 }
 
 CefSize ClientPrintHandlerGtk::GetPdfPaperSize(int device_units_per_inch) {
+  ScopedGdkThreadsEnter scoped_gdk_threads;
+
   GtkPageSetup* page_setup = gtk_page_setup_new();
 
   float width = gtk_page_setup_get_paper_width(page_setup, GTK_UNIT_INCH);
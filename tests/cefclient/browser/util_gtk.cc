@@ -0,0 +1,24 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include "cefclient/browser/util_gtk.h"
+
+#include <gdk/gdk.h>
+
+#include "cefclient/browser/main_message_loop.h"
+
+namespace client {
+
+ScopedGdkThreadsEnter::ScopedGdkThreadsEnter()
+    : take_lock_(!CURRENTLY_ON_MAIN_THREAD()) {
+  if (take_lock_)
+    gdk_threads_enter();
+}
+
+ScopedGdkThreadsEnter::~ScopedGdkThreadsEnter() {
+  if (take_lock_)
+    gdk_threads_leave();
+}
+
+}  // namespace client
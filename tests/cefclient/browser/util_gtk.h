@@ -0,0 +1,31 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#ifndef CEF_TESTS_CEFCLIENT_BROWSER_UTIL_GTK_H_
+#define CEF_TESTS_CEFCLIENT_BROWSER_UTIL_GTK_H_
+#pragma once
+
+#include "include/base/cef_macros.h"
+
+namespace client {
+
+// Acquires the GDK lock for the lifespan of this object when used on a thread
+// other than the main thread. When using multi-threaded message loop mode GTK+
+// may only be called from the CEF UI thread while holding the lock. Tasks and
+// GTK+ signal handlers on the main thread already hold the lock so this object
+// does nothing there.
+class ScopedGdkThreadsEnter {
+ public:
+  ScopedGdkThreadsEnter();
+  ~ScopedGdkThreadsEnter();
+
+ private:
+  bool take_lock_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedGdkThreadsEnter);
+};
+
+}  // namespace client
+
+#endif  // CEF_TESTS_CEFCLIENT_BROWSER_UTIL_GTK_H_
@@ -20,6 +20,7 @@
 #include "include/wrapper/cef_helpers.h"
 #include "cefclient/browser/client_app_browser.h"
 #include "cefclient/browser/main_context_impl.h"
+#include "cefclient/browser/main_message_loop_multithreaded_gtk.h"
 #include "cefclient/browser/main_message_loop_std.h"
 #include "cefclient/browser/test_runner.h"
 #include "cefclient/common/client_app_other.h"
@@ -89,7 +90,19 @@ int RunMain(int argc, char* argv[]) {
   context->PopulateSettings(&settings);
 
   // Create the main message loop object.
-  scoped_ptr<MainMessageLoop> message_loop(new MainMessageLoopStd);
+  scoped_ptr<MainMessageLoop> message_loop;
+  if (settings.multi_threaded_message_loop) {
+    // The OSR example renders using gtkglext from the CEF UI thread which is
+    // not supported when that thread differs from the GTK+ main thread.
+    if (settings.windowless_rendering_enabled) {
+      LOG(WARNING) << "Off-screen rendering is not supported with "
+                      "multi-threaded message loop mode on Linux";
+      settings.windowless_rendering_enabled = false;
+    }
+    message_loop.reset(new MainMessageLoopMultithreadedGtk);
+  } else {
+    message_loop.reset(new MainMessageLoopStd);
+  }
 
   // Initialize CEF.
   context->Initialize(main_args, settings, app, NULL);
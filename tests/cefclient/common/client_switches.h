@@ -12,10 +12,12 @@ namespace client {
 namespace switches {
 
 extern const char kMultiThreadedMessageLoop[];
+extern const char kExternalMessagePump[];
 extern const char kCachePath[];
 extern const char kUrl[];
 extern const char kOffScreenRenderingEnabled[];
 extern const char kOffScreenFrameRate[];
+extern const char kOffScreenPartialPaint[];
 extern const char kTransparentPaintingEnabled[];
 extern const char kShowUpdateRect[];
 extern const char kMouseCursorChangeDisabled[];
@@ -2,6 +2,8 @@
 // reserved. Use of this source code is governed by a BSD-style license that
 // can be found in the LICENSE file.
 
+#include <sstream>
+
 #include "cefclient/renderer/performance_test.h"
 #include "cefclient/renderer/performance_test_setup.h"
 #include "include/cef_v8.h"
@@ -85,6 +87,44 @@ PERF_TEST_FUNC(V8ArrayGetValue) {
   PERF_ITERATIONS_END()
 }
 
+PERF_TEST_FUNC(V8ArrayBufferCreate) {
+  class ReleaseCallback : public CefV8ArrayBufferReleaseCallback {
+   public:
+    ReleaseCallback() {}
+    virtual void ReleaseBuffer(void* buffer) OVERRIDE {}
+    IMPLEMENT_REFCOUNTING(ReleaseCallback);
+  };
+
+  static char buffer[65536];
+  CefRefPtr<CefV8ArrayBufferReleaseCallback> callback = new ReleaseCallback();
+
+  PERF_ITERATIONS_START()
+  CefRefPtr<CefV8Value> value =
+      CefV8Value::CreateArrayBuffer(buffer, sizeof(buffer), callback);
+  PERF_ITERATIONS_END()
+}
+
+PERF_TEST_FUNC(V8ArrayBufferGetData) {
+  class ReleaseCallback : public CefV8ArrayBufferReleaseCallback {
+   public:
+    ReleaseCallback() {}
+    virtual void ReleaseBuffer(void* buffer) OVERRIDE {}
+    IMPLEMENT_REFCOUNTING(ReleaseCallback);
+  };
+
+  static char buffer[65536];
+  CefRefPtr<CefV8Value> value =
+      CefV8Value::CreateArrayBuffer(buffer, sizeof(buffer),
+                                    new ReleaseCallback());
+
+  PERF_ITERATIONS_START()
+  void* data = value->GetArrayBufferData();
+  size_t length = value->GetArrayBufferByteLength();
+  ALLOW_UNUSED_LOCAL(data);
+  ALLOW_UNUSED_LOCAL(length);
+  PERF_ITERATIONS_END()
+}
+
 PERF_TEST_FUNC(V8FunctionCreate) {
   class Handler : public CefV8Handler {
    public:
@@ -152,6 +192,85 @@ PERF_TEST_FUNC(V8FunctionExecuteWithContext) {
   PERF_ITERATIONS_END()
 }
 
+// Handler that reads primitive arguments as a typical binding would.
+class PrimitiveArgsHandler : public CefV8Handler {
+ public:
+  PrimitiveArgsHandler() : sum_(0) {}
+  virtual bool Execute(const CefString& name,
+                       CefRefPtr<CefV8Value> object,
+                       const CefV8ValueList& arguments,
+                       CefRefPtr<CefV8Value>& retval,
+                       CefString& exception) OVERRIDE {
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      if (arguments[i]->IsInt())
+        sum_ += arguments[i]->GetIntValue();
+      else if (arguments[i]->IsDouble())
+        sum_ += arguments[i]->GetDoubleValue();
+      else if (arguments[i]->IsBool())
+        sum_ += arguments[i]->GetBoolValue() ? 1 : 0;
+    }
+    return true;
+  }
+  double sum_;
+  IMPLEMENT_REFCOUNTING(PrimitiveArgsHandler);
+};
+
+PERF_TEST_FUNC(V8FunctionExecuteWithPrimitiveArgs) {
+  CefString name = "name";
+  CefRefPtr<CefV8Value> func =
+      CefV8Value::CreateFunction(name, new PrimitiveArgsHandler());
+  CefRefPtr<CefV8Value> obj = CefV8Context::GetCurrentContext()->GetGlobal();
+  CefV8ValueList args;
+  args.push_back(CefV8Value::CreateInt(1));
+  args.push_back(CefV8Value::CreateDouble(0.5));
+  args.push_back(CefV8Value::CreateBool(true));
+  args.push_back(CefV8Value::CreateString("str"));
+
+  PERF_ITERATIONS_START()
+  func->ExecuteFunction(obj, args);
+  PERF_ITERATIONS_END()
+}
+
+PERF_TEST_FUNC(V8FunctionExecuteWithObjectArg) {
+  CefString name = "name";
+  CefRefPtr<CefV8Value> func =
+      CefV8Value::CreateFunction(name, new PrimitiveArgsHandler());
+  CefRefPtr<CefV8Value> obj = CefV8Context::GetCurrentContext()->GetGlobal();
+  CefV8ValueList args;
+  args.push_back(CefV8Value::CreateObject(NULL));
+
+  PERF_ITERATIONS_START()
+  func->ExecuteFunction(obj, args);
+  PERF_ITERATIONS_END()
+}
+
+// Calls a native function from a JavaScript loop. This is the path taken by
+// bindings that are called from requestAnimationFrame callbacks and avoids
+// including the cost of ExecuteFunction in the result.
+PERF_TEST_FUNC(V8FunctionCallFromScript) {
+  CefString name = "perfTestFunc";
+  CefRefPtr<CefV8Context> context = CefV8Context::GetCurrentContext();
+  CefRefPtr<CefV8Value> global = context->GetGlobal();
+  global->SetValue(name,
+                   CefV8Value::CreateFunction(name, new PrimitiveArgsHandler()),
+                   V8_PROPERTY_ATTRIBUTE_NONE);
+
+  std::stringstream ss;
+  ss << "for (var i = 0; i < " << iterations << "; ++i) " <<
+        "perfTestFunc(i, 0.5, true, 'str');";
+  CefString jsCode = ss.str();
+  CefRefPtr<CefV8Value> retval;
+  CefRefPtr<CefV8Exception> exception;
+
+  CefTimer timer;
+  timer.Start();
+  context->Eval(jsCode, retval, exception);
+  timer.Stop();
+
+  global->DeleteValue(name);
+  return timer.Delta();
+}
+
 PERF_TEST_FUNC(V8ObjectCreate) {
   PERF_ITERATIONS_START()
   CefRefPtr<CefV8Value> value = CefV8Value::CreateObject(NULL);
@@ -311,9 +430,14 @@ const PerfTestEntry kPerfTests[] = {
   PERF_TEST_ENTRY(V8ArrayCreate),
   PERF_TEST_ENTRY(V8ArraySetValue),
   PERF_TEST_ENTRY(V8ArrayGetValue),
+  PERF_TEST_ENTRY(V8ArrayBufferCreate),
+  PERF_TEST_ENTRY(V8ArrayBufferGetData),
   PERF_TEST_ENTRY(V8FunctionCreate),
   PERF_TEST_ENTRY(V8FunctionExecute),
   PERF_TEST_ENTRY(V8FunctionExecuteWithContext),
+  PERF_TEST_ENTRY(V8FunctionExecuteWithPrimitiveArgs),
+  PERF_TEST_ENTRY(V8FunctionExecuteWithObjectArg),
+  PERF_TEST_ENTRY(V8FunctionCallFromScript),
   PERF_TEST_ENTRY(V8ObjectCreate),
   PERF_TEST_ENTRY(V8ObjectCreateWithAccessor),
   PERF_TEST_ENTRY(V8ObjectSetValue),
@@ -9,6 +9,13 @@ using client::ClientAppBrowser;
 using client::ClientAppRenderer;
 
 void CreateBrowserDelegates(ClientAppBrowser::DelegateSet& delegates) {
+#if defined(OS_LINUX)
+  // Bring in the message pump delegate.
+  extern void CreateMessagePumpBrowserDelegate(
+      ClientAppBrowser::DelegateSet& delegates);
+  CreateMessagePumpBrowserDelegate(delegates);
+#endif
+
   // Bring in the Frame tests.
   extern void CreateFrameBrowserTests(
       ClientAppBrowser::DelegateSet& delegates);
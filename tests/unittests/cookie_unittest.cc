@@ -66,6 +66,51 @@ class TestSetCookieCallback : public CefSetCookieCallback {
   DISALLOW_COPY_AND_ASSIGN(TestSetCookieCallback);
 };
 
+class TestSetCookiesCallback : public CefSetCookiesCallback {
+ public:
+  TestSetCookiesCallback(int expected_num_set,
+                         base::WaitableEvent* event)
+    : expected_num_set_(expected_num_set),
+      event_(event) {}
+
+  void OnComplete(int num_set) override {
+    EXPECT_EQ(expected_num_set_, num_set);
+    event_->Signal();
+  }
+
+ private:
+  int expected_num_set_;
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(TestSetCookiesCallback);
+  DISALLOW_COPY_AND_ASSIGN(TestSetCookiesCallback);
+};
+
+class TestExportCookiesCallback : public CefExportCookiesCallback {
+ public:
+  TestExportCookiesCallback(CefRefPtr<CefBinaryValue>* data,
+                            int expected_num_exported,
+                            base::WaitableEvent* event)
+    : data_(data),
+      expected_num_exported_(expected_num_exported),
+      event_(event) {}
+
+  void OnComplete(CefRefPtr<CefBinaryValue> data,
+                  int num_exported) override {
+    EXPECT_EQ(expected_num_exported_, num_exported);
+    *data_ = data;
+    event_->Signal();
+  }
+
+ private:
+  CefRefPtr<CefBinaryValue>* data_;
+  int expected_num_exported_;
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(TestExportCookiesCallback);
+  DISALLOW_COPY_AND_ASSIGN(TestExportCookiesCallback);
+};
+
 class TestDeleteCookiesCallback : public CefDeleteCookiesCallback {
  public:
   TestDeleteCookiesCallback(int expected_num_deleted,
@@ -127,6 +172,17 @@ void SetCookies(CefRefPtr<CefCookieManager> manager,
   }
 }
 
+// Set the cookies in a single operation.
+void SetCookieLines(CefRefPtr<CefCookieManager> manager,
+                    const CefString& url,
+                    const std::vector<CefString>& lines,
+                    int expected_num_set,
+                    base::WaitableEvent& event) {
+  EXPECT_TRUE(manager->SetCookies(
+      url, lines, new TestSetCookiesCallback(expected_num_set, &event)));
+  event.Wait();
+}
+
 // Delete the cookie.
 void DeleteCookies(CefRefPtr<CefCookieManager> manager,
                    const CefString& url, const CefString& cookie_name,
@@ -211,6 +267,18 @@ void VisitUrlCookies(CefRefPtr<CefCookieManager> manager,
   event.Wait();
 }
 
+// Visit filtered cookies.
+void VisitFilteredCookies(CefRefPtr<CefCookieManager> manager,
+                          const CefString& domain,
+                          const CefString& name,
+                          const CefTime& expires_after,
+                          CookieVector& cookies,
+                          base::WaitableEvent& event) {
+  EXPECT_TRUE(manager->VisitFilteredCookies(domain, name, expires_after,
+      new TestVisitor(&cookies, false, &event)));
+  event.Wait();
+}
+
 // Visit all cookies.
 void VisitAllCookies(CefRefPtr<CefCookieManager> manager,
                      CookieVector& cookies,
@@ -784,6 +852,156 @@ TEST(CookieTest, SessionCookieWillPersist) {
   GetCookie(manager, cookie, true, event, false);
 }
 
+// Create cookies for 3 hosts and verify that the filtered visitor only
+// converts matching cookies.
+TEST(CookieTest, BulkSetAndFilteredVisit) {
+  base::WaitableEvent event(false, false);
+  CookieVector cookies;
+
+  CefRefPtr<CefCookieManager> manager =
+      CefCookieManager::CreateManager(CefString(), false,
+                                      new TestCompletionCallback(&event));
+  event.Wait();
+  EXPECT_TRUE(manager.get());
+
+  std::vector<CefString> lines;
+  lines.push_back("name1=value1");
+  lines.push_back("name2=value2; domain=test.com");
+  lines.push_back("name3=value3; expires=Fri, 11 Apr 2200 00:00:00 GMT");
+  SetCookieLines(manager, "http://www.test.com/", lines, 3, event);
+
+  lines.clear();
+  lines.push_back("name1=value1");
+  lines.push_back("name2=value2");
+  SetCookieLines(manager, "http://www.other.com/", lines, 2, event);
+
+  lines.clear();
+  lines.push_back("name1=value1");
+  SetCookieLines(manager, "http://sub.www.test.com/", lines, 1, event);
+
+  // Visit cookies for test.com and all subdomains.
+  VisitFilteredCookies(manager, "test.com", CefString(), CefTime(), cookies,
+                       event);
+  EXPECT_EQ(4U, cookies.size());
+  cookies.clear();
+
+  // Visit cookies for www.test.com and all subdomains.
+  VisitFilteredCookies(manager, ".www.test.com", CefString(), CefTime(),
+                       cookies, event);
+  EXPECT_EQ(3U, cookies.size());
+  cookies.clear();
+
+  // Partial host names don't match.
+  VisitFilteredCookies(manager, "st.com", CefString(), CefTime(), cookies,
+                       event);
+  EXPECT_EQ(0U, cookies.size());
+  cookies.clear();
+
+  // Visit cookies by name.
+  VisitFilteredCookies(manager, CefString(), "name2", CefTime(), cookies,
+                       event);
+  EXPECT_EQ(2U, cookies.size());
+  cookies.clear();
+
+  // Visit cookies by name and domain.
+  VisitFilteredCookies(manager, "other.com", "name1", CefTime(), cookies,
+                       event);
+  EXPECT_EQ(1U, cookies.size());
+  if (cookies.size() == 1U)
+    EXPECT_EQ(CefString(&cookies[0].domain), "www.other.com");
+  cookies.clear();
+
+  // Visit persistent cookies that expire after 2100.
+  CefTime expires_after;
+  expires_after.year = 2100;
+  expires_after.month = 1;
+  expires_after.day_of_month = 1;
+  VisitFilteredCookies(manager, CefString(), CefString(), expires_after,
+                       cookies, event);
+  EXPECT_EQ(1U, cookies.size());
+  if (cookies.size() == 1U)
+    EXPECT_EQ(CefString(&cookies[0].name), "name3");
+  cookies.clear();
+
+  // Invalid cookie lines are skipped.
+  lines.clear();
+  lines.push_back("name4=value4");
+  lines.push_back("name5=value5; domain=other.com");
+  SetCookieLines(manager, "http://www.test.com/", lines, 1, event);
+}
+
+void TestExportImport(cef_cookie_format_t format) {
+  base::WaitableEvent event(false, false);
+  CookieVector cookies;
+
+  CefRefPtr<CefCookieManager> manager =
+      CefCookieManager::CreateManager(CefString(), false,
+                                      new TestCompletionCallback(&event));
+  event.Wait();
+  EXPECT_TRUE(manager.get());
+
+  CefCookie cookie;
+  CreateCookie(manager, cookie, true, false, event);
+
+  std::vector<CefString> lines;
+  lines.push_back("host_cookie=host value; path=/host; httponly");
+  lines.push_back("secure_cookie=secure value; secure");
+  SetCookieLines(manager, "https://www.other.com/", lines, 2, event);
+
+  CefRefPtr<CefBinaryValue> data;
+  EXPECT_TRUE(manager->ExportCookies(format,
+      new TestExportCookiesCallback(&data, 3, &event)));
+  event.Wait();
+  EXPECT_TRUE(data.get());
+  if (!data.get())
+    return;
+
+  // Import into a new manager.
+  CefRefPtr<CefCookieManager> manager2 =
+      CefCookieManager::CreateManager(CefString(), false,
+                                      new TestCompletionCallback(&event));
+  event.Wait();
+  EXPECT_TRUE(manager2.get());
+
+  EXPECT_TRUE(manager2->ImportCookies(data,
+      new TestSetCookiesCallback(3, &event)));
+  event.Wait();
+
+  // The domain cookie is still a domain cookie.
+  GetCookie(manager2, cookie, true, event, false);
+
+  VisitUrlCookies(manager2, "https://www.other.com/host", true, cookies, false,
+                  event);
+  EXPECT_EQ(2U, cookies.size());
+  if (cookies.size() == 2U) {
+    // Ordered by longest path first.
+    EXPECT_EQ(CefString(&cookies[0].name), "host_cookie");
+    EXPECT_EQ(CefString(&cookies[0].value), "host value");
+    EXPECT_EQ(CefString(&cookies[0].domain), "www.other.com");
+    EXPECT_EQ(CefString(&cookies[0].path), "/host");
+    EXPECT_TRUE(cookies[0].httponly);
+    EXPECT_FALSE(cookies[0].secure);
+    EXPECT_FALSE(cookies[0].has_expires);
+    EXPECT_EQ(CefString(&cookies[1].name), "secure_cookie");
+    EXPECT_EQ(CefString(&cookies[1].value), "secure value");
+    EXPECT_TRUE(cookies[1].secure);
+    EXPECT_FALSE(cookies[1].httponly);
+  }
+
+  // Invalid data is rejected.
+  const char kInvalidData[] = "invalid";
+  EXPECT_FALSE(manager2->ImportCookies(
+      CefBinaryValue::Create(kInvalidData, sizeof(kInvalidData)), NULL));
+}
+
+TEST(CookieTest, ExportImportBinary) {
+  TestExportImport(COOKIE_FORMAT_BINARY);
+}
+
+TEST(CookieTest, ExportImportJSON) {
+  TestExportImport(COOKIE_FORMAT_JSON);
+}
+
 
 namespace {
 
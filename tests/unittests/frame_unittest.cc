@@ -5,8 +5,11 @@
 // Include this first to avoid type conflicts with CEF headers.
 #include "tests/unittests/chromium_includes.h"
 
+#include "base/strings/string_number_conversions.h"
+
 #include "include/base/cef_bind.h"
 #include "include/base/cef_scoped_ptr.h"
+#include "include/cef_string_visitor.h"
 #include "include/wrapper/cef_closure_task.h"
 #include "include/wrapper/cef_stream_resource_handler.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -1842,6 +1845,16 @@ bool VerifyBrowserIframe(CefRefPtr<CefBrowser> browser,
   V_EXPECT_TRUE(idents[1] == frame1->GetIdentifier());
   V_EXPECT_TRUE(idents[2] == frame2->GetIdentifier());
 
+  // Verify the GetFrames result.
+  std::vector<CefRefPtr<CefFrame> > frames;
+  browser->GetFrames(frames);
+  V_EXPECT_TRUE(frames.size() == 3U);
+  if (frames.size() == 3U) {
+    V_EXPECT_TRUE(frames[0]->GetIdentifier() == frame0->GetIdentifier());
+    V_EXPECT_TRUE(frames[1]->GetIdentifier() == frame1->GetIdentifier());
+    V_EXPECT_TRUE(frames[2]->GetIdentifier() == frame2->GetIdentifier());
+  }
+
   // Verify parent hierarchy.
   V_EXPECT_FALSE(frame0->GetParent().get());
   V_EXPECT_TRUE(frame1->GetParent()->GetIdentifier() == frame0id);
@@ -2338,6 +2351,168 @@ scoped_ptr<FrameNavExpectationsFactoryRenderer>
 }  // namespace
 
 
+namespace {
+
+const char kFrameStringUrl[] = "http://tests-frame-string/string.html";
+
+// Returns a document that is large enough to be delivered in multiple chunks.
+// Includes multi-byte characters so that chunk boundaries are exercised.
+std::string GetFrameStringHtml() {
+  std::string html = "<html><body>";
+  for (int i = 0; i < 40000; ++i) {
+    html += "<p>Paragraph " + base::IntToString(i) +
+            " caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80</p>";
+  }
+  html += "</body></html>";
+  return html;
+}
+
+// Compares the result of GetSourceChunked/GetTextChunked against
+// GetSource/GetText.
+class FrameStringTestHandler : public TestHandler {
+ public:
+  // If |cancel_after| is > 0 the chunked request will be canceled after that
+  // many chunks.
+  FrameStringTestHandler(bool text, int cancel_after)
+      : text_(text),
+        cancel_after_(cancel_after),
+        chunk_count_(0) {
+  }
+
+  void RunTest() override {
+    AddResource(kFrameStringUrl, GetFrameStringHtml(), "text/html");
+    CreateBrowser(kFrameStringUrl);
+
+    // Time out the test after a reasonable period of time.
+    SetTestTimeout();
+  }
+
+  void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                 CefRefPtr<CefFrame> frame,
+                 int httpStatusCode) override {
+    if (!frame->IsMain())
+      return;
+
+    // Retrieve the complete value for comparison.
+    if (text_)
+      frame->GetText(new Visitor(this));
+    else
+      frame->GetSource(new Visitor(this));
+  }
+
+ private:
+  class Visitor : public CefStringVisitor {
+   public:
+    explicit Visitor(FrameStringTestHandler* handler) : handler_(handler) {}
+
+    void Visit(const CefString& string) override {
+      handler_->OnString(string);
+    }
+
+   private:
+    CefRefPtr<FrameStringTestHandler> handler_;
+
+    IMPLEMENT_REFCOUNTING(Visitor);
+  };
+
+  class ChunkVisitor : public CefStringChunkVisitor {
+   public:
+    explicit ChunkVisitor(FrameStringTestHandler* handler)
+        : handler_(handler) {}
+
+    bool VisitChunk(const CefString& chunk) override {
+      return handler_->OnChunk(chunk);
+    }
+
+    void OnComplete(bool success) override {
+      handler_->OnComplete(success);
+    }
+
+   private:
+    CefRefPtr<FrameStringTestHandler> handler_;
+
+    IMPLEMENT_REFCOUNTING(ChunkVisitor);
+  };
+
+  void OnString(const std::string& value) {
+    EXPECT_TRUE(CefCurrentlyOn(TID_UI));
+    EXPECT_FALSE(value.empty());
+    expected_ = value;
+
+    CefRefPtr<CefFrame> frame = GetBrowser()->GetMainFrame();
+    if (text_)
+      frame->GetTextChunked(new ChunkVisitor(this));
+    else
+      frame->GetSourceChunked(new ChunkVisitor(this));
+  }
+
+  bool OnChunk(const std::string& chunk) {
+    EXPECT_TRUE(CefCurrentlyOn(TID_UI));
+    EXPECT_FALSE(got_complete_);
+    chunk_count_++;
+    actual_ += chunk;
+    return cancel_after_ == 0 || chunk_count_ < cancel_after_;
+  }
+
+  void OnComplete(bool success) {
+    EXPECT_TRUE(CefCurrentlyOn(TID_UI));
+    EXPECT_FALSE(got_complete_);
+    got_complete_.yes();
+
+    if (cancel_after_ > 0) {
+      EXPECT_FALSE(success);
+      EXPECT_EQ(cancel_after_, chunk_count_);
+      EXPECT_LT(actual_.size(), expected_.size());
+    } else {
+      EXPECT_TRUE(success);
+      EXPECT_GT(chunk_count_, 1);
+      EXPECT_EQ(expected_, actual_);
+    }
+
+    DestroyTest();
+  }
+
+  void DestroyTest() override {
+    EXPECT_TRUE(got_complete_);
+    TestHandler::DestroyTest();
+  }
+
+  const bool text_;
+  const int cancel_after_;
+
+  std::string expected_;
+  std::string actual_;
+  int chunk_count_;
+
+  TrackCallback got_complete_;
+};
+
+}  // namespace
+
+// Test that GetSourceChunked() returns the same value as GetSource().
+TEST(FrameTest, GetSourceChunked) {
+  CefRefPtr<FrameStringTestHandler> handler =
+      new FrameStringTestHandler(false, 0);
+  handler->ExecuteTest();
+  ReleaseAndWaitForDestructor(handler);
+}
+
+// Test that GetTextChunked() returns the same value as GetText().
+TEST(FrameTest, GetTextChunked) {
+  CefRefPtr<FrameStringTestHandler> handler =
+      new FrameStringTestHandler(true, 0);
+  handler->ExecuteTest();
+  ReleaseAndWaitForDestructor(handler);
+}
+
+// Test that a chunked request stops when the visitor returns false.
+TEST(FrameTest, GetSourceChunkedCancel) {
+  CefRefPtr<FrameStringTestHandler> handler =
+      new FrameStringTestHandler(false, 2);
+  handler->ExecuteTest();
+  ReleaseAndWaitForDestructor(handler);
+}
+
 // Entry point for creating frame browser test objects.
 // Called from client_app_delegates.cc.
 void CreateFrameBrowserTests(ClientAppBrowser::DelegateSet& delegates) {
@@ -0,0 +1,154 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+// Include this first to avoid type conflicts with CEF headers.
+#include "tests/unittests/chromium_includes.h"
+
+#include <algorithm>
+#include <string>
+
+#include "base/strings/string_number_conversions.h"
+#include "base/synchronization/waitable_event.h"
+#include "base/threading/platform_thread.h"
+#include "base/time/time.h"
+
+#include "include/cef_task.h"
+#include "include/wrapper/cef_closure_task.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "tests/cefclient/common/client_switches.h"
+#include "tests/unittests/test_message_pump.h"
+#include "tests/unittests/test_suite.h"
+
+// These tests require the external message pump. When the test suite is run
+// without the "external-message-pump" command-line switch each test runs
+// itself in a child process that has the switch.
+
+namespace {
+
+const int64 kDelayMs = 100;
+
+const int kLatencyIterations = 200;
+const int64 kIdleIntervalMs = 1000;
+
+// Poll intervals to compare against scheduled work. 0 means scheduled.
+const int64 kPollIntervalsMs[] = {0, 1, 10, 30};
+
+// Returns true if the current process uses the external message pump and the
+// test should continue. Otherwise, runs the current test in a child process
+// that uses the external message pump, verifies that it succeeds and returns
+// false.
+bool HasMessagePump() {
+  if (!CefTestSuite::RunCurrentTestWithSwitch(
+          client::switches::kExternalMessagePump)) {
+    return false;
+  }
+
+  if (!TestMessagePump::Get()) {
+    ADD_FAILURE() << "External message pump was not created";
+    return false;
+  }
+  return true;
+}
+
+void SignalOnUIThread(base::TimeTicks* time, base::WaitableEvent* event) {
+  EXPECT_TRUE(CefCurrentlyOn(TID_UI));
+  *time = base::TimeTicks::Now();
+  event->Signal();
+}
+
+// Returns the time between posting a task to the UI thread and that task
+// starting to execute.
+base::TimeDelta MeasureUITaskLatency(int64 delay_ms) {
+  base::WaitableEvent event(false, false);
+  base::TimeTicks run_time;
+
+  const base::TimeTicks post_time = base::TimeTicks::Now();
+  if (delay_ms > 0) {
+    CefPostDelayedTask(TID_UI,
+        base::Bind(&SignalOnUIThread, &run_time, &event), delay_ms);
+  } else {
+    CefPostTask(TID_UI, base::Bind(&SignalOnUIThread, &run_time, &event));
+  }
+  event.Wait();
+
+  return run_time - post_time;
+}
+
+}  // namespace
+
+// Test that work posted from another thread is performed.
+TEST(MessagePumpTest, PostTask) {
+  if (!HasMessagePump())
+    return;
+
+  TestMessagePump* message_pump = TestMessagePump::Get();
+  const TestMessagePump::Stats stats = message_pump->GetStats();
+
+  MeasureUITaskLatency(0);
+
+  const TestMessagePump::Stats stats2 = message_pump->GetStats();
+  EXPECT_GT(stats2.schedule_calls, stats.schedule_calls);
+  EXPECT_GT(stats2.work_calls, stats.work_calls);
+}
+
+// Test that delayed work is performed at the requested time and not before.
+TEST(MessagePumpTest, PostDelayedTask) {
+  if (!HasMessagePump())
+    return;
+
+  const base::TimeDelta latency = MeasureUITaskLatency(kDelayMs);
+  EXPECT_GE(latency.InMilliseconds(), kDelayMs);
+}
+
+// Compare UI task latency and idle CPU usage of scheduled work against
+// calling CefDoMessageLoopWork() on a fixed interval. Disabled by default
+// because it takes several seconds. Run with
+// --gtest_also_run_disabled_tests to collect the results.
+TEST(MessagePumpTest, DISABLED_Perf) {
+  if (!HasMessagePump())
+    return;
+
+  TestMessagePump* message_pump = TestMessagePump::Get();
+
+  for (size_t i = 0; i < arraysize(kPollIntervalsMs); ++i) {
+    const int64 interval_ms = kPollIntervalsMs[i];
+    message_pump->SetPollInterval(interval_ms);
+
+    // Allow pending work to settle.
+    base::PlatformThread::Sleep(base::TimeDelta::FromMilliseconds(100));
+
+    // Latency of tasks posted to an idle UI thread.
+    base::TimeDelta total_latency;
+    base::TimeDelta max_latency;
+    for (int j = 0; j < kLatencyIterations; ++j) {
+      const base::TimeDelta latency = MeasureUITaskLatency(0);
+      total_latency += latency;
+      max_latency = std::max(max_latency, latency);
+
+      // Post at varying offsets from the poll interval.
+      base::PlatformThread::Sleep(
+          base::TimeDelta::FromMicroseconds(500 + (j % 7) * 300));
+    }
+
+    // Main thread CPU usage and CefDoMessageLoopWork() calls while idle.
+    const TestMessagePump::Stats stats = message_pump->GetStats();
+    const base::TimeDelta cpu_time = message_pump->GetMainThreadCPUTime();
+    base::PlatformThread::Sleep(
+        base::TimeDelta::FromMilliseconds(kIdleIntervalMs));
+    const TestMessagePump::Stats stats2 = message_pump->GetStats();
+    const base::TimeDelta idle_cpu_time =
+        message_pump->GetMainThreadCPUTime() - cpu_time;
+
+    const std::string& mode = interval_ms == 0 ? std::string("scheduled") :
+        "poll " + base::Int64ToString(interval_ms) + "ms";
+    LOG(INFO) << "MessagePumpTest.Perf: " << mode << ": latency avg " <<
+        (total_latency / kLatencyIterations).InMicroseconds() << "us max " <<
+        max_latency.InMicroseconds() << "us, idle " <<
+        (stats2.work_calls - stats.work_calls) << " work calls and " <<
+        idle_cpu_time.InMicroseconds() << "us CPU in " << kIdleIntervalMs <<
+        "ms";
+  }
+
+  message_pump->SetPollInterval(0);
+}
@@ -2,9 +2,13 @@
 // reserved. Use of this source code is governed by a BSD-style license that
 // can be found in the LICENSE file.
 
+#include <set>
+#include <vector>
+
 // Include this first to avoid type conflicts with CEF headers.
 #include "tests/unittests/chromium_includes.h"
 
+#include "base/strings/stringprintf.h"
 #include "ui/events/keycodes/keyboard_codes.h"
 #include "ui/events/keycodes/keyboard_code_conversion.h"
 #include "ui/gfx/geometry/dip_util.h"
@@ -17,6 +21,7 @@
 #include "include/wrapper/cef_stream_resource_handler.h"
 #include "tests/cefclient/browser/resource_util.h"
 #include "tests/unittests/routing_test_handler.h"
+#include "tests/unittests/test_suite.h"
 
 #if defined(OS_MACOSX)
 #include "tests/unittests/os_rendering_unittest_mac.h"
@@ -126,6 +131,25 @@ const unsigned int kNativeKeyTestCodes[] = {
 // middle mouse button
 const int kMiddleButtonIconWidth = 16;
 
+// Matches cc::switches::kEnableBeginFrameScheduling. Frame pacing modes other
+// than FRAME_PACING_FIXED are only used with this switch.
+const char kEnableBeginFrameScheduling[] = "enable-begin-frame-scheduling";
+
+// frame rate for the frame pacing tests
+const int kFramePacingFrameRate = 30;
+// time to wait without new content while measuring BeginFrames
+const int kFramePacingIdleMs = 2000;
+// interval between calls to SendExternalBeginFrame
+const int kExternalBeginFrameIntervalMs = 16;
+// upper bound for a single frame capture
+const double kMaxCaptureLatencyMs = 1000.0;
+
+// elements added by the partial paint tests, in DIP coordinates
+const CefRect kPartialPaintRect1(20, 20, 40, 40);
+const CefRect kPartialPaintRect2(500, 300, 40, 40);
+// opaque blue in the BGRA pixel format used by OnPaint
+const uint32 kPartialPaintColor = 0xff0000ffU;
+
 // test type
 enum OSRTestType {
   // IsWindowRenderingDisabled should be true
@@ -152,6 +176,17 @@ enum OSRTestType {
   OSR_TEST_RESIZE,
   // Invalidate should trigger repaint synchronously
   OSR_TEST_INVALIDATE,
+  // frame statistics should count delivered frames
+  OSR_TEST_FRAME_STATISTICS,
+  // partial paint should deliver non-overlapping rects that are sufficient
+  // to keep a copy of the view current, from two alternating surfaces
+  OSR_TEST_PARTIAL_PAINT,
+  // same as OSR_TEST_PARTIAL_PAINT but without opting in, a single rect
+  OSR_TEST_PARTIAL_PAINT_DISABLED,
+  // adaptive frame pacing should send fewer BeginFrames while idle
+  OSR_TEST_FRAME_PACING_ADAPTIVE,
+  // external frame pacing should only send BeginFrames when requested
+  OSR_TEST_FRAME_PACING_EXTERNAL,
   // write into editbox LI08, click to navigate on LI09
   OSR_TEST_KEY_EVENTS,
   // mouse over LI10 will show a tooltip
@@ -196,7 +231,11 @@ class OSRTestHandler : public RoutingTestHandler,
         scale_factor_(scale_factor),
         event_count_(0),
         event_total_(1),
-        started_(false) {
+        started_(false),
+        external_begin_frames_(false),
+        external_begin_frame_count_(0),
+        partial_paint_step_(0),
+        last_buffer_(NULL) {
   }
 
   // TestHandler methods
@@ -211,6 +250,10 @@ class OSRTestHandler : public RoutingTestHandler,
     if (test_type_ == OSR_TEST_IS_WINDOWLESS) {
       EXPECT_TRUE(browser->GetHost()->IsWindowRenderingDisabled());
       DestroySucceededTestSoon();
+    } else if (test_type_ == OSR_TEST_FRAME_PACING_EXTERNAL) {
+      // Act as the client's vsync source until the first frame is painted.
+      external_begin_frames_ = true;
+      SendExternalBeginFrame(browser);
     }
     RoutingTestHandler::OnAfterCreated(browser);
   }
@@ -547,6 +590,70 @@ class OSRTestHandler : public RoutingTestHandler,
         }
         break;
       }
+      case OSR_TEST_FRAME_STATISTICS:
+        if (StartTest()) {
+          browser->GetHost()->Invalidate(PET_VIEW);
+        } else {
+          CefFrameStatistics stats;
+          EXPECT_TRUE(browser->GetHost()->GetWindowlessFrameStatistics(stats));
+          // The first full repaint and the invalidated frame.
+          EXPECT_GE(stats.frames_produced, 2);
+          EXPECT_LE(stats.idle_begin_frames, stats.begin_frames);
+          if (stats.capture_count > 0) {
+            // Frame capture is only used with GPU compositing.
+            EXPECT_GT(stats.last_capture_latency_ms, 0.0);
+            EXPECT_LT(stats.last_capture_latency_ms, kMaxCaptureLatencyMs);
+            EXPECT_GT(stats.average_capture_latency_ms, 0.0);
+            EXPECT_LT(stats.average_capture_latency_ms, kMaxCaptureLatencyMs);
+            EXPECT_LE(stats.capture_count, stats.frames_produced);
+          } else {
+            EXPECT_EQ(0, stats.capture_retries);
+            EXPECT_EQ(0.0, stats.last_capture_latency_ms);
+            EXPECT_EQ(0.0, stats.average_capture_latency_ms);
+          }
+          DestroySucceededTestSoon();
+        }
+        break;
+      case OSR_TEST_PARTIAL_PAINT:
+      case OSR_TEST_PARTIAL_PAINT_DISABLED:
+        if (type == PET_VIEW)
+          OnPartialPaintTest(browser, dirtyRects, buffer, width, height);
+        break;
+      case OSR_TEST_FRAME_PACING_ADAPTIVE:
+        if (StartTest()) {
+          // Measure the BeginFrames sent while the content is idle.
+          EXPECT_TRUE(browser->GetHost()->GetWindowlessFrameStatistics(
+              start_stats_));
+          EXPECT_GT(start_stats_.begin_frames, 0);
+          CefPostDelayedTask(TID_UI,
+              base::Bind(&OSRTestHandler::CheckAdaptiveIdle, this, browser),
+              kFramePacingIdleMs);
+        } else if (got_idle_check_) {
+          // Input returns to the full frame rate and the hover state of the
+          // element is painted.
+          CefFrameStatistics stats;
+          EXPECT_TRUE(browser->GetHost()->GetWindowlessFrameStatistics(stats));
+          EXPECT_GT(stats.frames_produced, start_stats_.frames_produced);
+          DestroySucceededTestSoon();
+        }
+        break;
+      case OSR_TEST_FRAME_PACING_EXTERNAL:
+        if (StartTest()) {
+          // Every BeginFrame was requested by the client.
+          EXPECT_TRUE(browser->GetHost()->GetWindowlessFrameStatistics(
+              start_stats_));
+          EXPECT_GT(start_stats_.frames_produced, 0);
+          EXPECT_GT(start_stats_.begin_frames, 0);
+          EXPECT_LE(start_stats_.begin_frames, external_begin_frame_count_);
+
+          // No BeginFrames should be sent after the client stops requesting
+          // them.
+          external_begin_frames_ = false;
+          CefPostDelayedTask(TID_UI,
+              base::Bind(&OSRTestHandler::CheckExternalIdle, this, browser),
+              kFramePacingIdleMs / 4);
+        }
+        break;
       case OSR_TEST_KEY_EVENTS:
         if (StartTest()) {
           // click inside edit box
@@ -863,6 +970,16 @@ class OSRTestHandler : public RoutingTestHandler,
     CefWindowInfo windowInfo;
     CefBrowserSettings settings;
 
+    if (test_type_ == OSR_TEST_FRAME_PACING_ADAPTIVE) {
+      settings.windowless_frame_rate = kFramePacingFrameRate;
+      settings.windowless_frame_pacing = FRAME_PACING_ADAPTIVE;
+    } else if (test_type_ == OSR_TEST_FRAME_PACING_EXTERNAL) {
+      settings.windowless_frame_rate = kFramePacingFrameRate;
+      settings.windowless_frame_pacing = FRAME_PACING_EXTERNAL;
+    } else if (test_type_ == OSR_TEST_PARTIAL_PAINT) {
+      settings.windowless_partial_paint = true;
+    }
+
     const bool transparent = (test_type_ ==  OSR_TEST_TRANSPARENCY);
 
 #if defined(OS_WIN)
@@ -1006,6 +1123,178 @@ class OSRTestHandler : public RoutingTestHandler,
     return true;
   }
 
+  void CheckAdaptiveIdle(CefRefPtr<CefBrowser> browser) {
+    CefFrameStatistics stats;
+    EXPECT_TRUE(browser->GetHost()->GetWindowlessFrameStatistics(stats));
+
+    // A fixed frame rate would keep sending BeginFrames at the full rate.
+    const int64 begin_frames = stats.begin_frames - start_stats_.begin_frames;
+    const int64 fixed_begin_frames =
+        kFramePacingIdleMs * kFramePacingFrameRate / 1000;
+    EXPECT_LT(begin_frames, fixed_begin_frames / 2);
+    EXPECT_GT(stats.idle_begin_frames, start_stats_.idle_begin_frames);
+
+    start_stats_ = stats;
+    got_idle_check_.yes();
+
+    // Move the mouse over an element that changes appearance on hover.
+    CefMouseEvent mouse_event;
+    const CefRect& expected_rect = GetExpectedRect(3);
+    mouse_event.x = MiddleX(expected_rect);
+    mouse_event.y = MiddleY(expected_rect);
+    mouse_event.modifiers = 0;
+    browser->GetHost()->SendMouseMoveEvent(mouse_event, false);
+  }
+
+  void SendExternalBeginFrame(CefRefPtr<CefBrowser> browser) {
+    if (!external_begin_frames_)
+      return;
+
+    browser->GetHost()->SendExternalBeginFrame();
+    external_begin_frame_count_++;
+
+    CefPostDelayedTask(TID_UI,
+        base::Bind(&OSRTestHandler::SendExternalBeginFrame, this, browser),
+        kExternalBeginFrameIntervalMs);
+  }
+
+  void CheckExternalIdle(CefRefPtr<CefBrowser> browser) {
+    CefFrameStatistics stats;
+    EXPECT_TRUE(browser->GetHost()->GetWindowlessFrameStatistics(stats));
+    EXPECT_EQ(start_stats_.begin_frames, stats.begin_frames);
+    DestroySucceededTestSoon();
+  }
+
+  // Keeps a copy of the view that is only updated inside |dirtyRects| and
+  // compares it to a full repaint after elements were added in two steps.
+  void OnPartialPaintTest(CefRefPtr<CefBrowser> browser,
+                          const RectList& dirtyRects,
+                          const void* buffer,
+                          int width, int height) {
+    const bool partial_paint = (test_type_ == OSR_TEST_PARTIAL_PAINT);
+    const uint32* pixels = static_cast<const uint32*>(buffer);
+    const size_t pixel_count = static_cast<size_t>(width * height);
+
+    if (partial_paint) {
+      // The surface passed to the previous call is not modified while this
+      // frame is produced.
+      if (last_buffer_ && last_buffer_ != buffer) {
+        EXPECT_EQ(0, memcmp(last_buffer_, &last_frame_[0],
+                            last_frame_.size() * sizeof(uint32)));
+      }
+      buffers_.insert(buffer);
+      EXPECT_LE(buffers_.size(), 2U);
+    } else {
+      // Without opting in a single bounding rect is delivered.
+      EXPECT_EQ(1U, dirtyRects.size());
+    }
+
+    // The rects are inside the view and do not overlap.
+    const gfx::Rect view_rect(width, height);
+    int dirty_area = 0;
+    for (size_t i = 0; i < dirtyRects.size(); ++i) {
+      const gfx::Rect rect(dirtyRects[i].x, dirtyRects[i].y,
+                           dirtyRects[i].width, dirtyRects[i].height);
+      EXPECT_FALSE(rect.IsEmpty());
+      EXPECT_TRUE(view_rect.Contains(rect));
+      for (size_t j = i + 1; j < dirtyRects.size(); ++j) {
+        EXPECT_FALSE(rect.Intersects(
+            gfx::Rect(dirtyRects[j].x, dirtyRects[j].y,
+                      dirtyRects[j].width, dirtyRects[j].height)));
+      }
+      dirty_area += rect.width() * rect.height();
+    }
+
+    const bool full_repaint = (dirtyRects.size() == 1U &&
+        IsFullRepaint(dirtyRects[0], width, height));
+
+    if (StartTest()) {
+      // The first paint with content is a full repaint.
+      EXPECT_TRUE(full_repaint);
+      shadow_.assign(pixels, pixels + pixel_count);
+      AddPartialPaintElement(browser, kPartialPaintRect1);
+      partial_paint_step_ = 1;
+    } else if (partial_paint_step_ == 3 && full_repaint) {
+      // The copy that was only updated inside the dirty rects matches the
+      // explicitly invalidated view.
+      EXPECT_EQ(shadow_.size(), pixel_count);
+      EXPECT_EQ(0, memcmp(&shadow_[0], pixels,
+                          pixel_count * sizeof(uint32)));
+      if (partial_paint) {
+        // Painting the two elements alternated between both surfaces.
+        EXPECT_EQ(2U, buffers_.size());
+      }
+      partial_paint_step_ = 4;
+      DestroySucceededTestSoon();
+    } else if (partial_paint_step_ > 0 && partial_paint_step_ < 4) {
+      UpdateShadow(dirtyRects, pixels, width);
+
+      if (partial_paint_step_ == 1 &&
+          IsColorInShadow(GetScaledRect(kPartialPaintRect1), width)) {
+        AddPartialPaintElement(browser, kPartialPaintRect2);
+        partial_paint_step_ = 2;
+      } else if (partial_paint_step_ == 2 &&
+          IsColorInShadow(GetScaledRect(kPartialPaintRect2), width)) {
+        if (partial_paint) {
+          // Only the damaged part of the view was delivered.
+          EXPECT_LT(dirty_area, width * height);
+        }
+        // Invalidate outside of this callback to avoid a nested OnPaint.
+        CefPostTask(TID_UI,
+            base::Bind(&OSRTestHandler::InvalidateView, this, browser));
+        partial_paint_step_ = 3;
+      }
+    }
+
+    if (partial_paint) {
+      last_buffer_ = buffer;
+      last_frame_.assign(pixels, pixels + pixel_count);
+    }
+  }
+
+  void AddPartialPaintElement(CefRefPtr<CefBrowser> browser,
+                              const CefRect& rect) {
+    const std::string& code = base::StringPrintf(
+        "var d = document.createElement('div');"
+        "d.style.cssText = 'position:absolute;z-index:10;background:blue;"
+        "left:%dpx;top:%dpx;width:%dpx;height:%dpx';"
+        "document.body.appendChild(d);",
+        rect.x, rect.y, rect.width, rect.height);
+    browser->GetMainFrame()->ExecuteJavaScript(code, kTestUrl, 0);
+  }
+
+  // Copies the pixels inside |dirtyRects| from |pixels| into |shadow_|.
+  void UpdateShadow(const RectList& dirtyRects, const uint32* pixels,
+                    int width) {
+    for (RectList::const_iterator it = dirtyRects.begin();
+         it != dirtyRects.end(); ++it) {
+      for (int y = it->y; y < it->y + it->height; ++y) {
+        const size_t offset = static_cast<size_t>(y * width + it->x);
+        memcpy(&shadow_[offset], pixels + offset,
+               it->width * sizeof(uint32));
+      }
+    }
+  }
+
+  bool IsColorInShadow(const CefRect& rect, int width) const {
+    for (int y = rect.y; y < rect.y + rect.height; ++y) {
+      for (int x = rect.x; x < rect.x + rect.width; ++x) {
+        if (shadow_[y * width + x] != kPartialPaintColor)
+          return false;
+      }
+    }
+    return true;
+  }
+
+  void InvalidateView(CefRefPtr<CefBrowser> browser) {
+    browser->GetHost()->Invalidate(PET_VIEW);
+  }
+
+  void DestroyTest() override {
+    external_begin_frames_ = false;
+    RoutingTestHandler::DestroyTest();
+  }
+
  private:
   OSRTestType test_type_;
   float scale_factor_;
@@ -1013,6 +1302,17 @@ class OSRTestHandler : public RoutingTestHandler,
   int event_total_;
   bool started_;
   TrackCallback got_update_cursor_;
+  TrackCallback got_idle_check_;
+  CefFrameStatistics start_stats_;
+  bool external_begin_frames_;
+  int64 external_begin_frame_count_;
+
+  // used by the partial paint tests
+  int partial_paint_step_;
+  std::vector<uint32> shadow_;
+  std::set<const void*> buffers_;
+  const void* last_buffer_;
+  std::vector<uint32> last_frame_;
 
   IMPLEMENT_REFCOUNTING(OSRTestHandler);
 };
@@ -1029,6 +1329,20 @@ TEST(OSRTest, name) {\
   ReleaseAndWaitForDestructor(handler);\
 }
 
+// tests that require BeginFrame scheduling. When the test suite is run
+// without the "enable-begin-frame-scheduling" command-line switch the test
+// runs itself in a child process that has the switch.
+#define OSR_BEGIN_FRAME_TEST(name, test_mode, scale_factor)\
+TEST(OSRTest, name) {\
+  if (!CefTestSuite::RunCurrentTestWithSwitch(kEnableBeginFrameScheduling))\
+    return;\
+  CefRefPtr<OSRTestHandler> handler = \
+      new OSRTestHandler(test_mode, scale_factor);\
+  handler->ExecuteTest();\
+  EXPECT_TRUE(handler->succeeded());\
+  ReleaseAndWaitForDestructor(handler);\
+}
+
 // tests
 OSR_TEST(Windowless, OSR_TEST_IS_WINDOWLESS, 1.0f);
 OSR_TEST(Windowless2x, OSR_TEST_IS_WINDOWLESS, 2.0f);
@@ -1057,6 +1371,14 @@ OSR_TEST(Resize, OSR_TEST_RESIZE, 1.0f);
 OSR_TEST(Resize2x, OSR_TEST_RESIZE, 2.0f);
 OSR_TEST(Invalidate, OSR_TEST_INVALIDATE, 1.0f);
 OSR_TEST(Invalidate2x, OSR_TEST_INVALIDATE, 2.0f);
+OSR_TEST(FrameStatistics, OSR_TEST_FRAME_STATISTICS, 1.0f);
+OSR_TEST(PartialPaint, OSR_TEST_PARTIAL_PAINT, 1.0f);
+OSR_TEST(PartialPaint2x, OSR_TEST_PARTIAL_PAINT, 2.0f);
+OSR_TEST(PartialPaintDisabled, OSR_TEST_PARTIAL_PAINT_DISABLED, 1.0f);
+OSR_BEGIN_FRAME_TEST(FramePacingAdaptive, OSR_TEST_FRAME_PACING_ADAPTIVE,
+                     1.0f);
+OSR_BEGIN_FRAME_TEST(FramePacingExternal, OSR_TEST_FRAME_PACING_EXTERNAL,
+                     1.0f);
 OSR_TEST(KeyEvents, OSR_TEST_KEY_EVENTS, 1.0f);
 OSR_TEST(KeyEvents2x, OSR_TEST_KEY_EVENTS, 2.0f);
 OSR_TEST(Tooltip, OSR_TEST_TOOLTIP, 1.0f);
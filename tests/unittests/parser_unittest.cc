@@ -5,6 +5,16 @@
 // Include this first to avoid type conflicts with CEF headers.
 #include "tests/unittests/chromium_includes.h"
 
+#include <string.h>
+
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "base/strings/string_number_conversions.h"
+#include "base/time/time.h"
+
 #include "include/cef_parser.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -468,3 +478,457 @@ TEST(ParserTest, ParseJSONAndReturnErrorTrailingComma) {
   EXPECT_EQ(JSON_TRAILING_COMMA, error_code);
   EXPECT_EQ(expect_error_msg, error_msg);
 }
+
+namespace {
+
+// Records CefParseJSONStream events as strings.
+class RecordingParserHandler : public CefJSONParserHandler {
+ public:
+  // If |stop_at| is non-empty parsing will be stopped when that event is
+  // received.
+  explicit RecordingParserHandler(const std::string& stop_at)
+      : stop_at_(stop_at) {
+  }
+
+  bool OnBeginDictionary() override { return Record("{"); }
+  bool OnEndDictionary() override { return Record("}"); }
+  bool OnBeginList() override { return Record("["); }
+  bool OnEndList() override { return Record("]"); }
+  bool OnKey(const CefString& key) override {
+    return Record("key:" + key.ToString());
+  }
+  bool OnNull() override { return Record("null"); }
+  bool OnBool(bool value) override {
+    return Record(value ? "true" : "false");
+  }
+  bool OnInt(int value) override {
+    return Record("int:" + base::IntToString(value));
+  }
+  bool OnDouble(double value) override {
+    return Record("double:" + base::DoubleToString(value));
+  }
+  bool OnString(const CefString& value) override {
+    return Record("string:" + value.ToString());
+  }
+
+  std::vector<std::string> events_;
+
+ private:
+  bool Record(const std::string& event) {
+    events_.push_back(event);
+    return event != stop_at_;
+  }
+
+  const std::string stop_at_;
+
+  IMPLEMENT_REFCOUNTING(RecordingParserHandler);
+};
+
+// Counts CefParseJSONStream events without storing them.
+class CountingParserHandler : public CefJSONParserHandler {
+ public:
+  CountingParserHandler() : count_(0) {}
+
+  bool OnBeginDictionary() override { count_++; return true; }
+  bool OnEndDictionary() override { count_++; return true; }
+  bool OnBeginList() override { count_++; return true; }
+  bool OnEndList() override { count_++; return true; }
+  bool OnKey(const CefString& key) override { count_++; return true; }
+  bool OnNull() override { count_++; return true; }
+  bool OnBool(bool value) override { count_++; return true; }
+  bool OnInt(int value) override { count_++; return true; }
+  bool OnDouble(double value) override { count_++; return true; }
+  bool OnString(const CefString& value) override { count_++; return true; }
+
+  size_t count_;
+
+ private:
+  IMPLEMENT_REFCOUNTING(CountingParserHandler);
+};
+
+// Returns data in chunks of at most |chunk_size| bytes to exercise buffer
+// boundaries in the parser.
+class ChunkedReadHandler : public CefReadHandler {
+ public:
+  ChunkedReadHandler(const std::string& data, size_t chunk_size)
+      : data_(data),
+        chunk_size_(chunk_size),
+        offset_(0) {
+  }
+
+  size_t Read(void* ptr, size_t size, size_t n) override {
+    size_t bytes = std::min(std::min(size * n, chunk_size_),
+                            data_.size() - offset_);
+    bytes -= bytes % size;
+    memcpy(ptr, data_.data() + offset_, bytes);
+    offset_ += bytes;
+    return bytes / size;
+  }
+  int Seek(int64 offset, int whence) override { return -1; }
+  int64 Tell() override { return offset_; }
+  int Eof() override { return offset_ == data_.size(); }
+  bool MayBlock() override { return false; }
+
+ private:
+  const std::string data_;
+  const size_t chunk_size_;
+  size_t offset_;
+
+  IMPLEMENT_REFCOUNTING(ChunkedReadHandler);
+};
+
+// Collects the data written to a CefStreamWriter.
+class StringWriteHandler : public CefWriteHandler {
+ public:
+  StringWriteHandler() {}
+
+  size_t Write(const void* ptr, size_t size, size_t n) override {
+    data_.append(static_cast<const char*>(ptr), size * n);
+    return n;
+  }
+  int Seek(int64 offset, int whence) override { return -1; }
+  int64 Tell() override { return data_.size(); }
+  int Flush() override { return 0; }
+  bool MayBlock() override { return false; }
+
+  std::string data_;
+
+ private:
+  IMPLEMENT_REFCOUNTING(StringWriteHandler);
+};
+
+CefRefPtr<CefStreamReader> CreateStringReader(const std::string& data) {
+  return CefStreamReader::CreateForData(
+      const_cast<char*>(data.data()), data.size());
+}
+
+bool ParseJSONStreamString(const std::string& data,
+                           CefRefPtr<CefJSONParserHandler> handler,
+                           cef_json_parser_options_t options,
+                           cef_json_parser_error_t& error_code,
+                           CefString& error_msg) {
+  return CefParseJSONStream(CreateStringReader(data), handler, options,
+                            error_code, error_msg);
+}
+
+const char kStreamTestData[] =
+    "\xEF\xBB\xBF{\"key1\": \"value1\", \"key2\": [123, -4, 1.5, 3e2, "
+    "4294967296, true, false, null],\n"
+    "  /* comment */ \"esc\\\"ape\": \"a\\tb\\u00e9\\ud83d\\ude00\xC3\xA9\", "
+    "// comment\n"
+    "  \"empty\": {}, \"\": []}";
+
+void ExpectStreamTestEvents(const std::vector<std::string>& events) {
+  const char* const expected[] = {
+    "{",
+    "key:key1", "string:value1",
+    "key:key2", "[", "int:123", "int:-4", "double:1.5", "double:300",
+        "double:4294967296", "true", "false", "null", "]",
+    "key:esc\"ape", "string:a\tb\xC3\xA9\xF0\x9F\x98\x80\xC3\xA9",
+    "key:empty", "{", "}",
+    "key:", "[", "]",
+    "}",
+  };
+  ASSERT_EQ(arraysize(expected), events.size());
+  for (size_t i = 0; i < arraysize(expected); ++i)
+    EXPECT_EQ(expected[i], events[i]) << "event " << i;
+}
+
+}  // namespace
+
+TEST(ParserTest, ParseJSONStream) {
+  CefRefPtr<RecordingParserHandler> handler =
+      new RecordingParserHandler(std::string());
+  cef_json_parser_error_t error_code = JSON_NO_ERROR;
+  CefString error_msg;
+  EXPECT_TRUE(ParseJSONStreamString(kStreamTestData, handler.get(),
+                                    JSON_PARSER_RFC, error_code, error_msg));
+  EXPECT_EQ(JSON_NO_ERROR, error_code);
+  EXPECT_TRUE(error_msg.empty());
+  ExpectStreamTestEvents(handler->events_);
+}
+
+// Verify that values split across stream reads are parsed correctly.
+TEST(ParserTest, ParseJSONStreamChunked) {
+  for (size_t chunk_size = 1; chunk_size <= 4; ++chunk_size) {
+    CefRefPtr<RecordingParserHandler> handler =
+        new RecordingParserHandler(std::string());
+    CefRefPtr<CefStreamReader> stream = CefStreamReader::CreateForHandler(
+        new ChunkedReadHandler(kStreamTestData, chunk_size));
+    cef_json_parser_error_t error_code = JSON_NO_ERROR;
+    CefString error_msg;
+    EXPECT_TRUE(CefParseJSONStream(stream, handler.get(), JSON_PARSER_RFC,
+                                   error_code, error_msg));
+    ExpectStreamTestEvents(handler->events_);
+  }
+}
+
+// Verify that errors match those reported by CefParseJSONAndReturnError.
+TEST(ParserTest, ParseJSONStreamErrors) {
+  const char* const data[] = {
+    "This is my test data",
+    "{\"key1\":123,}",
+    "[1,2,]",
+    "{key1:123}",
+    "{\"key1\" 123}",
+    "[1 2]",
+    "[\"a\\qb\"]",
+    "[\"\\ud800\"]",
+    "[\"\xFF\"]",
+    "[1]\n[2]",
+    "[01]",
+    "[tru]",
+  };
+
+  for (size_t i = 0; i < arraysize(data); ++i) {
+    cef_json_parser_error_t expected_code = JSON_NO_ERROR;
+    CefString expected_msg;
+    EXPECT_FALSE(CefParseJSONAndReturnError(data[i], JSON_PARSER_RFC,
+                                            expected_code, expected_msg));
+
+    CefRefPtr<RecordingParserHandler> handler =
+        new RecordingParserHandler(std::string());
+    cef_json_parser_error_t error_code = JSON_NO_ERROR;
+    CefString error_msg;
+    EXPECT_FALSE(ParseJSONStreamString(data[i], handler.get(),
+                                       JSON_PARSER_RFC, error_code,
+                                       error_msg));
+    EXPECT_EQ(expected_code, error_code) << data[i];
+    EXPECT_FALSE(error_msg.empty());
+
+    if (i == 0) {
+      EXPECT_EQ("Line: 1, column: 1, Unexpected token.",
+                error_msg.ToString());
+    } else if (i == 1) {
+      EXPECT_EQ("Line: 1, column: 13, Trailing comma not allowed.",
+                error_msg.ToString());
+    }
+  }
+}
+
+TEST(ParserTest, ParseJSONStreamTrailingCommas) {
+  CefRefPtr<RecordingParserHandler> handler =
+      new RecordingParserHandler(std::string());
+  cef_json_parser_error_t error_code = JSON_NO_ERROR;
+  CefString error_msg;
+  EXPECT_TRUE(ParseJSONStreamString("{\"key1\":[1,],}", handler.get(),
+                                    JSON_PARSER_ALLOW_TRAILING_COMMAS,
+                                    error_code, error_msg));
+  ASSERT_EQ(6U, handler->events_.size());
+  EXPECT_EQ("int:1", handler->events_[3]);
+  EXPECT_EQ("}", handler->events_[5]);
+}
+
+TEST(ParserTest, ParseJSONStreamTooMuchNesting) {
+  std::string data(101, '[');
+  data.append(101, ']');
+  CefRefPtr<RecordingParserHandler> handler =
+      new RecordingParserHandler(std::string());
+  cef_json_parser_error_t error_code = JSON_NO_ERROR;
+  CefString error_msg;
+  EXPECT_FALSE(ParseJSONStreamString(data, handler.get(), JSON_PARSER_RFC,
+                                     error_code, error_msg));
+  EXPECT_EQ(JSON_TOO_MUCH_NESTING, error_code);
+}
+
+// Verify that the handler can stop parsing.
+TEST(ParserTest, ParseJSONStreamStop) {
+  CefRefPtr<RecordingParserHandler> handler =
+      new RecordingParserHandler("key:key2");
+  cef_json_parser_error_t error_code = JSON_NO_ERROR;
+  CefString error_msg;
+  EXPECT_FALSE(ParseJSONStreamString(kStreamTestData, handler.get(),
+                                     JSON_PARSER_RFC, error_code, error_msg));
+  EXPECT_EQ(JSON_NO_ERROR, error_code);
+  EXPECT_TRUE(error_msg.empty());
+  EXPECT_EQ(4U, handler->events_.size());
+}
+
+namespace {
+
+// Write the same content as CreateWriteTestValue using |writer|.
+void WriteTestContent(CefRefPtr<CefJSONWriter> writer) {
+  EXPECT_TRUE(writer->BeginDictionary());
+  EXPECT_TRUE(writer->WriteKey("bool"));
+  EXPECT_TRUE(writer->WriteBool(true));
+  EXPECT_TRUE(writer->WriteKey("double"));
+  EXPECT_TRUE(writer->WriteDouble(-0.5));
+  EXPECT_TRUE(writer->WriteKey("int"));
+  EXPECT_TRUE(writer->WriteInt(42));
+  EXPECT_TRUE(writer->WriteKey("list"));
+  EXPECT_TRUE(writer->BeginList());
+  EXPECT_TRUE(writer->WriteDouble(2));
+  EXPECT_TRUE(writer->WriteString("two\"\n"));
+  EXPECT_TRUE(writer->BeginDictionary());
+  EXPECT_TRUE(writer->EndDictionary());
+  EXPECT_TRUE(writer->BeginList());
+  EXPECT_TRUE(writer->EndList());
+  EXPECT_TRUE(writer->EndList());
+  EXPECT_TRUE(writer->WriteKey("null"));
+  EXPECT_TRUE(writer->WriteNull());
+  EXPECT_FALSE(writer->IsComplete());
+  EXPECT_TRUE(writer->EndDictionary());
+  EXPECT_TRUE(writer->IsComplete());
+}
+
+CefRefPtr<CefValue> CreateWriteTestValue() {
+  CefRefPtr<CefListValue> list = CefListValue::Create();
+  list->SetDouble(0, 2);
+  list->SetString(1, "two\"\n");
+  list->SetDictionary(2, CefDictionaryValue::Create());
+  list->SetList(3, CefListValue::Create());
+
+  // Dictionary keys are written in sorted order by CefWriteJSON.
+  CefRefPtr<CefDictionaryValue> dict = CefDictionaryValue::Create();
+  dict->SetBool("bool", true);
+  dict->SetDouble("double", -0.5);
+  dict->SetInt("int", 42);
+  dict->SetList("list", list);
+  dict->SetNull("null");
+
+  CefRefPtr<CefValue> value = CefValue::Create();
+  value->SetDictionary(dict);
+  return value;
+}
+
+std::string WriteJSONStreamString(cef_json_writer_options_t options) {
+  CefRefPtr<StringWriteHandler> handler = new StringWriteHandler();
+  CefRefPtr<CefJSONWriter> writer = CefJSONWriter::Create(
+      CefStreamWriter::CreateForHandler(handler.get()), options);
+  WriteTestContent(writer);
+  EXPECT_TRUE(writer->Flush());
+  return handler->data_;
+}
+
+}  // namespace
+
+// Verify that CefJSONWriter output matches CefWriteJSON.
+TEST(ParserTest, WriteJSONStream) {
+  const cef_json_writer_options_t options[] = {
+    JSON_WRITER_DEFAULT,
+    JSON_WRITER_OMIT_DOUBLE_TYPE_PRESERVATION,
+    JSON_WRITER_PRETTY_PRINT,
+  };
+
+  CefRefPtr<CefValue> value = CreateWriteTestValue();
+  for (size_t i = 0; i < arraysize(options); ++i) {
+    EXPECT_EQ(CefWriteJSON(value, options[i]).ToString(),
+              WriteJSONStreamString(options[i]));
+  }
+
+  EXPECT_EQ("{\"bool\":true,\"double\":-0.5,\"int\":42,"
+            "\"list\":[2.0,\"two\\\"\\n\",{},[]],\"null\":null}",
+            WriteJSONStreamString(JSON_WRITER_DEFAULT));
+}
+
+// Verify that the writer rejects calls that would produce invalid JSON.
+TEST(ParserTest, WriteJSONStreamInvalid) {
+  CefRefPtr<StringWriteHandler> handler = new StringWriteHandler();
+  CefRefPtr<CefJSONWriter> writer = CefJSONWriter::Create(
+      CefStreamWriter::CreateForHandler(handler.get()), JSON_WRITER_DEFAULT);
+
+  EXPECT_FALSE(writer->WriteKey("key"));
+  EXPECT_FALSE(writer->EndList());
+  EXPECT_TRUE(writer->BeginDictionary());
+  EXPECT_FALSE(writer->WriteInt(1));
+  EXPECT_FALSE(writer->EndList());
+  EXPECT_TRUE(writer->WriteKey("key"));
+  EXPECT_FALSE(writer->WriteKey("key2"));
+  EXPECT_FALSE(writer->EndDictionary());
+  EXPECT_FALSE(writer->WriteDouble(std::numeric_limits<double>::infinity()));
+  EXPECT_TRUE(writer->WriteInt(1));
+  EXPECT_TRUE(writer->EndDictionary());
+  EXPECT_FALSE(writer->WriteInt(2));
+  EXPECT_FALSE(writer->BeginList());
+  EXPECT_TRUE(writer->Flush());
+
+  EXPECT_EQ("{\"key\":1}", handler->data_);
+}
+
+namespace {
+
+const int kStreamPerfRecordCount = 20000;
+const int kStreamPerfIterations = 5;
+
+// Write a list of records similar to a typical API response.
+void WritePerfRecords(CefRefPtr<CefJSONWriter> writer) {
+  writer->BeginList();
+  for (int i = 0; i < kStreamPerfRecordCount; ++i) {
+    writer->BeginDictionary();
+    writer->WriteKey("id");
+    writer->WriteInt(i);
+    writer->WriteKey("name");
+    writer->WriteString("record name \xC3\xA9");
+    writer->WriteKey("score");
+    writer->WriteDouble(i * 0.25);
+    writer->WriteKey("tags");
+    writer->BeginList();
+    writer->WriteString("alpha");
+    writer->WriteString("beta");
+    writer->EndList();
+    writer->WriteKey("valid");
+    writer->WriteBool(i % 2 == 0);
+    writer->EndDictionary();
+  }
+  writer->EndList();
+}
+
+void LogThroughput(const char* name, size_t bytes,
+                   const base::TimeDelta& elapsed) {
+  const int64 us = std::max(elapsed.InMicroseconds(), static_cast<int64>(1));
+  LOG(INFO) << "ParserTest.JSONStreamPerf: " << name << " " <<
+      bytes * kStreamPerfIterations << " bytes in " << us << "us (" <<
+      (bytes * kStreamPerfIterations / us) << " MB/s)";
+}
+
+}  // namespace
+
+// Compare the throughput of the streaming parser/writer with the existing
+// value-based methods.
+TEST(ParserTest, JSONStreamPerf) {
+  CefRefPtr<StringWriteHandler> write_handler = new StringWriteHandler();
+  CefRefPtr<CefJSONWriter> writer = CefJSONWriter::Create(
+      CefStreamWriter::CreateForHandler(write_handler.get()),
+      JSON_WRITER_DEFAULT);
+  WritePerfRecords(writer);
+  EXPECT_TRUE(writer->IsComplete());
+  EXPECT_TRUE(writer->Flush());
+  const std::string data = write_handler->data_;
+
+  CefRefPtr<CefValue> value;
+  base::TimeTicks start = base::TimeTicks::Now();
+  for (int i = 0; i < kStreamPerfIterations; ++i) {
+    value = CefParseJSON(data, JSON_PARSER_RFC);
+    EXPECT_TRUE(value.get());
+  }
+  LogThroughput("CefParseJSON", data.size(), base::TimeTicks::Now() - start);
+
+  start = base::TimeTicks::Now();
+  for (int i = 0; i < kStreamPerfIterations; ++i) {
+    CefRefPtr<CountingParserHandler> handler = new CountingParserHandler();
+    cef_json_parser_error_t error_code = JSON_NO_ERROR;
+    CefString error_msg;
+    EXPECT_TRUE(ParseJSONStreamString(data, handler.get(), JSON_PARSER_RFC,
+                                      error_code, error_msg));
+    EXPECT_EQ(static_cast<size_t>(kStreamPerfRecordCount * 15 + 2),
+              handler->count_);
+  }
+  LogThroughput("CefParseJSONStream", data.size(),
+                base::TimeTicks::Now() - start);
+
+  start = base::TimeTicks::Now();
+  for (int i = 0; i < kStreamPerfIterations; ++i)
+    EXPECT_EQ(data.size(), CefWriteJSON(value, JSON_WRITER_DEFAULT).length());
+  LogThroughput("CefWriteJSON", data.size(), base::TimeTicks::Now() - start);
+
+  start = base::TimeTicks::Now();
+  for (int i = 0; i < kStreamPerfIterations; ++i) {
+    CefRefPtr<StringWriteHandler> handler = new StringWriteHandler();
+    CefRefPtr<CefJSONWriter> writer = CefJSONWriter::Create(
+        CefStreamWriter::CreateForHandler(handler.get()), JSON_WRITER_DEFAULT);
+    WritePerfRecords(writer);
+    EXPECT_TRUE(writer->Flush());
+    EXPECT_EQ(data.size(), handler->data_.size());
+  }
+  LogThroughput("CefJSONWriter", data.size(), base::TimeTicks::Now() - start);
+}
@@ -5,6 +5,21 @@
 // Include this first to avoid type conflicts with CEF headers.
 #include "tests/unittests/chromium_includes.h"
 
+#include "base/logging.h"
+#include "base/time/time.h"
+
+#if defined(OS_WIN)
+#include <windows.h>
+#elif defined(OS_MACOSX)
+#include <mach/mach.h>
+#include <mach/mach_vm.h>
+#elif defined(OS_LINUX)
+#include <stdio.h>
+#include <sstream>
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#endif
+
 #include "include/cef_process_message.h"
 #include "include/cef_task.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -20,8 +35,73 @@ namespace {
 const char kSendRecvUrl[] = "http://tests/ProcessMessageTest.SendRecv";
 const char kSendRecvMsg[] = "ProcessMessageTest.SendRecv";
 
-// Creates a test message.
-CefRefPtr<CefProcessMessage> CreateTestMessage() {
+// Unique values for the SendThroughput test.
+const char kThroughputUrl[] = "http://tests/ProcessMessageTest.SendThroughput";
+const char kThroughputMsg[] = "ProcessMessageTest.SendThroughput";
+const char kThroughputDoneMsg[] = "ProcessMessageTest.SendThroughputDone";
+
+// Number of messages sent in each pass of the SendThroughput test.
+const int kThroughputMessageCount = 5000;
+
+// Size of binary values that will be transferred using shared memory with the
+// default threshold.
+const size_t kLargeBinarySize = 1024 * 1024;
+
+// Returns true if |data| points into memory that is shared with another
+// process instead of memory that is private to the current process.
+bool IsSharedMemory(const void* data) {
+#if defined(OS_WIN)
+  MEMORY_BASIC_INFORMATION info;
+  if (!VirtualQuery(data, &info, sizeof(info)))
+    return false;
+  return info.Type == MEM_MAPPED;
+#elif defined(OS_MACOSX)
+  mach_vm_address_t address = reinterpret_cast<mach_vm_address_t>(data);
+  mach_vm_size_t size = 0;
+  vm_region_basic_info_data_64_t info;
+  mach_msg_type_number_t count = VM_REGION_BASIC_INFO_COUNT_64;
+  mach_port_t object_name;
+  if (mach_vm_region(mach_task_self(), &address, &size,
+                     VM_REGION_BASIC_INFO_64,
+                     reinterpret_cast<vm_region_info_t>(&info), &count,
+                     &object_name) != KERN_SUCCESS) {
+    return false;
+  }
+  if (address > reinterpret_cast<mach_vm_address_t>(data))
+    return false;
+  return info.shared ? true : false;
+#elif defined(OS_LINUX)
+  // Each line starts with "<start>-<end> <perms>" where the last permission
+  // character is 's' for shared mappings and 'p' for private mappings.
+  std::string maps;
+  if (!base::ReadFileToString(base::FilePath("/proc/self/maps"), &maps))
+    return false;
+  const uintptr_t address = reinterpret_cast<uintptr_t>(data);
+  std::istringstream stream(maps);
+  std::string line;
+  while (std::getline(stream, line)) {
+    unsigned long start, end;
+    char perms[5];
+    if (sscanf(line.c_str(), "%lx-%lx %4s", &start, &end, perms) != 3)
+      continue;
+    if (address >= start && address < end)
+      return perms[3] == 's';
+  }
+  return false;
+#endif
+}
+
+// Creates a binary value of |size| bytes filled with printable characters.
+CefRefPtr<CefBinaryValue> CreateTestBinary(size_t size) {
+  std::string data(size, 0);
+  for (size_t i = 0; i < size; ++i)
+    data[i] = static_cast<char>('a' + (i % 26));
+  return CefBinaryValue::Create(data.data(), data.size());
+}
+
+// Creates a test message. If |large_binary| is true the message will include
+// binary values that are large enough to be sent using shared memory.
+CefRefPtr<CefProcessMessage> CreateTestMessage(bool large_binary) {
   CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create(kSendRecvMsg);
   EXPECT_TRUE(msg.get());
 
@@ -36,11 +116,46 @@ CefRefPtr<CefProcessMessage> CreateTestMessage() {
   args->SetString(index++, "test string");
   args->SetList(index++, args->Copy());
 
+  if (large_binary) {
+    args->SetBinary(index++, CreateTestBinary(16));
+    args->SetBinary(index++, CreateTestBinary(kLargeBinarySize));
+
+    // Nested values are also sent using shared memory.
+    CefRefPtr<CefDictionaryValue> dict = CefDictionaryValue::Create();
+    dict->SetBinary("large", CreateTestBinary(kLargeBinarySize + 1));
+    dict->SetBinary("small", CreateTestBinary(32));
+    args->SetDictionary(index++, dict);
+  }
+
   EXPECT_EQ((size_t)index, args->GetSize());
 
   return msg;
 }
 
+// Creates a message similar to high-frequency telemetry with nested
+// dictionaries.
+CefRefPtr<CefProcessMessage> CreateThroughputMessage() {
+  CefRefPtr<CefProcessMessage> msg = CefProcessMessage::Create(kThroughputMsg);
+  CefRefPtr<CefListValue> args = msg->GetArgumentList();
+
+  for (int i = 0; i < 8; ++i) {
+    CefRefPtr<CefDictionaryValue> sample = CefDictionaryValue::Create();
+    sample->SetString("name", "sample.name");
+    sample->SetInt("id", i);
+    sample->SetDouble("value", i * 1.5);
+
+    CefRefPtr<CefDictionaryValue> tags = CefDictionaryValue::Create();
+    tags->SetString("host", "tests");
+    tags->SetString("path", "/process/message");
+    tags->SetBool("sampled", true);
+    sample->SetDictionary("tags", tags);
+
+    args->SetDictionary(i, sample);
+  }
+
+  return msg;
+}
+
 // Renderer side.
 class SendRecvRendererTest : public ClientAppRenderer::Delegate {
  public:
@@ -71,14 +186,60 @@ class SendRecvRendererTest : public ClientAppRenderer::Delegate {
   IMPLEMENT_REFCOUNTING(SendRecvRendererTest);
 };
 
+// Renderer side.
+class SendThroughputRendererTest : public ClientAppRenderer::Delegate {
+ public:
+  SendThroughputRendererTest()
+      : message_count_(0),
+        mismatch_count_(0) {}
+
+  bool OnProcessMessageReceived(
+      CefRefPtr<ClientAppRenderer> app,
+      CefRefPtr<CefBrowser> browser,
+      CefProcessId source_process,
+      CefRefPtr<CefProcessMessage> message) override {
+    const std::string& name = message->GetName();
+    if (name == kThroughputMsg) {
+      if (!expected_.get())
+        expected_ = CreateThroughputMessage();
+      if (!message->GetArgumentList()->IsEqual(expected_->GetArgumentList()))
+        mismatch_count_++;
+      message_count_++;
+      return true;
+    } else if (name == kThroughputDoneMsg) {
+      // Report the number of messages received since the last pass and how
+      // many of them had unexpected arguments.
+      CefRefPtr<CefProcessMessage> response =
+          CefProcessMessage::Create(kThroughputDoneMsg);
+      response->GetArgumentList()->SetInt(0, message_count_);
+      response->GetArgumentList()->SetInt(1, mismatch_count_);
+      message_count_ = 0;
+      mismatch_count_ = 0;
+      EXPECT_TRUE(browser->SendProcessMessage(PID_BROWSER, response));
+      return true;
+    }
+
+    // Message not handled.
+    return false;
+  }
+
+ private:
+  CefRefPtr<CefProcessMessage> expected_;
+  int message_count_;
+  int mismatch_count_;
+
+  IMPLEMENT_REFCOUNTING(SendThroughputRendererTest);
+};
+
 // Browser side.
 class SendRecvTestHandler : public TestHandler {
  public:
-  SendRecvTestHandler() {
+  explicit SendRecvTestHandler(bool large_binary)
+      : large_binary_(large_binary) {
   }
 
   void RunTest() override {
-    message_ = CreateTestMessage();
+    message_ = CreateTestMessage(large_binary_);
 
     AddResource(kSendRecvUrl, "<html><body>TEST</body></html>", "text/html");
     CreateBrowser(kSendRecvUrl);
@@ -106,6 +267,19 @@ class SendRecvTestHandler : public TestHandler {
     // Verify that the recieved message is the same as the sent message.
     TestProcessMessageEqual(message_, message);
 
+    if (large_binary_) {
+      // Large binary values are read directly from the shared memory segments
+      // that were used to transfer them. Small binary values are copied out of
+      // the IPC message.
+      CefRefPtr<CefListValue> args = message->GetArgumentList();
+      const size_t index = args->GetSize() - 3;
+      EXPECT_FALSE(IsSharedMemory(args->GetBinary(index)->GetRawData()));
+      EXPECT_TRUE(IsSharedMemory(args->GetBinary(index + 1)->GetRawData()));
+      CefRefPtr<CefDictionaryValue> dict = args->GetDictionary(index + 2);
+      EXPECT_TRUE(IsSharedMemory(dict->GetBinary("large")->GetRawData()));
+      EXPECT_FALSE(IsSharedMemory(dict->GetBinary("small")->GetRawData()));
+    }
+
     got_message_.yes();
 
     // Test is complete.
@@ -114,17 +288,95 @@ class SendRecvTestHandler : public TestHandler {
     return true;
   }
 
+  const bool large_binary_;
   CefRefPtr<CefProcessMessage> message_;
   TrackCallback got_message_;
 
   IMPLEMENT_REFCOUNTING(SendRecvTestHandler);
 };
 
+// Browser side. Measures the rate at which messages are sent to the renderer
+// process. The first pass copies each message before sending it, which matches
+// the cost of sending before arguments were serialized in place. The second
+// pass sends the message directly.
+class SendThroughputTestHandler : public TestHandler {
+ public:
+  SendThroughputTestHandler() : copy_pass_(true) {}
+
+  void RunTest() override {
+    message_ = CreateThroughputMessage();
+
+    AddResource(kThroughputUrl, "<html><body>TEST</body></html>",
+                "text/html");
+    CreateBrowser(kThroughputUrl);
+
+    // Time out the test after a reasonable period of time.
+    SetTestTimeout();
+  }
+
+  void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                 CefRefPtr<CefFrame> frame,
+                 int httpStatusCode) override {
+    SendPass(browser);
+  }
+
+  bool OnProcessMessageReceived(
+      CefRefPtr<CefBrowser> browser,
+      CefProcessId source_process,
+      CefRefPtr<CefProcessMessage> message) override {
+    EXPECT_STREQ(kThroughputDoneMsg, message->GetName().ToString().c_str());
+    EXPECT_EQ(kThroughputMessageCount,
+              message->GetArgumentList()->GetInt(0));
+    // All messages must arrive with the arguments intact.
+    EXPECT_EQ(0, message->GetArgumentList()->GetInt(1));
+
+    const base::TimeDelta elapsed = base::TimeTicks::Now() - start_time_;
+    LOG(INFO) << "ProcessMessageTest.SendThroughput: " <<
+        (copy_pass_ ? "copy" : "in place") << " " <<
+        static_cast<int64>(kThroughputMessageCount / elapsed.InSecondsF()) <<
+        " messages/sec";
+
+    if (copy_pass_) {
+      copy_pass_ = false;
+      SendPass(browser);
+    } else {
+      got_message_.yes();
+      DestroyTest();
+    }
+
+    return true;
+  }
+
+  CefRefPtr<CefProcessMessage> message_;
+  TrackCallback got_message_;
+
+ private:
+  void SendPass(CefRefPtr<CefBrowser> browser) {
+    start_time_ = base::TimeTicks::Now();
+    for (int i = 0; i < kThroughputMessageCount; ++i) {
+      EXPECT_TRUE(browser->SendProcessMessage(PID_RENDERER,
+          copy_pass_ ? message_->Copy() : message_));
+    }
+    EXPECT_TRUE(browser->SendProcessMessage(PID_RENDERER,
+        CefProcessMessage::Create(kThroughputDoneMsg)));
+
+    // Sending must leave the arguments of |message_| unchanged.
+    EXPECT_TRUE(message_->IsValid());
+    EXPECT_TRUE(message_->GetArgumentList()->IsEqual(
+        CreateThroughputMessage()->GetArgumentList()));
+  }
+
+  bool copy_pass_;
+  base::TimeTicks start_time_;
+
+  IMPLEMENT_REFCOUNTING(SendThroughputTestHandler);
+};
+
 }  // namespace
 
 // Verify send and recieve.
 TEST(ProcessMessageTest, SendRecv) {
-  CefRefPtr<SendRecvTestHandler> handler = new SendRecvTestHandler();
+  CefRefPtr<SendRecvTestHandler> handler = new SendRecvTestHandler(false);
   handler->ExecuteTest();
 
   EXPECT_TRUE(handler->got_message_);
@@ -132,6 +384,29 @@ TEST(ProcessMessageTest, SendRecv) {
   ReleaseAndWaitForDestructor(handler);
 }
 
+// Verify send and recieve of binary values that are transferred using shared
+// memory in both directions.
+TEST(ProcessMessageTest, SendRecvLargeBinary) {
+  CefRefPtr<SendRecvTestHandler> handler = new SendRecvTestHandler(true);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(handler->got_message_);
+
+  ReleaseAndWaitForDestructor(handler);
+}
+
+// Measure the rate at which messages with nested arguments can be sent. The
+// sent message must be unchanged afterwards.
+TEST(ProcessMessageTest, SendThroughput) {
+  CefRefPtr<SendThroughputTestHandler> handler = new SendThroughputTestHandler;
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(handler->got_message_);
+  TestProcessMessageEqual(CreateThroughputMessage(), handler->message_);
+
+  ReleaseAndWaitForDestructor(handler);
+}
+
 // Verify create.
 TEST(ProcessMessageTest, Create) {
   CefRefPtr<CefProcessMessage> message =
@@ -150,7 +425,7 @@ TEST(ProcessMessageTest, Create) {
 
 // Verify copy.
 TEST(ProcessMessageTest, Copy) {
-  CefRefPtr<CefProcessMessage> message = CreateTestMessage();
+  CefRefPtr<CefProcessMessage> message = CreateTestMessage(false);
   CefRefPtr<CefProcessMessage> message2 = message->Copy();
   TestProcessMessageEqual(message, message2);
 }
@@ -162,4 +437,7 @@ void CreateProcessMessageRendererTests(
     ClientAppRenderer::DelegateSet& delegates) {
   // For ProcessMessageTest.SendRecv
   delegates.insert(new SendRecvRendererTest);
+
+  // For ProcessMessageTest.SendThroughput
+  delegates.insert(new SendThroughputRendererTest);
 }
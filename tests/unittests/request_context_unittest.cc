@@ -6,12 +6,16 @@
 #include "tests/unittests/chromium_includes.h"
 
 #include "include/base/cef_bind.h"
+#include "base/files/file_util.h"
 #include "base/files/scoped_temp_dir.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/synchronization/waitable_event.h"
 #include "include/cef_request_context.h"
 #include "include/cef_request_context_handler.h"
 #include "include/wrapper/cef_closure_task.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "tests/unittests/test_handler.h"
+#include "tests/unittests/test_server.h"
 
 TEST(RequestContextTest, GetGlobalContext) {
   CefRefPtr<CefRequestContext> context1 =
@@ -236,6 +240,256 @@ TEST(RequestContextTest, CreateContextSharedOnDisk) {
 
 namespace {
 
+// Cache path prefix handled by the test server. The remainder of the path is
+// the size of the response body.
+const char kCacheTestPath[] = "/cache/";
+
+struct TestCacheStatistics {
+  TestCacheStatistics()
+      : hit_count(-1),
+        miss_count(-1),
+        cached_bytes(-1),
+        network_bytes(-1),
+        entry_count(-1) {}
+
+  int64 hit_count;
+  int64 miss_count;
+  int64 cached_bytes;
+  int64 network_bytes;
+  int entry_count;
+};
+
+class TestCacheStatisticsCallback : public CefCacheStatisticsCallback {
+ public:
+  TestCacheStatisticsCallback(TestCacheStatistics* statistics,
+                              base::WaitableEvent* event)
+      : statistics_(statistics),
+        event_(event) {}
+
+  void OnComplete(int64 hit_count,
+                  int64 miss_count,
+                  int64 cached_bytes,
+                  int64 network_bytes,
+                  int entry_count) override {
+    statistics_->hit_count = hit_count;
+    statistics_->miss_count = miss_count;
+    statistics_->cached_bytes = cached_bytes;
+    statistics_->network_bytes = network_bytes;
+    statistics_->entry_count = entry_count;
+    event_->Signal();
+  }
+
+ private:
+  TestCacheStatistics* statistics_;
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(TestCacheStatisticsCallback);
+  DISALLOW_COPY_AND_ASSIGN(TestCacheStatisticsCallback);
+};
+
+class TestCacheEntryCallback : public CefCacheEntryCallback {
+ public:
+  TestCacheEntryCallback(bool expected_success,
+                         base::WaitableEvent* event)
+      : expected_success_(expected_success),
+        event_(event) {}
+
+  void OnComplete(bool success) override {
+    EXPECT_EQ(expected_success_, success);
+    event_->Signal();
+  }
+
+ private:
+  bool expected_success_;
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(TestCacheEntryCallback);
+  DISALLOW_COPY_AND_ASSIGN(TestCacheEntryCallback);
+};
+
+void GetCacheStatistics(CefRefPtr<CefRequestContext> context,
+                        TestCacheStatistics* statistics) {
+  base::WaitableEvent event(false, false);
+  context->GetCacheStatistics(
+      new TestCacheStatisticsCallback(statistics, &event));
+  event.Wait();
+}
+
+void PreloadCacheEntry(CefRefPtr<CefRequestContext> context,
+                       const std::string& url,
+                       bool expected_success) {
+  base::WaitableEvent event(false, false);
+  context->PreloadCacheEntry(url,
+      new TestCacheEntryCallback(expected_success, &event));
+  event.Wait();
+}
+
+void EvictCacheEntry(CefRefPtr<CefRequestContext> context,
+                     const std::string& url,
+                     bool expected_success) {
+  base::WaitableEvent event(false, false);
+  context->EvictCacheEntry(url,
+      new TestCacheEntryCallback(expected_success, &event));
+  event.Wait();
+}
+
+// Returns cacheable responses for kCacheTestPath requests. Scheme handler
+// responses bypass the HTTP cache so the responses must be received through
+// the network stack.
+class CacheTestServerHandler : public TestServer::Handler {
+ public:
+  CacheTestServerHandler() {}
+
+  // Called on the server thread.
+  bool OnRequest(const TestServer::Request& request,
+                 TestServer::Response* response) override {
+    size_t size = 0;
+    if (request.path.find(kCacheTestPath) != 0 ||
+        !base::StringToSizeT(
+            request.path.substr(sizeof(kCacheTestPath) - 1), &size)) {
+      return false;
+    }
+
+    response->body = std::string(size, 'x');
+    response->headers = "Cache-Control: max-age=3600\r\n";
+    return true;
+  }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(CacheTestServerHandler);
+};
+
+std::string GetCacheTestURL(const TestServer& server, size_t size) {
+  // Skip the leading slash.
+  return server.GetURL(kCacheTestPath + 1 + base::SizeTToString(size));
+}
+
+}  // namespace
+
+// Verify that an in-memory HTTP cache can be used with an on-disk context.
+TEST(RequestContextTest, CacheInMemory) {
+  base::ScopedTempDir tempdir;
+  EXPECT_TRUE(tempdir.CreateUniqueTempDir());
+
+  CefRequestContextSettings settings;
+  CefString(&settings.cache_path) = tempdir.path().value();
+  settings.cache_in_memory = true;
+  settings.memory_cache_max_size = 1024 * 1024;
+
+  CefRefPtr<CefRequestContext> context =
+      CefRequestContext::CreateContext(settings, NULL);
+  EXPECT_TRUE(context.get());
+
+  TestCacheStatistics statistics;
+  GetCacheStatistics(context, &statistics);
+  EXPECT_EQ(0, statistics.hit_count);
+  EXPECT_EQ(0, statistics.miss_count);
+  EXPECT_EQ(0, statistics.entry_count);
+
+  // The cache backend has been created so any disk cache files would exist.
+  EXPECT_FALSE(base::PathExists(tempdir.path().AppendASCII("index")));
+
+  // Evicting an entry that doesn't exist fails.
+  EvictCacheEntry(context, "http://tests/missing.html", false);
+
+  // Only HTTP and HTTPS resources can be preloaded.
+  PreloadCacheEntry(context, "file:///missing.html", false);
+
+  CacheTestServerHandler server_handler;
+  TestServer server(&server_handler);
+  ASSERT_TRUE(server.Start());
+
+  const size_t kBodySize = 1024;
+  const std::string& url = GetCacheTestURL(server, kBodySize);
+
+  // The first load is received from the network and stored in the cache.
+  PreloadCacheEntry(context, url, true);
+  GetCacheStatistics(context, &statistics);
+  EXPECT_EQ(0, statistics.hit_count);
+  EXPECT_EQ(1, statistics.miss_count);
+  EXPECT_EQ(0, statistics.cached_bytes);
+  EXPECT_GT(statistics.network_bytes, static_cast<int64>(kBodySize));
+  EXPECT_EQ(1, statistics.entry_count);
+
+  // The second load is served from the cache.
+  const int64 network_bytes = statistics.network_bytes;
+  PreloadCacheEntry(context, url, true);
+  GetCacheStatistics(context, &statistics);
+  EXPECT_EQ(1, statistics.hit_count);
+  EXPECT_EQ(1, statistics.miss_count);
+  EXPECT_EQ(static_cast<int64>(kBodySize), statistics.cached_bytes);
+  EXPECT_EQ(network_bytes, statistics.network_bytes);
+  EXPECT_EQ(1, statistics.entry_count);
+
+  // Evicting the entry removes it from the cache.
+  EvictCacheEntry(context, url, true);
+  GetCacheStatistics(context, &statistics);
+  EXPECT_EQ(0, statistics.entry_count);
+
+  // The next load is received from the network again.
+  PreloadCacheEntry(context, url, true);
+  GetCacheStatistics(context, &statistics);
+  EXPECT_EQ(1, statistics.hit_count);
+  EXPECT_EQ(2, statistics.miss_count);
+  EXPECT_EQ(1, statistics.entry_count);
+
+  server.Stop();
+}
+
+// Verify that CefRequestContextSettings.cache_max_size limits the disk cache.
+TEST(RequestContextTest, CacheMaxSize) {
+  CacheTestServerHandler server_handler;
+  TestServer server(&server_handler);
+  ASSERT_TRUE(server.Start());
+
+  // The disk cache will not store a single entry that is larger than 1/8th of
+  // the maximum cache size.
+  const int kCacheMaxSize = 1024 * 1024;
+  const std::string& small_url = GetCacheTestURL(server, 1024);
+  const std::string& large_url = GetCacheTestURL(server, kCacheMaxSize / 4);
+
+  base::ScopedTempDir tempdir;
+  EXPECT_TRUE(tempdir.CreateUniqueTempDir());
+
+  CefRequestContextSettings settings;
+  CefString(&settings.cache_path) =
+      tempdir.path().AppendASCII("limited").value();
+  settings.cache_max_size = kCacheMaxSize;
+
+  CefRefPtr<CefRequestContext> context =
+      CefRequestContext::CreateContext(settings, NULL);
+  EXPECT_TRUE(context.get());
+
+  // The large response is loaded but not kept in the cache. Loading the
+  // small response afterwards also waits for pending cache operations.
+  PreloadCacheEntry(context, large_url, true);
+  PreloadCacheEntry(context, small_url, true);
+
+  TestCacheStatistics statistics;
+  GetCacheStatistics(context, &statistics);
+  EXPECT_EQ(2, statistics.miss_count);
+  EXPECT_EQ(1, statistics.entry_count);
+
+  // Without the limit the large response is kept.
+  CefString(&settings.cache_path) =
+      tempdir.path().AppendASCII("unlimited").value();
+  settings.cache_max_size = 0;
+
+  context = CefRequestContext::CreateContext(settings, NULL);
+  EXPECT_TRUE(context.get());
+
+  PreloadCacheEntry(context, large_url, true);
+  PreloadCacheEntry(context, small_url, true);
+
+  GetCacheStatistics(context, &statistics);
+  EXPECT_EQ(2, statistics.miss_count);
+  EXPECT_EQ(2, statistics.entry_count);
+
+  server.Stop();
+}
+
+namespace {
+
 class CookieTestHandler : public TestHandler {
  public:
   class RequestContextHandler : public CefRequestContextHandler {
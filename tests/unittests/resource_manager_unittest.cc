@@ -9,6 +9,8 @@
 
 #include "base/files/file_util.h"
 #include "base/files/scoped_temp_dir.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/time/time.h"
 
 #include "include/base/cef_bind.h"
 #include "include/wrapper/cef_closure_task.h"
@@ -730,6 +732,113 @@ TEST(ResourceManagerTest, DirectoryProvider) {
   EXPECT_EQ(not_handled_message, state.messages_[3]);
 }
 
+namespace {
+
+void GetCacheStatisticsOnIOThread(
+    CefRefPtr<CefResourceManager> manager,
+    CefResourceManager::CacheStatistics* statistics) {
+  EXPECT_IO_THREAD();
+  *statistics = manager->GetCacheStatistics();
+}
+
+CefResourceManager::CacheStatistics GetCacheStatistics(
+    CefRefPtr<CefResourceManager> manager) {
+  CefResourceManager::CacheStatistics statistics;
+  CefPostTask(TID_IO,
+      base::Bind(GetCacheStatisticsOnIOThread, manager, &statistics));
+  WaitForIOThread();
+  return statistics;
+}
+
+}  // namespace
+
+// Test AddDirectoryProvider with response caching.
+TEST(ResourceManagerTest, DirectoryProviderCache) {
+  const char kUrlBase[] = "http://test.com/ResourceManager";
+  const char kFile1[] = "File1.html";
+  const char kFile2[] = "File2.html";
+
+  const std::string& success1_message = CreateMessage(kDoneMsg, "Success1");
+  const std::string& success2_message = CreateMessage(kDoneMsg, "Success2");
+  // Same length as |success1_message| so that validation must detect the
+  // change using the modification time.
+  const std::string& modified1_message = CreateMessage(kDoneMsg, "Modified");
+
+  const std::string& url1 = kUrlBase + std::string("/") + kFile1;
+  const std::string& url2 = kUrlBase + std::string("/") + kFile2;
+
+  ResourceManagerTestHandler::State state;
+  state.urls_.push_back(url1);
+  state.urls_.push_back(url2);
+  state.urls_.push_back(url1);
+  state.urls_.push_back(url1);
+  // Responses for different query components are cached separately.
+  state.urls_.push_back(url1 + "?query");
+
+  base::ScopedTempDir scoped_dir;
+  EXPECT_TRUE(scoped_dir.CreateUniqueTempDir());
+
+  // Write the files to disk.
+  const base::FilePath& temp_dir = scoped_dir.path();
+  WriteFile(temp_dir.AppendASCII(kFile1), CreateContents(success1_message));
+  WriteFile(temp_dir.AppendASCII(kFile2), CreateContents(success2_message));
+
+  state.manager_->SetCacheLimit(1024 * 1024);
+  // Validate before each use of a cached response.
+  state.manager_->SetCacheValidationInterval(0);
+  state.manager_->AddDirectoryProvider(kUrlBase,
+                                       CefString(temp_dir.value()),
+                                       0, std::string());
+
+  CefRefPtr<ResourceManagerTestHandler> handler =
+      new ResourceManagerTestHandler(&state);
+  handler->ExecuteTest();
+
+  ReleaseAndWaitForDestructor(handler);
+
+  // The repeated loads of |url1| are returned from the cache.
+  CefResourceManager::CacheStatistics statistics =
+      GetCacheStatistics(state.manager_);
+  EXPECT_EQ(2U, statistics.hit_count);
+  EXPECT_EQ(3U, statistics.miss_count);
+  EXPECT_EQ(3U, statistics.entry_count);
+
+  // Modify the file on disk. Validation fails and the response is replaced.
+  WriteFile(temp_dir.AppendASCII(kFile1), CreateContents(modified1_message));
+
+  ResourceManagerTestHandler::State state2;
+  state2.manager_ = state.manager_;
+  state2.urls_.push_back(url1);
+
+  handler = new ResourceManagerTestHandler(&state2);
+  handler->ExecuteTest();
+
+  ReleaseAndWaitForDestructor(handler);
+
+  statistics = GetCacheStatistics(state.manager_);
+  EXPECT_EQ(2U, statistics.hit_count);
+  EXPECT_EQ(4U, statistics.miss_count);
+  EXPECT_EQ(3U, statistics.entry_count);
+
+  state.manager_ = NULL;
+  state2.manager_ = NULL;
+
+  // Wait for the manager to be deleted.
+  WaitForIOThread();
+
+  EXPECT_TRUE(scoped_dir.Delete());
+
+  EXPECT_EQ(state.messages_.size(), 5U);
+  EXPECT_EQ(success1_message, state.messages_[0]);
+  EXPECT_EQ(success2_message, state.messages_[1]);
+  EXPECT_EQ(success1_message, state.messages_[2]);
+  EXPECT_EQ(success1_message, state.messages_[3]);
+  EXPECT_EQ(success1_message, state.messages_[4]);
+
+  EXPECT_EQ(state2.messages_.size(), 1U);
+  EXPECT_EQ(modified1_message, state2.messages_[0]);
+}
+
 // Test AddArchiveProvider.
 TEST(ResourceManagerTest, ArchiveProvider) {
   const char kUrlBase[] = "http://test.com/ResourceManager";
@@ -1778,3 +1887,146 @@ TEST(ResourceManagerTest, AddProviderBefore) {
   EXPECT_EQ(state.messages_.size(), 1U);
   EXPECT_EQ(CreateMessage(kDoneMsg, kNotHandled), state.messages_[0]);
 }
+
+namespace {
+
+const int kLookupPerfProviderCount = 150;
+const int kLookupPerfIterations = 10000;
+
+void RunProviderLookupPerfOnIOThread(CefRefPtr<CefResourceManager> manager,
+                                     const std::string& url) {
+  EXPECT_IO_THREAD();
+
+  CefRefPtr<CefRequest> request = CefRequest::Create();
+  request->SetURL(url);
+
+  const base::TimeTicks start = base::TimeTicks::Now();
+  for (int i = 0; i < kLookupPerfIterations; ++i) {
+    EXPECT_EQ(RV_CONTINUE_ASYNC,
+              manager->OnBeforeResourceLoad(NULL, NULL, request, NULL));
+  }
+  const base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+
+  LOG(INFO) << "ResourceManagerTest.ProviderLookupPerf: " <<
+      kLookupPerfIterations << " lookups with " <<
+      (kLookupPerfProviderCount * 2 + 1) << " providers in " <<
+      elapsed.InMicroseconds() << "us (" <<
+      (elapsed.InMicroseconds() * 1000 / kLookupPerfIterations) <<
+      "ns per lookup)";
+}
+
+// Returns the contents provided by |handler|. The handler must provide the
+// contents synchronously.
+std::string ReadHandlerContents(CefRefPtr<CefResourceHandler> handler) {
+  CefRefPtr<CefResponse> response = CefResponse::Create();
+  int64 response_length = 0;
+  CefString redirect_url;
+  handler->GetResponseHeaders(response, response_length, redirect_url);
+
+  std::string contents;
+  char buffer[256];
+  int bytes_read = 0;
+  while (handler->ReadResponse(buffer, sizeof(buffer), bytes_read, NULL) &&
+         bytes_read > 0) {
+    contents.append(buffer, bytes_read);
+  }
+  EXPECT_EQ(response_length, static_cast<int64>(contents.size()));
+  return contents;
+}
+
+void StartProviderLookupOnIOThread(CefRefPtr<CefResourceManager> manager,
+                                   const std::string& url,
+                                   cef_return_value_t expected_result) {
+  EXPECT_IO_THREAD();
+
+  CefRefPtr<CefRequest> request = CefRequest::Create();
+  request->SetURL(url);
+  EXPECT_EQ(expected_result,
+            manager->OnBeforeResourceLoad(NULL, NULL, request, NULL));
+}
+
+// Verify the handler that resulted from the previous lookup. If
+// |expected_contents| is empty no handler is expected.
+void VerifyProviderLookupOnIOThread(CefRefPtr<CefResourceManager> manager,
+                                    const std::string& expected_contents) {
+  EXPECT_IO_THREAD();
+
+  CefRefPtr<CefResourceHandler> handler =
+      manager->GetResourceHandler(NULL, NULL, CefRequest::Create());
+  if (expected_contents.empty()) {
+    EXPECT_FALSE(handler.get());
+    return;
+  }
+
+  ASSERT_TRUE(handler.get());
+  EXPECT_STREQ(expected_contents.c_str(),
+               ReadHandlerContents(handler).c_str());
+}
+
+// Look up |url| and verify the resulting contents.
+void RunProviderLookup(CefRefPtr<CefResourceManager> manager,
+                       const std::string& url,
+                       cef_return_value_t expected_result,
+                       const std::string& expected_contents) {
+  CefPostTask(TID_IO,
+      base::Bind(StartProviderLookupOnIOThread, manager, url,
+                 expected_result));
+  // Providers continue requests asynchronously on the IO thread.
+  WaitForIOThread();
+
+  CefPostTask(TID_IO,
+      base::Bind(VerifyProviderLookupOnIOThread, manager, expected_contents));
+  WaitForIOThread();
+}
+
+}  // namespace
+
+// Benchmark provider lookup with many registered providers. Only the matching
+// content provider, which is ordered last, should be called for the request.
+TEST(ResourceManagerTest, ProviderLookupPerf) {
+  const char kUrlBase[] = "http://test.com/ResourceManager";
+  const std::string& url = kUrlBase + std::string("/Content.html");
+
+  CefRefPtr<CefResourceManager> manager = new CefResourceManager();
+
+  for (int i = 0; i < kLookupPerfProviderCount; ++i) {
+    const std::string& index = base::IntToString(i);
+    manager->AddDirectoryProvider(kUrlBase + std::string("/dir") + index,
+                                  "/nonexistent" + index, 0, std::string());
+    manager->AddContentProvider(kUrlBase + std::string("/") + index + ".html",
+                                "content", "text/html", 0, std::string());
+  }
+  manager->AddContentProvider(url, CreateContents("Success"), "text/html", 1,
+                              std::string());
+
+  CefPostTask(TID_IO,
+      base::Bind(RunProviderLookupPerfOnIOThread, manager, url));
+  WaitForIOThread();
+
+  // All requests in the benchmark share the same identifier so a single
+  // handler is pending.
+  CefPostTask(TID_IO,
+      base::Bind(VerifyProviderLookupOnIOThread, manager,
+                 CreateContents("Success")));
+  WaitForIOThread();
+
+  // Verify that the correct provider matches other URLs.
+  RunProviderLookup(manager, url, RV_CONTINUE_ASYNC,
+                    CreateContents("Success"));
+  RunProviderLookup(manager, kUrlBase + std::string("/0.html"),
+                    RV_CONTINUE_ASYNC, "content");
+  RunProviderLookup(manager,
+                    kUrlBase + std::string("/") +
+                        base::IntToString(kLookupPerfProviderCount - 1) +
+                        ".html",
+                    RV_CONTINUE_ASYNC, "content");
+  RunProviderLookup(manager, kUrlBase + std::string("/Missing.html"),
+                    RV_CONTINUE, std::string());
+  RunProviderLookup(manager, "http://other.com/Content.html", RV_CONTINUE,
+                    std::string());
+
+  manager = NULL;
+
+  // Wait for the manager to be deleted.
+  WaitForIOThread();
+}
@@ -29,8 +29,25 @@
 #include "include/cef_sandbox_win.h"
 #endif
 
+#if defined(OS_LINUX)
+#include "tests/unittests/test_message_pump.h"
+#endif
+
 namespace {
 
+// Quit the application message loop.
+void QuitMessageLoop() {
+#if defined(OS_LINUX)
+  TestMessagePump* message_pump = TestMessagePump::Get();
+  if (message_pump) {
+    message_pump->Quit();
+    return;
+  }
+#endif
+
+  CefQuitMessageLoop();
+}
+
 // Thread used to run the test suite.
 class CefTestThread : public base::Thread {
  public:
@@ -48,7 +65,7 @@ class CefTestThread : public base::Thread {
       base::PlatformThread::Sleep(base::TimeDelta::FromMilliseconds(100));
 
     // Quit the CEF message loop.
-    CefPostTask(TID_UI, base::Bind(&CefQuitMessageLoop));
+    CefPostTask(TID_UI, base::Bind(&QuitMessageLoop));
   }
 
   int retval() { return retval_; }
@@ -154,6 +171,13 @@ int main(int argc, char* argv[]) {
   XSetIOErrorHandler(XIOErrorHandlerImpl);
 #endif
 
+#if defined(OS_LINUX)
+  // Scheduling callbacks may arrive during CefInitialize().
+  scoped_ptr<TestMessagePump> message_pump;
+  if (settings.external_message_pump && !settings.multi_threaded_message_loop)
+    message_pump.reset(new TestMessagePump());
+#endif
+
   // Initialize CEF.
   CefInitialize(main_args, settings, app, windows_sandbox_info);
 
@@ -177,7 +201,12 @@ int main(int argc, char* argv[]) {
     CefPostTask(TID_UI, base::Bind(&RunTests, thread.get()));
 
     // Run the CEF message loop.
-    CefRunMessageLoop();
+#if defined(OS_LINUX)
+    if (message_pump)
+      message_pump->Run();
+    else
+#endif
+      CefRunMessageLoop();
 
     // The test suite has completed.
     retval = thread->retval();
@@ -189,6 +218,10 @@ int main(int argc, char* argv[]) {
   // Shut down CEF.
   CefShutdown();
 
+#if defined(OS_LINUX)
+  message_pump.reset();
+#endif
+
 #if defined(OS_MACOSX)
   // Platform-specific cleanup.
   extern void PlatformCleanup();
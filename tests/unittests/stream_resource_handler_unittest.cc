@@ -51,6 +51,10 @@ class ReadHandler : public CefReadHandler {
     return expected_result_;
   }
 
+  const std::string& content() const {
+    return content_;
+  }
+
   size_t Read(void* ptr, size_t size, size_t n) override {
     EXPECT_EQ(1U, size);
 
@@ -93,10 +97,31 @@ class ReadHandler : public CefReadHandler {
   IMPLEMENT_REFCOUNTING(ReadHandler);
 };
 
+class DataBlock : public CefResourceDataBlock {
+ public:
+  explicit DataBlock(const std::string& data)
+    : data_(data) {
+  }
+
+  void* GetData() override {
+    return const_cast<char*>(data_.data());
+  }
+
+  size_t GetSize() override {
+    return data_.size();
+  }
+
+ private:
+  const std::string data_;
+
+  IMPLEMENT_REFCOUNTING(DataBlock);
+};
+
 class ReadTestHandler : public RoutingTestHandler {
  public:
-  explicit ReadTestHandler(bool may_block)
+  ReadTestHandler(bool may_block, bool data_block)
       : may_block_(may_block),
+        data_block_(data_block),
         expected_result_(0) {}
 
   void RunTest() override {
@@ -120,6 +145,11 @@ class ReadTestHandler : public RoutingTestHandler {
     handler->CreateContent();
     expected_result_ = handler->GetExpectedResult();
 
+    if (data_block_) {
+      return new CefStreamResourceHandler("text/html",
+                                          new DataBlock(handler->content()));
+    }
+
     CefRefPtr<CefStreamReader> stream =
         CefStreamReader::CreateForHandler(handler.get());
     return new CefStreamResourceHandler("text/html", stream);
@@ -165,6 +195,7 @@ class ReadTestHandler : public RoutingTestHandler {
   }
 
   const bool may_block_;
+  const bool data_block_;
 
   int expected_result_;
   TrackCallback got_resource_handler_;
@@ -177,13 +208,19 @@ class ReadTestHandler : public RoutingTestHandler {
 }  // namespace
 
 TEST(StreamResourceHandlerTest, ReadWillBlock) {
-  CefRefPtr<ReadTestHandler> handler = new ReadTestHandler(true);
+  CefRefPtr<ReadTestHandler> handler = new ReadTestHandler(true, false);
   handler->ExecuteTest();
   ReleaseAndWaitForDestructor(handler);
 }
 
 TEST(StreamResourceHandlerTest, ReadWontBlock) {
-  CefRefPtr<ReadTestHandler> handler = new ReadTestHandler(false);
+  CefRefPtr<ReadTestHandler> handler = new ReadTestHandler(false, false);
+  handler->ExecuteTest();
+  ReleaseAndWaitForDestructor(handler);
+}
+
+TEST(StreamResourceHandlerTest, ReadDataBlock) {
+  CefRefPtr<ReadTestHandler> handler = new ReadTestHandler(false, true);
   handler->ExecuteTest();
   ReleaseAndWaitForDestructor(handler);
 }
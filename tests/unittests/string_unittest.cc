@@ -8,6 +8,10 @@
 // Include this first to avoid type conflicts with CEF headers.
 #include "tests/unittests/chromium_includes.h"
 
+#include "base/logging.h"
+#include "base/strings/stringprintf.h"
+#include "base/time/time.h"
+
 #include "include/base/cef_string16.h"
 #include "include/internal/cef_string.h"
 #include "include/internal/cef_string_list.h"
@@ -366,3 +370,193 @@ TEST(StringTest, Multimap) {
 
   cef_string_multimap_free(mapPtr);
 }
+
+// Test that string maps keep insertion order and ignore duplicate keys.
+TEST(StringTest, MapOrder) {
+  cef_string_map_t mapPtr = cef_string_map_alloc();
+
+  CefString key, value, str;
+  const char* kKeys[] = {"Key C", "Key A", "Key B", "Key A"};
+  const char* kValues[] = {"String C", "String A", "String B", "String A2"};
+  for (size_t i = 0; i < arraysize(kKeys); ++i) {
+    key = kKeys[i];
+    value = kValues[i];
+    EXPECT_TRUE(cef_string_map_append(mapPtr, key.GetStruct(),
+                                      value.GetStruct()));
+  }
+
+  // The duplicate key is ignored.
+  EXPECT_EQ(cef_string_map_size(mapPtr), 3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(cef_string_map_key(mapPtr, i, str.GetWritableStruct()));
+    EXPECT_EQ(str, kKeys[i]);
+    EXPECT_TRUE(cef_string_map_value(mapPtr, i, str.GetWritableStruct()));
+    EXPECT_EQ(str, kValues[i]);
+  }
+
+  key = "Key A";
+  EXPECT_TRUE(cef_string_map_find(mapPtr, key.GetStruct(),
+                                  str.GetWritableStruct()));
+  EXPECT_EQ(str, "String A");
+
+  key = "Key D";
+  EXPECT_FALSE(cef_string_map_find(mapPtr, key.GetStruct(),
+                                   str.GetWritableStruct()));
+
+  // Enough keys to grow the hash index several times.
+  cef_string_map_clear(mapPtr);
+  const int kCount = 1000;
+  for (int i = 0; i < kCount; ++i) {
+    key = base::StringPrintf("Key %d", i);
+    value = base::StringPrintf("String %d", i);
+    cef_string_map_append(mapPtr, key.GetStruct(), value.GetStruct());
+  }
+  EXPECT_EQ(cef_string_map_size(mapPtr), kCount);
+  for (int i = 0; i < kCount; ++i) {
+    key = base::StringPrintf("Key %d", i);
+    EXPECT_TRUE(cef_string_map_find(mapPtr, key.GetStruct(),
+                                    str.GetWritableStruct()));
+    EXPECT_EQ(str, base::StringPrintf("String %d", i));
+    EXPECT_TRUE(cef_string_map_key(mapPtr, i, str.GetWritableStruct()));
+    EXPECT_EQ(str, key);
+  }
+
+  cef_string_map_free(mapPtr);
+}
+
+// Test that string multimaps keep insertion order across and within keys.
+TEST(StringTest, MultimapOrder) {
+  cef_string_multimap_t mapPtr = cef_string_multimap_alloc();
+
+  CefString key, value, str;
+  const char* kKeys[] = {"Key C", "Key A", "Key C", "Key B", "Key C"};
+  const char* kValues[] = {"String C", "String A", "String C2", "String B",
+                           "String C3"};
+  for (size_t i = 0; i < arraysize(kKeys); ++i) {
+    key = kKeys[i];
+    value = kValues[i];
+    EXPECT_TRUE(cef_string_multimap_append(mapPtr, key.GetStruct(),
+                                           value.GetStruct()));
+  }
+
+  EXPECT_EQ(cef_string_multimap_size(mapPtr), 5);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(cef_string_multimap_key(mapPtr, i, str.GetWritableStruct()));
+    EXPECT_EQ(str, kKeys[i]);
+    EXPECT_TRUE(cef_string_multimap_value(mapPtr, i,
+                                          str.GetWritableStruct()));
+    EXPECT_EQ(str, kValues[i]);
+  }
+
+  key = "Key C";
+  EXPECT_EQ(cef_string_multimap_find_count(mapPtr, key.GetStruct()), 3);
+  EXPECT_TRUE(cef_string_multimap_enumerate(mapPtr, key.GetStruct(), 0,
+                                            str.GetWritableStruct()));
+  EXPECT_EQ(str, "String C");
+  EXPECT_TRUE(cef_string_multimap_enumerate(mapPtr, key.GetStruct(), 1,
+                                            str.GetWritableStruct()));
+  EXPECT_EQ(str, "String C2");
+  EXPECT_TRUE(cef_string_multimap_enumerate(mapPtr, key.GetStruct(), 2,
+                                            str.GetWritableStruct()));
+  EXPECT_EQ(str, "String C3");
+
+  key = "Key D";
+  EXPECT_EQ(cef_string_multimap_find_count(mapPtr, key.GetStruct()), 0);
+
+  cef_string_multimap_free(mapPtr);
+}
+
+namespace {
+
+typedef std::multimap<CefString, CefString> HeaderMap;
+
+// Number of simulated requests for each header count.
+const int kHeaderPerfIterations = 2000;
+
+// Populate |map| with |count| request headers.
+void BuildHeaderMap(size_t count, HeaderMap* map) {
+  map->insert(std::make_pair("Accept", "text/html,application/xhtml+xml"));
+  map->insert(std::make_pair("Accept-Encoding", "gzip, deflate"));
+  map->insert(std::make_pair("Accept-Language", "en-US,en;q=0.8"));
+  map->insert(std::make_pair("User-Agent", "Mozilla/5.0 (CEF) Chrome/47.0"));
+  for (size_t i = map->size(); i < count; ++i) {
+    map->insert(std::make_pair(base::StringPrintf("X-Custom-Header-%d",
+                                                  static_cast<int>(i)),
+                               "custom header value"));
+  }
+}
+
+// Copy |map| into and back out of a cef_string_multimap_t the same way that
+// HeaderMap values cross the library boundary. Returns the average cost per
+// copy in microseconds.
+double MeasureHeaderCopyCost(const HeaderMap& map) {
+  const base::TimeTicks start = base::TimeTicks::Now();
+  for (int i = 0; i < kHeaderPerfIterations; ++i) {
+    cef_string_multimap_t mapPtr = cef_string_multimap_alloc();
+    HeaderMap::const_iterator it = map.begin();
+    for (; it != map.end(); ++it) {
+      cef_string_multimap_append(mapPtr, it->first.GetStruct(),
+                                 it->second.GetStruct());
+    }
+
+    HeaderMap copy;
+    const int size = cef_string_multimap_size(mapPtr);
+    for (int j = 0; j < size; ++j) {
+      CefString key, value;
+      cef_string_multimap_key(mapPtr, j, key.GetWritableStruct());
+      cef_string_multimap_value(mapPtr, j, value.GetWritableStruct());
+      copy.insert(std::make_pair(key, value));
+    }
+    EXPECT_EQ(map.size(), copy.size());
+
+    cef_string_multimap_free(mapPtr);
+  }
+  const base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+  return elapsed.InMicrosecondsF() / kHeaderPerfIterations;
+}
+
+// Same as MeasureHeaderCopyCost but using the previous std::multimap storage
+// where each indexed access walks from begin().
+double MeasureTreeHeaderCopyCost(const HeaderMap& map) {
+  const base::TimeTicks start = base::TimeTicks::Now();
+  for (int i = 0; i < kHeaderPerfIterations; ++i) {
+    HeaderMap* impl = new HeaderMap;
+    HeaderMap::const_iterator it = map.begin();
+    for (; it != map.end(); ++it)
+      impl->insert(std::make_pair(it->first, it->second));
+
+    HeaderMap copy;
+    const int size = static_cast<int>(impl->size());
+    for (int j = 0; j < size; ++j) {
+      HeaderMap::const_iterator key_it = impl->begin();
+      for (int ct = 0; ct < j; ++ct)
+        ++key_it;
+      HeaderMap::const_iterator value_it = impl->begin();
+      for (int ct = 0; ct < j; ++ct)
+        ++value_it;
+      copy.insert(std::make_pair(key_it->first, value_it->second));
+    }
+    EXPECT_EQ(map.size(), copy.size());
+
+    delete impl;
+  }
+  const base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+  return elapsed.InMicrosecondsF() / kHeaderPerfIterations;
+}
+
+}  // namespace
+
+// Report the per-request cost of copying header maps through the C API.
+TEST(StringTest, MultimapHeaderCopyPerf) {
+  const size_t kHeaderCounts[] = {8, 32, 128};
+  for (size_t i = 0; i < arraysize(kHeaderCounts); ++i) {
+    HeaderMap map;
+    BuildHeaderMap(kHeaderCounts[i], &map);
+
+    const double cost = MeasureHeaderCopyCost(map);
+    const double tree_cost = MeasureTreeHeaderCopyCost(map);
+    LOG(INFO) << "StringTest.MultimapHeaderCopyPerf: " << map.size() <<
+        " headers: " << cost << " us/request, previous tree walk " <<
+        tree_cost << " us/request";
+  }
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#ifndef CEF_TESTS_UNITTESTS_TEST_MESSAGE_PUMP_H_
+#define CEF_TESTS_UNITTESTS_TEST_MESSAGE_PUMP_H_
+#pragma once
+
+#include <glib.h>
+#include <pthread.h>
+
+#include "base/basictypes.h"
+#include "base/synchronization/lock.h"
+#include "base/threading/platform_thread.h"
+#include "base/time/time.h"
+
+// Application message loop used when the test suite is run with the
+// "external-message-pump" command-line switch. CefDoMessageLoopWork() is called
+// from the default GLib main context when the descriptor returned by
+// cef_get_message_pump_fd() becomes readable, so the loop blocks in poll() while
+// idle. Linux only.
+class TestMessagePump {
+ public:
+  // Counters used for benchmarking.
+  struct Stats {
+    Stats() : work_calls(0), schedule_calls(0) {}
+
+    // Number of CefDoMessageLoopWork() calls.
+    int64 work_calls;
+    // Number of CefBrowserProcessHandler::OnScheduleMessagePumpWork()
+    // callbacks.
+    int64 schedule_calls;
+  };
+
+  // Must be created on the main application thread before CefInitialize().
+  TestMessagePump();
+  ~TestMessagePump();
+
+  // Returns the singleton instance or NULL if the external message pump is not
+  // in use.
+  static TestMessagePump* Get();
+
+  // Run the message loop until Quit() is called. Must be called on the main
+  // application thread after CefInitialize().
+  void Run();
+
+  // Quit the message loop. May be called on any thread.
+  void Quit();
+
+  // Count a scheduling request from CEF. Work itself is triggered by the CEF
+  // descriptor. May be called on any thread.
+  void OnScheduleMessagePumpWork(int64 delay_ms);
+
+  // Call CefDoMessageLoopWork() every |interval_ms| milliseconds and ignore
+  // the CEF descriptor. Pass 0 to return to scheduled mode. Used to compare
+  // scheduled work against fixed-interval polling. May be called on any thread.
+  void SetPollInterval(int64 interval_ms);
+
+  // Returns the current counters. May be called on any thread.
+  Stats GetStats();
+
+  // Returns the CPU time consumed so far by the main application thread. May be
+  // called on any thread.
+  base::TimeDelta GetMainThreadCPUTime() const;
+
+ private:
+  static gboolean SourcePrepare(GSource* source, gint* timeout_ms);
+  static gboolean SourceCheck(GSource* source);
+  static gboolean SourceDispatch(GSource* source,
+                                 GSourceFunc callback,
+                                 gpointer user_data);
+
+  // Returns the GLib poll timeout in milliseconds or -1 if no work is pending.
+  int GetTimeout();
+
+  // Perform pending work.
+  void DoWork();
+
+  // Watch the CEF descriptor only while not polling on a fixed interval.
+  // Called on the main application thread.
+  void UpdateCefPollFd();
+
+  // Wake the message loop from another thread.
+  void Wakeup();
+
+  bool IsQuitting();
+
+  const base::PlatformThreadId main_thread_id_;
+  const pthread_t main_thread_;
+
+  // Used to wake the loop for Quit() and SetPollInterval().
+  int event_fd_;
+  GSource* source_;
+  GPollFD poll_fd_;
+
+  // Only accessed on the main application thread.
+  GPollFD cef_poll_fd_;
+  bool cef_poll_fd_added_;
+
+  base::Lock lock_;
+
+  // The following members are protected by |lock_|.
+  // Time when work should next be performed regardless of the CEF descriptor.
+  // Null if no such work is scheduled.
+  base::TimeTicks work_time_;
+  int64 poll_interval_ms_;
+  bool quit_;
+  Stats stats_;
+
+  DISALLOW_COPY_AND_ASSIGN(TestMessagePump);
+};
+
+#endif  // CEF_TESTS_UNITTESTS_TEST_MESSAGE_PUMP_H_
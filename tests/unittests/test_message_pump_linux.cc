@@ -0,0 +1,270 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+// Include this first to avoid type conflicts with CEF headers.
+#include "tests/unittests/chromium_includes.h"
+
+#include "tests/unittests/test_message_pump.h"
+
+#include <sys/eventfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "base/logging.h"
+#include "base/posix/eintr_wrapper.h"
+
+#include "include/cef_app.h"
+#include "include/internal/cef_types_linux.h"
+#include "tests/cefclient/browser/client_app_browser.h"
+
+namespace {
+
+TestMessagePump* g_message_pump = NULL;
+
+struct WorkSource {
+  GSource source;
+  TestMessagePump* pump;
+};
+
+GSourceFuncs g_work_source_funcs = {
+  NULL,  // prepare
+  NULL,  // check
+  NULL,  // dispatch
+  NULL,  // finalize
+  NULL,  // closure_callback
+  NULL,  // closure_marshal
+};
+
+// Forwards scheduling requests from CEF to the TestMessagePump.
+class MessagePumpBrowserDelegate : public client::ClientAppBrowser::Delegate {
+ public:
+  MessagePumpBrowserDelegate() {}
+
+  void OnScheduleMessagePumpWork(CefRefPtr<client::ClientAppBrowser> app,
+                                 int64 delay_ms) override {
+    TestMessagePump* message_pump = TestMessagePump::Get();
+    if (message_pump)
+      message_pump->OnScheduleMessagePumpWork(delay_ms);
+  }
+
+ private:
+  IMPLEMENT_REFCOUNTING(MessagePumpBrowserDelegate);
+};
+
+}  // namespace
+
+TestMessagePump::TestMessagePump()
+    : main_thread_id_(base::PlatformThread::CurrentId()),
+      main_thread_(pthread_self()),
+      event_fd_(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+      source_(NULL),
+      cef_poll_fd_added_(false),
+      poll_interval_ms_(0),
+      quit_(false) {
+  DCHECK(!g_message_pump);
+  g_message_pump = this;
+
+  PCHECK(event_fd_ >= 0) << "eventfd failed";
+
+  g_work_source_funcs.prepare = &TestMessagePump::SourcePrepare;
+  g_work_source_funcs.check = &TestMessagePump::SourceCheck;
+  g_work_source_funcs.dispatch = &TestMessagePump::SourceDispatch;
+
+  source_ = g_source_new(&g_work_source_funcs, sizeof(WorkSource));
+  reinterpret_cast<WorkSource*>(source_)->pump = this;
+
+  poll_fd_.fd = event_fd_;
+  poll_fd_.events = G_IO_IN;
+  poll_fd_.revents = 0;
+  g_source_add_poll(source_, &poll_fd_);
+  g_source_attach(source_, NULL);
+
+  // The CEF descriptor is not available until CefInitialize() is called.
+  cef_poll_fd_.fd = -1;
+  cef_poll_fd_.events = G_IO_IN;
+  cef_poll_fd_.revents = 0;
+}
+
+TestMessagePump::~TestMessagePump() {
+  DCHECK_EQ(g_message_pump, this);
+
+  g_source_destroy(source_);
+  g_source_unref(source_);
+  close(event_fd_);
+
+  g_message_pump = NULL;
+}
+
+// static
+TestMessagePump* TestMessagePump::Get() {
+  return g_message_pump;
+}
+
+void TestMessagePump::Run() {
+  DCHECK_EQ(main_thread_id_, base::PlatformThread::CurrentId());
+
+  if (cef_poll_fd_.fd < 0) {
+    cef_poll_fd_.fd = cef_get_message_pump_fd();
+    PCHECK(cef_poll_fd_.fd >= 0) << "cef_get_message_pump_fd failed";
+  }
+
+  // Block in poll() until the CEF descriptor, the eventfd, the timeout or
+  // another GLib source (X11 events, for example) wakes us up.
+  while (!IsQuitting())
+    g_main_context_iteration(NULL, TRUE);
+
+  // The CEF descriptor is closed by CefShutdown().
+  if (cef_poll_fd_added_) {
+    g_source_remove_poll(source_, &cef_poll_fd_);
+    cef_poll_fd_added_ = false;
+  }
+  cef_poll_fd_.fd = -1;
+  cef_poll_fd_.revents = 0;
+}
+
+void TestMessagePump::Quit() {
+  {
+    base::AutoLock lock_scope(lock_);
+    quit_ = true;
+  }
+  Wakeup();
+}
+
+void TestMessagePump::OnScheduleMessagePumpWork(int64 delay_ms) {
+  base::AutoLock lock_scope(lock_);
+  stats_.schedule_calls++;
+}
+
+void TestMessagePump::SetPollInterval(int64 interval_ms) {
+  {
+    base::AutoLock lock_scope(lock_);
+    poll_interval_ms_ = interval_ms;
+
+    // Perform work as soon as possible in either mode so that nothing is missed
+    // while switching.
+    work_time_ = base::TimeTicks::Now();
+  }
+  Wakeup();
+}
+
+TestMessagePump::Stats TestMessagePump::GetStats() {
+  base::AutoLock lock_scope(lock_);
+  return stats_;
+}
+
+base::TimeDelta TestMessagePump::GetMainThreadCPUTime() const {
+  clockid_t clock_id;
+  struct timespec ts;
+  if (pthread_getcpuclockid(main_thread_, &clock_id) != 0 ||
+      clock_gettime(clock_id, &ts) != 0) {
+    NOTREACHED();
+    return base::TimeDelta();
+  }
+  return base::TimeDelta::FromSeconds(ts.tv_sec) +
+         base::TimeDelta::FromMicroseconds(
+             ts.tv_nsec / base::Time::kNanosecondsPerMicrosecond);
+}
+
+// static
+gboolean TestMessagePump::SourcePrepare(GSource* source, gint* timeout_ms) {
+  TestMessagePump* pump = reinterpret_cast<WorkSource*>(source)->pump;
+  pump->UpdateCefPollFd();
+  *timeout_ms = pump->GetTimeout();
+  return *timeout_ms == 0;
+}
+
+// static
+gboolean TestMessagePump::SourceCheck(GSource* source) {
+  TestMessagePump* pump = reinterpret_cast<WorkSource*>(source)->pump;
+  if ((pump->poll_fd_.revents | pump->cef_poll_fd_.revents) & G_IO_IN)
+    return TRUE;
+  return pump->GetTimeout() == 0;
+}
+
+// static
+gboolean TestMessagePump::SourceDispatch(GSource* source,
+                                         GSourceFunc callback,
+                                         gpointer user_data) {
+  reinterpret_cast<WorkSource*>(source)->pump->DoWork();
+  return TRUE;  // Keep the source.
+}
+
+int TestMessagePump::GetTimeout() {
+  base::AutoLock lock_scope(lock_);
+  if (work_time_.is_null())
+    return -1;
+
+  const base::TimeDelta delay = work_time_ - base::TimeTicks::Now();
+  if (delay <= base::TimeDelta())
+    return 0;
+  return static_cast<int>(delay.InMillisecondsRoundedUp());
+}
+
+void TestMessagePump::DoWork() {
+  // Consume any pending wakeups.
+  uint64_t value;
+  ignore_result(HANDLE_EINTR(read(event_fd_, &value, sizeof(value))));
+
+  {
+    base::AutoLock lock_scope(lock_);
+    if (quit_)
+      return;
+
+    const base::TimeTicks now = base::TimeTicks::Now();
+    const bool cef_ready = cef_poll_fd_added_ && poll_interval_ms_ == 0 &&
+                           (cef_poll_fd_.revents & G_IO_IN);
+    if (!cef_ready && (work_time_.is_null() || work_time_ > now)) {
+      // Woken up early. Wait for the new timeout.
+      return;
+    }
+
+    if (poll_interval_ms_ > 0)
+      work_time_ = now + base::TimeDelta::FromMilliseconds(poll_interval_ms_);
+    else
+      work_time_ = base::TimeTicks();
+
+    stats_.work_calls++;
+  }
+
+  CefDoMessageLoopWork();
+}
+
+void TestMessagePump::UpdateCefPollFd() {
+  if (cef_poll_fd_.fd < 0)
+    return;
+
+  bool polling;
+  {
+    base::AutoLock lock_scope(lock_);
+    polling = poll_interval_ms_ > 0;
+  }
+
+  // The CEF descriptor stays readable until CefDoMessageLoopWork() is called so
+  // it must not be watched while polling on a fixed interval.
+  if (polling && cef_poll_fd_added_) {
+    g_source_remove_poll(source_, &cef_poll_fd_);
+    cef_poll_fd_.revents = 0;
+    cef_poll_fd_added_ = false;
+  } else if (!polling && !cef_poll_fd_added_) {
+    g_source_add_poll(source_, &cef_poll_fd_);
+    cef_poll_fd_added_ = true;
+  }
+}
+
+void TestMessagePump::Wakeup() {
+  const uint64_t value = 1;
+  ignore_result(HANDLE_EINTR(write(event_fd_, &value, sizeof(value))));
+}
+
+bool TestMessagePump::IsQuitting() {
+  base::AutoLock lock_scope(lock_);
+  return quit_;
+}
+
+// Entry point for creating the message pump browser delegate.
+// Called from client_app_delegates.cc.
+void CreateMessagePumpBrowserDelegate(
+    client::ClientAppBrowser::DelegateSet& delegates) {
+  delegates.insert(new MessagePumpBrowserDelegate);
+}
@@ -0,0 +1,250 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+// Include this first to avoid type conflicts with CEF headers.
+#include "tests/unittests/chromium_includes.h"
+
+#include "tests/unittests/test_server.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "base/logging.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
+#include "base/synchronization/cancellation_flag.h"
+#include "base/threading/platform_thread.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+#if defined(OS_WIN)
+#include <winsock2.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#if defined(OS_WIN)
+typedef SOCKET SocketDescriptor;
+const SocketDescriptor kInvalidSocket = INVALID_SOCKET;
+void CloseSocket(SocketDescriptor s) { closesocket(s); }
+#else
+typedef int SocketDescriptor;
+const SocketDescriptor kInvalidSocket = -1;
+void CloseSocket(SocketDescriptor s) { close(s); }
+#endif
+
+// How often the server thread checks whether it should exit.
+const int kAcceptPollMs = 100;
+
+// Maximum time to wait for data on an accepted connection.
+const int kReceiveTimeoutMs = 5000;
+
+// Returns true if data is available to read from |s| within |timeout_ms|.
+bool WaitForData(SocketDescriptor s, int timeout_ms) {
+  fd_set read_fds;
+  FD_ZERO(&read_fds);
+  FD_SET(s, &read_fds);
+  struct timeval timeout;
+  timeout.tv_sec = timeout_ms / 1000;
+  timeout.tv_usec = (timeout_ms % 1000) * 1000;
+  return select(static_cast<int>(s) + 1, &read_fds, NULL, NULL,
+                &timeout) > 0;
+}
+
+// Appends data received from |s| to |data|. Returns false if the connection
+// was closed or no data arrived in time.
+bool Receive(SocketDescriptor s, std::string* data) {
+  if (!WaitForData(s, kReceiveTimeoutMs))
+    return false;
+  char buf[4096];
+  const int bytes = recv(s, buf, sizeof(buf), 0);
+  if (bytes <= 0)
+    return false;
+  data->append(buf, bytes);
+  return true;
+}
+
+}  // namespace
+
+class TestServer::Impl : public base::PlatformThread::Delegate {
+ public:
+  explicit Impl(Handler* handler)
+      : handler_(handler),
+        listen_socket_(kInvalidSocket),
+        port_(0),
+        started_(false) {
+#if defined(OS_WIN)
+    WSADATA wsa_data;
+    EXPECT_EQ(0, WSAStartup(MAKEWORD(2, 2), &wsa_data));
+#endif
+  }
+
+  ~Impl() override {
+    Stop();
+    if (listen_socket_ != kInvalidSocket)
+      CloseSocket(listen_socket_);
+#if defined(OS_WIN)
+    WSACleanup();
+#endif
+  }
+
+  bool Start() {
+    DCHECK(!started_);
+
+    listen_socket_ = socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_socket_ == kInvalidSocket)
+      return false;
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    if (bind(listen_socket_, reinterpret_cast<struct sockaddr*>(&addr),
+             sizeof(addr)) != 0 ||
+        listen(listen_socket_, SOMAXCONN) != 0) {
+      return false;
+    }
+
+#if defined(OS_WIN)
+    int addr_len = sizeof(addr);
+#else
+    socklen_t addr_len = sizeof(addr);
+#endif
+    if (getsockname(listen_socket_, reinterpret_cast<struct sockaddr*>(&addr),
+                    &addr_len) != 0) {
+      return false;
+    }
+    port_ = ntohs(addr.sin_port);
+
+    started_ = base::PlatformThread::Create(0, this, &thread_);
+    return started_;
+  }
+
+  void Stop() {
+    if (!started_)
+      return;
+    stop_flag_.Set();
+    base::PlatformThread::Join(thread_);
+    started_ = false;
+  }
+
+  std::string GetURL(const std::string& path) const {
+    return base::StringPrintf("http://127.0.0.1:%d/%s", port_, path.c_str());
+  }
+
+ private:
+  // base::PlatformThread::Delegate methods.
+  void ThreadMain() override {
+    while (!stop_flag_.IsSet()) {
+      if (!WaitForData(listen_socket_, kAcceptPollMs))
+        continue;
+      SocketDescriptor s = accept(listen_socket_, NULL, NULL);
+      if (s == kInvalidSocket)
+        continue;
+      HandleConnection(s);
+      CloseSocket(s);
+    }
+  }
+
+  void HandleConnection(SocketDescriptor s) {
+    // Read the request line and headers.
+    std::string data;
+    size_t headers_end;
+    while ((headers_end = data.find("\r\n\r\n")) == std::string::npos) {
+      if (!Receive(s, &data))
+        return;
+    }
+
+    Request request;
+
+    // Parse the request line, for example "GET /path HTTP/1.1".
+    const size_t method_end = data.find(' ');
+    const size_t path_end = data.find(' ', method_end + 1);
+    if (method_end == std::string::npos || path_end == std::string::npos ||
+        path_end > headers_end) {
+      return;
+    }
+    request.method = data.substr(0, method_end);
+    request.path = data.substr(method_end + 1, path_end - method_end - 1);
+
+    const std::string& headers =
+        base::StringToLowerASCII(data.substr(0, headers_end));
+    request.body = data.substr(headers_end + 4);
+
+    // Read the request body, if any.
+    size_t content_length = 0;
+    const char kContentLength[] = "\r\ncontent-length:";
+    const size_t pos = headers.find(kContentLength);
+    if (pos != std::string::npos) {
+      content_length = static_cast<size_t>(
+          atoi(headers.c_str() + pos + sizeof(kContentLength) - 1));
+    }
+    while (request.body.size() < content_length) {
+      if (!Receive(s, &request.body))
+        break;
+    }
+    request.body_complete = (request.body.size() == content_length);
+
+    Response response;
+    if (!handler_->OnRequest(request, &response))
+      return;
+
+    const std::string& response_data = base::StringPrintf(
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: %s\r\n"
+        "Content-Length: %d\r\n"
+        "Connection: close\r\n"
+        "%s"
+        "\r\n",
+        response.content_type.c_str(),
+        static_cast<int>(response.body.size()),
+        response.headers.c_str()) + response.body;
+
+    size_t offset = 0;
+    while (offset < response_data.size()) {
+      const int bytes = send(s, response_data.data() + offset,
+                             static_cast<int>(response_data.size() - offset),
+                             0);
+      if (bytes <= 0)
+        return;
+      offset += bytes;
+    }
+  }
+
+  Handler* handler_;
+  SocketDescriptor listen_socket_;
+  int port_;
+
+  bool started_;
+  base::PlatformThreadHandle thread_;
+  base::CancellationFlag stop_flag_;
+
+  DISALLOW_COPY_AND_ASSIGN(Impl);
+};
+
+TestServer::TestServer(Handler* handler)
+    : impl_(new Impl(handler)) {
+}
+
+TestServer::~TestServer() {
+}
+
+bool TestServer::Start() {
+  return impl_->Start();
+}
+
+void TestServer::Stop() {
+  impl_->Stop();
+}
+
+std::string TestServer::GetURL(const std::string& path) const {
+  return impl_->GetURL(path);
+}
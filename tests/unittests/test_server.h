@@ -0,0 +1,77 @@
+// Copyright (c) 2015 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#ifndef CEF_TESTS_UNITTESTS_TEST_SERVER_H_
+#define CEF_TESTS_UNITTESTS_TEST_SERVER_H_
+#pragma once
+
+#include <string>
+
+#include "include/base/cef_macros.h"
+#include "include/base/cef_scoped_ptr.h"
+
+// Minimal HTTP server that listens on the loopback interface. Scheme handlers
+// bypass the network stack so this is used by tests that need the network
+// stack to send requests or receive responses, such as upload and HTTP cache
+// tests. Connections are handled one at a time on a separate thread and each
+// connection carries a single request.
+class TestServer {
+ public:
+  struct Request {
+    Request() : body_complete(false) {}
+
+    std::string method;
+    std::string path;
+    std::string body;
+
+    // False if the connection ended before the number of bytes specified by
+    // the Content-Length header was received.
+    bool body_complete;
+  };
+
+  struct Response {
+    Response() : content_type("text/plain") {}
+
+    std::string content_type;
+
+    // Additional header lines, each terminated by "\r\n".
+    std::string headers;
+
+    std::string body;
+  };
+
+  class Handler {
+   public:
+    // Called on the server thread for each request. Fill |response| and return
+    // true to send a "200 OK" response, or return false to close the
+    // connection without responding.
+    virtual bool OnRequest(const Request& request, Response* response) =0;
+
+   protected:
+    virtual ~Handler() {}
+  };
+
+  // |handler| must outlive this object.
+  explicit TestServer(Handler* handler);
+  ~TestServer();
+
+  // Start listening on a random port. Returns false on failure.
+  bool Start();
+
+  // Stop accepting connections and wait for the server thread to exit. Results
+  // recorded by the Handler may be read safely after this method returns.
+  void Stop();
+
+  // Returns the URL for |path| on this server. |path| should not start with a
+  // slash.
+  std::string GetURL(const std::string& path) const;
+
+ private:
+  class Impl;
+  scoped_ptr<Impl> impl_;
+
+  DISALLOW_COPY_AND_ASSIGN(TestServer);
+};
+
+#endif  // CEF_TESTS_UNITTESTS_TEST_SERVER_H_
@@ -9,6 +9,8 @@
 
 #include "base/command_line.h"
 #include "base/logging.h"
+#include "base/process/launch.h"
+#include "base/process/process.h"
 #include "base/test/test_suite.h"
 
 #if defined(OS_MACOSX)
@@ -19,6 +21,7 @@
 #include "base/test/test_timeouts.h"
 #endif
 
+#include "testing/gtest/include/gtest/gtest.h"
 #include "tests/cefclient/common/client_switches.h"
 
 base::CommandLine* CefTestSuite::commandline_ = NULL;
@@ -51,6 +54,12 @@ void CefTestSuite::GetSettings(CefSettings& settings) {
       commandline_->HasSwitch(client::switches::kMultiThreadedMessageLoop);
 #endif
 
+#if defined(OS_LINUX)
+  // The application message loop is provided by TestMessagePump.
+  settings.external_message_pump =
+      commandline_->HasSwitch(client::switches::kExternalMessagePump);
+#endif
+
   CefString(&settings.cache_path) =
       commandline_->GetSwitchValueASCII(client::switches::kCachePath);
 
@@ -87,6 +96,35 @@ bool CefTestSuite::GetCachePath(std::string& path) {
   return false;
 }
 
+// static
+bool CefTestSuite::RunCurrentTestWithSwitch(const std::string& switch_name) {
+  const base::CommandLine& current_command_line =
+      *base::CommandLine::ForCurrentProcess();
+  if (current_command_line.HasSwitch(switch_name))
+    return true;
+
+  const ::testing::TestInfo* test_info =
+      ::testing::UnitTest::GetInstance()->current_test_info();
+  const std::string& filter =
+      std::string(test_info->test_case_name()) + "." + test_info->name();
+
+  // The last --gtest_filter value takes precedence.
+  base::CommandLine command_line(current_command_line);
+  command_line.AppendSwitch(switch_name);
+  command_line.AppendSwitchASCII("gtest_filter", filter);
+
+  base::Process process =
+      base::LaunchProcess(command_line, base::LaunchOptions());
+  EXPECT_TRUE(process.IsValid());
+  if (!process.IsValid())
+    return false;
+
+  int exit_code = -1;
+  EXPECT_TRUE(process.WaitForExit(&exit_code));
+  EXPECT_EQ(0, exit_code) << filter << " failed with --" << switch_name;
+  return false;
+}
+
 #if defined(OS_MACOSX)
 void CefTestSuite::Initialize() {
   // The below code is copied from base/test/test_suite.cc to avoid calling
@@ -27,6 +27,12 @@ class CefTestSuite : public base::TestSuite {
   static void GetSettings(CefSettings& settings);
   static bool GetCachePath(std::string& path);
 
+  // Returns true if the current process was launched with |switch_name|.
+  // Otherwise, runs the current test in a child process with |switch_name|
+  // added to the command line, expects it to succeed and returns false. Used
+  // for tests that depend on process-wide configuration.
+  static bool RunCurrentTestWithSwitch(const std::string& switch_name);
+
  protected:
 #if defined(OS_MACOSX)
   virtual void Initialize();
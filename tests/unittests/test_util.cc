@@ -45,6 +45,11 @@ void TestPostDataElementEqual(CefRefPtr<CefPostDataElement> elem1,
     }  break;
     case PDE_TYPE_FILE:
       EXPECT_EQ(elem1->GetFile(), elem2->GetFile());
+      EXPECT_EQ(elem1->GetFileOffset(), elem2->GetFileOffset());
+      EXPECT_EQ(elem1->GetFileLength(), elem2->GetFileLength());
+      break;
+    case PDE_TYPE_STREAM:
+      EXPECT_EQ(elem1->GetStreamLength(), elem2->GetStreamLength());
       break;
     default:
       break;
@@ -60,7 +65,7 @@ void TestPostDataEqual(CefRefPtr<CefPostData> postData1,
 
   CefPostData::ElementVector ev1, ev2;
   postData1->GetElements(ev1);
-  postData1->GetElements(ev2);
+  postData2->GetElements(ev2);
   ASSERT_EQ(ev1.size(), ev2.size());
 
   CefPostData::ElementVector::const_iterator it1 = ev1.begin();
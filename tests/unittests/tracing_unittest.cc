@@ -7,9 +7,11 @@
 
 #include "base/files/file_util.h"
 #include "base/synchronization/waitable_event.h"
+#include "base/time/time.h"
 
 #include "include/base/cef_bind.h"
 #include "include/base/cef_trace_event.h"
+#include "include/cef_parser.h"
 #include "include/cef_task.h"
 #include "include/cef_trace.h"
 #include "include/wrapper/cef_closure_task.h"
@@ -420,6 +422,249 @@ TRACING_TEST(TraceEventAsyncEnd1, TT_TRACE_EVENT_ASYNC_END1);
 TRACING_TEST(TraceEventAsyncEnd2, TT_TRACE_EVENT_ASYNC_END2);
 TRACING_TEST(TraceEventCopyAsyncEnd0, TT_TRACE_EVENT_COPY_ASYNC_END0);
 
+namespace {
+
+enum TracingDataTestType {
+  TDT_END_TRACING,
+  TDT_MONITORING_SNAPSHOT
+};
+
+// Test delivery of trace data in memory via CefTraceDataCallback.
+class TracingDataTestHandler : public CefTraceDataCallback,
+                               public CefCompletionCallback {
+ public:
+  TracingDataTestHandler(TracingDataTestType type, const char* trace_type)
+      : completion_event_(true, false),
+        trace_type_(trace_type),
+        type_(type),
+        started_(false),
+        chunk_count_(0) {
+  }
+
+  void RunTracing() {
+    EXPECT_UI_THREAD();
+
+    // Results in a call to OnComplete.
+    if (type_ == TDT_END_TRACING)
+      EXPECT_TRUE(CefBeginTracing(kTraceTestCategory, this));
+    else
+      EXPECT_TRUE(CefBeginTraceMonitoring(kTraceTestCategory, this));
+  }
+
+  // CefCompletionCallback method:
+  void OnComplete() override {
+    EXPECT_UI_THREAD();
+
+    if (started_) {
+      // Monitoring has stopped.
+      completion_event_.Signal();
+      return;
+    }
+    started_ = true;
+
+    TRACE_EVENT_INSTANT0(kTraceTestCategory, trace_type_);
+
+    // Results in calls to OnTraceDataChunk and OnTraceDataComplete.
+    if (type_ == TDT_END_TRACING) {
+      EXPECT_TRUE(CefEndTracingToCallback(this));
+    } else {
+      EXPECT_TRUE(CefCaptureTraceMonitoringSnapshot(this));
+      // Only one snapshot may be pending at a time.
+      EXPECT_FALSE(CefCaptureTraceMonitoringSnapshot(this));
+    }
+  }
+
+  // CefTraceDataCallback methods:
+  void OnTraceDataChunk(const void* data, size_t data_size) override {
+    EXPECT_UI_THREAD();
+    trace_data_.append(static_cast<const char*>(data), data_size);
+    chunk_count_++;
+  }
+
+  void OnTraceDataComplete() override {
+    EXPECT_UI_THREAD();
+
+    if (type_ == TDT_END_TRACING) {
+      completion_event_.Signal();
+    } else {
+      // Results in a call to OnComplete.
+      EXPECT_TRUE(CefEndTraceMonitoring(this));
+    }
+  }
+
+  void ExecuteTest() {
+    // Run the test.
+    CefPostTask(TID_UI, base::Bind(&TracingDataTestHandler::RunTracing, this));
+
+    // Wait for the test to complete.
+    completion_event_.Wait();
+
+    // Verify the results.
+    EXPECT_GT(chunk_count_, 1);
+    EXPECT_EQ(0U, trace_data_.find("{\"traceEvents\":["));
+    EXPECT_EQ(trace_data_.size() - 2, trace_data_.rfind("]}"));
+    EXPECT_TRUE(strstr(trace_data_.c_str(), trace_type_) != NULL);
+
+    CefRefPtr<CefValue> value = CefParseJSON(trace_data_, JSON_PARSER_RFC);
+    EXPECT_TRUE(value.get());
+    if (value.get())
+      EXPECT_EQ(VTYPE_DICTIONARY, value->GetType());
+  }
+
+ private:
+  ~TracingDataTestHandler() override {}
+
+  // Handle used to notify when the test is complete.
+  base::WaitableEvent completion_event_;
+
+  const char* trace_type_;
+  TracingDataTestType type_;
+  bool started_;
+  int chunk_count_;
+  std::string trace_data_;
+
+  IMPLEMENT_REFCOUNTING(TracingDataTestHandler);
+};
+
+}  // namespace
+
+// Test that trace data can be delivered in memory when tracing ends.
+TEST(TracingTest, EndTracingToCallback) {
+  CefRefPtr<TracingDataTestHandler> handler =
+      new TracingDataTestHandler(TDT_END_TRACING, "TDT_END_TRACING");
+  handler->ExecuteTest();
+}
+
+// Test that a monitoring snapshot can be captured without stopping.
+TEST(TracingTest, MonitoringSnapshot) {
+  CefRefPtr<TracingDataTestHandler> handler =
+      new TracingDataTestHandler(TDT_MONITORING_SNAPSHOT,
+                                 "TDT_MONITORING_SNAPSHOT");
+  handler->ExecuteTest();
+}
+
+namespace {
+
+const char kTracePerfCategory[] = "test_perf_category";
+const int kTracePerfDisabledIterations = 1000000;
+const int kTracePerfEnabledIterations = 10000;
+
+// Returns the average cost in nanoseconds of a TRACE_EVENT0 begin/end pair.
+double MeasureTraceEventCost(int iterations) {
+  const base::TimeTicks start = base::TimeTicks::Now();
+  for (int i = 0; i < iterations; ++i) {
+    TRACE_EVENT0(kTracePerfCategory, "MeasureTraceEventCost");
+  }
+  const base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+  return elapsed.InMicrosecondsF() * 1000.0 / iterations;
+}
+
+// Returns the average cost in nanoseconds of calling the exported begin/end
+// functions directly. This is the cost of every disabled event without the
+// client-side category cache.
+double MeasureExportedCallCost(int iterations) {
+  const base::TimeTicks start = base::TimeTicks::Now();
+  for (int i = 0; i < iterations; ++i) {
+    cef_trace_event_begin(kTracePerfCategory, "MeasureExportedCallCost",
+                          NULL, 0, NULL, 0, false);
+    cef_trace_event_end(kTracePerfCategory, "MeasureExportedCallCost",
+                        NULL, 0, NULL, 0, false);
+  }
+  const base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+  return elapsed.InMicrosecondsF() * 1000.0 / iterations;
+}
+
+class TracingPerfTestHandler : public CefEndTracingCallback,
+                               public CefCompletionCallback {
+ public:
+  TracingPerfTestHandler()
+      : completion_event_(true, false),
+        enabled_cost_(0),
+        enabled_flag_(0) {
+  }
+
+  void DeleteTracingFile(const base::FilePath& file_path) {
+    EXPECT_FILE_THREAD();
+    base::DeleteFile(file_path, false);
+    completion_event_.Signal();
+  }
+
+  // CefEndTracingCallback method:
+  void OnEndTracingComplete(const CefString& tracing_file) override {
+    EXPECT_UI_THREAD();
+
+#if defined(OS_WIN)
+    base::FilePath file_path(tracing_file.ToWString());
+#else
+    base::FilePath file_path(tracing_file.ToString());
+#endif
+    CefPostTask(TID_FILE,
+        base::Bind(&TracingPerfTestHandler::DeleteTracingFile, this,
+                   file_path));
+  }
+
+  void RunTracing() {
+    EXPECT_UI_THREAD();
+
+    // Results in a call to OnComplete.
+    CefBeginTracing(kTracePerfCategory, this);
+  }
+
+  void OnComplete() override {
+    EXPECT_UI_THREAD();
+
+    enabled_flag_ = *cef_trace_event_get_category_enabled(kTracePerfCategory);
+    enabled_cost_ = MeasureTraceEventCost(kTracePerfEnabledIterations);
+
+    // Results in a call to OnEndTracingComplete.
+    CefEndTracing(CefString(), this);
+  }
+
+  void ExecuteTest() {
+    CefPostTask(TID_UI, base::Bind(&TracingPerfTestHandler::RunTracing, this));
+    completion_event_.Wait();
+  }
+
+  double enabled_cost() const { return enabled_cost_; }
+  unsigned char enabled_flag() const { return enabled_flag_; }
+
+ private:
+  ~TracingPerfTestHandler() override {}
+
+  base::WaitableEvent completion_event_;
+  double enabled_cost_;
+  unsigned char enabled_flag_;
+
+  IMPLEMENT_REFCOUNTING(TracingPerfTestHandler);
+};
+
+}  // namespace
+
+// Verify that the cached enabled flag follows CefBeginTracing/CefEndTracing
+// and report the per-event cost in both states.
+TEST(TracingTest, TraceEventPerf) {
+  const unsigned char* enabled_flag =
+      cef_trace_event_get_category_enabled(kTracePerfCategory);
+  ASSERT_TRUE(enabled_flag != NULL);
+  EXPECT_EQ(enabled_flag,
+            cef_trace_event_get_category_enabled(kTracePerfCategory));
+  EXPECT_EQ(0, *enabled_flag);
+
+  const double disabled_cost =
+      MeasureTraceEventCost(kTracePerfDisabledIterations);
+  const double exported_cost =
+      MeasureExportedCallCost(kTracePerfDisabledIterations);
+
+  CefRefPtr<TracingPerfTestHandler> handler = new TracingPerfTestHandler();
+  handler->ExecuteTest();
+
+  EXPECT_NE(0, handler->enabled_flag());
+  EXPECT_EQ(0, *enabled_flag);
+
+  LOG(INFO) << "TracingTest.TraceEventPerf: disabled " << disabled_cost <<
+      " ns/event, disabled exported call " << exported_cost <<
+      " ns/event, enabled " << handler->enabled_cost() << " ns/event";
+}
 
 TEST(TracingTest, NowFromSystemTraceTime) {
   int64 val = CefNowFromSystemTraceTime();
@@ -21,6 +21,7 @@
 #include "testing/gtest/include/gtest/gtest.h"
 #include "tests/cefclient/renderer/client_app_renderer.h"
 #include "tests/unittests/test_handler.h"
+#include "tests/unittests/test_server.h"
 #include "tests/unittests/test_suite.h"
 #include "tests/unittests/test_util.h"
 
@@ -49,8 +50,12 @@ enum RequestTestMode {
   REQTEST_GET_NODATA,
   REQTEST_GET_ALLOWCOOKIES,
   REQTEST_GET_REDIRECT,
+  REQTEST_GET_POOLED,
+  REQTEST_GET_STREAM_WRITER,
   REQTEST_POST,
   REQTEST_POST_FILE,
+  REQTEST_POST_FILE_RANGE,
+  REQTEST_POST_STREAM,
   REQTEST_POST_WITHPROGRESS,
   REQTEST_HEAD,
 };
@@ -66,6 +71,7 @@ struct RequestRunSettings {
     : expect_upload_progress(false),
       expect_download_progress(true),
       expect_download_data(true),
+      download_to_stream(false),
       expected_status(UR_SUCCESS),
       expected_error_code(ERR_NONE),
       expect_send_cookie(false),
@@ -82,6 +88,9 @@ struct RequestRunSettings {
   // Optional response data that will be returned by the scheme handler.
   std::string response_data;
 
+  // If non-empty the scheme handler will expect to receive this upload data.
+  std::string expected_upload_data;
+
   // If true upload progress notification will be expected.
   bool expect_upload_progress;
 
@@ -91,6 +100,10 @@ struct RequestRunSettings {
   // If true download data will be expected.
   bool expect_download_data;
 
+  // If true the response data will be written to a CefStreamWriter instead of
+  // being delivered via OnDownloadData.
+  bool download_to_stream;
+
   // Expected status value.
   CefURLRequest::Status expected_status;
 
@@ -129,6 +142,29 @@ void SetUploadFile(CefRefPtr<CefRequest> request,
   request->SetPostData(postData);
 }
 
+void SetUploadFileRange(CefRefPtr<CefRequest> request,
+                        const base::FilePath& file,
+                        int64 offset,
+                        int64 length) {
+  CefRefPtr<CefPostData> postData = CefPostData::Create();
+  CefRefPtr<CefPostDataElement> element = CefPostDataElement::Create();
+  element->SetToFileRange(file.value(), offset, length);
+  postData->AddElement(element);
+  request->SetPostData(postData);
+}
+
+void SetUploadStream(CefRefPtr<CefRequest> request,
+                     const std::string& data) {
+  CefRefPtr<CefPostData> postData = CefPostData::Create();
+  CefRefPtr<CefPostDataElement> element = CefPostDataElement::Create();
+  element->SetToStream(
+      CefStreamReader::CreateForData(const_cast<char*>(data.data()),
+                                     data.size()),
+      data.size());
+  postData->AddElement(element);
+  request->SetPostData(postData);
+}
+
 void GetUploadData(CefRefPtr<CefRequest> request,
                    std::string& data) {
   CefRefPtr<CefPostData> postData = request->GetPostData();
@@ -146,6 +182,65 @@ void GetUploadData(CefRefPtr<CefRequest> request,
   EXPECT_EQ(size, element->GetBytes(size, const_cast<char*>(data.c_str())));
 }
 
+// Read the contents of all elements in |postData|, as the server would receive
+// them, into |data|.
+void ReadUploadData(CefRefPtr<CefPostData> postData,
+                    std::string& data) {
+  EXPECT_TRUE(postData.get());
+  CefPostData::ElementVector elements;
+  postData->GetElements(elements);
+
+  CefPostData::ElementVector::const_iterator it = elements.begin();
+  for (; it != elements.end(); ++it) {
+    CefRefPtr<CefPostDataElement> element = *it;
+
+    CefRefPtr<CefStreamReader> stream;
+    int64 length = -1;
+    switch (element->GetType()) {
+      case PDE_TYPE_BYTES: {
+        const size_t size = element->GetBytesCount();
+        std::string bytes(size, '\0');
+        EXPECT_EQ(size, element->GetBytes(size, &bytes[0]));
+        data += bytes;
+      }  break;
+      case PDE_TYPE_FILE:
+        stream = CefStreamReader::CreateForFile(element->GetFile());
+        EXPECT_TRUE(stream.get());
+        if (stream.get()) {
+          EXPECT_EQ(0, stream->Seek(element->GetFileOffset(), SEEK_SET));
+          length = element->GetFileLength();
+        }
+        break;
+      case PDE_TYPE_STREAM:
+        // Streams are only read by the network stack. Handlers receive the
+        // length, which is verified by TestRequestEqual().
+        EXPECT_FALSE(element->GetStream().get());
+        break;
+      default:
+        ADD_FAILURE() << "Unexpected empty element";
+        break;
+    }
+
+    if (!stream.get())
+      continue;
+
+    // A length of -1 means the remainder of the file.
+    char buff[4096];
+    while (length != 0) {
+      size_t to_read = sizeof(buff);
+      if (length > 0 && static_cast<int64>(to_read) > length)
+        to_read = static_cast<size_t>(length);
+      const size_t read = stream->Read(buff, 1, to_read);
+      if (read == 0)
+        break;
+      data.append(buff, read);
+      if (length > 0)
+        length -= read;
+    }
+    EXPECT_TRUE(length <= 0);
+  }
+}
+
 // Set a cookie so that we can test if it's sent with the request.
 void SetTestCookie(CefRefPtr<CefRequestContext> request_context,
                    base::WaitableEvent* event) {
@@ -239,6 +334,19 @@ class RequestSchemeHandler : public CefResourceHandler {
     // Verify that the request was sent correctly.
     TestRequestEqual(settings_.request, request, true);
 
+    if (!settings_.expected_upload_data.empty()) {
+      // Verify that the upload data arrived intact.
+      std::string upload_data;
+      ReadUploadData(request->GetPostData(), upload_data);
+      EXPECT_EQ(settings_.expected_upload_data.size(), upload_data.size());
+      EXPECT_TRUE(settings_.expected_upload_data == upload_data);
+    } else if (request->GetPostData().get()) {
+      // Only stream elements, which cannot be read here, are expected.
+      std::string upload_data;
+      ReadUploadData(request->GetPostData(), upload_data);
+      EXPECT_TRUE(upload_data.empty());
+    }
+
     // HEAD requests are identical to GET requests except no response data is
     // sent.
     if (request->GetMethod() == "HEAD")
@@ -472,8 +580,9 @@ class RequestClient : public CefURLRequestClient {
     virtual ~Delegate() {}
   };
 
-  explicit RequestClient(Delegate* delegate)
+  RequestClient(Delegate* delegate, bool download_to_stream)
     : delegate_(delegate),
+      download_to_stream_(download_to_stream),
       request_complete_ct_(0),
       upload_progress_ct_(0),
       download_progress_ct_(0),
@@ -523,6 +632,40 @@ class RequestClient : public CefURLRequestClient {
     download_data_ += std::string(static_cast<const char*>(data), data_length);
   }
 
+  CefRefPtr<CefStreamWriter> GetDownloadStreamWriter(
+      CefRefPtr<CefURLRequest> request) override {
+    if (!download_to_stream_)
+      return NULL;
+
+    // The writer does not block so it will be accessed on the IO thread. The
+    // contents are only read after the request completes.
+    class Handler : public CefWriteHandler {
+     public:
+      explicit Handler(std::string* data) : data_(data) {}
+
+      size_t Write(const void* ptr, size_t size, size_t n) override {
+        data_->append(static_cast<const char*>(ptr), size * n);
+        return n;
+      }
+      int Seek(int64 offset, int whence) override {
+        if (whence != SEEK_SET || offset > static_cast<int64>(data_->size()))
+          return -1;
+        data_->resize(static_cast<size_t>(offset));
+        return 0;
+      }
+      int64 Tell() override { return data_->size(); }
+      int Flush() override { return 0; }
+      bool MayBlock() override { return false; }
+
+     private:
+      std::string* data_;
+
+      IMPLEMENT_REFCOUNTING(Handler);
+    };
+
+    return CefStreamWriter::CreateForHandler(new Handler(&stream_data_));
+  }
+
    bool GetAuthCredentials(bool isProxy,
                            const CefString& host,
                            int port,
@@ -534,6 +677,7 @@ class RequestClient : public CefURLRequestClient {
 
  private:
   Delegate* delegate_;
+  bool download_to_stream_;
 
  public:
   int request_complete_ct_;
@@ -544,6 +688,7 @@ class RequestClient : public CefURLRequestClient {
   uint64 upload_total_;
   uint64 download_total_;
   std::string download_data_;
+  std::string stream_data_;
   CefRefPtr<CefRequest> request_;
   CefURLRequest::Status status_;
   CefURLRequest::ErrorCode error_code_;
@@ -583,8 +728,14 @@ class RequestTestRunner : public base::RefCountedThreadSafe<RequestTestRunner> {
     REGISTER_TEST(REQTEST_GET_ALLOWCOOKIES, SetupGetAllowCookiesTest,
                   GenericRunTest);
     REGISTER_TEST(REQTEST_GET_REDIRECT, SetupGetRedirectTest, GenericRunTest);
+    REGISTER_TEST(REQTEST_GET_POOLED, SetupGetPooledTest, GenericRunTest);
+    REGISTER_TEST(REQTEST_GET_STREAM_WRITER, SetupGetStreamWriterTest,
+                  GenericRunTest);
     REGISTER_TEST(REQTEST_POST, SetupPostTest, GenericRunTest);
     REGISTER_TEST(REQTEST_POST_FILE, SetupPostFileTest, GenericRunTest);
+    REGISTER_TEST(REQTEST_POST_FILE_RANGE, SetupPostFileRangeTest,
+                  GenericRunTest);
+    REGISTER_TEST(REQTEST_POST_STREAM, SetupPostStreamTest, GenericRunTest);
     REGISTER_TEST(REQTEST_POST_WITHPROGRESS, SetupPostWithProgressTest,
                   GenericRunTest);
     REGISTER_TEST(REQTEST_HEAD, SetupHeadTest, GenericRunTest);
@@ -677,11 +828,34 @@ class RequestTestRunner : public base::RefCountedThreadSafe<RequestTestRunner> {
     settings_.redirect_response->SetHeaderMap(headerMap);
   }
 
+  void SetupGetPooledTest() {
+    // Start with the normal get test.
+    SetupGetTest();
+
+    // Deliver download data from pooled buffers.
+    settings_.request->SetFlags(UR_FLAG_POOLED_DOWNLOAD_DATA);
+
+    // Large enough to require more reads than there are pooled buffers.
+    settings_.response_data.assign(256 * 1024, 'x');
+  }
+
+  void SetupGetStreamWriterTest() {
+    // Start with the normal get test.
+    SetupGetTest();
+
+    // Write download data to a stream instead of OnDownloadData.
+    settings_.download_to_stream = true;
+    settings_.expect_download_data = false;
+
+    settings_.response_data.assign(64 * 1024, 'x');
+  }
+
   void SetupPostTest() {
     settings_.request = CefRequest::Create();
     settings_.request->SetURL(MakeSchemeURL("PostTest.html"));
     settings_.request->SetMethod("POST");
     SetUploadData(settings_.request, "the_post_data");
+    settings_.expected_upload_data = "the_post_data";
 
     settings_.response = CefResponse::Create();
     settings_.response->SetMimeType("text/html");
@@ -703,6 +877,51 @@ class RequestTestRunner : public base::RefCountedThreadSafe<RequestTestRunner> {
     int write_ct = base::WriteFile(path, content, sizeof(content) - 1);
     EXPECT_EQ(static_cast<int>(sizeof(content) - 1), write_ct);
     SetUploadFile(settings_.request, path);
+    settings_.expected_upload_data = content;
+
+    settings_.response = CefResponse::Create();
+    settings_.response->SetMimeType("text/html");
+    settings_.response->SetStatus(200);
+    settings_.response->SetStatusText("OK");
+
+    settings_.response_data = "POST TEST SUCCESS";
+  }
+
+  void SetupPostFileRangeTest() {
+    settings_.request = CefRequest::Create();
+    settings_.request->SetURL(MakeSchemeURL("PostFileRangeTest.html"));
+    settings_.request->SetMethod("POST");
+
+    EXPECT_TRUE(post_file_tmpdir_.CreateUniqueTempDir());
+    const base::FilePath& path =
+        post_file_tmpdir_.path().Append(FILE_PATH_LITERAL("example.txt"));
+    const char content[] = "SKIPPED HELLO FRIEND! SKIPPED";
+    int write_ct = base::WriteFile(path, content, sizeof(content) - 1);
+    EXPECT_EQ(static_cast<int>(sizeof(content) - 1), write_ct);
+
+    // Only upload the middle portion of the file.
+    SetUploadFileRange(settings_.request, path, 8, 13);
+    settings_.expected_upload_data = "HELLO FRIEND!";
+
+    settings_.response = CefResponse::Create();
+    settings_.response->SetMimeType("text/html");
+    settings_.response->SetStatus(200);
+    settings_.response->SetStatusText("OK");
+
+    settings_.response_data = "POST TEST SUCCESS";
+  }
+
+  void SetupPostStreamTest() {
+    settings_.request = CefRequest::Create();
+    settings_.request->SetURL(MakeSchemeURL("PostStreamTest.html"));
+    settings_.request->SetMethod("POST");
+
+    // Large enough to require multiple reads from the stream. The scheme
+    // handler can only verify the length because the network stack does not
+    // read uploads for scheme handlers. See URLRequestTest.BrowserPOSTStream*
+    // below for tests of the contents.
+    post_stream_data_.assign(256 * 1024, 'x');
+    SetUploadStream(settings_.request, post_stream_data_);
 
     settings_.response = CefResponse::Create();
     settings_.response->SetMimeType("text/html");
@@ -804,6 +1023,13 @@ class RequestTestRunner : public base::RefCountedThreadSafe<RequestTestRunner> {
           EXPECT_TRUE(client->download_data_.empty());
         }
 
+        if (settings_.download_to_stream) {
+          EXPECT_EQ(runner_->settings_.response_data,
+                    client->stream_data_);
+        } else {
+          EXPECT_TRUE(client->stream_data_.empty());
+        }
+
         runner_->DestroyTest();
       }
 
@@ -820,7 +1046,8 @@ class RequestTestRunner : public base::RefCountedThreadSafe<RequestTestRunner> {
     EXPECT_TRUE(request.get());
 
     CefRefPtr<RequestClient> client =
-        new RequestClient(new Test(this, settings_));
+        new RequestClient(new Test(this, settings_),
+                          settings_.download_to_stream);
 
     CefURLRequest::Create(request, client.get(), request_context_);
   }
@@ -892,6 +1119,8 @@ class RequestTestRunner : public base::RefCountedThreadSafe<RequestTestRunner> {
   CefRefPtr<RequestSchemeHandlerFactory> scheme_factory_;
 
   base::ScopedTempDir post_file_tmpdir_;
+  // Must outlive the stream reader created by SetupPostStreamTest.
+  std::string post_stream_data_;
 
  public:
   RequestRunSettings settings_;
@@ -1196,8 +1425,16 @@ void RegisterURLRequestCustomSchemes(
            REQTEST_GET_ALLOWCOOKIES, context_mode, true); \
   REQ_TEST(BrowserGETRedirect##suffix, \
            REQTEST_GET_REDIRECT, context_mode, true); \
+  REQ_TEST(BrowserGETPooled##suffix, REQTEST_GET_POOLED, context_mode, \
+           true); \
+  REQ_TEST(BrowserGETStreamWriter##suffix, REQTEST_GET_STREAM_WRITER, \
+           context_mode, true); \
   REQ_TEST(BrowserPOST##suffix, REQTEST_POST, context_mode, true); \
   REQ_TEST(BrowserPOSTFile##suffix, REQTEST_POST_FILE, context_mode, true); \
+  REQ_TEST(BrowserPOSTFileRange##suffix, REQTEST_POST_FILE_RANGE, \
+           context_mode, true); \
+  REQ_TEST(BrowserPOSTStream##suffix, REQTEST_POST_STREAM, context_mode, \
+           true); \
   REQ_TEST(BrowserPOSTWithProgress##suffix, \
            REQTEST_POST_WITHPROGRESS, context_mode, true); \
   REQ_TEST(BrowserHEAD##suffix, REQTEST_HEAD, context_mode, true); \
@@ -1300,3 +1537,222 @@ TEST(URLRequestTest, BrowserInvalidURL) {
   // Verify that there's only one reference to the client.
   EXPECT_TRUE(client->HasOneRef());
 }
+
+
+namespace {
+
+// Records the upload request received by TestServer. The response is only
+// sent if the complete body was received.
+class UploadTestServerHandler : public TestServer::Handler {
+ public:
+  UploadTestServerHandler() : request_count_(0) {}
+
+  // Called on the server thread.
+  bool OnRequest(const TestServer::Request& request,
+                 TestServer::Response* response) override {
+    request_count_++;
+    request_ = request;
+    if (!request.body_complete)
+      return false;
+    response->body = "OK";
+    return true;
+  }
+
+  // Only valid after TestServer::Stop() returns.
+  int request_count_;
+  TestServer::Request request_;
+};
+
+// Sends a stream upload to TestServer so that the upload is read by the
+// network stack.
+class StreamUploadTestClient : public CefURLRequestClient {
+ public:
+  StreamUploadTestClient(CefRefPtr<CefPostData> post_data,
+                         const std::string& url)
+      : post_data_(post_data),
+        url_(url),
+        event_(false, false),
+        status_(UR_UNKNOWN),
+        error_code_(ERR_NONE),
+        upload_progress_ct_(0),
+        upload_current_(0),
+        upload_total_(0) {
+  }
+
+  void RunTest() {
+    CefPostTask(TID_UI,
+        base::Bind(&StreamUploadTestClient::RunOnUIThread, this));
+
+    // Wait for the test to complete.
+    event_.Wait();
+  }
+
+  void OnRequestComplete(CefRefPtr<CefURLRequest> request) override {
+    status_ = request->GetRequestStatus();
+    error_code_ = request->GetRequestError();
+
+    // Let the call stack unwind before signaling completion.
+    CefPostTask(TID_UI,
+        base::Bind(&StreamUploadTestClient::CompleteOnUIThread, this));
+  }
+
+  void OnUploadProgress(CefRefPtr<CefURLRequest> request,
+                        int64 current,
+                        int64 total) override {
+    EXPECT_GE(current, upload_current_);
+    upload_progress_ct_++;
+    upload_current_ = current;
+    upload_total_ = total;
+  }
+
+  void OnDownloadProgress(CefRefPtr<CefURLRequest> request,
+                          int64 current,
+                          int64 total) override {
+  }
+
+  void OnDownloadData(CefRefPtr<CefURLRequest> request,
+                      const void* data,
+                      size_t data_length) override {
+    download_data_.append(static_cast<const char*>(data), data_length);
+  }
+
+  bool GetAuthCredentials(
+      bool isProxy,
+      const CefString& host,
+      int port,
+      const CefString& realm,
+      const CefString& scheme,
+      CefRefPtr<CefAuthCallback> callback) override {
+    EXPECT_TRUE(false);  // Not reached.
+    return false;
+  }
+
+  CefURLRequest::Status status_;
+  CefURLRequest::ErrorCode error_code_;
+  int upload_progress_ct_;
+  int64 upload_current_;
+  int64 upload_total_;
+  std::string download_data_;
+
+ private:
+  void RunOnUIThread() {
+    EXPECT_UI_THREAD();
+    CefRefPtr<CefRequest> request = CefRequest::Create();
+    request->SetMethod("POST");
+    request->SetURL(url_);
+    request->SetPostData(post_data_);
+    request->SetFlags(UR_FLAG_REPORT_UPLOAD_PROGRESS | UR_FLAG_SKIP_CACHE);
+
+    CefURLRequest::Create(request, this, NULL);
+  }
+
+  void CompleteOnUIThread() {
+    EXPECT_UI_THREAD();
+    // Signal that the test is complete.
+    event_.Signal();
+  }
+
+  CefRefPtr<CefPostData> post_data_;
+  std::string url_;
+  base::WaitableEvent event_;
+
+  IMPLEMENT_REFCOUNTING(StreamUploadTestClient);
+};
+
+// net::ERR_UPLOAD_FILE_CHANGED, which is not part of cef_errorcode_t.
+const int kErrUploadFileChanged = -14;
+
+}  // namespace
+
+// Verify that stream uploads are read by the network stack from both
+// non-blocking streams on the IO thread and blocking streams on the FILE
+// thread, with upload progress notifications.
+TEST(URLRequestTest, BrowserPOSTStreamNetwork) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  // Large enough to require multiple reads from each stream.
+  const std::string data(256 * 1024, 'x');
+  std::string file_data(256 * 1024, 'y');
+  file_data[0] = 'S';
+  const base::FilePath& path =
+      temp_dir.path().Append(FILE_PATH_LITERAL("upload.txt"));
+  ASSERT_EQ(static_cast<int>(file_data.size()),
+            base::WriteFile(path, file_data.data(),
+                            static_cast<int>(file_data.size())));
+
+  CefRefPtr<CefPostData> post_data = CefPostData::Create();
+  CefRefPtr<CefPostDataElement> element = CefPostDataElement::Create();
+  element->SetToStream(
+      CefStreamReader::CreateForData(const_cast<char*>(data.data()),
+                                     data.size()),
+      data.size());
+  post_data->AddElement(element);
+
+  // File streams report MayBlock(). Skip the first byte to test the starting
+  // offset.
+  CefRefPtr<CefStreamReader> file_stream =
+      CefStreamReader::CreateForFile(path.value());
+  ASSERT_TRUE(file_stream.get());
+  EXPECT_TRUE(file_stream->MayBlock());
+  EXPECT_EQ(0, file_stream->Seek(1, SEEK_SET));
+  element = CefPostDataElement::Create();
+  element->SetToStream(file_stream, file_data.size() - 1);
+  post_data->AddElement(element);
+
+  const std::string& expected_body = data + file_data.substr(1);
+
+  UploadTestServerHandler server_handler;
+  TestServer server(&server_handler);
+  ASSERT_TRUE(server.Start());
+
+  CefRefPtr<StreamUploadTestClient> client =
+      new StreamUploadTestClient(post_data, server.GetURL("upload"));
+  client->RunTest();
+  server.Stop();
+
+  EXPECT_EQ(UR_SUCCESS, client->status_);
+  EXPECT_EQ(ERR_NONE, client->error_code_);
+  EXPECT_STREQ("OK", client->download_data_.c_str());
+
+  EXPECT_EQ(1, server_handler.request_count_);
+  EXPECT_STREQ("POST", server_handler.request_.method.c_str());
+  EXPECT_STREQ("/upload", server_handler.request_.path.c_str());
+  EXPECT_TRUE(server_handler.request_.body_complete);
+  EXPECT_EQ(expected_body.size(), server_handler.request_.body.size());
+  EXPECT_TRUE(expected_body == server_handler.request_.body);
+
+  EXPECT_GT(client->upload_progress_ct_, 0);
+  EXPECT_EQ(static_cast<int64>(expected_body.size()), client->upload_total_);
+  EXPECT_EQ(client->upload_total_, client->upload_current_);
+}
+
+// Verify that the request fails if a stream ends before the specified length.
+TEST(URLRequestTest, BrowserPOSTStreamShortRead) {
+  const std::string data(64 * 1024, 'x');
+
+  CefRefPtr<CefPostData> post_data = CefPostData::Create();
+  CefRefPtr<CefPostDataElement> element = CefPostDataElement::Create();
+  element->SetToStream(
+      CefStreamReader::CreateForData(const_cast<char*>(data.data()),
+                                     data.size()),
+      data.size() * 2);
+  post_data->AddElement(element);
+
+  UploadTestServerHandler server_handler;
+  TestServer server(&server_handler);
+  ASSERT_TRUE(server.Start());
+
+  CefRefPtr<StreamUploadTestClient> client =
+      new StreamUploadTestClient(post_data, server.GetURL("upload"));
+  client->RunTest();
+  server.Stop();
+
+  EXPECT_EQ(UR_FAILED, client->status_);
+  EXPECT_EQ(kErrUploadFileChanged, static_cast<int>(client->error_code_));
+  EXPECT_TRUE(client->download_data_.empty());
+
+  // The server never received more than the available data.
+  EXPECT_FALSE(server_handler.request_.body_complete);
+  EXPECT_LE(server_handler.request_.body.size(), data.size());
+}
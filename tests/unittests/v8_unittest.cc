@@ -52,6 +52,9 @@ enum V8TestMode {
   V8TEST_EMPTY_STRING_CREATE,
   V8TEST_ARRAY_CREATE,
   V8TEST_ARRAY_VALUE,
+  V8TEST_ARRAY_BUFFER,
+  V8TEST_ARRAY_BUFFER_RELEASE,
+  V8TEST_ARRAY_BUFFER_VIEW,
   V8TEST_OBJECT_CREATE,
   V8TEST_OBJECT_USERDATA,
   V8TEST_OBJECT_ACCESSOR,
@@ -72,9 +75,15 @@ enum V8TestMode {
   V8TEST_FUNCTION_HANDLER_NO_OBJECT,
   V8TEST_FUNCTION_HANDLER_WITH_CONTEXT,
   V8TEST_FUNCTION_HANDLER_EMPTY_STRING,
+  V8TEST_FUNCTION_HANDLER_RETAIN_ARGUMENTS,
   V8TEST_CONTEXT_EVAL,
   V8TEST_CONTEXT_EVAL_EXCEPTION,
   V8TEST_CONTEXT_ENTERED,
+  V8TEST_SCRIPT_RUN,
+  V8TEST_SCRIPT_COMPILE_EXCEPTION,
+  V8TEST_SCRIPT_CACHED_DATA,
+  V8TEST_SCRIPT_CACHED_DATA_REJECTED,
+  V8TEST_SCRIPT_RUN_OTHER_CONTEXT,
   V8TEST_CONTEXT_INVALID,
   V8TEST_BINDING,
   V8TEST_STACK_TRACE,
@@ -101,6 +110,12 @@ class V8BrowserTest : public ClientAppBrowser::Delegate {
       char buff[33];
       sprintf(buff, "%d", g_current_test_mode);
       command_line->AppendSwitchWithValue(kV8TestCmdArg, buff);
+
+      if (g_current_test_mode == V8TEST_ARRAY_BUFFER_RELEASE) {
+        // Expose the gc() function to JS so that the test can force garbage
+        // collection.
+        command_line->AppendSwitchWithValue("js-flags", "--expose-gc");
+      }
     }
   }
 
@@ -114,7 +129,8 @@ class V8RendererTest : public ClientAppRenderer::Delegate,
                        public CefLoadHandler {
  public:
   V8RendererTest()
-      : test_mode_(V8TEST_NONE) {
+      : test_mode_(V8TEST_NONE),
+        array_buffer_released_(false) {
   }
 
   // Run a test when the process message is received from the browser.
@@ -150,6 +166,15 @@ class V8RendererTest : public ClientAppRenderer::Delegate,
       case V8TEST_ARRAY_VALUE:
         RunArrayValueTest();
         break;
+      case V8TEST_ARRAY_BUFFER:
+        RunArrayBufferTest();
+        break;
+      case V8TEST_ARRAY_BUFFER_RELEASE:
+        RunArrayBufferReleaseTest();
+        break;
+      case V8TEST_ARRAY_BUFFER_VIEW:
+        RunArrayBufferViewTest();
+        break;
       case V8TEST_OBJECT_CREATE:
         RunObjectCreateTest();
         break;
@@ -210,6 +235,9 @@ class V8RendererTest : public ClientAppRenderer::Delegate,
       case V8TEST_FUNCTION_HANDLER_EMPTY_STRING:
         RunFunctionHandlerEmptyStringTest();
         break;
+      case V8TEST_FUNCTION_HANDLER_RETAIN_ARGUMENTS:
+        RunFunctionHandlerRetainArgumentsTest();
+        break;
       case V8TEST_CONTEXT_EVAL:
         RunContextEvalTest();
         break;
@@ -219,6 +247,21 @@ class V8RendererTest : public ClientAppRenderer::Delegate,
       case V8TEST_CONTEXT_ENTERED:
         RunContextEnteredTest();
         break;
+      case V8TEST_SCRIPT_RUN:
+        RunScriptRunTest();
+        break;
+      case V8TEST_SCRIPT_COMPILE_EXCEPTION:
+        RunScriptCompileExceptionTest();
+        break;
+      case V8TEST_SCRIPT_CACHED_DATA:
+        RunScriptCachedDataTest();
+        break;
+      case V8TEST_SCRIPT_CACHED_DATA_REJECTED:
+        RunScriptCachedDataRejectedTest();
+        break;
+      case V8TEST_SCRIPT_RUN_OTHER_CONTEXT:
+        RunScriptRunOtherContextTest();
+        break;
       case V8TEST_CONTEXT_INVALID:
         // The test is triggered when the context is released.
         browser_->GetMainFrame()->LoadURL(kV8NavTestUrl);
@@ -514,6 +557,154 @@ class V8RendererTest : public ClientAppRenderer::Delegate,
     DestroyTest();
   }
 
+  class ArrayBufferReleaseCallback : public CefV8ArrayBufferReleaseCallback {
+   public:
+    explicit ArrayBufferReleaseCallback(bool* released = NULL)
+        : released_(released) {}
+
+    void ReleaseBuffer(void* buffer) override {
+      if (released_)
+        *released_ = true;
+      delete [] static_cast<char*>(buffer);
+    }
+
+   private:
+    bool* released_;
+
+    IMPLEMENT_REFCOUNTING(ArrayBufferReleaseCallback);
+  };
+
+  void RunArrayBufferTest() {
+    CefRefPtr<CefV8Context> context = GetContext();
+
+    static const size_t kBufferSize = 16;
+    char* buffer = new char[kBufferSize];
+    for (size_t i = 0; i < kBufferSize; ++i)
+      buffer[i] = static_cast<char>(i);
+
+    // Enter the V8 context.
+    EXPECT_TRUE(context->Enter());
+
+    CefRefPtr<CefV8Value> value =
+        CefV8Value::CreateArrayBuffer(buffer, kBufferSize,
+                                      new ArrayBufferReleaseCallback());
+    EXPECT_TRUE(value.get());
+    EXPECT_TRUE(value->IsArrayBuffer());
+    EXPECT_TRUE(value->IsObject());
+    EXPECT_FALSE(value->IsArrayBufferView());
+    EXPECT_FALSE(value->IsArray());
+
+    // The backing store is the native buffer.
+    EXPECT_EQ(buffer, value->GetArrayBufferData());
+    EXPECT_EQ(kBufferSize, value->GetArrayBufferByteLength());
+
+    // Exit the V8 context.
+    EXPECT_TRUE(context->Exit());
+
+    EXPECT_FALSE(value->IsUndefined());
+    EXPECT_FALSE(value->IsBool());
+    EXPECT_FALSE(value->IsDate());
+    EXPECT_FALSE(value->IsDouble());
+    EXPECT_FALSE(value->IsFunction());
+    EXPECT_FALSE(value->IsInt());
+    EXPECT_FALSE(value->IsUInt());
+    EXPECT_FALSE(value->IsNull());
+    EXPECT_FALSE(value->IsString());
+
+    DestroyTest();
+  }
+
+  void RunArrayBufferReleaseTest() {
+    CefRefPtr<CefV8Context> context = GetContext();
+
+    static const size_t kBufferSize = 16;
+    char* buffer = new char[kBufferSize];
+    for (size_t i = 0; i < kBufferSize; ++i)
+      buffer[i] = static_cast<char>(i);
+
+    // Enter the V8 context.
+    EXPECT_TRUE(context->Enter());
+
+    CefRefPtr<CefV8Value> value =
+        CefV8Value::CreateArrayBuffer(buffer, kBufferSize,
+                                      new ArrayBufferReleaseCallback(
+                                          &array_buffer_released_));
+    EXPECT_TRUE(value.get());
+    EXPECT_TRUE(context->GetGlobal()->SetValue("buffer", value,
+                                               V8_PROPERTY_ATTRIBUTE_NONE));
+
+    // Releasing the last CefV8Value reference must not release the buffer
+    // while it is still reachable from JS.
+    value = NULL;
+    EXPECT_FALSE(array_buffer_released_);
+
+    CefRefPtr<CefV8Value> retval;
+    CefRefPtr<CefV8Exception> exception;
+    EXPECT_TRUE(context->Eval("new Uint8Array(buffer)[15]", retval,
+                              exception));
+    EXPECT_FALSE(exception.get());
+    EXPECT_TRUE(retval.get());
+    EXPECT_EQ(15, retval->GetIntValue());
+    EXPECT_FALSE(array_buffer_released_);
+
+    // The buffer is released when the ArrayBuffer is garbage collected after
+    // the last JS reference is removed.
+    EXPECT_TRUE(context->GetGlobal()->DeleteValue("buffer"));
+    EXPECT_TRUE(context->Eval("gc()", retval, exception));
+    EXPECT_FALSE(exception.get());
+    EXPECT_TRUE(array_buffer_released_);
+
+    // Exit the V8 context.
+    EXPECT_TRUE(context->Exit());
+
+    DestroyTest();
+  }
+
+  void RunArrayBufferViewTest() {
+    CefRefPtr<CefV8Context> context = GetContext();
+
+    static const size_t kBufferSize = 16;
+    char* buffer = new char[kBufferSize];
+    memset(buffer, 0, kBufferSize);
+
+    // Enter the V8 context.
+    EXPECT_TRUE(context->Enter());
+
+    CefRefPtr<CefV8Value> value =
+        CefV8Value::CreateArrayBuffer(buffer, kBufferSize,
+                                      new ArrayBufferReleaseCallback());
+    EXPECT_TRUE(value.get());
+    EXPECT_TRUE(context->GetGlobal()->SetValue("buffer", value,
+                                               V8_PROPERTY_ATTRIBUTE_NONE));
+
+    // Create a view into the buffer and write to it from JS.
+    CefRefPtr<CefV8Value> retval;
+    CefRefPtr<CefV8Exception> exception;
+    EXPECT_TRUE(context->Eval(
+        "var view = new Uint8Array(buffer, 4, 8); view[0] = 42; view",
+        retval, exception));
+    EXPECT_FALSE(exception.get());
+    EXPECT_TRUE(retval.get());
+    EXPECT_TRUE(retval->IsArrayBufferView());
+    EXPECT_FALSE(retval->IsArrayBuffer());
+
+    // The view shares the native buffer without copying.
+    EXPECT_EQ(buffer + 4, retval->GetArrayBufferData());
+    EXPECT_EQ(8U, retval->GetArrayBufferByteLength());
+    EXPECT_EQ(42, buffer[4]);
+
+    // Writes from native code are visible to JS.
+    buffer[5] = 43;
+    EXPECT_TRUE(context->Eval("view[1]", retval, exception));
+    EXPECT_TRUE(retval.get());
+    EXPECT_EQ(43, retval->GetIntValue());
+
+    // Exit the V8 context.
+    EXPECT_TRUE(context->Exit());
+
+    DestroyTest();
+  }
+
   void RunObjectCreateTest() {
     CefRefPtr<CefV8Context> context = GetContext();
 
@@ -1451,6 +1642,117 @@ class V8RendererTest : public ClientAppRenderer::Delegate,
     DestroyTest();
   }
 
+  void RunFunctionHandlerRetainArgumentsTest() {
+    CefRefPtr<CefV8Context> context = GetContext();
+
+    static const char* kFuncName = "myfunc";
+    static const char* kVal1 = "first";
+    static const char* kVal2 = "second";
+
+    // Argument and object wrappers are pooled and reused for later calls
+    // unless the handler keeps a reference to them.
+    class Handler : public CefV8Handler {
+     public:
+      Handler() : execute_ct_(0) {}
+      bool Execute(const CefString& name,
+                   CefRefPtr<CefV8Value> object,
+                   const CefV8ValueList& arguments,
+                   CefRefPtr<CefV8Value>& retval,
+                   CefString& exception) override {
+        EXPECT_STREQ(kFuncName, name.ToString().c_str());
+        EXPECT_EQ((size_t)2, arguments.size());
+        EXPECT_TRUE(arguments[0]->IsString());
+        EXPECT_TRUE(arguments[1]->IsInt());
+
+        if (execute_ct_ == 0) {
+          EXPECT_TRUE(object->IsSame(object1_));
+          EXPECT_STREQ(kVal1,
+                       arguments[0]->GetStringValue().ToString().c_str());
+          EXPECT_EQ(1, arguments[1]->GetIntValue());
+
+          // Keep the object and the first argument past the call.
+          retained_object_ = object;
+          retained_arg_ = arguments[0];
+        } else {
+          EXPECT_TRUE(object->IsSame(object2_));
+          EXPECT_STREQ(kVal2,
+                       arguments[0]->GetStringValue().ToString().c_str());
+          EXPECT_EQ(2, arguments[1]->GetIntValue());
+
+          // The kept wrappers were not reused for this call.
+          EXPECT_NE(retained_object_.get(), object.get());
+          for (size_t i = 0; i < arguments.size(); ++i)
+            EXPECT_NE(retained_arg_.get(), arguments[i].get());
+
+          // The kept wrappers still hold the values from the first call.
+          EXPECT_TRUE(retained_object_->IsValid());
+          EXPECT_TRUE(retained_object_->IsSame(object1_));
+          EXPECT_TRUE(retained_arg_->IsValid());
+          EXPECT_TRUE(retained_arg_->IsString());
+          EXPECT_STREQ(kVal1,
+                       retained_arg_->GetStringValue().ToString().c_str());
+        }
+
+        retval = CefV8Value::CreateInt(++execute_ct_);
+        return true;
+      }
+
+      CefRefPtr<CefV8Value> object1_;
+      CefRefPtr<CefV8Value> object2_;
+      CefRefPtr<CefV8Value> retained_object_;
+      CefRefPtr<CefV8Value> retained_arg_;
+      int execute_ct_;
+
+      IMPLEMENT_REFCOUNTING(Handler);
+    };
+
+    // Enter the V8 context.
+    EXPECT_TRUE(context->Enter());
+
+    Handler* handler = new Handler;
+    CefRefPtr<CefV8Handler> handlerPtr(handler);
+
+    CefRefPtr<CefV8Value> func =
+        CefV8Value::CreateFunction(kFuncName, handler);
+    EXPECT_TRUE(func.get());
+
+    handler->object1_ = CefV8Value::CreateObject(NULL);
+    handler->object2_ = CefV8Value::CreateObject(NULL);
+
+    CefV8ValueList args;
+    args.push_back(CefV8Value::CreateString(kVal1));
+    args.push_back(CefV8Value::CreateInt(1));
+
+    CefRefPtr<CefV8Value> retval =
+        func->ExecuteFunction(handler->object1_, args);
+    EXPECT_FALSE(func->HasException());
+    EXPECT_TRUE(retval.get());
+    EXPECT_EQ(1, retval->GetIntValue());
+
+    // The second call acquires wrappers from the pool that the first call
+    // returned to it.
+    args.clear();
+    args.push_back(CefV8Value::CreateString(kVal2));
+    args.push_back(CefV8Value::CreateInt(2));
+
+    retval = func->ExecuteFunction(handler->object2_, args);
+    EXPECT_FALSE(func->HasException());
+    EXPECT_TRUE(retval.get());
+    EXPECT_EQ(2, retval->GetIntValue());
+
+    EXPECT_EQ(2, handler->execute_ct_);
+
+    handler->object1_ = NULL;
+    handler->object2_ = NULL;
+    handler->retained_object_ = NULL;
+    handler->retained_arg_ = NULL;
+
+    // Exit the V8 context.
+    EXPECT_TRUE(context->Exit());
+
+    DestroyTest();
+  }
+
   void RunFunctionHandlerEmptyStringTest() {
     CefRefPtr<CefV8Context> context = GetContext();
 
@@ -1539,6 +1841,215 @@ class V8RendererTest : public ClientAppRenderer::Delegate,
     DestroyTest();
   }
 
+  void RunScriptRunTest() {
+    CefRefPtr<CefV8Context> context = GetContext();
+
+    CefRefPtr<CefV8Value> retval;
+    CefRefPtr<CefV8Exception> exception;
+
+    // Enter the V8 context.
+    EXPECT_TRUE(context->Enter());
+
+    CefRefPtr<CefV8Script> script =
+        CefV8Script::Create("1+2", "http://tests/script.js", NULL, exception);
+
+    // Exit the V8 context.
+    EXPECT_TRUE(context->Exit());
+
+    EXPECT_TRUE(script.get());
+    EXPECT_FALSE(exception.get());
+    EXPECT_TRUE(script->IsValid());
+
+    // The same compiled script can be run multiple times.
+    for (int i = 0; i < 2; ++i) {
+      EXPECT_TRUE(script->Run(context, retval, exception));
+      EXPECT_TRUE(retval.get());
+      EXPECT_TRUE(retval->IsInt());
+      EXPECT_EQ(3, retval->GetIntValue());
+      EXPECT_FALSE(exception.get());
+    }
+
+    // Runtime exceptions are reported by Run().
+    EXPECT_TRUE(context->Enter());
+    script = CefV8Script::Create("1+foo", CefString(), NULL, exception);
+    EXPECT_TRUE(context->Exit());
+
+    EXPECT_TRUE(script.get());
+    EXPECT_FALSE(exception.get());
+    EXPECT_FALSE(script->Run(context, retval, exception));
+    EXPECT_FALSE(retval.get());
+    EXPECT_TRUE(exception.get());
+
+    DestroyTest();
+  }
+
+  void RunScriptCompileExceptionTest() {
+    CefRefPtr<CefV8Context> context = GetContext();
+
+    CefRefPtr<CefV8Exception> exception;
+
+    // Enter the V8 context.
+    EXPECT_TRUE(context->Enter());
+
+    CefRefPtr<CefV8Script> script =
+        CefV8Script::Create("1+", CefString(), NULL, exception);
+
+    // Exit the V8 context.
+    EXPECT_TRUE(context->Exit());
+
+    EXPECT_FALSE(script.get());
+    EXPECT_TRUE(exception.get());
+
+    DestroyTest();
+  }
+
+  void RunScriptCachedDataTest() {
+    CefRefPtr<CefV8Context> context = GetContext();
+
+    const char kCode[] =
+        "(function() { var sum = 0;"
+        "  for (var i = 0; i < 10; ++i) sum += i;"
+        "  return sum; })()";
+
+    CefRefPtr<CefV8Value> retval;
+    CefRefPtr<CefV8Exception> exception;
+
+    // Enter the V8 context.
+    EXPECT_TRUE(context->Enter());
+
+    // Compiling without cached data produces it.
+    CefRefPtr<CefV8Script> script =
+        CefV8Script::Create(kCode, "http://tests/cached.js", NULL, exception);
+    EXPECT_TRUE(script.get());
+    EXPECT_FALSE(exception.get());
+
+    CefRefPtr<CefBinaryValue> cached_data = script->GetCachedData();
+    EXPECT_TRUE(cached_data.get());
+    EXPECT_GT(cached_data->GetSize(), 0U);
+    EXPECT_FALSE(script->IsCachedDataRejected());
+
+    // Compiling with the cached data consumes it.
+    CefRefPtr<CefV8Script> cached_script =
+        CefV8Script::Create(kCode, "http://tests/cached.js", cached_data,
+                            exception);
+
+    // Exit the V8 context.
+    EXPECT_TRUE(context->Exit());
+
+    EXPECT_TRUE(cached_script.get());
+    EXPECT_FALSE(exception.get());
+    EXPECT_FALSE(cached_script->IsCachedDataRejected());
+
+    EXPECT_TRUE(cached_script->Run(context, retval, exception));
+    EXPECT_TRUE(retval.get());
+    EXPECT_TRUE(retval->IsInt());
+    EXPECT_EQ(45, retval->GetIntValue());
+    EXPECT_FALSE(exception.get());
+
+    DestroyTest();
+  }
+
+  void RunScriptCachedDataRejectedTest() {
+    CefRefPtr<CefV8Context> context = GetContext();
+
+    // V8 checks the source length so the codes have different lengths.
+    const char kCode[] = "(function() { return 1 + 2; })()";
+    const char kOtherCode[] = "(function() { return 'other code'; })()";
+
+    CefRefPtr<CefV8Value> retval;
+    CefRefPtr<CefV8Exception> exception;
+
+    // Enter the V8 context.
+    EXPECT_TRUE(context->Enter());
+
+    CefRefPtr<CefV8Script> script =
+        CefV8Script::Create(kCode, "http://tests/cached.js", NULL, exception);
+    EXPECT_TRUE(script.get());
+    EXPECT_FALSE(exception.get());
+
+    CefRefPtr<CefBinaryValue> cached_data = script->GetCachedData();
+    EXPECT_TRUE(cached_data.get());
+
+    // Cached data for different code is rejected and the code is compiled
+    // from source instead.
+    CefRefPtr<CefV8Script> other_script =
+        CefV8Script::Create(kOtherCode, "http://tests/other.js", cached_data,
+                            exception);
+
+    // Exit the V8 context.
+    EXPECT_TRUE(context->Exit());
+
+    EXPECT_TRUE(other_script.get());
+    EXPECT_FALSE(exception.get());
+    EXPECT_TRUE(other_script->IsValid());
+    EXPECT_TRUE(other_script->IsCachedDataRejected());
+    EXPECT_FALSE(other_script->GetCachedData().get());
+
+    EXPECT_TRUE(other_script->Run(context, retval, exception));
+    EXPECT_FALSE(exception.get());
+    EXPECT_TRUE(retval.get());
+    EXPECT_TRUE(retval->IsString());
+    EXPECT_STREQ("other code", retval->GetStringValue().ToString().c_str());
+
+    DestroyTest();
+  }
+
+  void RunScriptRunOtherContextTest() {
+    CefRefPtr<CefV8Context> context = GetContext();
+
+    // Returns a value that is different in each context.
+    const char kCode[] = "script_context_value";
+
+    CefRefPtr<CefV8Value> retval;
+    CefRefPtr<CefV8Exception> exception;
+
+    // Create a same-origin iframe with a context of its own.
+    EXPECT_TRUE(context->Eval(
+        "var f = document.createElement('iframe');"
+        "f.name = 'script_frame';"
+        "document.body.appendChild(f);"
+        "window.script_context_value = 1;"
+        "f.contentWindow.script_context_value = 2;",
+        retval, exception));
+    EXPECT_FALSE(exception.get());
+
+    CefRefPtr<CefFrame> frame = browser_->GetFrame("script_frame");
+    EXPECT_TRUE(frame.get());
+    CefRefPtr<CefV8Context> other_context = frame->GetV8Context();
+    EXPECT_TRUE(other_context.get());
+    EXPECT_TRUE(other_context->IsValid());
+    EXPECT_FALSE(other_context->IsSame(context));
+
+    // Compile the script in the first context.
+    EXPECT_TRUE(context->Enter());
+    CefRefPtr<CefV8Script> script =
+        CefV8Script::Create(kCode, "http://tests/script.js", NULL, exception);
+    EXPECT_TRUE(context->Exit());
+
+    EXPECT_TRUE(script.get());
+    EXPECT_FALSE(exception.get());
+
+    // Run the same script using the global object of each context.
+    EXPECT_TRUE(script->Run(context, retval, exception));
+    EXPECT_FALSE(exception.get());
+    EXPECT_TRUE(retval.get());
+    EXPECT_TRUE(retval->IsInt());
+    EXPECT_EQ(1, retval->GetIntValue());
+
+    EXPECT_TRUE(script->Run(other_context, retval, exception));
+    EXPECT_FALSE(exception.get());
+    EXPECT_TRUE(retval.get());
+    EXPECT_TRUE(retval->IsInt());
+    EXPECT_EQ(2, retval->GetIntValue());
+
+    // Running in the first context again is not affected by the second.
+    EXPECT_TRUE(script->Run(context, retval, exception));
+    EXPECT_TRUE(retval.get());
+    EXPECT_EQ(1, retval->GetIntValue());
+
+    DestroyTest();
+  }
+
   void RunContextEnteredTest() {
     CefRefPtr<CefV8Context> context = GetContext();
 
@@ -1980,6 +2491,10 @@ class V8RendererTest : public ClientAppRenderer::Delegate,
   // Used by startup tests to indicate success.
   TrackCallback startup_test_success_;
 
+  // Set when the ArrayBufferRelease test buffer is released. This object lives
+  // as long as the render process so it outlives the ArrayBuffer.
+  bool array_buffer_released_;
+
   IMPLEMENT_REFCOUNTING(V8RendererTest);
 };
 
@@ -2142,6 +2657,9 @@ V8_TEST(StringCreate, V8TEST_STRING_CREATE);
 V8_TEST(EmptyStringCreate, V8TEST_EMPTY_STRING_CREATE);
 V8_TEST(ArrayCreate, V8TEST_ARRAY_CREATE);
 V8_TEST(ArrayValue, V8TEST_ARRAY_VALUE);
+V8_TEST(ArrayBuffer, V8TEST_ARRAY_BUFFER);
+V8_TEST(ArrayBufferRelease, V8TEST_ARRAY_BUFFER_RELEASE);
+V8_TEST(ArrayBufferView, V8TEST_ARRAY_BUFFER_VIEW);
 V8_TEST(ObjectCreate, V8TEST_OBJECT_CREATE);
 V8_TEST(ObjectUserData, V8TEST_OBJECT_USERDATA);
 V8_TEST(ObjectAccessor, V8TEST_OBJECT_ACCESSOR);
@@ -2162,10 +2680,17 @@ V8_TEST(FunctionHandlerFail, V8TEST_FUNCTION_HANDLER_FAIL);
 V8_TEST(FunctionHandlerNoObject, V8TEST_FUNCTION_HANDLER_NO_OBJECT);
 V8_TEST(FunctionHandlerWithContext, V8TEST_FUNCTION_HANDLER_WITH_CONTEXT);
 V8_TEST(FunctionHandlerEmptyString, V8TEST_FUNCTION_HANDLER_EMPTY_STRING);
+V8_TEST(FunctionHandlerRetainArguments,
+        V8TEST_FUNCTION_HANDLER_RETAIN_ARGUMENTS);
 V8_TEST(ContextEval, V8TEST_CONTEXT_EVAL);
 V8_TEST(ContextEvalException, V8TEST_CONTEXT_EVAL_EXCEPTION);
 V8_TEST_EX(ContextEntered, V8TEST_CONTEXT_ENTERED, NULL);
 V8_TEST(ContextInvalid, V8TEST_CONTEXT_INVALID);
+V8_TEST(ScriptRun, V8TEST_SCRIPT_RUN);
+V8_TEST(ScriptCompileException, V8TEST_SCRIPT_COMPILE_EXCEPTION);
+V8_TEST(ScriptCachedData, V8TEST_SCRIPT_CACHED_DATA);
+V8_TEST(ScriptCachedDataRejected, V8TEST_SCRIPT_CACHED_DATA_REJECTED);
+V8_TEST(ScriptRunOtherContext, V8TEST_SCRIPT_RUN_OTHER_CONTEXT);
 V8_TEST_EX(Binding, V8TEST_BINDING, kV8BindingTestUrl);
 V8_TEST(StackTrace, V8TEST_STACK_TRACE);
 V8_TEST(OnUncaughtException, V8TEST_ON_UNCAUGHT_EXCEPTION);
@@ -5,8 +5,16 @@
 // Include this first to avoid type conflicts with CEF headers.
 #include "tests/unittests/chromium_includes.h"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "base/strings/stringprintf.h"
+#include "base/time/time.h"
+
 #include "include/cef_stream.h"
 #include "include/cef_xml_reader.h"
+#include "include/wrapper/cef_xml_document.h"
 #include "include/wrapper/cef_xml_object.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -643,3 +651,262 @@ TEST(XmlReaderTest, ObjectLoadError) {
         "Value following child element, line 4");
   }
 }
+
+namespace {
+
+// Same as |g_test_xml| but without references to DTD entities, which
+// CefXmlDocument does not support.
+char g_test_document_xml[] =
+    "\xEF\xBB\xBF<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<?my_instruction my_value?>\n"
+    "<!DOCTYPE my_document SYSTEM \"example.dtd\" [\n"
+    "    <!ENTITY EA \"EA Value\">\n"
+    "]>\n"
+    "<ns:obj xmlns:ns=\"http://www.example.org/ns\">\n"
+    "  <ns:objA>value A</ns:objA>\n"
+    "  <!-- my comment -->\n"
+    "  <ns:objB>\n"
+    "    <ns:objB_1>value B1</ns:objB_1>\n"
+    "    <ns:objB_2><![CDATA[some <br/> data]]></ns:objB_2>\n"
+    "    <ns:objB_3>&lt;escaped&gt; &#x41;&#66;\r\n</ns:objB_3>\n"
+    "    <ns:objB_4><b>this is</b> mixed content</ns:objB_4>\n"
+    "  </ns:objB>\n"
+    "  <ns:objC ns:attr1=\"value C1\" ns:attr2=\'&quot;C2&quot;\'/><ns:objD>"
+    "</ns:objD>\n"
+    "</ns:obj>\n";
+
+// Records the SAX notifications as a string.
+class RecordingSaxHandler : public CefXmlSaxHandler {
+ public:
+  bool OnStartElement(const CefXmlStringRef& name,
+                      const CefXmlAttributeRef* attributes,
+                      size_t attribute_count) override {
+    events_ += "<" + name.ToString();
+    for (size_t i = 0; i < attribute_count; ++i) {
+      events_ += " " + attributes[i].name.ToString() + "=" +
+                 attributes[i].value.ToString();
+    }
+    events_ += ">";
+    return true;
+  }
+
+  bool OnEndElement(const CefXmlStringRef& name) override {
+    events_ += "</" + name.ToString() + ">";
+    return true;
+  }
+
+  bool OnText(const CefXmlStringRef& text) override {
+    events_ += text.ToString();
+    return true;
+  }
+
+  std::string events_;
+};
+
+CefRefPtr<CefXmlDocument> LoadDocument(const std::string& xml,
+                                       CefString* error) {
+  CefRefPtr<CefStreamReader> stream(
+      CefStreamReader::CreateForData(const_cast<char*>(xml.data()),
+                                     xml.size()));
+  EXPECT_TRUE(stream.get());
+  return CefXmlDocument::Load(stream, error);
+}
+
+}  // namespace
+
+// Test XmlDocument load behavior.
+TEST(XmlReaderTest, DocumentLoad) {
+  CefString error_str;
+  CefRefPtr<CefXmlDocument> document(LoadDocument(g_test_document_xml,
+                                                  &error_str));
+  ASSERT_TRUE(document.get()) << error_str.ToString();
+  EXPECT_EQ(10U, document->GetElementCount());
+
+  const CefXmlDocument::Element* obj = document->GetRoot();
+  ASSERT_TRUE(obj);
+  EXPECT_TRUE(obj->GetName().Equals("ns:obj"));
+  EXPECT_FALSE(obj->GetParent());
+  EXPECT_TRUE(obj->GetValue().empty());
+  EXPECT_EQ(1U, obj->GetAttributeCount());
+  EXPECT_EQ("http://www.example.org/ns",
+            obj->GetAttributeValue("xmlns:ns").ToString());
+  ASSERT_EQ(4U, obj->GetChildCount());
+
+  const CefXmlDocument::Element* child = obj->GetFirstChild();
+  ASSERT_TRUE(child);
+  EXPECT_TRUE(child->GetName().Equals("ns:objA"));
+  EXPECT_EQ(obj, child->GetParent());
+  EXPECT_EQ(0U, child->GetChildCount());
+  EXPECT_EQ("value A", child->GetValue().ToString());
+
+  child = child->GetNextSibling();
+  ASSERT_TRUE(child);
+  EXPECT_TRUE(child->GetName().Equals("ns:objB"));
+  EXPECT_TRUE(child->GetValue().empty());
+  ASSERT_EQ(4U, child->GetChildCount());
+  EXPECT_EQ("value B1",
+            child->FindChild("ns:objB_1")->GetValue().ToString());
+  EXPECT_EQ("some <br/> data",
+            child->FindChild("ns:objB_2")->GetValue().ToString());
+  EXPECT_EQ("<escaped> AB\n",
+            child->FindChild("ns:objB_3")->GetValue().ToString());
+  const CefXmlDocument::Element* mixed = child->FindChild("ns:objB_4");
+  ASSERT_TRUE(mixed);
+  EXPECT_EQ(" mixed content", mixed->GetValue().ToString());
+  ASSERT_EQ(1U, mixed->GetChildCount());
+  EXPECT_EQ("this is", mixed->FindChild("b")->GetValue().ToString());
+  EXPECT_FALSE(child->FindChild("ns:objB_5"));
+
+  child = child->GetNextSibling();
+  ASSERT_TRUE(child);
+  EXPECT_TRUE(child->GetName().Equals("ns:objC"));
+  EXPECT_TRUE(child->GetValue().empty());
+  ASSERT_EQ(2U, child->GetAttributeCount());
+  EXPECT_TRUE(child->GetAttribute(0).name.Equals("ns:attr1"));
+  EXPECT_TRUE(child->GetAttribute(1).name.Equals("ns:attr2"));
+  EXPECT_TRUE(child->HasAttribute("ns:attr1"));
+  EXPECT_FALSE(child->HasAttribute("ns:attr3"));
+  EXPECT_EQ("value C1", child->GetAttributeValue("ns:attr1").ToString());
+  EXPECT_EQ("\"C2\"", child->GetAttributeValue("ns:attr2").ToString());
+
+  // Names are interned.
+  EXPECT_EQ(document->GetInternedName("ns:objC").data,
+            child->GetName().data);
+  EXPECT_TRUE(document->GetInternedName("ns:missing").empty());
+
+  child = child->GetNextSibling();
+  ASSERT_TRUE(child);
+  EXPECT_TRUE(child->GetName().Equals("ns:objD"));
+  EXPECT_TRUE(child->GetValue().empty());
+  EXPECT_EQ(0U, child->GetAttributeCount());
+  EXPECT_FALSE(child->GetNextSibling());
+
+  EXPECT_EQ(child, obj->FindChild("ns:objD"));
+  EXPECT_EQ(child, obj->FindChild("ns:objA")->FindNextSibling("ns:objD"));
+}
+
+// Test XmlDocument load error handling behavior.
+TEST(XmlReaderTest, DocumentLoadError) {
+  CefString error_str;
+
+  EXPECT_FALSE(LoadDocument("<obj>\n<foo>\n</obj>\n</foo>",
+                            &error_str).get());
+  EXPECT_EQ("Opening and ending tag mismatch: foo and obj, line 3",
+            error_str.ToString());
+
+  EXPECT_FALSE(LoadDocument("<obj>\n<a>&EA;</a></obj>", &error_str).get());
+  EXPECT_EQ("Undefined entity EA, line 2", error_str.ToString());
+
+  EXPECT_FALSE(LoadDocument("<obj>\n<foo>", &error_str).get());
+  EXPECT_EQ("Premature end of data in tag foo, line 2", error_str.ToString());
+
+  EXPECT_FALSE(LoadDocument("<obj/>\n<obj/>", &error_str).get());
+  EXPECT_EQ("Extra content at the end of the document, line 2",
+            error_str.ToString());
+
+  EXPECT_FALSE(LoadDocument("<obj attr=value/>", &error_str).get());
+  EXPECT_EQ("Attribute value must be quoted, line 1", error_str.ToString());
+
+  EXPECT_FALSE(LoadDocument("  \n", &error_str).get());
+  EXPECT_EQ("Document is empty, line 2", error_str.ToString());
+}
+
+// Test that the SAX parser produces the same results regardless of how the
+// data is split.
+TEST(XmlReaderTest, SaxParserPush) {
+  const std::string xml(g_test_document_xml);
+
+  RecordingSaxHandler expected_handler;
+  CefXmlSaxParser expected_parser(&expected_handler);
+  EXPECT_TRUE(expected_parser.Push(xml.data(), xml.size()));
+  EXPECT_TRUE(expected_parser.Finish());
+  EXPECT_EQ(18, expected_parser.GetLineNumber());
+  EXPECT_NE(std::string::npos,
+            expected_handler.events_.find(
+                "<ns:objB_2>some <br/> data</ns:objB_2>"));
+
+  for (size_t chunk_size = 1; chunk_size <= 7; ++chunk_size) {
+    RecordingSaxHandler handler;
+    CefXmlSaxParser parser(&handler);
+    for (size_t i = 0; i < xml.size(); i += chunk_size) {
+      EXPECT_TRUE(parser.Push(xml.data() + i,
+                              std::min(chunk_size, xml.size() - i)));
+    }
+    EXPECT_TRUE(parser.Finish()) << parser.GetError();
+    EXPECT_EQ(expected_parser.GetLineNumber(), parser.GetLineNumber());
+
+    // Text may be reported in multiple pieces but the result is the same.
+    EXPECT_EQ(expected_handler.events_, handler.events_);
+  }
+}
+
+namespace {
+
+const int kDocumentPerfRecordCount = 20000;
+
+std::string CreatePerfDocument() {
+  std::string xml = "<records>\n";
+  for (int i = 0; i < kDocumentPerfRecordCount; ++i) {
+    xml += base::StringPrintf(
+        "  <record id=\"%d\" type=\"%s\">\n"
+        "    <name>record name %d</name>\n"
+        "    <score>%.2f</score>\n"
+        "    <tags><tag>alpha</tag><tag>beta</tag></tags>\n"
+        "  </record>\n",
+        i, (i % 2 == 0) ? "even" : "odd", i, i * 0.25);
+  }
+  xml += "</records>\n";
+  return xml;
+}
+
+void LogThroughput(const char* name, size_t bytes,
+                   const base::TimeDelta& elapsed) {
+  const int64 us = std::max(elapsed.InMicroseconds(), static_cast<int64>(1));
+  LOG(INFO) << "XmlReaderTest.DocumentPerf: " << name << " " << bytes <<
+      " bytes in " << us << "us (" << (bytes / us) << " MB/s)";
+}
+
+}  // namespace
+
+// Compare the load time of CefXmlDocument with CefXmlObject.
+TEST(XmlReaderTest, DocumentPerf) {
+  std::string xml = CreatePerfDocument();
+
+  base::TimeTicks start = base::TimeTicks::Now();
+  CefRefPtr<CefXmlObject> object(new CefXmlObject("object"));
+  EXPECT_TRUE(object->Load(
+      CefStreamReader::CreateForData(&xml[0], xml.size()), XML_ENCODING_NONE,
+      "http://www.example.org/example.xml", NULL));
+  LogThroughput("CefXmlObject", xml.size(), base::TimeTicks::Now() - start);
+
+  CefRefPtr<CefXmlObject> records = object->FindChild("records");
+  ASSERT_TRUE(records.get());
+  EXPECT_EQ(static_cast<size_t>(kDocumentPerfRecordCount),
+            records->GetChildCount());
+
+  start = base::TimeTicks::Now();
+  CefRefPtr<CefXmlDocument> document = CefXmlDocument::Load(
+      CefStreamReader::CreateForData(&xml[0], xml.size()), NULL);
+  LogThroughput("CefXmlDocument", xml.size(), base::TimeTicks::Now() - start);
+
+  ASSERT_TRUE(document.get());
+  const CefXmlDocument::Element* root = document->GetRoot();
+  EXPECT_EQ(static_cast<size_t>(kDocumentPerfRecordCount),
+            root->GetChildCount());
+  EXPECT_EQ(static_cast<size_t>(1 + kDocumentPerfRecordCount * 6),
+            document->GetElementCount());
+
+  // Both representations contain the same data.
+  CefXmlObject::ObjectVector record_objects;
+  records->GetChildren(record_objects);
+  const CefXmlDocument::Element* record = root->GetFirstChild();
+  for (size_t i = 0; i < record_objects.size(); ++i) {
+    ASSERT_TRUE(record);
+    EXPECT_EQ(record_objects[i]->GetAttributeValue("id").ToString(),
+              record->GetAttributeValue("id").ToString());
+    EXPECT_EQ(record_objects[i]->FindChild("score")->GetValue().ToString(),
+              record->FindChild("score")->GetValue().ToString());
+    record = record->GetNextSibling();
+  }
+  EXPECT_FALSE(record);
+}
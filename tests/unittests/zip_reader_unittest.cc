@@ -5,6 +5,8 @@
 // Include this first to avoid type conflicts with CEF headers.
 #include "tests/unittests/chromium_includes.h"
 
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
 #include "include/cef_stream.h"
 #include "include/cef_zip_reader.h"
 #include "include/wrapper/cef_zip_archive.h"
@@ -125,6 +127,88 @@ namespace {
     0x00, 0x00, 0x71, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00
   };
 
+  // Archive containing a single compressed file "Deflated/File.txt".
+  unsigned char g_test_deflated_zip[] = {
+    0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x21, 0x46, 0x01, 0xea, 0x00, 0x3b, 0x20, 0x00, 0x00, 0x00, 0x6c, 0x00,
+    0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x44, 0x65, 0x66, 0x6c, 0x61, 0x74,
+    0x65, 0x64, 0x2f, 0x46, 0x69, 0x6c, 0x65, 0x2e, 0x74, 0x78, 0x74, 0x73,
+    0xce, 0xcf, 0x2b, 0x49, 0xcd, 0x2b, 0x29, 0x56, 0xc8, 0x4f, 0x53, 0x48,
+    0x49, 0x4d, 0xcb, 0x49, 0x2c, 0x49, 0x4d, 0x51, 0x48, 0xcb, 0xcc, 0x49,
+    0xd5, 0x53, 0x70, 0xa6, 0xb6, 0x14, 0x00, 0x50, 0x4b, 0x01, 0x02, 0x14,
+    0x03, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x46, 0x01,
+    0xea, 0x00, 0x3b, 0x20, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x44, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65,
+    0x64, 0x2f, 0x46, 0x69, 0x6c, 0x65, 0x2e, 0x74, 0x78, 0x74, 0x50, 0x4b,
+    0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00
+  };
+
+  // Archive containing the compressed files "Deflated/First.txt" and
+  // "Deflated/Second.txt" which both have the same contents as
+  // "Deflated/File.txt".
+  unsigned char g_test_deflated_pair_zip[] = {
+    0x50, 0x4b, 0x03, 0x04, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x21, 0x46, 0x01, 0xea, 0x00, 0x3b, 0x20, 0x00, 0x00, 0x00, 0x6c, 0x00,
+    0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x44, 0x65, 0x66, 0x6c, 0x61, 0x74,
+    0x65, 0x64, 0x2f, 0x46, 0x69, 0x72, 0x73, 0x74, 0x2e, 0x74, 0x78, 0x74,
+    0x73, 0xce, 0xcf, 0x2b, 0x49, 0xcd, 0x2b, 0x29, 0x56, 0xc8, 0x4f, 0x53,
+    0x48, 0x49, 0x4d, 0xcb, 0x49, 0x2c, 0x49, 0x4d, 0x51, 0x48, 0xcb, 0xcc,
+    0x49, 0xd5, 0x53, 0x70, 0xa6, 0xb6, 0x14, 0x00, 0x50, 0x4b, 0x03, 0x04,
+    0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x46, 0x01, 0xea,
+    0x00, 0x3b, 0x20, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x13, 0x00,
+    0x00, 0x00, 0x44, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x2f, 0x53,
+    0x65, 0x63, 0x6f, 0x6e, 0x64, 0x2e, 0x74, 0x78, 0x74, 0x73, 0xce, 0xcf,
+    0x2b, 0x49, 0xcd, 0x2b, 0x29, 0x56, 0xc8, 0x4f, 0x53, 0x48, 0x49, 0x4d,
+    0xcb, 0x49, 0x2c, 0x49, 0x4d, 0x51, 0x48, 0xcb, 0xcc, 0x49, 0xd5, 0x53,
+    0x70, 0xa6, 0xb6, 0x14, 0x00, 0x50, 0x4b, 0x01, 0x02, 0x14, 0x03, 0x14,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21, 0x46, 0x01, 0xea, 0x00,
+    0x3b, 0x20, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0x65, 0x66, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x2f,
+    0x46, 0x69, 0x72, 0x73, 0x74, 0x2e, 0x74, 0x78, 0x74, 0x50, 0x4b, 0x01,
+    0x02, 0x14, 0x03, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x21,
+    0x46, 0x01, 0xea, 0x00, 0x3b, 0x20, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00,
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x01, 0x50, 0x00, 0x00, 0x00, 0x44, 0x65, 0x66, 0x6c, 0x61,
+    0x74, 0x65, 0x64, 0x2f, 0x53, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x2e, 0x74,
+    0x78, 0x74, 0x50, 0x4b, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x81, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00
+  };
+
+  const char kDeflatedContents[] =
+      "Contents of deflated file. Contents of deflated file. "
+      "Contents of deflated file. Contents of deflated file. ";
+
+  // Write |size| bytes of |data| to a file named |name| in |dir|.
+  bool WriteArchive(const base::ScopedTempDir& dir,
+                    const char* name,
+                    const unsigned char* data,
+                    size_t size,
+                    base::FilePath* path) {
+    *path = dir.path().AppendASCII(name);
+    return base::WriteFile(*path, reinterpret_cast<const char*>(data),
+                           static_cast<int>(size)) == static_cast<int>(size);
+  }
+
+  void VerifyDeflatedFile(CefRefPtr<CefZipArchive::File> file) {
+    const size_t size = sizeof(kDeflatedContents) - 1;
+    ASSERT_TRUE(file.get());
+    ASSERT_EQ(file->GetDataSize(), size);
+    ASSERT_TRUE(file->GetData() != NULL);
+    ASSERT_TRUE(!strncmp(reinterpret_cast<const char*>(file->GetData()),
+        kDeflatedContents, size));
+
+    CefRefPtr<CefStreamReader> reader(file->GetStreamReader());
+    ASSERT_TRUE(reader.get());
+
+    char buff[sizeof(kDeflatedContents)];
+    ASSERT_EQ(reader->Read(buff, 1, sizeof(buff)), size);
+    ASSERT_TRUE(!strncmp(buff, kDeflatedContents, size));
+    ASSERT_TRUE(reader->Eof());
+  }
+
 }  // namespace
 
 // Test Zip reading.
@@ -254,3 +338,131 @@ TEST(ZipReaderTest, ReadArchive) {
   ASSERT_TRUE(!strncmp(buff, " 2A.", 4));
   ASSERT_TRUE(reader->Eof());
 }
+
+// Test CefZipArchive object with memory mapped loading.
+TEST(ZipReaderTest, ReadArchiveMapped) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  base::FilePath stored_path, deflated_path;
+  ASSERT_TRUE(WriteArchive(temp_dir, "stored.zip", g_test_zip,
+                           sizeof(g_test_zip) - 1, &stored_path));
+  ASSERT_TRUE(WriteArchive(temp_dir, "deflated.zip", g_test_deflated_zip,
+                           sizeof(g_test_deflated_zip), &deflated_path));
+
+  // Create the Zip archive object.
+  CefRefPtr<CefZipArchive> archive(new CefZipArchive());
+
+  ASSERT_EQ(archive->LoadMapped(stored_path.value(), CefString(), false),
+            (size_t)5);
+  ASSERT_EQ(archive->LoadMapped(deflated_path.value(), CefString(), false),
+            (size_t)1);
+  ASSERT_EQ(archive->GetFileCount(), (size_t)6);
+
+  ASSERT_TRUE(archive->HasFile("test_archive/file 1.txt"));
+  ASSERT_TRUE(archive->HasFile("test_archive/folder 1/file 1a.txt"));
+  ASSERT_TRUE(archive->HasFile("test_archive/FOLDER 1/file 1b.txt"));
+  ASSERT_TRUE(archive->HasFile("test_archive/folder 1/folder 1a/file 1a1.txt"));
+  ASSERT_TRUE(archive->HasFile("test_archive/folder 2/file 2a.txt"));
+  ASSERT_TRUE(archive->HasFile("deflated/file.txt"));
+
+  // Test content retrieval of a stored file.
+  CefRefPtr<CefZipArchive::File> file;
+  file = archive->GetFile("test_archive/folder 2/file 2a.txt");
+  ASSERT_TRUE(file.get());
+
+  ASSERT_EQ(file->GetDataSize(), (size_t)20);
+  ASSERT_TRUE(!strncmp(reinterpret_cast<const char*>(file->GetData()),
+      "Contents of file 2A.", 20));
+
+  // Test stream reading of a stored file.
+  CefRefPtr<CefStreamReader> reader(file->GetStreamReader());
+  ASSERT_TRUE(reader.get());
+
+  char buff[8];
+  ASSERT_EQ(reader->Read(buff, 1, 8), (size_t)8);
+  ASSERT_TRUE(!strncmp(buff, "Contents", 8));
+  ASSERT_EQ(reader->Read(buff, 1, 8), (size_t)8);
+  ASSERT_TRUE(!strncmp(buff, " of file", 8));
+  ASSERT_EQ(reader->Read(buff, 1, 8), (size_t)4);
+  ASSERT_TRUE(!strncmp(buff, " 2A.", 4));
+  ASSERT_TRUE(reader->Eof());
+
+  // Test content retrieval of a compressed file, first from the cache and
+  // then with caching disabled.
+  VerifyDeflatedFile(archive->GetFile("Deflated/File.txt"));
+  VerifyDeflatedFile(archive->GetFile("Deflated/File.txt"));
+  archive->SetCacheLimit(0);
+  VerifyDeflatedFile(archive->GetFile("Deflated/File.txt"));
+
+  // File data remains valid after the archive is cleared.
+  file = archive->GetFile("Deflated/File.txt");
+  const unsigned char* data = file->GetData();
+  archive->Clear();
+  ASSERT_EQ(archive->GetFileCount(), (size_t)0);
+  ASSERT_TRUE(!strncmp(reinterpret_cast<const char*>(data),
+      kDeflatedContents, sizeof(kDeflatedContents) - 1));
+  VerifyDeflatedFile(file);
+}
+
+// Test eviction from the decompressed data cache of a memory mapped archive.
+TEST(ZipReaderTest, ReadArchiveMappedEviction) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  base::FilePath path;
+  ASSERT_TRUE(WriteArchive(temp_dir, "pair.zip", g_test_deflated_pair_zip,
+                           sizeof(g_test_deflated_pair_zip), &path));
+
+  CefRefPtr<CefZipArchive> archive(new CefZipArchive());
+  ASSERT_EQ(archive->LoadMapped(path.value(), CefString(), false), (size_t)2);
+
+  const char kFirst[] = "Deflated/First.txt";
+  const char kSecond[] = "Deflated/Second.txt";
+
+  // Only one decompressed file fits in the cache.
+  const size_t size = sizeof(kDeflatedContents) - 1;
+  archive->SetCacheLimit(size + size / 2);
+
+  // A second request for a cached file returns the same data.
+  CefRefPtr<CefZipArchive::File> first1 = archive->GetFile(kFirst);
+  VerifyDeflatedFile(first1);
+  CefRefPtr<CefZipArchive::File> first2 = archive->GetFile(kFirst);
+  VerifyDeflatedFile(first2);
+  EXPECT_EQ(first1->GetData(), first2->GetData());
+
+  // Decompressing the second file evicts the first file. The first file is
+  // decompressed again on the next request, and the data held by existing
+  // File objects remains valid.
+  CefRefPtr<CefZipArchive::File> second1 = archive->GetFile(kSecond);
+  VerifyDeflatedFile(second1);
+  CefRefPtr<CefZipArchive::File> first3 = archive->GetFile(kFirst);
+  VerifyDeflatedFile(first3);
+  EXPECT_NE(first1->GetData(), first3->GetData());
+  VerifyDeflatedFile(first1);
+
+  // Decompressing the first file again evicted the second file.
+  CefRefPtr<CefZipArchive::File> second2 = archive->GetFile(kSecond);
+  VerifyDeflatedFile(second2);
+  EXPECT_NE(second1->GetData(), second2->GetData());
+  VerifyDeflatedFile(second1);
+
+  // Both files fit after raising the limit.
+  archive->SetCacheLimit(size * 2);
+  CefRefPtr<CefZipArchive::File> first4 = archive->GetFile(kFirst);
+  VerifyDeflatedFile(first4);
+  CefRefPtr<CefZipArchive::File> second3 = archive->GetFile(kSecond);
+  VerifyDeflatedFile(second3);
+  CefRefPtr<CefZipArchive::File> first5 = archive->GetFile(kFirst);
+  EXPECT_EQ(first4->GetData(), first5->GetData());
+  CefRefPtr<CefZipArchive::File> second4 = archive->GetFile(kSecond);
+  EXPECT_EQ(second3->GetData(), second4->GetData());
+
+  // Lowering the limit evicts the least recently used file.
+  archive->SetCacheLimit(size);
+  CefRefPtr<CefZipArchive::File> second5 = archive->GetFile(kSecond);
+  EXPECT_EQ(second4->GetData(), second5->GetData());
+  CefRefPtr<CefZipArchive::File> first6 = archive->GetFile(kFirst);
+  VerifyDeflatedFile(first6);
+  EXPECT_NE(first5->GetData(), first6->GetData());
+}
@@ -1435,8 +1435,13 @@ class obj_argument:
             raise Exception('Cannot be called for argument types')
 
         # unsupported modifiers
-        if self.type.is_const() or self.type.is_byref() or \
-            self.type.is_byaddr():
+        if self.type.is_const() or self.type.is_byref():
+            return 'invalid'
+
+        if self.type.is_byaddr():
+            # raw memory addresses are the only supported pointer return type
+            if self.type.get_type() == 'void':
+                return 'simple'
             return 'invalid'
 
         # void types don't have a return value
@@ -1478,6 +1483,8 @@ class obj_argument:
         # next look at the retval type value.
         type = self.get_retval_type()
         if type == 'simple':
+            if self.type.is_byaddr():
+                return 'NULL'
             return self.get_type().get_result_simple_default()
         elif type == 'bool':
             if for_capi:
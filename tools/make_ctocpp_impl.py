@@ -286,7 +286,9 @@ def make_ctocpp_function_impl_new(clsname, name, func):
 
     if retval_type != 'none':
         # has a return value
-        if retval_type == 'simple' or retval_type == 'bool':
+        if retval_type == 'simple':
+            result += retval.get_type().get_result_simple_type()
+        elif retval_type == 'bool':
             result += retval.get_type().get_result_simple_type_root()
         elif retval_type == 'string':
             result += 'cef_string_userfree_t'